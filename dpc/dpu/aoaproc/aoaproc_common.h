@@ -201,7 +201,8 @@
  *   - @ref DPU_AoAProcHWA_Cmd_MultiObjBeamFormingCfg,
  *   - @ref DPU_AoAProcHWA_Cmd_CompRxChannelBiasCfg,
  *   - @ref DPU_AoAProcHWA_Cmd_PrepareRangeAzimuthHeatMap,
- *   - @ref DPU_AoAProcHWA_Cmd_ExtMaxVelocityCfg
+ *   - @ref DPU_AoAProcHWA_Cmd_ExtMaxVelocityCfg,
+ *   - @ref DPU_AoAProcHWA_Cmd_AngleInterpCfg
  *
  *  Full API details can be seen at @ref DPU_AOAPROC_EXTERNAL
  *
@@ -219,13 +220,13 @@
  * @image html dsp_aoa_top_level.png "DSP-AOA high level data flow"
  *
  * This DPU has the following restrictions regarding its input parameters:\n
- * The number of Doppler chirps (numDopplerChirps) must be a multiple of 4 and the number of Doppler bins (numDopplerBins)
+ * The number of Doppler chirps (numDopplerChirps) must be a multiple of 2 and the number of Doppler bins (numDopplerBins)
  * must be a power of 2 greater or equal than numDopplerChirps. Also, due to restrictions on the FFT implementation by DSPLIB,
  * numDopplerBins must be at least 16.
  *
  *   Parameter         |  Restriction  
  *  :------------------|:--------------
- *  numDopplerChirps   |  Must be a multiple of 4.   
+ *  numDopplerChirps   |  Must be a multiple of 2.   
  *  numDopplerBins     |  Must be at least 16. Must be a power of two, greater or equal than numDopplerChirps.      
  * \n
  *
@@ -258,7 +259,11 @@
  * The above steps are repeated for all virtual antennas for the given range bin before moving to the next step.\n\n
  *
  * **Doppler Compensation**\n
- * Doppler correction is done on the symbols belonging to TX1 and TX2 antennas.\n\n
+ * Doppler correction is done on the symbols belonging to TX1 and TX2 antennas.
+ * If the extended maximum velocity feature is enabled (see @ref Extended_max_velocity), the symbols are
+ * compensated for each of the numTxAntennas Doppler hypotheses, the azimuth FFT of every hypothesis is
+ * computed and the hypothesis with the largest peak is used for the rest of the processing and for
+ * the reported velocity.\n\n
  * 
  * **BPM decoding**\n
  * If BPM is enabled, BPM is decoded. \n\n
@@ -269,6 +274,14 @@
  * **Angle of Arrival Estimation**\n
  * Azimuth FFT is computed, Elevation FFT is computed. These FFTs are input to @ref AoAProcDSP_angleEstimationAzimElev,
  * which calculates the x/y/z coordinates of the object. \n\n
+ *
+ * **2D angle FFT over an antenna map**\n
+ * For antenna arrays that are not an azimuth row plus one elevation row, the virtual antenna
+ * positions are given in @ref DPU_AoAProcDSP_AntennaGeometryCfg. The compensated symbols are then
+ * scattered into a zero padded map of numRows x numAngleBins with a table built at configuration
+ * time, the azimuth FFT is computed for each row and the elevation FFT (numElevBins) for each
+ * azimuth bin, and the largest bin of the 2D spectrum gives the azimuth and elevation of the object.
+ * With extended maximum velocity the hypothesis with the largest 2D peak is selected.\n\n
  * 
  * **Detailed block diagram for 3 TX 4 RX TDM-MIMO (no BPM)**\n
  * 
@@ -309,6 +322,26 @@
  *
  * @image html dsp_aoa_azimuth.png "DSP-AOA Azimuth heatmap computation"
  *
+ * **Incremental update**\n
+ * With @ref DPU_AoAProc_HeatMapUpdateCfg the heatmap can be refreshed for a subset of the
+ * range bins per frame: every decimation-th range bin in round robin order, or only the
+ * range bins whose zero Doppler detection matrix value changed by more than a threshold
+ * since their last refresh. Only the selected range bins are fetched from the radar cube,
+ * the EDMA ping/pong chain jumps directly from one selected range bin to the next. The
+ * other range bins keep their last values.\n\n
+ *
+ * **Capon (MVDR) heatmap**\n
+ * When @ref DPU_AoAProcDSP_CaponCfg::enabled is set, the clutter removed and BPM decoded
+ * chirp samples of all azimuth virtual antennas of a range bin are also kept in
+ * @ref DPU_AoAProcDSP_HW_Resources::caponSnapshotBuf. Once the last antenna of the range
+ * bin is fetched, the spatial covariance matrix R is accumulated over the chirps, RX channel
+ * phase compensation is applied to R and its diagonal is loaded by
+ * @ref DPU_AoAProcDSP_CaponCfg::diagLoading times the average antenna power. R is Cholesky
+ * factored (R = L L^H) and L is inverted, then for every angle bin k the Capon spectrum
+ * P(k) = 1 / ||L^-1 a_k||^2 is written to @ref DPU_AoAProcDSP_HW_Resources::caponHeatMap
+ * in floating point. The steering vectors a_k are computed once at configuration time.
+ * Up to @ref DPU_AOAPROCDSP_CAPON_MAX_NUM_ANT azimuth virtual antennas are supported.\n\n
+ *
  *  @subsection bpmCfgNotes BPM Scheme
  *    Similar to TDM-MIMO, in BPM scheme a frame consists of multiple blocks, each
  *    block consisting of 2 chirp intervals. However, unlike in TDM-MIMO where only
@@ -385,7 +418,10 @@
  *   - @ref DPU_AoAProcDSP_Cmd_MultiObjBeamFormingCfg,
  *   - @ref DPU_AoAProcDSP_Cmd_CompRxChannelBiasCfg,
  *   - @ref DPU_AoAProcDSP_Cmd_PrepareRangeAzimuthHeatMap,
- *   - @ref DPU_AoAProcDSP_Cmd_staticClutterCfg
+ *   - @ref DPU_AoAProcDSP_Cmd_staticClutterCfg,
+ *   - @ref DPU_AoAProcDSP_Cmd_AngleInterpCfg,
+ *   - @ref DPU_AoAProcDSP_Cmd_ExtMaxVelocityCfg,
+ *   - @ref DPU_AoAProcDSP_Cmd_HeatMapUpdateCfg
  *
  *  Full API details can be seen at @ref DPU_AOAPROC_EXTERNAL \n\n\n
  *
@@ -529,6 +565,22 @@
  * The brute-force method of checking limits on \f$\phi\f$ and \f$\theta\f$ directly
  * requires computing these, which involves two sin inverses, one cosine and one
  * division which are computationally more expensive than the above method.
+ *
+ * @subsection compactSubSection Compact point cloud
+ *
+ * Next to the float point cloud (@ref DPIF_PointCloudCartesian_t and @ref DPIF_PointCloudSideInfo_t,
+ * 20 bytes per point) the DSP AoA DPU can write a compact point cloud of
+ * @ref DPU_AoAProc_PointCloudCompact_t (10 bytes per point) preceded by a per-frame
+ * @ref DPU_AoAProc_PointCloudCompactHeader_t. x/y/z and velocity are signed Q-format numbers
+ * whose fractional bits are given in the header. They are chosen every frame as the largest
+ * number of fractional bits that holds the maximum range
+ * (numRangeBins * rangeStep) and the maximum velocity (numDopplerBins/2 * dopplerStep, times the
+ * number of Tx antennas with extended maximum velocity). SNR and noise are unsigned in steps of
+ * @ref DPU_AOAPROC_COMPACT_SNR_STEP (0.1 dB units) and saturate at 255 steps. The points are
+ * quantized with rounding, the error is at most half a step.
+ * The format is defined in aoaproc_compact.h and @ref DPU_AoAProc_compactPointCloudDecode
+ * (aoaproc_compact.c) converts a compact point cloud back to float. Both only depend on the
+ * C standard library and can be built for the host.
  * 
  * 
  */
@@ -602,6 +654,8 @@
 #include <stdio.h>
 #include <math.h>
 
+/* Compact point cloud format */
+#include <ti/datapath/dpc/dpu/aoaproc/aoaproc_compact.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -613,6 +667,11 @@ extern "C" {
 #define AOA_DOPPLER_IDX_TO_SIGNED(_idx, _fftSize) ((_idx) < (_fftSize)/2 ? \
         ((int16_t) (_idx)) : ((int16_t) (_idx) - (int16_t) (_fftSize)))
 
+/*! @brief Maximum number of azimuth peaks (objects) reported per detected range/Doppler point
+ *         when multi object beam forming is enabled, see @ref DPU_AoAProc_MultiObjBeamFormingCfg_t
+ */
+#define DPU_AOAPROC_MAX_NUM_PEAKS 8U
+
 /**
  * @brief
  *  Field of view - AoA Configuration
@@ -653,7 +712,13 @@ typedef struct DPU_AoAProc_MultiObjBeamFormingCfg_t
     /*! @brief    enabled flag:  1-enabled 0-disabled */
     uint8_t     enabled;
 
-    /*! @brief    second peak detection threshold */
+    /*! @brief    maximum number of peaks reported per detected point, including the
+                  strongest one, up to @ref DPU_AOAPROC_MAX_NUM_PEAKS. The value 0 selects
+                  2 peaks (strongest and second peak). */
+    uint8_t     maxNumPeaks;
+
+    /*! @brief    peak detection threshold relative to the strongest peak, applied to
+                  every additional peak */
     float        multiPeakThrsScal;
 
 } DPU_AoAProc_MultiObjBeamFormingCfg;
@@ -711,6 +776,70 @@ typedef struct DPU_AoAProc_StaticClutterRemovalCfg_t
     bool  isEnabled;
 }DPU_AoAProc_StaticClutterRemovalCfg;
 
+/**
+ * @brief
+ *  Angle interpolation configuration
+ *
+ * @details
+ *  The structure contains the configuration of the sub-bin azimuth peak interpolation.
+ *  When enabled, the azimuth peak position is refined by a parabolic fit through the
+ *  magnitudes of the peak bin and its two neighbours of the azimuth FFT output, so x/y
+ *  are no longer quantized to the angle FFT bins. The elevation estimate is not changed:
+ *  it is taken from the phase difference between the azimuth and elevation FFT outputs
+ *  at the peak bin. The sub-bin offset adds the same phase to both outputs, so the
+ *  difference is referenced to the bin centre azimuth and z is not biased by an off-bin
+ *  target. Only the azimuth antennas of the standard 3Tx layout are interpolated, the
+ *  antenna geometry table path of the DSP DPU is not.
+ *
+ *  \ingroup DPU_AOAPROC_EXTERNAL_DATA_STRUCTURE
+ */
+typedef struct DPU_AoAProc_AngleInterpCfg_t
+{
+    /*! @brief    enabled flag:  1-enabled 0-disabled */
+    uint8_t     enabled;
+}DPU_AoAProc_AngleInterpCfg;
+
+/*! @brief Range-azimuth heat map update mode: all range bins are refreshed every frame */
+#define DPU_AOAPROC_HEATMAP_UPDATE_FULL           0U
+
+/*! @brief Range-azimuth heat map update mode: 1/decimation of the range bins is refreshed
+ *         every frame in round robin order */
+#define DPU_AOAPROC_HEATMAP_UPDATE_ROUND_ROBIN    1U
+
+/*! @brief Range-azimuth heat map update mode: only range bins whose zero Doppler energy
+ *         in the detection matrix changed by more than the threshold are refreshed */
+#define DPU_AOAPROC_HEATMAP_UPDATE_ON_CHANGE      2U
+
+/**
+ * @brief
+ *  Range-azimuth heat map update configuration
+ *
+ * @details
+ *  The structure selects how many range bins of the range-azimuth heat map are
+ *  recomputed per frame. Range bins that are not refreshed keep the values of the frame
+ *  in which they were last computed, all virtual antennas of a range bin are always
+ *  refreshed together. The first frame after configuration, after the heat map is
+ *  enabled or after this configuration changes refreshes all range bins.
+ *  Valid only for DSP version of the AoA DPU.
+ *
+ *  \ingroup DPU_AOAPROC_EXTERNAL_DATA_STRUCTURE
+ */
+typedef struct DPU_AoAProc_HeatMapUpdateCfg_t
+{
+    /*! @brief    Update mode, one of DPU_AOAPROC_HEATMAP_UPDATE_xxx */
+    uint8_t     mode;
+
+    /*! @brief    Round robin decimation, the range bins r with
+                  r % decimation == frame % decimation are refreshed. Must be at least 1. */
+    uint8_t     decimation;
+
+    /*! @brief    Change threshold for @ref DPU_AOAPROC_HEATMAP_UPDATE_ON_CHANGE, in the
+                  detection matrix format (log2 magnitude in Q8, same as the CFAR threshold).
+                  A range bin is refreshed when its zero Doppler detection matrix value
+                  differs from the value at its last refresh by more than the threshold. */
+    uint16_t    changeThreshold;
+}DPU_AoAProc_HeatMapUpdateCfg;
+
 /**
  * @brief
  *  AoAProc dynamic configuration
@@ -741,6 +870,12 @@ typedef struct DPU_AoAProc_DynamicConfig_t
 
     /*! @brief Static clutter removal configuration. Valid only for DSP version of the AoA DPU.*/
     DPU_AoAProc_StaticClutterRemovalCfg  staticClutterCfg;
+
+    /*! @brief Azimuth peak interpolation configuration */
+    DPU_AoAProc_AngleInterpCfg  angleInterpCfg;
+
+    /*! @brief Range-azimuth heat map update configuration. Valid only for DSP version of the AoA DPU.*/
+    DPU_AoAProc_HeatMapUpdateCfg  heatMapUpdateCfg;
 } DPU_AoAProc_DynamicConfig;
 
 
@@ -0,0 +1,168 @@
+/**
+ *   @file  aoaproc_compact.h
+ *
+ *   @brief
+ *      Compact point cloud format of the AoA DPU and its decoder. The header only
+ *      depends on the C standard library so that it can be used on the host.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef AOAPROC_COMPACT_H
+#define AOAPROC_COMPACT_H
+
+/* Standard Include Files. */
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! @brief Step of the SNR and noise of @ref DPU_AoAProc_PointCloudCompact_t, in 0.1 dB */
+#define DPU_AOAPROC_COMPACT_SNR_STEP 5U
+
+/*! @brief Maximum number of fractional bits of the compact point cloud Q-format values */
+#define DPU_AOAPROC_COMPACT_MAX_FRAC_BITS 15U
+
+/**
+ * @brief
+ *  Compact point cloud header
+ *
+ * @details
+ *  Written once per frame ahead of the compact points, see @ref compactSubSection.
+ *
+ *  \ingroup DPU_AOAPROC_EXTERNAL_DATA_STRUCTURE
+ */
+typedef struct DPU_AoAProc_PointCloudCompactHeader_t
+{
+    /*! @brief    Number of points that follow */
+    uint16_t    numPoints;
+
+    /*! @brief    Fractional bits of x, y and z, a value v is v / 2^xyzFracBits meters */
+    uint8_t     xyzFracBits;
+
+    /*! @brief    Fractional bits of velocity, a value v is v / 2^velocityFracBits m/s */
+    uint8_t     velocityFracBits;
+}DPU_AoAProc_PointCloudCompactHeader;
+
+/**
+ * @brief
+ *  Compact point
+ *
+ * @details
+ *  One detected point of the compact point cloud, 10 bytes, see @ref compactSubSection.
+ *
+ *  \ingroup DPU_AOAPROC_EXTERNAL_DATA_STRUCTURE
+ */
+typedef struct DPU_AoAProc_PointCloudCompact_t
+{
+    /*! @brief    x, Q-format with @ref DPU_AoAProc_PointCloudCompactHeader_t::xyzFracBits */
+    int16_t     x;
+
+    /*! @brief    y, Q-format with @ref DPU_AoAProc_PointCloudCompactHeader_t::xyzFracBits */
+    int16_t     y;
+
+    /*! @brief    z, Q-format with @ref DPU_AoAProc_PointCloudCompactHeader_t::xyzFracBits */
+    int16_t     z;
+
+    /*! @brief    Velocity, Q-format with @ref DPU_AoAProc_PointCloudCompactHeader_t::velocityFracBits */
+    int16_t     velocity;
+
+    /*! @brief    SNR in steps of @ref DPU_AOAPROC_COMPACT_SNR_STEP */
+    uint8_t     snr;
+
+    /*! @brief    Noise in steps of @ref DPU_AOAPROC_COMPACT_SNR_STEP */
+    uint8_t     noise;
+}DPU_AoAProc_PointCloudCompact;
+
+/**
+ * @brief
+ *  Decoded compact point
+ *
+ * @details
+ *  Output of @ref DPU_AoAProc_compactPointCloudDecode, in the units of
+ *  DPIF_PointCloudCartesian (x/y/z in meters, velocity in m/s) and
+ *  DPIF_PointCloudSideInfo (snr and noise in 0.1 dB).
+ *
+ *  \ingroup DPU_AOAPROC_EXTERNAL_DATA_STRUCTURE
+ */
+typedef struct DPU_AoAProc_PointCloudDecoded_t
+{
+    /*! @brief    x in meters */
+    float       x;
+
+    /*! @brief    y in meters */
+    float       y;
+
+    /*! @brief    z in meters */
+    float       z;
+
+    /*! @brief    Velocity in m/s */
+    float       velocity;
+
+    /*! @brief    SNR in 0.1 dB */
+    int16_t     snr;
+
+    /*! @brief    Noise in 0.1 dB */
+    int16_t     noise;
+}DPU_AoAProc_PointCloudDecoded;
+
+/**
+ *  @b Description
+ *  @n
+ *      Converts a compact point cloud back to float x/y/z/velocity and 0.1 dB SNR/noise.
+ *  The function only uses the C standard library and can be built for the host.
+ *
+ *  @param[in]  header                  Compact point cloud header of the frame
+ *  @param[in]  points                  Compact points, header->numPoints elements
+ *  @param[out] decoded                 Decoded points
+ *  @param[in]  decodedMaxSize          Number of elements of decoded, points beyond it are
+ *                                      not decoded
+ *
+ *  \ingroup    DPU_AOAPROC_EXTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Number of decoded points
+ */
+uint32_t DPU_AoAProc_compactPointCloudDecode
+(
+    const DPU_AoAProc_PointCloudCompactHeader   *header,
+    const DPU_AoAProc_PointCloudCompact         *points,
+    DPU_AoAProc_PointCloudDecoded               *decoded,
+    uint32_t                                    decodedMaxSize
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -53,6 +53,7 @@
 
 /* Datapath files */
 #include <ti/datapath/dpif/dpif_radarcube.h>
+#include <ti/datapath/dpif/dpif_detmatrix.h>
 #include <ti/datapath/dpif/dpif_pointcloud.h>
 #include <ti/datapath/dpedma/dpedma.h>
 #include <ti/datapath/dpif/dp_error.h>
@@ -114,7 +115,7 @@ extern "C" {
 #define DPU_AOAPROCDSP_EINVALID_NUM_VIRT_ANT_AND_AZIMUTH_STATIC_HEAT_MAP (DP_ERRNO_AOA_PROC_BASE-27)
 
 /**
- * @brief   Error Code: Number of Doppler chirps is not a multiple of 4
+ * @brief   Error Code: Number of Doppler chirps is not a multiple of 2
  */
 #define DPU_AOAPROCDSP_ENUMDOPCHIRPS           (DP_ERRNO_AOA_PROC_BASE-28)
 
@@ -133,6 +134,39 @@ extern "C" {
  */
 #define DPU_AOAPROCDSP_EEXCEEDMAXEDMA           (DP_ERRNO_AOA_PROC_BASE-31)
 
+/**
+ * @brief   Error Code: Number of angle bins is not a power of 2 in the supported range or
+ *          is less than the number of azimuth/elevation virtual antennas
+ */
+#define DPU_AOAPROCDSP_ENUMANGLEBINS           (DP_ERRNO_AOA_PROC_BASE-32)
+
+/**
+ * @brief   Error Code: Multi object beam forming maximum number of peaks exceeds @ref DPU_AOAPROC_MAX_NUM_PEAKS
+ */
+#define DPU_AOAPROCDSP_EMULTIPEAKCFG          (DP_ERRNO_AOA_PROC_BASE-33)
+
+/**
+ * @brief   Error Code: Invalid Capon heat map configuration, see @ref DPU_AoAProcDSP_CaponCfg
+ */
+#define DPU_AOAPROCDSP_ECAPONCFG              (DP_ERRNO_AOA_PROC_BASE-34)
+
+/**
+ * @brief   Error Code: Missing or insufficient memory for one of the Capon heat map buffers
+ */
+#define DPU_AOAPROCDSP_ENOMEM__CAPON          (DP_ERRNO_AOA_PROC_BASE-35)
+
+/**
+ * @brief   Error Code: Invalid range-azimuth heat map update configuration or missing
+ *          buffers for @ref DPU_AOAPROC_HEATMAP_UPDATE_ON_CHANGE
+ */
+#define DPU_AOAPROCDSP_EHEATMAPUPDATECFG      (DP_ERRNO_AOA_PROC_BASE-36)
+
+/**
+ * @brief   Error Code: Invalid antenna geometry configuration, see @ref DPU_AoAProcDSP_AntennaGeometryCfg,
+ *          or missing buffers for the 2D angle FFT
+ */
+#define DPU_AOAPROCDSP_EANTGEOMETRYCFG        (DP_ERRNO_AOA_PROC_BASE-37)
+
 /**
 @}
 */
@@ -157,15 +191,69 @@ extern "C" {
  */
 #define DPU_AOAPROCDSP_DET_OBJ_ELEVATION_ANGLE_BYTE_ALIGNMENT (sizeof(float))
 
+/*! @brief Alignment for memory allocation purpose. 
+ */
+#define DPU_AOAPROCDSP_POINT_CLOUD_COMPACT_BYTE_ALIGNMENT (sizeof(int16_t))
+
 /*! @brief Alignment for memory allocation purpose of all remaining buffers required by the DPU. 
  */
 #define DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT 8U
 
 /**
- * @brief   Number of angle bins for the Azimuth/Elevation FFT
+ * @brief   Default number of angle bins for the Azimuth/Elevation FFT
  */
 #define DPU_AOAPROCDSP_NUM_ANGLE_BINS          (64U)
 
+/**
+ * @brief   Minimum number of angle bins for the Azimuth/Elevation FFT
+ */
+#define DPU_AOAPROCDSP_MIN_NUM_ANGLE_BINS      (32U)
+
+/**
+ * @brief   Maximum number of angle bins for the Azimuth/Elevation FFT
+ */
+#define DPU_AOAPROCDSP_MAX_NUM_ANGLE_BINS      (256U)
+
+/**
+ * @brief   Maximum number of azimuth virtual antennas supported by the Capon heat map
+ */
+#define DPU_AOAPROCDSP_CAPON_MAX_NUM_ANT       (8U)
+
+/**
+ * @brief   Maximum number of virtual antennas of the antenna geometry table
+ */
+#define DPU_AOAPROCDSP_MAX_NUM_VIRT_ANT        (SYS_COMMON_NUM_TX_ANTENNAS * SYS_COMMON_NUM_RX_CHANNEL)
+
+/**
+ * @brief   Maximum number of antenna rows of the antenna geometry table
+ */
+#define DPU_AOAPROCDSP_MAX_NUM_ANT_ROWS        (4U)
+
+/**
+ * @brief   Minimum number of elevation bins of the 2D angle FFT (DSPLIB FFT limitation)
+ */
+#define DPU_AOAPROCDSP_MIN_NUM_ELEV_BINS       (16U)
+
+/**
+ * @brief
+ *  Point cloud output buffers
+ *
+ * @details
+ *  Argument of @ref DPU_AoAProcDSP_Cmd_PointCloudOutCfg. Both buffers are sized to
+ *  @ref DPU_AoAProcDSP_Resources_t::detObjOutMaxSize elements and aligned as the
+ *  configured ones. They can for example be in a caller provided output frame, so that
+ *  the point cloud is written in place.
+ *
+ *  \ingroup DPU_AOAPROC_EXTERNAL_DATA_STRUCTURE
+ */
+typedef struct DPU_AoAProcDSP_PointCloudOutCfg_t
+{
+    /*! @brief      Detected objects output list */
+    DPIF_PointCloudCartesian *detObjOut;
+
+    /*! @brief      Detected objects side information (snr + noise) output list */
+    DPIF_PointCloudSideInfo *detObjOutSideInfo;
+} DPU_AoAProcDSP_PointCloudOutCfg;
 
 /**
 * @brief
@@ -187,7 +275,24 @@ typedef enum DPU_AoAProcDSP_Cmd_e
  /*! @brief     Command to update Azimuth heat-map configuration */
  DPU_AoAProcDSP_Cmd_PrepareRangeAzimuthHeatMap,
  /*! @brief     Command to update static clutter removal configuration.*/
-DPU_AoAProcDSP_Cmd_staticClutterCfg
+DPU_AoAProcDSP_Cmd_staticClutterCfg,
+ /*! @brief     Command to update azimuth peak interpolation configuration */
+ DPU_AoAProcDSP_Cmd_AngleInterpCfg,
+ /*! @brief     Command to update extended maximum velocity configuration */
+ DPU_AoAProcDSP_Cmd_ExtMaxVelocityCfg,
+ /*! @brief     Command to update range-azimuth heat map update configuration */
+ DPU_AoAProcDSP_Cmd_HeatMapUpdateCfg,
+ /*! @brief     Command to switch the input radar cube between frames, the argument is a
+                @ref DPIF_RadarCube of the same size and format as the configured one */
+ DPU_AoAProcDSP_Cmd_RadarCubeCfg,
+ /*! @brief     Command to switch the point cloud output buffers between frames, the argument
+                is a @ref DPU_AoAProcDSP_PointCloudOutCfg */
+ DPU_AoAProcDSP_Cmd_PointCloudOutCfg,
+ /*! @brief     Command to skip the range-azimuth heat map refresh in the next call to
+                @ref DPU_AoAProcDSP_process only, the argument is a bool. Unlike
+                @ref DPU_AoAProcDSP_Cmd_PrepareRangeAzimuthHeatMap the heat map stays valid,
+                the range bins keep the values of the previous frame. */
+ DPU_AoAProcDSP_Cmd_SkipHeatMapRefresh
 } DPU_AoAProcDSP_Cmd;
 
 
@@ -232,6 +337,15 @@ typedef struct DPU_AoAProcDSP_Resources_t
      *              must be aligned to @ref DPU_AOAPROCDSP_POINT_CLOUD_SIDE_INFO_BYTE_ALIGNMENT */
     DPIF_PointCloudSideInfo *detObjOutSideInfo;
 
+    /*! @brief      Compact point cloud header, written every frame, see @ref compactSubSection.
+     *              Optional, the compact point cloud is not produced if NULL. */
+    DPU_AoAProc_PointCloudCompactHeader *detObjOutCompactHeader;
+
+    /*! @brief      Compact point cloud sized to @ref detObjOutMaxSize elements, must be aligned to
+     *              @ref DPU_AOAPROCDSP_POINT_CLOUD_COMPACT_BYTE_ALIGNMENT. Required if
+     *              @ref detObjOutCompactHeader is set. */
+    DPU_AoAProc_PointCloudCompact *detObjOutCompact;
+
     /*! @brief      This field dimensions several other fields in this structure as
      *              referred in their descriptions. It is determined by the dpc/application based
      *              on balancing between maximum number of objects expected to be
@@ -282,7 +396,7 @@ typedef struct DPU_AoAProcDSP_Resources_t
 
     /*! @brief      Pointer for twiddle table for Angle FFT. Data in this buffer needs to be preserved
                     (or recomputed) between frames. This array is populated by the DPU during config time.   \n
-                    Size: sizeof(cmplx32ReIm_t) * DPU_AOAPROCDSP_NUM_ANGLE_BINS\n
+                    Size: sizeof(cmplx32ReIm_t) * numAngleBins\n
                     Byte alignment Requirement = @ref DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT
      */
     cmplx32ReIm_t   *angleTwiddle32x32;
@@ -299,9 +413,15 @@ typedef struct DPU_AoAProcDSP_Resources_t
 
     /*! @brief      Size of the buffer for twiddle table */
     uint32_t        twiddleSize;
+
+    /*! @brief      @ref twiddle32x32 and @ref angleTwiddle32x32 already hold the tables of this
+                    configuration, e.g. tables shared with other instances that may be processing,
+                    so #DPU_AoAProcDSP_config does not generate them again. The other tables
+                    of the DPU are always generated. */
+    bool            isTablesInitialized;
      
     /*! @brief      Pointer for angle (azimuth and elevation) FFT input buffer.    \n
-                    Size: sizeof(cmplx32ReIm_t) * DPU_AOAPROCDSP_NUM_ANGLE_BINS\n
+                    Size: sizeof(cmplx32ReIm_t) * numAngleBins\n
                     Byte alignment Requirement = @ref DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT
      */
     cmplx32ReIm_t   *angleFftIn;
@@ -310,7 +430,7 @@ typedef struct DPU_AoAProcDSP_Resources_t
     uint32_t        angleFftInSize;
 
     /*! @brief      Pointer for elevation FFT output buffer.    \n
-                    Size: sizeof(cmplx32ReIm_t) * DPU_AOAPROCDSP_NUM_ANGLE_BINS\n
+                    Size: sizeof(cmplx32ReIm_t) * numAngleBins\n
                     Byte alignment Requirement = @ref DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT \n
                     This buffer does not need to be allocated if elevation antenna is not used or not supported.
      */
@@ -322,7 +442,7 @@ typedef struct DPU_AoAProcDSP_Resources_t
     /*! @brief      This scratch buffer is used for the following 2 operations:\n
                     1) 2D Windowing output buffer\n
                     2) Azimuth FFT output buffer\n 
-                    Size: Max[(sizeof(cmplx32ReIm_t) * numDopplerBins) , (sizeof(cmplx32ReIm_t) * DPU_AOAPROCDSP_NUM_ANGLE_BINS)] \n
+                    Size: Max[(sizeof(cmplx32ReIm_t) * numDopplerBins) , (sizeof(cmplx32ReIm_t) * numAngleBins)] \n
                     Byte alignment Requirement = @ref DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT
      */
     void            *scratch1Buff;
@@ -333,15 +453,198 @@ typedef struct DPU_AoAProcDSP_Resources_t
     /*! @brief      This scratch buffer is used for the following 2 operations:\n
                     1) 2D FFT output buffer\n
                     2) Azimuth magnitude squared buffer\n 
-                    Size: Max[(sizeof(cmplx32ReIm_t) * numDopplerBins) , (sizeof(float) * DPU_AOAPROCDSP_NUM_ANGLE_BINS)] \n
+                    Size: Max[(sizeof(cmplx32ReIm_t) * numDopplerBins) , (sizeof(float) * numAngleBins)] \n
                     Byte alignment Requirement = @ref DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT
      */
     void            *scratch2Buff;
 
     /*! @brief      Size of the scratch2 buffer */
     uint32_t        scratch2Size;
+
+    /*! @brief      Optional buffer holding the 2D FFT output of all virtual antennas of one
+                    range bin. When provided together with @ref detObjRangeBinOrder, the CFAR
+                    detections are processed grouped by range bin: the antenna samples of a
+                    range bin are fetched from the radar cube and Doppler FFT processed once and
+                    all detections of that range bin are served from this buffer. The point
+                    cloud is then ordered by increasing range bin, detections of a range bin
+                    keep their CFAR list order. Set to NULL to process detections one by one.
+
+                    Size: sizeof(cmplx32ReIm_t) * numTxAntennas * numRxAntennas * numDopplerBins 
+
+                    Byte alignment Requirement = @ref DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT
+     */
+    cmplx32ReIm_t   *rangeBinDopplerFftBuf;
+
+    /*! @brief      Size of the rangeBinDopplerFftBuf buffer in bytes */
+    uint32_t        rangeBinDopplerFftBufSize;
+
+    /*! @brief      Scratch buffer ordering the CFAR detections by range bin during range bin
+                    grouping: per range bin counts followed by the detection indices. Not
+                    used when the CFAR list is already ordered by range bin.
+
+                    Size: sizeof(uint16_t) * (numRangeBins + 1 + cfarRngDopSnrListSize)
+     */
+    uint16_t        *detObjRangeBinOrder;
+
+    /*! @brief      Size of the detObjRangeBinOrder buffer in number of uint16_t entries */
+    uint32_t        detObjRangeBinOrderSize;
+
+    /*! @brief      Capon heat map snapshot buffer. Holds the (clutter removed, BPM decoded)
+                    chirp samples of all azimuth virtual antennas of the current range bin.
+                    Only needed when @ref DPU_AoAProcDSP_CaponCfg::enabled is set.\n
+                    Size: sizeof(cmplx16ImRe_t) * numVirtualAntAzim * numDopplerChirps \n
+                    Byte alignment Requirement = @ref DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT
+     */
+    cmplx16ImRe_t   *caponSnapshotBuf;
+
+    /*! @brief      Size of the caponSnapshotBuf buffer in bytes */
+    uint32_t        caponSnapshotBufSize;
+
+    /*! @brief      Capon steering vectors, stored as interleaved (real, imaginary) float pairs
+                    in the layout x[numAngleBins][numVirtualAntAzim] where numAngleBins is
+                    @ref DPU_AoAProcDSP_CaponCfg::numAngleBins. Data in this buffer needs to be preserved
+                    (or recomputed) between frames. This array is populated by the DPU during config time.\n
+                    Size: 2 * sizeof(float) * numAngleBins * numVirtualAntAzim \n
+                    Byte alignment Requirement = @ref DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT
+     */
+    float           *caponSteeringVec;
+
+    /*! @brief      Size of the caponSteeringVec buffer in bytes */
+    uint32_t        caponSteeringVecSize;
+
+    /*! @brief      Capon (MVDR) range-azimuth heat map output, laid out as
+                    x[numRangeBins][numAngleBins] where numAngleBins is @ref DPU_AoAProcDSP_CaponCfg::numAngleBins.
+                    Angle bins are in FFT order, bin k corresponds to sin(azimuth) = 2k/numAngleBins
+                    with the upper half of the bins mapping to negative angles.
+                    Populated together with @ref azimuthStaticHeatMap.\n
+                    Size: sizeof(float) * numRangeBins * numAngleBins \n
+                    Byte alignment Requirement = @ref DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT
+     */
+    float           *caponHeatMap;
+
+    /*! @brief      Number of elements of caponHeatMap */
+    uint32_t        caponHeatMapSize;
+
+    /*! @brief      Detection matrix of the current frame, used by the
+                    @ref DPU_AOAPROC_HEATMAP_UPDATE_ON_CHANGE heat map update mode to read the
+                    zero Doppler energy of each range bin. Only needed for that mode. */
+    DPIF_DetMatrix  detMatrix;
+
+    /*! @brief      Zero Doppler detection matrix value of each range bin at its last heat map
+                    refresh. Data in this buffer needs to be preserved between frames.
+                    Only needed for the @ref DPU_AOAPROC_HEATMAP_UPDATE_ON_CHANGE heat map update mode.\n
+                    Size: sizeof(uint16_t) * numRangeBins
+     */
+    uint16_t        *heatMapRefEnergy;
+
+    /*! @brief      Number of elements of heatMapRefEnergy */
+    uint32_t        heatMapRefEnergySize;
+
+    /*! @brief      2D angle FFT buffer, holding the antenna map, the azimuth FFT output of
+                    each antenna row and the elevation FFT input and output.
+                    Only needed when @ref DPU_AoAProcDSP_AntennaGeometryCfg::enabled is set.\n
+                    Size: sizeof(cmplx32ReIm_t) * (2 * numRows * numAngleBins + 2 * numElevBins) \n
+                    Byte alignment Requirement = @ref DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT
+     */
+    cmplx32ReIm_t   *angle2DFftBuf;
+
+    /*! @brief      Size of the angle2DFftBuf buffer in bytes */
+    uint32_t        angle2DFftBufSize;
+
+    /*! @brief      Pointer for twiddle table for the elevation FFT of the 2D angle FFT. Data in this
+                    buffer needs to be preserved (or recomputed) between frames. This array is populated
+                    by the DPU during config time. Only needed when @ref DPU_AoAProcDSP_AntennaGeometryCfg::enabled
+                    is set.\n
+                    Size: sizeof(cmplx32ReIm_t) * numElevBins\n
+                    Byte alignment Requirement = @ref DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT
+     */
+    cmplx32ReIm_t   *elevTwiddle32x32;
+
+    /*! @brief      Size of the buffer for elevation twiddle table in bytes */
+    uint32_t        elevTwiddleSize;
 } DPU_AoAProcDSP_HW_Resources;
 
+/**
+ * @brief
+ *  Capon (MVDR) range-azimuth heat map configuration
+ *
+ * @details
+ *  When enabled, the DPU computes for every range bin the spatial covariance matrix of
+ *  the azimuth virtual antennas over the chirps of the frame, applies diagonal loading
+ *  and evaluates the Capon spectrum P(k) = 1 / (a_k^H R^-1 a_k) for the precomputed
+ *  steering vectors a_k. The heat map is computed whenever the range-azimuth heat map is
+ *  prepared, see @ref DPU_AoAProc_DynamicConfig::prepareRangeAzimuthHeatMap.
+ *
+ *  \ingroup DPU_AOAPROC_EXTERNAL_DATA_STRUCTURE
+ */
+typedef struct DPU_AoAProcDSP_CaponCfg_t
+{
+    /*! @brief  Enables the Capon heat map. Requires numVirtualAntAzim to be
+                between 2 and @ref DPU_AOAPROCDSP_CAPON_MAX_NUM_ANT */
+    uint8_t     enabled;
+
+    /*! @brief  Number of angle bins of the Capon heat map, between 2 and
+                @ref DPU_AOAPROCDSP_MAX_NUM_ANGLE_BINS. Need not be a power of 2. */
+    uint16_t    numAngleBins;
+
+    /*! @brief  Diagonal loading relative to the average antenna power, i.e. the
+                loading added to the covariance diagonal is diagLoading * trace(R) / numVirtualAntAzim.
+                Must be non-negative, typical values are 0.01 to 0.1. */
+    float       diagLoading;
+} DPU_AoAProcDSP_CaponCfg;
+
+/**
+ * @brief
+ *  Position of a virtual antenna in the antenna map
+ *
+ *  \ingroup DPU_AOAPROC_EXTERNAL_DATA_STRUCTURE
+ */
+typedef struct DPU_AoAProcDSP_AntennaPos_t
+{
+    /*! @brief  Row, in units of half wavelength, increasing upwards */
+    uint8_t     row;
+
+    /*! @brief  Column, in units of half wavelength, increasing in the azimuth direction */
+    uint8_t     col;
+} DPU_AoAProcDSP_AntennaPos;
+
+/**
+ * @brief
+ *  Virtual antenna geometry for the 2D (azimuth + elevation) angle FFT
+ *
+ * @details
+ *  When enabled, the angle FFT input of a detection is not split into an azimuth row
+ *  and one elevation row. Instead every virtual antenna is placed at its position of the
+ *  antenna map, a 2D FFT is computed over the map (azimuth FFT of numAngleBins along the
+ *  rows, elevation FFT of numElevBins along the columns) and the largest bin of the 2D
+ *  spectrum gives the azimuth and elevation of the detection.\n
+ *  A virtual antenna at (row, col) sees the phase pi * (col * Wx - row * Wz) for a target
+ *  in direction (Wx, Wz), which is the convention of the elevation antennas of the
+ *  azimuth/elevation layout (e.g. xWR14xx EVM: Tx0/Tx1 at row 0, columns 0..7 and Tx2 at
+ *  row 1, columns 2..5).\n
+ *  Multi object beam forming and sub-bin interpolation are not applied in this mode.
+ *
+ *  \ingroup DPU_AOAPROC_EXTERNAL_DATA_STRUCTURE
+ */
+typedef struct DPU_AoAProcDSP_AntennaGeometryCfg_t
+{
+    /*! @brief  Enables the 2D angle FFT over the antenna map. Requires numVirtualAntAzim +
+                numVirtualAntElev to be equal to numTxAntennas * numRxAntennas */
+    uint8_t     enabled;
+
+    /*! @brief  Number of rows of the antenna map, between 1 and @ref DPU_AOAPROCDSP_MAX_NUM_ANT_ROWS */
+    uint8_t     numRows;
+
+    /*! @brief  Number of elevation bins of the 2D angle FFT, power of 2 between
+                @ref DPU_AOAPROCDSP_MIN_NUM_ELEV_BINS and @ref DPU_AOAPROCDSP_MAX_NUM_ANGLE_BINS */
+    uint16_t    numElevBins;
+
+    /*! @brief  Position of each virtual antenna, indexed by txAntIdx * numRxAntennas + rxAntIdx.
+                Rows must be less than numRows and columns less than numAngleBins.
+                Two antennas must not share a position. */
+    DPU_AoAProcDSP_AntennaPos antPos[DPU_AOAPROCDSP_MAX_NUM_VIRT_ANT];
+} DPU_AoAProcDSP_AntennaGeometryCfg;
+
 /**
  * @brief
  *  AoAProcDSP DPU static configuration parameters
@@ -370,12 +673,18 @@ typedef struct DPU_AoAProcDSP_StaticConfig_t
                For example, in TDM/BPM-MIMO scheme, this is the physical chirps
                in a frame per transmit antenna
                i.e numDopplerChirps = numChirpsPerFrame / numTxAntennas.\n
-               Must be multiple of 4. */
+               Must be multiple of 2. */
     uint16_t    numDopplerChirps;
 
     /*! @brief  Number of doppler bins. Must be at least 16. Must be power of 2. */
     uint16_t    numDopplerBins;
 
+    /*! @brief  Number of angle bins of the Azimuth/Elevation FFT. Must be power of 2 between
+                @ref DPU_AOAPROCDSP_MIN_NUM_ANGLE_BINS and @ref DPU_AOAPROCDSP_MAX_NUM_ANGLE_BINS
+                and not less than the number of azimuth or elevation virtual antennas.
+                Smaller sizes save cycles per detection at the cost of angle resolution. */
+    uint16_t    numAngleBins;
+
     /*! @brief  Range conversion factor for range FFT index to meters */
     float       rangeStep;
 
@@ -386,6 +695,12 @@ typedef struct DPU_AoAProcDSP_StaticConfig_t
     BPM can only be enabled/disabled during configuration time.*/
     bool        isBpmEnabled;
 
+    /*! @brief  Capon range-azimuth heat map configuration */
+    DPU_AoAProcDSP_CaponCfg caponCfg;
+
+    /*! @brief  Virtual antenna geometry for the 2D angle FFT */
+    DPU_AoAProcDSP_AntennaGeometryCfg antGeometryCfg;
+
 } DPU_AoAProcDSP_StaticConfig;
 
 /**
@@ -428,6 +743,14 @@ typedef struct DPU_AoAProcDSP_OutParams_t
     /*! @brief      Number of AoA DPU detected points*/
     uint32_t numAoADetectedPoints;
 
+    /*! @brief      Number of range bins fetched from the radar cube for angle estimation.
+                    Equal to the number of processed detections when range bin grouping
+                    is not used. */
+    uint32_t numRangeBinFetches;
+
+    /*! @brief      Number of range bins of the range-azimuth heat map refreshed in this frame */
+    uint32_t numHeatMapRangeBins;
+
 }DPU_AoAProcDSP_OutParams;
 
 /**
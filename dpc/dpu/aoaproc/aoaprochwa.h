@@ -217,6 +217,11 @@ extern "C" {
  */
 #define DPU_AOAPROCHWA_ENOMEMALIGN_RADAR_CUBE  (DP_ERRNO_AOA_PROC_BASE-32)
 
+/**
+ * @brief   Error Code: Multi object beam forming maximum number of peaks exceeds @ref DPU_AOAPROC_MAX_NUM_PEAKS
+ */
+#define DPU_AOAPROCHWA_EMULTIPEAKCFG          (DP_ERRNO_AOA_PROC_BASE-33)
+
 /**
  * @brief   Error Code: Internal error
  */
@@ -257,7 +262,9 @@ typedef enum DPU_AoAProcHWA_Cmd_e
  /*! @brief     Command to update Azimuth heat-map configuration */
  DPU_AoAProcHWA_Cmd_PrepareRangeAzimuthHeatMap,
  /*! @brief     Command to update field of extended maximum velocity */
- DPU_AoAProcHWA_Cmd_ExtMaxVelocityCfg
+ DPU_AoAProcHWA_Cmd_ExtMaxVelocityCfg,
+ /*! @brief     Command to update azimuth peak interpolation configuration */
+ DPU_AoAProcHWA_Cmd_AngleInterpCfg
 } DPU_AoAProcHWA_Cmd;
 
 /**
@@ -15,7 +15,7 @@ vpath %.c src
 ifneq ($(filter $(MMWAVE_SDK_DEVICE_TYPE),xwr18xx xwr68xx), )
 AOAPROC_HWA_LIB_SOURCES = aoaprochwa.c
 endif
-AOAPROC_DSP_LIB_SOURCES = aoaprocdsp.c 			
+AOAPROC_DSP_LIB_SOURCES = aoaprocdsp.c aoaproc_compact.c
 
 ###################################################################################
 # Library objects
@@ -58,6 +58,7 @@
 #include <ti/common/sys_common.h>
 #include <ti/utils/cycleprofiler/cycle_profiler.h>
 #include <ti/datapath/dpc/dpu/aoaproc/aoaprocdsp.h>
+#include <ti/datapath/dpc/dpu/staticclutterproc/staticclutterproc_kernel.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -122,6 +123,15 @@ typedef struct DPU_AoAProc_DynamicLocalConfig_t
 
     /*! @brief Static clutter removal configuration. Valid only for DSP version of the AoA DPU.*/
     DPU_AoAProc_StaticClutterRemovalCfg  staticClutterCfg;
+
+    /*! @brief Azimuth peak interpolation configuration */
+    DPU_AoAProc_AngleInterpCfg  angleInterpCfg;
+
+    /*! @brief      Extended maximum velocity configuration */
+    DPU_AoAProc_ExtendedMaxVelocityCfg extMaxVelCfg;
+
+    /*! @brief      Range-azimuth heat map update configuration */
+    DPU_AoAProc_HeatMapUpdateCfg heatMapUpdateCfg;
 } DPU_AoAProc_DynamicLocalConfig;
 
 
@@ -150,6 +160,32 @@ typedef struct AOADspObj_t
     /*! @brief     Dynamic configuration */
     DPU_AoAProc_DynamicLocalConfig dynLocalCfg;
 
+    /*! @brief     Flag indicating that every range bin of the heat map has been computed
+                   since the last configuration change, cleared to force a full refresh */
+    bool        heatMapValid;
+
+    /*! @brief     Flag to skip the heat map refresh in the next frame only, see
+                   @ref DPU_AoAProcDSP_Cmd_SkipHeatMapRefresh */
+    bool        skipHeatMapRefresh;
+
+    /*! @brief     Round robin phase of the heat map update, range bins with
+                   rangeIdx % decimation == heatMapRangePhase are refreshed next */
+    uint16_t    heatMapRangePhase;
+
+    /*! @brief     Offset of each virtual antenna in the antenna map of the 2D angle FFT,
+                   row * numAngleBins + col, see @ref DPU_AoAProcDSP_AntennaGeometryCfg */
+    uint16_t    antMapIdx[DPU_AOAPROCDSP_MAX_NUM_VIRT_ANT];
+
+    /*! @brief     2^xyzFracBits of the compact point cloud of the current frame */
+    float       compactXyzScale;
+
+    /*! @brief     2^velocityFracBits of the compact point cloud of the current frame */
+    float       compactVelocityScale;
+
+    /*! @brief     Static clutter removal kernel configuration for numDopplerChirps samples,
+                   also used for the zero Doppler sum of the heat map */
+    DPU_StaticClutterProc_KernelCfg clutterKernelCfg;
+
 }AOADspObj;
 
 
@@ -115,6 +115,9 @@ typedef struct DPU_AoAProc_DynamicLocalConfig_t
     /** @brief      Extended maximum velocity configuration */
     DPU_AoAProc_ExtendedMaxVelocityCfg extMaxVelCfg;
 
+    /*! @brief      Azimuth peak interpolation configuration */
+    DPU_AoAProc_AngleInterpCfg angleInterpCfg;
+
 } DPU_AoAProc_DynamicLocalConfig;
 
 /** @addtogroup DPU_AOAPROC_INTERNAL_DEFINITION
@@ -0,0 +1,96 @@
+/**
+ *   @file  aoaproc_compact.c
+ *
+ *   @brief
+ *      Implements the decoder of the AoA DPU compact point cloud. It only depends on
+ *      the C standard library so that it can be built for the host.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+
+/* Standard Include Files. */
+#include <stdint.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+/* Data Path Include Files */
+#include <ti/datapath/dpc/dpu/aoaproc/aoaproc_compact.h>
+
+/*===========================================================
+ *                    Exported APIs
+ *===========================================================*/
+
+uint32_t DPU_AoAProc_compactPointCloudDecode
+(
+    const DPU_AoAProc_PointCloudCompactHeader   *header,
+    const DPU_AoAProc_PointCloudCompact         *points,
+    DPU_AoAProc_PointCloudDecoded               *decoded,
+    uint32_t                                    decodedMaxSize
+)
+{
+    uint32_t    idx, numPoints;
+    float       xyzStep, velocityStep;
+
+    if ((header == NULL) || (points == NULL) || (decoded == NULL))
+    {
+        return 0;
+    }
+
+    numPoints = header->numPoints;
+    if (numPoints > decodedMaxSize)
+    {
+        numPoints = decodedMaxSize;
+    }
+
+    xyzStep = 1.f / (float)(1U << header->xyzFracBits);
+    velocityStep = 1.f / (float)(1U << header->velocityFracBits);
+
+    for (idx = 0; idx < numPoints; idx++)
+    {
+        decoded[idx].x = (float)points[idx].x * xyzStep;
+        decoded[idx].y = (float)points[idx].y * xyzStep;
+        decoded[idx].z = (float)points[idx].z * xyzStep;
+        decoded[idx].velocity = (float)points[idx].velocity * velocityStep;
+        decoded[idx].snr = (int16_t)(points[idx].snr * DPU_AOAPROC_COMPACT_SNR_STEP);
+        decoded[idx].noise = (int16_t)(points[idx].noise * DPU_AOAPROC_COMPACT_SNR_STEP);
+    }
+
+    return numPoints;
+}
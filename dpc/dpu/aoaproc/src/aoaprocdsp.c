@@ -65,6 +65,20 @@
 /* C64P dsplib (fixed point part for C674X) */
 #include "DSP_fft32x32.h"
 
+/* C674x mathlib. Error against libm, checked by the DSP unit test:
+ *  - sqrtsp: relative error below 1e-6 for any input up to 1e19 (magnitude squared of the
+ *    azimuth FFT output, range squared, 1 - Wz^2), 0 for a zero input
+ *  - atan2sp, sinsp, cossp: absolute error below 1e-5 for angles in [-pi, pi]
+ */
+/* Suppress the mathlib.h warnings
+ *  #48-D: incompatible redefinition of macro "TRUE"
+ *  #48-D: incompatible redefinition of macro "FALSE"
+ */
+#pragma diag_push
+#pragma diag_suppress 48
+#include <ti/mathlib/mathlib.h>
+#pragma diag_pop
+
 
 /*===========================================================
  *                    Internal Functions
@@ -109,7 +123,7 @@ static void AoAProcDSP_rxChanPhaseBiasCompensation(cmplx16ImRe_t *rxChComp,
  *  @n
  *      This function implements static clutter removal.
  *
- *  @param[in]  cfg             DPU static configuration.
+ *  @param[in]  aoaDspObj       Pointer to internal AoAProcDSP data object
  *  @param[in]  inputBuf        input buffer. Clutter removal algorithm will work on this data.
  *
  *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
@@ -118,31 +132,11 @@ static void AoAProcDSP_rxChanPhaseBiasCompensation(cmplx16ImRe_t *rxChComp,
  */
 static void AoAProcDSP_clutterRemoval
 (
-    DPU_AoAProcDSP_StaticConfig *cfg,
+    AOADspObj                   *aoaDspObj,
     cmplx16ImRe_t               *inputBuf
 )
 {
-    uint32_t sumVal[2]={0};
-    cmplx32ImRe_t *pSumVal  = (cmplx32ImRe_t *) sumVal;
-    uint32_t meanVal = 0;
-    cmplx16ImRe_t *pMeanVal = (cmplx16ImRe_t *) &meanVal;
-    
-    /*Mmwavelib API requires size to be multiple of 4, which is fine because DPU allows 
-      only numDopplerChirps that is multiple of 4*/
-    mmwavelib_vecsum((int16_t *) inputBuf,
-                     (int32_t *) sumVal,
-                     (int32_t)   cfg->numDopplerChirps);
-
-    /*Divide by numDopplerChirps as the scratch buffer was padded to zero to make it a 
-      multiple of 4 so it does not affect the average*/    
-    pMeanVal->real = pSumVal->real / cfg->numDopplerChirps ;
-    pMeanVal->imag = pSumVal->imag / cfg->numDopplerChirps ;
-    
-    /*Lib requires size to be multiple of 4*/
-    mmwavelib_vecsubc((int16_t *) inputBuf,
-                      (int16_t *) inputBuf,
-                      (uint32_t)  meanVal,
-                      (int32_t)   cfg->numDopplerChirps);
+    DPU_StaticClutterProc_kernelRemoveMean(&aoaDspObj->clutterKernelCfg, inputBuf);
 }
 
 /**
@@ -290,52 +284,249 @@ static inline int32_t AoAProcDSP_waitInData(DPU_AoAProcDSP_HW_Resources *res, ui
 /**
  *  @b Description
  *  @n
- *      This function is called per object and it calculates its x/y/z coordinates
- *      based on Azimuth/elevation FFT outputs. It stores the coordinates
- *      to the output list of type @ref DPIF_PointCloudCartesian_t and it also
- *      calculates object's SNR and the noise level and writes into the side
- *      information list of type @ref DPIF_PointCloudSideInfo_t
+ *      Estimates the sub-bin offset of an azimuth FFT peak by fitting a parabola
+ *      through the magnitudes of the peak bin and its two (cyclic) neighbours.
+ *
+ *  @param[in] azimuthMagSqr Magnitude squared of the azimuth FFT output
+ *
+ *  @param[in] peakIdx      Index of the peak bin
+ *
+ *  @param[in] numAngleBins Number of angle FFT bins (power of 2)
+ *
+ *  @retval Offset of the interpolated peak from peakIdx, in bins within [-0.5, 0.5]
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ */
+static inline float AoAProcDSP_interpolatePeak
+(
+    float       *azimuthMagSqr,
+    uint32_t    peakIdx,
+    uint32_t    numAngleBins
+)
+{
+    float magLeft, magPeak, magRight;
+    float denom;
+    float delta = 0.f;
+
+    magLeft  = sqrtsp(azimuthMagSqr[(peakIdx - 1U) & (numAngleBins - 1U)]);
+    magPeak  = sqrtsp(azimuthMagSqr[peakIdx]);
+    magRight = sqrtsp(azimuthMagSqr[(peakIdx + 1U) & (numAngleBins - 1U)]);
+
+    denom = magLeft - 2.f * magPeak + magRight;
+    if (denom < 0.f)
+    {
+        delta = 0.5f * (magLeft - magRight) / denom;
+        if (delta > 0.5f)
+        {
+            delta = 0.5f;
+        }
+        else if (delta < -0.5f)
+        {
+            delta = -0.5f;
+        }
+    }
+
+    return delta;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Quantizes a value to a signed 16-bit Q-format number with rounding and saturation.
+ *
+ *  @param[in] val   Value to quantize
+ *
+ *  @param[in] scale 2^(number of fractional bits)
+ *
+ *  @retval Quantized value
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ */
+static inline int16_t AoAProcDSP_quantizeQ15(float val, float scale)
+{
+    float q = val * scale;
+
+    q = (q >= 0.f) ? (q + 0.5f) : (q - 0.5f);
+    if (q > 32767.f)
+    {
+        q = 32767.f;
+    }
+    else if (q < -32768.f)
+    {
+        q = -32768.f;
+    }
+    return ((int16_t)q);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Quantizes an SNR or noise value in 0.1 dB to the unsigned 8-bit steps of
+ *      @ref DPU_AOAPROC_COMPACT_SNR_STEP with rounding and saturation.
+ *
+ *  @param[in] val   Value in 0.1 dB
+ *
+ *  @retval Quantized value
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ */
+static inline uint8_t AoAProcDSP_quantizeSnr(int16_t val)
+{
+    int32_t q;
+
+    q = ((int32_t)val + (int32_t)(DPU_AOAPROC_COMPACT_SNR_STEP / 2U)) / (int32_t)DPU_AOAPROC_COMPACT_SNR_STEP;
+    if (q < 0)
+    {
+        q = 0;
+    }
+    else if (q > 255)
+    {
+        q = 255;
+    }
+    return ((uint8_t)q);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Largest number of fractional bits of a signed 16-bit Q-format number that
+ *      holds +/-maxAbsVal.
+ *
+ *  @param[in] maxAbsVal Largest magnitude to represent
+ *
+ *  @retval Number of fractional bits, 0 to @ref DPU_AOAPROC_COMPACT_MAX_FRAC_BITS
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ */
+static uint8_t AoAProcDSP_compactFracBits(float maxAbsVal)
+{
+    uint8_t fracBits = DPU_AOAPROC_COMPACT_MAX_FRAC_BITS;
+
+    while ((fracBits > 0U) && ((maxAbsVal * (float)(1U << fracBits)) >= 32767.f))
+    {
+        fracBits--;
+    }
+    return fracBits;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Selects the Q-formats of the compact point cloud for this frame from the maximum
+ *      range and the maximum velocity, see @ref compactSubSection, and writes the
+ *      frame header with zero points.
  *
  *  @param[in] aoaDspObj Pointer to AoA DPU internal object
  *
- *  @param[in] objOutIdx Index of the current object in the output lists @ref DPIF_PointCloudCartesian_t and @ref DPIF_PointCloudSideInfo_t
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ */
+static void AoAProcDSP_compactHeaderInit(AOADspObj *aoaDspObj)
+{
+    DPU_AoAProcDSP_StaticConfig *params = &aoaDspObj->params;
+    DPU_AoAProc_PointCloudCompactHeader *header = aoaDspObj->res.detObjOutCompactHeader;
+    float maxVelocity;
+
+    maxVelocity = params->dopplerStep * (float)(params->numDopplerBins / 2U);
+    if (aoaDspObj->dynLocalCfg.extMaxVelCfg.enabled && (params->numTxAntennas > 1))
+    {
+        maxVelocity *= (float)params->numTxAntennas;
+    }
+
+    header->numPoints = 0;
+    header->xyzFracBits = AoAProcDSP_compactFracBits(params->rangeStep * (float)params->numRangeBins);
+    header->velocityFracBits = AoAProcDSP_compactFracBits(maxVelocity);
+
+    aoaDspObj->compactXyzScale = (float)(1U << header->xyzFracBits);
+    aoaDspObj->compactVelocityScale = (float)(1U << header->velocityFracBits);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Writes an object to the compact point cloud, if enabled.
+ *
+ *  @param[in] aoaDspObj Pointer to AoA DPU internal object
+ *
+ *  @param[in] objOutIdx Index of the object in the output lists, its float output
+ *                       and side information must have been written
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ */
+static inline void AoAProcDSP_compactPointOutput(AOADspObj *aoaDspObj, uint32_t objOutIdx)
+{
+    DPU_AoAProcDSP_HW_Resources *res = &aoaDspObj->res;
+    DPU_AoAProc_PointCloudCompact *compact;
+
+    if (res->detObjOutCompactHeader == NULL)
+    {
+        return;
+    }
+
+    compact = &res->detObjOutCompact[objOutIdx];
+    compact->x = AoAProcDSP_quantizeQ15(res->detObjOut[objOutIdx].x, aoaDspObj->compactXyzScale);
+    compact->y = AoAProcDSP_quantizeQ15(res->detObjOut[objOutIdx].y, aoaDspObj->compactXyzScale);
+    compact->z = AoAProcDSP_quantizeQ15(res->detObjOut[objOutIdx].z, aoaDspObj->compactXyzScale);
+    compact->velocity = AoAProcDSP_quantizeQ15(res->detObjOut[objOutIdx].velocity, aoaDspObj->compactVelocityScale);
+    compact->snr = AoAProcDSP_quantizeSnr(res->detObjOutSideInfo[objOutIdx].snr);
+    compact->noise = AoAProcDSP_quantizeSnr(res->detObjOutSideInfo[objOutIdx].noise);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Calculates the x/y/z coordinates of an object from its azimuth and elevation
+ *      sine values, checks them against the configured field of view and, if inside,
+ *      stores the object to the output list of type @ref DPIF_PointCloudCartesian_t
+ *      together with its side information of type @ref DPIF_PointCloudSideInfo_t.
+ *
+ *  @param[in] aoaDspObj Pointer to AoA DPU internal object
+ *
+ *  @param[in] objOutIdx Index of the current object in the output lists
  *
  *  @param[in] objInCfarIdx Index of the current object in CFAR output list @ref DPIF_CFARDetList_t
  *
- *  @param[in] maxIdx Peak position in the FFT output of azimuth antennas
+ *  @param[in] Wx Sine of the azimuth angle
  *
- *  @param[in] peakVal Value of the FFT output of azimuth antennas
+ *  @param[in] Wz Sine of the elevation angle
  *
- *  @retval objOutIdx Index for the next object in the output list
+ *  @param[in] isElevValid true if Wz has been estimated, false to place the object at z = 0
+ *
+ *  @param[in] azimIdx Azimuth FFT bin of the object, for debugging
  *
+ *  @param[in] dopplerIdx Signed (unwrapped) Doppler index of the object
+ *
+ *  @retval objOutIdx Index for the next object in the output list
  *
  *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
  *
  */
-static uint32_t AoAProcDSP_XYZestimation
+static uint32_t AoAProcDSP_pointOutput
 (
     AOADspObj   *aoaDspObj,
     uint32_t    objOutIdx,
     uint32_t    objInCfarIdx,
-    uint32_t    maxIdx,
-    uint32_t    peakVal
+    float       Wx,
+    float       Wz,
+    bool        isElevValid,
+    uint32_t    azimIdx,
+    int32_t     dopplerIdx
 )
 {
-    int32_t         sMaxIdx;
     float           temp;
-    float           Wx, Wz;
     float           range;
     float           limitScale;
     float           x, y, z;
-    float           peakAzimRe, peakAzimIm, peakElevRe, peakElevIm;
     DPU_AoAProcDSP_HW_Resources  *res = &aoaDspObj->res;
     DPIF_CFARDetList  *objIn = res->cfarRngDopSnrList;
     DPIF_PointCloudCartesian *objOut = res->detObjOut;
     DPIF_PointCloudSideInfo *objOutSideInfo = res->detObjOutSideInfo;
-
     DPU_AoAProcDSP_StaticConfig *params = &aoaDspObj->params;
-    uint16_t numDopplerBins = params->numDopplerBins;
-    cmplx32ReIm_t *azimuthFftOut = (cmplx32ReIm_t *)res->scratch1Buff;
 
     range = objIn[objInCfarIdx].rangeIdx * params->rangeStep;
 
@@ -346,38 +537,10 @@ static uint32_t AoAProcDSP_XYZestimation
         range = 0;
     }
 
-    if(maxIdx > (DPU_AOAPROCDSP_NUM_ANGLE_BINS/2 -1))
-    {
-        sMaxIdx = maxIdx - DPU_AOAPROCDSP_NUM_ANGLE_BINS;
-    }
-    else
-    {
-        sMaxIdx = maxIdx;
-    }
-
-    Wx = 2 * (float) sMaxIdx / DPU_AOAPROCDSP_NUM_ANGLE_BINS;
-    /* Check if it is within configured field of view */
-
     x = range * Wx;
 
-    if (params->numVirtualAntElev > 0)
+    if (isElevValid)
     {
-        peakAzimIm = (float) azimuthFftOut[maxIdx].imag;
-        peakAzimRe = (float) azimuthFftOut[maxIdx].real;
-        peakElevIm = (float) res->elevationFftOut[maxIdx].imag;
-        peakElevRe = (float) res->elevationFftOut[maxIdx].real;
-        
-        Wz = atan2(peakAzimIm * peakElevRe - peakAzimRe * peakElevIm,
-                   peakAzimRe * peakElevRe + peakAzimIm * peakElevIm)/PI_ + (2 * Wx);
-
-        if (Wz > 1)
-        {
-            Wz = Wz - 2;
-        }
-        else if (Wz < -1)
-        {
-            Wz = Wz + 2;
-        }
         /* Check if it is within configured field of view */
         if((Wz < aoaDspObj->dynLocalCfg.fovAoaLocalCfg.minElevationSineVal) || (Wz > aoaDspObj->dynLocalCfg.fovAoaLocalCfg.maxElevationSineVal))
         {
@@ -387,7 +550,7 @@ static uint32_t AoAProcDSP_XYZestimation
         z = range * Wz;
         /*record wz for debugging/testing*/
         res->detObjElevationAngle[objOutIdx] = Wz;
-        limitScale = sqrt(1 - Wz*Wz);
+        limitScale = sqrtsp(1 - Wz*Wz);
     }
     else
     {
@@ -395,6 +558,7 @@ static uint32_t AoAProcDSP_XYZestimation
         limitScale = 1;
     }
 
+    /* Check if it is within configured field of view */
     if((Wx < (limitScale * aoaDspObj->dynLocalCfg.fovAoaLocalCfg.minAzimuthSineVal)) ||
        (Wx > (limitScale * aoaDspObj->dynLocalCfg.fovAoaLocalCfg.maxAzimuthSineVal)))
     {
@@ -404,7 +568,7 @@ static uint32_t AoAProcDSP_XYZestimation
     temp = range*range -x*x -z*z;
     if (temp > 0)
     {
-        y = sqrt(temp);
+        y = sqrtsp(temp);
     }
     else
     {
@@ -415,11 +579,11 @@ static uint32_t AoAProcDSP_XYZestimation
     objOut[objOutIdx].y = y;
     objOut[objOutIdx].z = z;
 
-    objOut[objOutIdx].velocity = params->dopplerStep *
-        AOA_DOPPLER_IDX_TO_SIGNED(objIn[objInCfarIdx].dopplerIdx, numDopplerBins);
+    objOut[objOutIdx].velocity = params->dopplerStep * dopplerIdx;
     objOutSideInfo[objOutIdx].noise = objIn[objInCfarIdx].noise;
     objOutSideInfo[objOutIdx].snr = objIn[objInCfarIdx].snr;
-    res->detObj2dAzimIdx[objOutIdx] = maxIdx;
+    res->detObj2dAzimIdx[objOutIdx] = azimIdx;
+    AoAProcDSP_compactPointOutput(aoaDspObj, objOutIdx);
 
     objOutIdx++;
 
@@ -427,6 +591,104 @@ exit:
     return (objOutIdx);
 }
 
+/**
+ *  @b Description
+ *  @n
+ *      This function is called per object and it calculates its x/y/z coordinates
+ *      based on Azimuth/elevation FFT outputs. It stores the coordinates
+ *      to the output list of type @ref DPIF_PointCloudCartesian_t and it also
+ *      calculates object's SNR and the noise level and writes into the side
+ *      information list of type @ref DPIF_PointCloudSideInfo_t
+ *
+ *  @param[in] aoaDspObj Pointer to AoA DPU internal object
+ *
+ *  @param[in] objOutIdx Index of the current object in the output lists @ref DPIF_PointCloudCartesian_t and @ref DPIF_PointCloudSideInfo_t
+ *
+ *  @param[in] objInCfarIdx Index of the current object in CFAR output list @ref DPIF_CFARDetList_t
+ *
+ *  @param[in] maxIdx Peak position in the FFT output of azimuth antennas
+ *
+ *  @param[in] peakVal Value of the FFT output of azimuth antennas
+ *
+ *  @param[in] dopplerIdx Signed Doppler index of the object, unwrapped by the selected
+ *              hypothesis when extended maximum velocity is enabled
+ *
+ *  @retval objOutIdx Index for the next object in the output list
+ *
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ */
+static uint32_t AoAProcDSP_XYZestimation
+(
+    AOADspObj   *aoaDspObj,
+    uint32_t    objOutIdx,
+    uint32_t    objInCfarIdx,
+    uint32_t    maxIdx,
+    uint32_t    peakVal,
+    int32_t     dopplerIdx
+)
+{
+    int32_t         sMaxIdx;
+    float           Wx, WxBin, Wz;
+    float           peakAzimRe, peakAzimIm, peakElevRe, peakElevIm;
+    DPU_AoAProcDSP_HW_Resources  *res = &aoaDspObj->res;
+    DPU_AoAProcDSP_StaticConfig *params = &aoaDspObj->params;
+    cmplx32ReIm_t *azimuthFftOut = (cmplx32ReIm_t *)res->scratch1Buff;
+
+    if(maxIdx > (params->numAngleBins/2 -1))
+    {
+        sMaxIdx = maxIdx - params->numAngleBins;
+    }
+    else
+    {
+        sMaxIdx = maxIdx;
+    }
+
+    WxBin = 2 * (float) sMaxIdx / params->numAngleBins;
+    Wx = WxBin;
+
+    /* Sub-bin azimuth interpolation */
+    if (aoaDspObj->dynLocalCfg.angleInterpCfg.enabled)
+    {
+        Wx += 2 * AoAProcDSP_interpolatePeak((float *)res->scratch2Buff, maxIdx, params->numAngleBins) /
+              params->numAngleBins;
+    }
+
+    Wz = 0;
+    if (params->numVirtualAntElev > 0)
+    {
+        peakAzimIm = (float) azimuthFftOut[maxIdx].imag;
+        peakAzimRe = (float) azimuthFftOut[maxIdx].real;
+        peakElevIm = (float) res->elevationFftOut[maxIdx].imag;
+        peakElevRe = (float) res->elevationFftOut[maxIdx].real;
+        
+        /* Both FFT outputs are taken at the peak bin, their sub-bin phase terms cancel and the
+         * phase difference is referenced to the bin centre: use WxBin, the interpolated Wx
+         * would bias Wz by 2 * (Wx - WxBin) */
+        Wz = atan2sp(peakAzimIm * peakElevRe - peakAzimRe * peakElevIm,
+                     peakAzimRe * peakElevRe + peakAzimIm * peakElevIm)/PI_ + (2 * WxBin);
+
+        if (Wz > 1)
+        {
+            Wz = Wz - 2;
+        }
+        else if (Wz < -1)
+        {
+            Wz = Wz + 2;
+        }
+    }
+
+    return AoAProcDSP_pointOutput(aoaDspObj,
+                                  objOutIdx,
+                                  objInCfarIdx,
+                                  Wx,
+                                  Wz,
+                                  (params->numVirtualAntElev > 0),
+                                  maxIdx,
+                                  dopplerIdx);
+}
+
 /**
  *   @b Description
  *   @n
@@ -441,6 +703,9 @@ exit:
  *
  *  @param[in]  numTxAnt             Number of Tx Antennas
  *
+ *  @param[in]  wrapInd              Number of Doppler FFT periods added to the signed
+ *                                   Doppler index (extended maximum velocity hypothesis)
+ *
  *  @return Doppler compensation index
  *
  *
@@ -451,7 +716,8 @@ static float AoAProcDSP_calcCompIdx
 (
     uint16_t dopplerIdx,
     uint32_t numDopplerBins,
-    uint32_t numTxAnt
+    uint32_t numTxAnt,
+    int32_t  wrapInd
 )
 {
     float      dopplerCompensationIdx;
@@ -465,6 +731,7 @@ static float AoAProcDSP_calcCompIdx
     {
         dopplerCompensationIdx =  dopplerIdx;
     }
+    dopplerCompensationIdx += (float) (wrapInd * (int32_t) numDopplerBins);
     
     /* Doppler phase correction is 1/2 or (1/3 in elevation case) of the phase between two chirps of the same antenna */
     dopplerCompensationIdx = dopplerCompensationIdx / (float) numTxAnt;
@@ -514,16 +781,17 @@ static void AoAProcDSP_dopplerComp
 /**
  *   @b Description
  *   @n
- *      Function performs Doppler compensation on antenna symbols.
- *
- *
- *  @param[in]  numDetectedObjects  Number of detected objects
+ *      Function performs Doppler compensation on antenna symbols of one detected
+ *      object. With extended maximum velocity one compensated set of symbols is
+ *      produced per Doppler hypothesis, the sets are stored one after another in
+ *      the output buffer.
  *
  *  @param[in]  srcPtr              Input pointer to antenna symbols
  *
- *  @param[in]  cfarOutList         CFAR detection list
+ *  @param[in]  cfarOutList         CFAR detection of the object
  *
- *  @param[in]  dstPtr              Output pointer to antenna symbols
+ *  @param[in]  dstPtr              Output pointer to antenna symbols,
+ *                                  numHypotheses x (numVirtualAntAzim + numVirtualAntElev)
  *
  *  @param[in]  numTxAnt            Number of Tx antennas
  *
@@ -535,6 +803,11 @@ static void AoAProcDSP_dopplerComp
  *
  *  @param[in]  numDopplerBins      Number of Doppler bins
  *
+ *  @param[in]  numHypotheses       Number of Doppler hypotheses, 1 if extended maximum
+ *                                  velocity is disabled
+ *
+ *  @param[in]  wrapStartInd        Doppler FFT period offset of the first hypothesis
+ *
  *  @return None
  *
  *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
@@ -542,7 +815,6 @@ static void AoAProcDSP_dopplerComp
  */
 static void AoAProcDSP_dopplerCompensation
 (
-    uint32_t numDetectedObjects,
     cmplx32ReIm_t *srcPtr,
     DPIF_CFARDetList *cfarOutList,
     cmplx32ReIm_t *dstPtr,
@@ -550,22 +822,29 @@ static void AoAProcDSP_dopplerCompensation
     uint32_t numRxAnt,
     uint32_t numVirtualAntAzim,
     uint32_t numVirtualAntElev,
-    uint32_t numDopplerBins
+    uint32_t numDopplerBins,
+    uint32_t numHypotheses,
+    int32_t  wrapStartInd
 )
 {
     uint32_t   index;
     uint32_t   j;
     uint16_t   dopplerIdx;
     float      dopplerCompensationIdx;
+    cmplx32ReIm_t *inPtr;
     
-    for(index = 0; index < numDetectedObjects; index ++)
+    dopplerIdx = cfarOutList->dopplerIdx;
+
+    for(index = 0; index < numHypotheses; index ++)
     {
-        dopplerIdx = cfarOutList->dopplerIdx;
+        inPtr = srcPtr;
 
         /* First set of virtual antennas (corresponding to chirp of antenna TX0), nothing needs to be done,
-           just advance the pointers to the next set of symbols for TX1. */
-        dstPtr += numRxAnt;
-        srcPtr += numRxAnt;
+           just copy and advance the pointers to the next set of symbols for TX1. */
+        for(j = 0; j < numRxAnt; j++)
+        {
+            *dstPtr++ = *inPtr++;
+        }
         
         /* Do we have more virtual antennas? If so need to do doppler compensation
            for TX1 and TX2. */
@@ -573,15 +852,16 @@ static void AoAProcDSP_dopplerCompensation
         {
             float Cos,Sin;
             
-            dopplerCompensationIdx = AoAProcDSP_calcCompIdx(dopplerIdx, numDopplerBins, numTxAnt);
+            dopplerCompensationIdx = AoAProcDSP_calcCompIdx(dopplerIdx, numDopplerBins, numTxAnt,
+                                                            wrapStartInd + (int32_t) index);
 
-            Cos = cos(2 * PI_ * dopplerCompensationIdx / numDopplerBins);
-            Sin = sin(2 * PI_ * dopplerCompensationIdx / numDopplerBins);
+            Cos = cossp(2 * PI_ * dopplerCompensationIdx / numDopplerBins);
+            Sin = sinsp(2 * PI_ * dopplerCompensationIdx / numDopplerBins);
 
             /* Compensate for virtual antennas corresponding to  Tx1*/ 
             for(j = numRxAnt; j < numVirtualAntAzim; j++)
             {
-                AoAProcDSP_dopplerComp(srcPtr++, dstPtr++, Cos, Sin);
+                AoAProcDSP_dopplerComp(inPtr++, dstPtr++, Cos, Sin);
             }
 
             if (numVirtualAntElev > 0)
@@ -593,42 +873,141 @@ static void AoAProcDSP_dopplerCompensation
                 Sin2 = 2 * Cos * Sin;
                 for(j = 0; j < numVirtualAntElev; j++)
                 {
-                    AoAProcDSP_dopplerComp(srcPtr++, dstPtr++, Cos2, Sin2);
+                    AoAProcDSP_dopplerComp(inPtr++, dstPtr++, Cos2, Sin2);
                 }
             }
         }
-        cfarOutList++;
     }
 }            
 
 /**
  *  @b  Description
  *  @n
- *      Function calculates x/y/z coordinates of the objects detected by CFAR DPU.
- *      The number of output objects may be larger than input if multiobject beam
- *      forming is enabled, and more than one objects are detected at the
- *      same range/doppler bin.
+ *      Function finds the additional azimuth peaks for multi object beam forming.
+ *      Local maxima above the threshold are first collected over the angle spectrum
+ *      in a branch free loop: the candidate index is always stored and the list
+ *      only advances on a peak, so the loop software pipelines. The strongest
+ *      candidates are then kept with a partial insertion sort, which is cheap since
+ *      the number of requested peaks is small.
  *
- *  @param[in]  aoaDspObj          Pointer to AoAProc DPU internal data Object
+ *  @param[in]  azimuthMagSqr   Azimuth FFT output power, numAngleBins samples
  *
- *  @param[in]  objInCfarIdx       Index of the current object in CFAR output list @ref DPIF_CFARDetList_t
+ *  @param[in]  numAngleBins    Azimuth FFT size
  *
- *  @param[in]  objOutIdx          Index to the next object in the output list
+ *  @param[in]  maxIdx          Index of the strongest peak, excluded from the search
  *
- *  @retval     objOutIdx          Number of detected objects in the output list
+ *  @param[in]  threshold       Minimum power of a reported peak
+ *
+ *  @param[in]  maxNumPeaks     Maximum number of additional peaks to report
+ *
+ *  @param[out] peakIdxList     Indices of the additional peaks, in decreasing power
+ *
+ *  @retval     Number of additional peaks found
  *
  *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
  *
  */
-static inline uint32_t AoAProcDSP_angleEstimationAzimElev
+static uint32_t AoAProcDSP_multiPeakSearch
 (
-    AOADspObj       *aoaDspObj,
-    uint32_t        objInCfarIdx,
-    uint32_t        objOutIdx
+    const float *restrict azimuthMagSqr,
+    uint32_t        numAngleBins,
+    uint32_t        maxIdx,
+    float           threshold,
+    uint32_t        maxNumPeaks,
+    uint16_t        *peakIdxList
 )
 {
-    DPU_AoAProcDSP_HW_Resources *res = &aoaDspObj->res;
-    uint16_t maxNumObj = res->detObjOutMaxSize;
+    uint16_t candIdxList[DPU_AOAPROCDSP_MAX_NUM_ANGLE_BINS / 2U + 2U];
+    uint32_t numCand, numPeaks;
+    uint32_t i, j, idx;
+    uint32_t isPeak;
+    float    val;
+
+    if (maxNumPeaks == 0)
+    {
+        return 0;
+    }
+
+    /* Circular neighbours of the first bin */
+    val = azimuthMagSqr[0];
+    isPeak = (val > azimuthMagSqr[numAngleBins - 1]) & (val >= azimuthMagSqr[1]) & (val > threshold);
+    candIdxList[0] = 0;
+    numCand = isPeak;
+
+    /* Local maxima of the inner bins */
+    for (i = 1; i < numAngleBins - 1; i++)
+    {
+        val = azimuthMagSqr[i];
+        isPeak = (val > azimuthMagSqr[i - 1]) & (val >= azimuthMagSqr[i + 1]) & (val > threshold);
+        candIdxList[numCand] = (uint16_t) i;
+        numCand += isPeak;
+    }
+
+    /* Circular neighbours of the last bin */
+    val = azimuthMagSqr[numAngleBins - 1];
+    isPeak = (val > azimuthMagSqr[numAngleBins - 2]) & (val >= azimuthMagSqr[0]) & (val > threshold);
+    candIdxList[numCand] = (uint16_t) (numAngleBins - 1);
+    numCand += isPeak;
+
+    /* Keep the strongest maxNumPeaks candidates, sorted by decreasing power */
+    numPeaks = 0;
+    for (i = 0; i < numCand; i++)
+    {
+        idx = candIdxList[i];
+        if (idx == maxIdx)
+        {
+            continue;
+        }
+        val = azimuthMagSqr[idx];
+        if ((numPeaks == maxNumPeaks) && (val <= azimuthMagSqr[peakIdxList[numPeaks - 1]]))
+        {
+            continue;
+        }
+        if (numPeaks < maxNumPeaks)
+        {
+            numPeaks++;
+        }
+        for (j = numPeaks - 1; (j > 0) && (val > azimuthMagSqr[peakIdxList[j - 1]]); j--)
+        {
+            peakIdxList[j] = peakIdxList[j - 1];
+        }
+        peakIdxList[j] = (uint16_t) idx;
+    }
+
+    return numPeaks;
+}
+
+/**
+ *  @b  Description
+ *  @n
+ *      Function calculates x/y/z coordinates of the objects detected by CFAR DPU.
+ *      The number of output objects may be larger than input if multiobject beam
+ *      forming is enabled, and more than one objects are detected at the
+ *      same range/doppler bin.
+ *
+ *  @param[in]  aoaDspObj          Pointer to AoAProc DPU internal data Object
+ *
+ *  @param[in]  objInCfarIdx       Index of the current object in CFAR output list @ref DPIF_CFARDetList_t
+ *
+ *  @param[in]  objOutIdx          Index to the next object in the output list
+ *
+ *  @param[in]  dopplerIdx         Signed (unwrapped) Doppler index of the object
+ *
+ *  @retval     objOutIdx          Number of detected objects in the output list
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ */
+static inline uint32_t AoAProcDSP_angleEstimationAzimElev
+(
+    AOADspObj       *aoaDspObj,
+    uint32_t        objInCfarIdx,
+    uint32_t        objOutIdx,
+    int32_t         dopplerIdx
+)
+{
+    DPU_AoAProcDSP_HW_Resources *res = &aoaDspObj->res;
+    uint16_t maxNumObj = res->detObjOutMaxSize;
     float maxVal;
     int32_t maxIdx;
     cmplx32ReIm_t *azimuthFftOut = (cmplx32ReIm_t *)res->scratch1Buff;
@@ -638,7 +1017,7 @@ static inline uint32_t AoAProcDSP_angleEstimationAzimElev
     /* Calculate power(Magnitude Squared) of complex samples of the azimuth FFT output,
     and also find azimuth index which is the position with the maximum power. */
     maxIdx = mmwavelib_powerAndMax((int32_t*)&azimuthFftOut[0],
-                                        DPU_AOAPROCDSP_NUM_ANGLE_BINS,
+                                        aoaDspObj->params.numAngleBins,
                                         &azimuthMagSqr[0],
                                         &maxVal);
 
@@ -647,7 +1026,8 @@ static inline uint32_t AoAProcDSP_angleEstimationAzimElev
                                          objOutIdx,
                                          objInCfarIdx,
                                          maxIdx,
-                                         maxVal);
+                                         maxVal,
+                                         dopplerIdx);
                                          
     if (objOutIdx >= maxNumObj)
     {
@@ -657,26 +1037,27 @@ static inline uint32_t AoAProcDSP_angleEstimationAzimElev
     /* Multi peak azimuzth search?*/
     if (aoaDspObj->dynLocalCfg.multiObjBeamFormingCfg.enabled)
     {
-        float maxVal2;
-        uint16_t azimIdx;
-        float* azimuthMag = (float *)res->scratch2Buff;
-        
-        azimIdx = mmwavelib_secondPeakSearch(azimuthMag,
-                                             DPU_AOAPROCDSP_NUM_ANGLE_BINS,
-                                             maxIdx);
-                                             
-        maxVal2 = azimuthMag[azimIdx];
-                
-        /* Is second peak greater than threshold? */
-        if ( (maxVal2 >( ((maxVal * aoaDspObj->dynLocalCfg.multiObjBeamFormingCfg.multiPeakThrsScal)))) && (objOutIdx < maxNumObj) )
+        DPU_AoAProc_MultiObjBeamFormingCfg *bfCfg = &aoaDspObj->dynLocalCfg.multiObjBeamFormingCfg;
+        uint16_t peakIdxList[DPU_AOAPROC_MAX_NUM_PEAKS];
+        uint32_t numPeaks, peakIdx;
+        uint32_t maxNumPeaks = (bfCfg->maxNumPeaks == 0) ? 2U : bfCfg->maxNumPeaks;
+
+        numPeaks = AoAProcDSP_multiPeakSearch(azimuthMagSqr,
+                                              aoaDspObj->params.numAngleBins,
+                                              maxIdx,
+                                              maxVal * bfCfg->multiPeakThrsScal,
+                                              maxNumPeaks - 1,
+                                              peakIdxList);
+
+        /* Estimate x,y,z for the additional peaks */
+        for (peakIdx = 0; (peakIdx < numPeaks) && (objOutIdx < maxNumObj); peakIdx++)
         {
-
-            /* Estimate x,y,z for second peak */
             objOutIdx = AoAProcDSP_XYZestimation(aoaDspObj,
                                                  objOutIdx,
                                                  objInCfarIdx,
-                                                 azimIdx,
-                                                 maxVal2);
+                                                 peakIdxList[peakIdx],
+                                                 azimuthMagSqr[peakIdxList[peakIdx]],
+                                                 dopplerIdx);
         }
     }
     
@@ -765,10 +1146,7 @@ static void AoAProcDSP_computeHeatMapVal
     uint16_t virtAntIdx, heatMapIdx;
         
     /* Sum all symbols to compute Doppler bin zero*/
-    /* Lib requires size (numDopplerChirps) to be multiple of 4*/
-    mmwavelib_vecsum((int16_t *) inputBuffer,
-                     (int32_t *) &sumValImRe,
-                     (int32_t)   aoaObj->params.numDopplerChirps);
+    sumValImRe = DPU_StaticClutterProc_kernelSum(&aoaObj->clutterKernelCfg, inputBuffer);
     
     /*First swap from ImRe to ReIm*/                                                                      
     sumValReIm.real = sumValImRe.real;
@@ -785,20 +1163,308 @@ static void AoAProcDSP_computeHeatMapVal
                                            
     /* Populate azimuthHeatMapArray = azimuthStaticHeatMap[numRangeBins][numVirtualAntAzim]*/
     heatMapIdx = virtAntIdx + rangeIdx * aoaObj->params.numVirtualAntAzim;    
-    aoaObj->res.azimuthStaticHeatMap[heatMapIdx].real = (int16_t) (sumValReIm.real / aoaObj->params.numDopplerChirps);
-    aoaObj->res.azimuthStaticHeatMap[heatMapIdx].imag = (int16_t) (sumValReIm.imag / aoaObj->params.numDopplerChirps);
+    aoaObj->res.azimuthStaticHeatMap[heatMapIdx].real = (int16_t) DPU_StaticClutterProc_kernelDivide(&aoaObj->clutterKernelCfg, sumValReIm.real);
+    aoaObj->res.azimuthStaticHeatMap[heatMapIdx].imag = (int16_t) DPU_StaticClutterProc_kernelDivide(&aoaObj->clutterKernelCfg, sumValReIm.imag);
+
+    /* Keep the chirp samples of this virtual antenna for the Capon covariance */
+    if (aoaObj->params.caponCfg.enabled)
+    {
+        memcpy((void *)&aoaObj->res.caponSnapshotBuf[(txAntIdx * aoaObj->params.numRxAntennas + rxAntIdx) *
+                                                     aoaObj->params.numDopplerChirps],
+               (void *)inputBuffer,
+               aoaObj->params.numDopplerChirps * sizeof(cmplx16ImRe_t));
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      The function computes the Capon (MVDR) spectrum of one range bin from the
+ *      chirp samples of the azimuth virtual antennas in the snapshot buffer.\n
+ *      The spatial covariance R = 1/Nc * sum(x x^H) is accumulated over the chirps,
+ *      Rx channel compensation is applied to R as R_ij * w_i * conj(w_j) and the
+ *      diagonal is loaded by diagLoading * trace(R) / N. The Cholesky factor L of R
+ *      is inverted once per range bin and the spectrum of every angle bin is then
+ *      P_k = 1 / ||L^-1 a_k||^2, which avoids forming R^-1 explicitly.
+ *
+ *  @param[in]    aoaObj        Pointer to internal AoAProc data object
+ *  @param[in]    rangeIdx      Range index of the snapshot
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval none
+ */
+static void AoAProcDSP_caponRangeBin
+(
+    AOADspObj     *aoaObj,
+    uint16_t      rangeIdx
+)
+{
+    float covRe[DPU_AOAPROCDSP_CAPON_MAX_NUM_ANT][DPU_AOAPROCDSP_CAPON_MAX_NUM_ANT];
+    float covIm[DPU_AOAPROCDSP_CAPON_MAX_NUM_ANT][DPU_AOAPROCDSP_CAPON_MAX_NUM_ANT];
+    float invLRe[DPU_AOAPROCDSP_CAPON_MAX_NUM_ANT][DPU_AOAPROCDSP_CAPON_MAX_NUM_ANT];
+    float invLIm[DPU_AOAPROCDSP_CAPON_MAX_NUM_ANT][DPU_AOAPROCDSP_CAPON_MAX_NUM_ANT];
+    float wRe[DPU_AOAPROCDSP_CAPON_MAX_NUM_ANT];
+    float wIm[DPU_AOAPROCDSP_CAPON_MAX_NUM_ANT];
+    float accRe, accIm, tmpRe, tmpIm, trace, diag;
+    const cmplx16ImRe_t *restrict xi;
+    const cmplx16ImRe_t *restrict xj;
+    const float *restrict steerVec;
+    float *restrict heatMap;
+    uint32_t i, j, k, chirpIdx, virtAntIdx;
+    uint32_t numAnt = aoaObj->params.numVirtualAntAzim;
+    uint32_t numChirps = aoaObj->params.numDopplerChirps;
+    uint32_t numAngleBins = aoaObj->params.caponCfg.numAngleBins;
+    uint32_t numRxAnt = aoaObj->params.numRxAntennas;
+
+    heatMap = &aoaObj->res.caponHeatMap[rangeIdx * numAngleBins];
+
+    /* Rx channel compensation coefficients of the azimuth virtual antennas (Q15) */
+    for (i = 0; i < numAnt; i++)
+    {
+        virtAntIdx = (i / numRxAnt) * SYS_COMMON_NUM_RX_CHANNEL + (i % numRxAnt);
+        wRe[i] = (float) aoaObj->dynLocalCfg.compRxChanCfg.rxChPhaseComp[virtAntIdx].real * (1.f / 32768.f);
+        wIm[i] = (float) aoaObj->dynLocalCfg.compRxChanCfg.rxChPhaseComp[virtAntIdx].imag * (1.f / 32768.f);
+    }
+
+    /* Upper triangle of the compensated covariance matrix */
+    trace = 0.f;
+    for (i = 0; i < numAnt; i++)
+    {
+        xi = &aoaObj->res.caponSnapshotBuf[i * numChirps];
+        for (j = i; j < numAnt; j++)
+        {
+            xj = &aoaObj->res.caponSnapshotBuf[j * numChirps];
+            accRe = 0.f;
+            accIm = 0.f;
+            for (chirpIdx = 0; chirpIdx < numChirps; chirpIdx++)
+            {
+                /* x_i * conj(x_j) */
+                accRe += (float) xi[chirpIdx].real * (float) xj[chirpIdx].real +
+                         (float) xi[chirpIdx].imag * (float) xj[chirpIdx].imag;
+                accIm += (float) xi[chirpIdx].imag * (float) xj[chirpIdx].real -
+                         (float) xi[chirpIdx].real * (float) xj[chirpIdx].imag;
+            }
+            accRe = accRe / (float) numChirps;
+            accIm = accIm / (float) numChirps;
+
+            /* w_i * conj(w_j) */
+            tmpRe = wRe[i] * wRe[j] + wIm[i] * wIm[j];
+            tmpIm = wIm[i] * wRe[j] - wRe[i] * wIm[j];
+
+            covRe[i][j] = accRe * tmpRe - accIm * tmpIm;
+            covIm[i][j] = accRe * tmpIm + accIm * tmpRe;
+        }
+        trace += covRe[i][i];
+    }
+
+    /* Diagonal loading */
+    diag = aoaObj->params.caponCfg.diagLoading * trace / (float) numAnt;
+    for (i = 0; i < numAnt; i++)
+    {
+        covRe[i][i] += diag;
+    }
+
+    /* In place Cholesky decomposition R = L * L^H. The lower triangle of L is
+       stored transposed and conjugated in the upper triangle of cov, i.e.
+       cov[i][j] = conj(L[j][i]) for j >= i. */
+    for (i = 0; i < numAnt; i++)
+    {
+        for (k = 0; k < i; k++)
+        {
+            covRe[i][i] -= covRe[k][i] * covRe[k][i] + covIm[k][i] * covIm[k][i];
+        }
+        if (covRe[i][i] <= 0.f)
+        {
+            /* Singular covariance (e.g. no signal and no loading) */
+            memset((void *)heatMap, 0, numAngleBins * sizeof(float));
+            return;
+        }
+        covRe[i][i] = sqrtsp(covRe[i][i]);
+        covIm[i][i] = 0.f;
+        diag = 1.f / covRe[i][i];
+
+        for (j = i + 1; j < numAnt; j++)
+        {
+            /* conj(L[j][i]) = (R_ij - sum_k L[i][k] * conj(L[j][k])) / L[i][i] */
+            accRe = covRe[i][j];
+            accIm = covIm[i][j];
+            for (k = 0; k < i; k++)
+            {
+                /* L[i][k] = conj(cov[k][i]), conj(L[j][k]) = cov[k][j] */
+                accRe -= covRe[k][i] * covRe[k][j] + covIm[k][i] * covIm[k][j];
+                accIm -= covRe[k][i] * covIm[k][j] - covIm[k][i] * covRe[k][j];
+            }
+            covRe[i][j] = accRe * diag;
+            covIm[i][j] = accIm * diag;
+        }
+    }
+
+    /* Invert the lower triangular factor by forward substitution, column by column */
+    for (j = 0; j < numAnt; j++)
+    {
+        invLRe[j][j] = 1.f / covRe[j][j];
+        invLIm[j][j] = 0.f;
+        for (i = j + 1; i < numAnt; i++)
+        {
+            /* invL[i][j] = -(sum_{k=j}^{i-1} L[i][k] * invL[k][j]) / L[i][i] */
+            accRe = 0.f;
+            accIm = 0.f;
+            for (k = j; k < i; k++)
+            {
+                /* L[i][k] = conj(cov[k][i]) */
+                accRe += covRe[k][i] * invLRe[k][j] + covIm[k][i] * invLIm[k][j];
+                accIm += covRe[k][i] * invLIm[k][j] - covIm[k][i] * invLRe[k][j];
+            }
+            invLRe[i][j] = -accRe / covRe[i][i];
+            invLIm[i][j] = -accIm / covRe[i][i];
+        }
+    }
+
+    /* Batched spectrum evaluation P_k = 1 / ||L^-1 a_k||^2 over all angle bins */
+    for (k = 0; k < numAngleBins; k++)
+    {
+        steerVec = &aoaObj->res.caponSteeringVec[2 * k * numAnt];
+        tmpRe = 0.f;
+        for (i = 0; i < numAnt; i++)
+        {
+            accRe = 0.f;
+            accIm = 0.f;
+            for (j = 0; j <= i; j++)
+            {
+                accRe += invLRe[i][j] * steerVec[2 * j] - invLIm[i][j] * steerVec[2 * j + 1];
+                accIm += invLRe[i][j] * steerVec[2 * j + 1] + invLIm[i][j] * steerVec[2 * j];
+            }
+            tmpRe += accRe * accRe + accIm * accIm;
+        }
+        heatMap[k] = 1.f / tmpRe;
+    }
+}
+
+
+/**
+ *  @b Description
+ *  @n
+ *      The function returns the first range bin at or after rangeIdx that is refreshed
+ *      in the range-azimuth heat map of the current frame, according to the heat map
+ *      update configuration.
+ *
+ *  @param[in]    aoaDspObj     Pointer to internal AoAProc data object
+ *  @param[in]    rangeIdx      First candidate range bin
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Range bin to refresh, numRangeBins if there is none left
+ */
+static inline uint16_t AoAProcDSP_heatMapNextRangeBin
+(
+    AOADspObj *aoaDspObj,
+    uint16_t  rangeIdx
+)
+{
+    DPU_AoAProc_HeatMapUpdateCfg *cfg = &aoaDspObj->dynLocalCfg.heatMapUpdateCfg;
+    uint16_t numRangeBins = aoaDspObj->params.numRangeBins;
+    uint16_t *detMatrix;
+    int32_t diff;
+    uint32_t phase;
+
+    if (!aoaDspObj->heatMapValid || (cfg->mode == DPU_AOAPROC_HEATMAP_UPDATE_FULL))
+    {
+        /* Nothing to select */
+    }
+    else if (cfg->mode == DPU_AOAPROC_HEATMAP_UPDATE_ROUND_ROBIN)
+    {
+        phase = rangeIdx % cfg->decimation;
+        rangeIdx += (aoaDspObj->heatMapRangePhase + cfg->decimation - phase) % cfg->decimation;
+    }
+    else
+    {
+        detMatrix = (uint16_t *)aoaDspObj->res.detMatrix.data;
+        for (; rangeIdx < numRangeBins; rangeIdx++)
+        {
+            diff = (int32_t)detMatrix[rangeIdx * aoaDspObj->params.numDopplerBins] -
+                   (int32_t)aoaDspObj->res.heatMapRefEnergy[rangeIdx];
+            if ((diff > (int32_t)cfg->changeThreshold) || (-diff > (int32_t)cfg->changeThreshold))
+            {
+                break;
+            }
+        }
+    }
+
+    if (rangeIdx > numRangeBins)
+    {
+        rangeIdx = numRangeBins;
+    }
+    return rangeIdx;
 }
 
+/**
+ *  @b Description
+ *  @n
+ *      Validates the range-azimuth heat map update configuration against the
+ *      DPU resources.
+ *
+ *  @param[in]    cfg           Heat map update configuration
+ *  @param[in]    res           DPU hardware resources
+ *  @param[in]    numRangeBins  Number of range bins
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Success     - 0
+ *  @retval
+ *      Error       - <0
+ */
+static int32_t AoAProcDSP_validateHeatMapUpdateCfg
+(
+    DPU_AoAProc_HeatMapUpdateCfg *cfg,
+    DPU_AoAProcDSP_HW_Resources  *res,
+    uint16_t                     numRangeBins
+)
+{
+    int32_t retVal = 0;
+
+    switch (cfg->mode)
+    {
+        case DPU_AOAPROC_HEATMAP_UPDATE_FULL:
+        break;
+
+        case DPU_AOAPROC_HEATMAP_UPDATE_ROUND_ROBIN:
+            if (cfg->decimation == 0U)
+            {
+                retVal = DPU_AOAPROCDSP_EHEATMAPUPDATECFG;
+            }
+        break;
+
+        case DPU_AOAPROC_HEATMAP_UPDATE_ON_CHANGE:
+            if ((res->detMatrix.data == NULL) ||
+                (res->detMatrix.datafmt != DPIF_DETMATRIX_FORMAT_1) ||
+                (res->heatMapRefEnergy == NULL) ||
+                (res->heatMapRefEnergySize < numRangeBins))
+            {
+                retVal = DPU_AOAPROCDSP_EHEATMAPUPDATECFG;
+            }
+        break;
+
+        default:
+            retVal = DPU_AOAPROCDSP_EHEATMAPUPDATECFG;
+        break;
+    }
+
+    return retVal;
+}
 
 /**
  *  @b Description
  *  @n
  *      The function generates the range-azimuth heat-map. 
  *      It computes bin zero of 2D-FFT for all azimuth virtual antennas  
- *      for all range bins.
+ *      for all range bins selected by the heat map update configuration.
  *
  *  @param[in]    aoaDspObj     Pointer to internal AoAProc data object
  *  @param[inout] waitingTime   Pointer to CPU waiting time
+ *  @param[out]   numRangeBinsUpdated   Number of refreshed range bins
  *
  *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
  *
@@ -808,7 +1474,8 @@ static void AoAProcDSP_computeHeatMapVal
  *      Error       - <0
  */
 static inline int32_t  AoAProcDSP_RangeAzimuthHeatmap(AOADspObj *aoaDspObj,
-                                        volatile uint32_t *waitingTime)
+                                        volatile uint32_t *waitingTime,
+                                        uint32_t *numRangeBinsUpdated)
 {
     volatile uint32_t startTimeWait;
     int32_t retVal = 0;
@@ -816,7 +1483,7 @@ static inline int32_t  AoAProcDSP_RangeAzimuthHeatmap(AOADspObj *aoaDspObj,
     DPU_AoAProcDSP_HW_Resources *res;
     DPU_AoAProcDSP_StaticConfig *DPParams;
     uint16_t rxAntIdx, rangeIdx, txAntIdx, rxAntIdxPing, txAntIdxPing, numAzimTxAnt; 
-    uint16_t nextTransferRxIdx, nextTransferRangeIdx, nextTransferTxIdx; 
+    uint16_t nextTransferRxIdx, nextTransferRangeIdx, nextTransferTxIdx, nextRangeIdx; 
     uint32_t pingPongIdx, nextTransferIdx;
     uint8_t  channel;
     cmplx16ImRe_t  *inpBuf;
@@ -840,6 +1507,14 @@ static inline int32_t  AoAProcDSP_RangeAzimuthHeatmap(AOADspObj *aoaDspObj,
     
     /* Reset ping/pong index */
     pingPongIdx = DPU_AOAPROCDSP_PING_IDX;
+
+    /* First range bin to refresh in this frame */
+    *numRangeBinsUpdated = 0;
+    rangeIdx = AoAProcDSP_heatMapNextRangeBin(aoaDspObj, 0);
+    if (rangeIdx >= DPParams->numRangeBins)
+    {
+        goto done;
+    }
     
     /* Trigger first DMA.
        Note: EDMA ping/pong scheme should cover only azimuth antennas and must bring antenna data
@@ -852,12 +1527,15 @@ static inline int32_t  AoAProcDSP_RangeAzimuthHeatmap(AOADspObj *aoaDspObj,
        by just changing the source addresses.       */
     EDMA_setSourceAddress(res->edmaHandle, 
                           res->edmaPing.channel, 
-                          (uint32_t) &radarCubeBase[0]);
+                          (uint32_t) &radarCubeBase[rangeIdx]);
     
     EDMA_startDmaTransfer(res->edmaHandle, res->edmaPing.channel);
     
-    for (rangeIdx = 0; rangeIdx < DPParams->numRangeBins; rangeIdx++)
+    for (; rangeIdx < DPParams->numRangeBins; rangeIdx = nextRangeIdx)
     {
+        /* Range bin fetched after the last virtual antenna of this one */
+        nextRangeIdx = AoAProcDSP_heatMapNextRangeBin(aoaDspObj, rangeIdx + 1);
+
         for (rxAntIdx = 0; rxAntIdx < DPParams->numRxAntennas; rxAntIdx++)
         {
             for (txAntIdx = 0; txAntIdx < numAzimTxAnt; txAntIdx++)
@@ -883,7 +1561,7 @@ static inline int32_t  AoAProcDSP_RangeAzimuthHeatmap(AOADspObj *aoaDspObj,
                    if(nextTransferRxIdx == DPParams->numRxAntennas)
                    {
                        nextTransferRxIdx = 0;
-                       nextTransferRangeIdx++;
+                       nextTransferRangeIdx = nextRangeIdx;
                    }
                 }
                 
@@ -891,8 +1569,8 @@ static inline int32_t  AoAProcDSP_RangeAzimuthHeatmap(AOADspObj *aoaDspObj,
                                    nextTransferRxIdx) * DPParams->numRangeBins + nextTransferRangeIdx;
                 
                 /*Last computation happens when nextTransferRangeIdx reaches numRangeBins. 
-                  This indicates that, the current virtual antenna is the last one for (numRangeBins-1). 
-                  Therefore, do not trigger next EDMA.*/
+                  This indicates that, the current virtual antenna is the last one of the last
+                  refreshed range bin. Therefore, do not trigger next EDMA.*/
                 if(nextTransferRangeIdx < DPParams->numRangeBins)
                 {
                     /* kick off next DMA */
@@ -916,7 +1594,7 @@ static inline int32_t  AoAProcDSP_RangeAzimuthHeatmap(AOADspObj *aoaDspObj,
                 /* Remove static clutter? */
                 if (aoaDspObj->dynLocalCfg.staticClutterCfg.isEnabled)
                 {
-                    AoAProcDSP_clutterRemoval(DPParams, inpBuf);
+                    AoAProcDSP_clutterRemoval(aoaDspObj, inpBuf);
                 }
                 
                 if(DPParams->isBpmEnabled)
@@ -969,7 +1647,35 @@ static inline int32_t  AoAProcDSP_RangeAzimuthHeatmap(AOADspObj *aoaDspObj,
                 pingPongIdx ^= 1;
             }/*txAntIdx*/
         } /* rxAntIdx */
+
+        /* All azimuth virtual antennas of this range bin are in the snapshot buffer */
+        if (DPParams->caponCfg.enabled)
+        {
+            AoAProcDSP_caponRangeBin(aoaDspObj, rangeIdx);
+        }
+
+        /* Remember the energy this range bin was refreshed with */
+        if (aoaDspObj->dynLocalCfg.heatMapUpdateCfg.mode == DPU_AOAPROC_HEATMAP_UPDATE_ON_CHANGE)
+        {
+            res->heatMapRefEnergy[rangeIdx] =
+                ((uint16_t *)res->detMatrix.data)[rangeIdx * DPParams->numDopplerBins];
+        }
+        (*numRangeBinsUpdated)++;
     }/*rangeIdx*/
+
+done:
+    /* Advance the round robin phase. A full refresh (first frame after a configuration
+       change) is followed by phase 0. */
+    if (aoaDspObj->heatMapValid &&
+        (aoaDspObj->dynLocalCfg.heatMapUpdateCfg.mode == DPU_AOAPROC_HEATMAP_UPDATE_ROUND_ROBIN))
+    {
+        aoaDspObj->heatMapRangePhase++;
+        if (aoaDspObj->heatMapRangePhase >= aoaDspObj->dynLocalCfg.heatMapUpdateCfg.decimation)
+        {
+            aoaDspObj->heatMapRangePhase = 0;
+        }
+    }
+    aoaDspObj->heatMapValid = true;
     
 exit:
     return retVal;
@@ -993,16 +1699,106 @@ exit:
 static void AoAProcDSP_ConvertFov(AOADspObj *aoaDspObj,
                                   DPU_AoAProc_FovAoaCfg *fovAoaCfg)
 {
-    aoaDspObj->dynLocalCfg.fovAoaLocalCfg.minAzimuthSineVal = sin(fovAoaCfg->minAzimuthDeg / 180. * PI_);
-    aoaDspObj->dynLocalCfg.fovAoaLocalCfg.maxAzimuthSineVal = sin(fovAoaCfg->maxAzimuthDeg / 180. * PI_);
-    aoaDspObj->dynLocalCfg.fovAoaLocalCfg.minElevationSineVal = sin(fovAoaCfg->minElevationDeg / 180. * PI_);
-    aoaDspObj->dynLocalCfg.fovAoaLocalCfg.maxElevationSineVal = sin(fovAoaCfg->maxElevationDeg  / 180. * PI_);
+    aoaDspObj->dynLocalCfg.fovAoaLocalCfg.minAzimuthSineVal = sinsp(fovAoaCfg->minAzimuthDeg / 180.f * PI_);
+    aoaDspObj->dynLocalCfg.fovAoaLocalCfg.maxAzimuthSineVal = sinsp(fovAoaCfg->maxAzimuthDeg / 180.f * PI_);
+    aoaDspObj->dynLocalCfg.fovAoaLocalCfg.minElevationSineVal = sinsp(fovAoaCfg->minElevationDeg / 180.f * PI_);
+    aoaDspObj->dynLocalCfg.fovAoaLocalCfg.maxElevationSineVal = sinsp(fovAoaCfg->maxElevationDeg  / 180.f * PI_);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Validates the antenna geometry configuration and the 2D angle FFT buffers, and
+ *      builds the antenna map offset of each virtual antenna.
+ *
+ *  @param[in]    aoaDspCfg     DPU configuration
+ *  @param[out]   antMapIdx     Antenna map offset of each virtual antenna
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Success     - 0
+ *  @retval
+ *      Error       - <0
+ */
+static int32_t AoAProcDSP_configAntGeometry
+(
+    DPU_AoAProcDSP_Config    *aoaDspCfg,
+    uint16_t                 *antMapIdx
+)
+{
+    DPU_AoAProcDSP_StaticConfig *staticCfg = &aoaDspCfg->staticCfg;
+    DPU_AoAProcDSP_AntennaGeometryCfg *geometryCfg = &staticCfg->antGeometryCfg;
+    DPU_AoAProcDSP_HW_Resources *res = &aoaDspCfg->res;
+    uint32_t numVirtAnt = staticCfg->numVirtualAntAzim + staticCfg->numVirtualAntElev;
+    uint32_t antIdx, otherIdx;
+    int32_t  retVal = 0;
+
+    if (!geometryCfg->enabled)
+    {
+        goto exit;
+    }
+
+    if ((numVirtAnt != (uint32_t)staticCfg->numTxAntennas * staticCfg->numRxAntennas) ||
+        (numVirtAnt > DPU_AOAPROCDSP_MAX_NUM_VIRT_ANT) ||
+        (geometryCfg->numRows == 0) ||
+        (geometryCfg->numRows > DPU_AOAPROCDSP_MAX_NUM_ANT_ROWS) ||
+        (geometryCfg->numElevBins < DPU_AOAPROCDSP_MIN_NUM_ELEV_BINS) ||
+        (geometryCfg->numElevBins > DPU_AOAPROCDSP_MAX_NUM_ANGLE_BINS) ||
+        ((geometryCfg->numElevBins & (geometryCfg->numElevBins - 1U)) != 0))
+    {
+        retVal = DPU_AOAPROCDSP_EANTGEOMETRYCFG;
+        goto exit;
+    }
+
+    for (antIdx = 0; antIdx < numVirtAnt; antIdx++)
+    {
+        if ((geometryCfg->antPos[antIdx].row >= geometryCfg->numRows) ||
+            (geometryCfg->antPos[antIdx].col >= staticCfg->numAngleBins))
+        {
+            retVal = DPU_AOAPROCDSP_EANTGEOMETRYCFG;
+            goto exit;
+        }
+        antMapIdx[antIdx] = geometryCfg->antPos[antIdx].row * staticCfg->numAngleBins +
+                            geometryCfg->antPos[antIdx].col;
+        for (otherIdx = 0; otherIdx < antIdx; otherIdx++)
+        {
+            if (antMapIdx[otherIdx] == antMapIdx[antIdx])
+            {
+                retVal = DPU_AOAPROCDSP_EANTGEOMETRYCFG;
+                goto exit;
+            }
+        }
+    }
+
+    if (!res->angle2DFftBuf ||
+        !res->elevTwiddle32x32 ||
+        !res->detObjElevationAngle ||
+        (res->angle2DFftBufSize < sizeof(cmplx32ReIm_t) * (2U * geometryCfg->numRows * staticCfg->numAngleBins +
+                                                           2U * geometryCfg->numElevBins)) ||
+        (res->elevTwiddleSize < sizeof(cmplx32ReIm_t) * geometryCfg->numElevBins) ||
+        (res->scratch2Size < sizeof(float) * geometryCfg->numElevBins))
+    {
+        retVal = DPU_AOAPROCDSP_EANTGEOMETRYCFG;
+        goto exit;
+    }
+
+    if (MEM_IS_NOT_ALIGN(res->angle2DFftBuf,    DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT) ||
+        MEM_IS_NOT_ALIGN(res->elevTwiddle32x32, DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT))
+    {
+        retVal = DPU_AOAPROCDSP_ENOMEMALIGN_BUFF;
+        goto exit;
+    }
+
+exit:
+    return retVal;
 }
 
 /**
  *  @b Description
  *  @n
- *      Generate Twiddle tables used by the DPU.
+ *      Generate Twiddle tables used by the DPU. The Doppler and angle FFT twiddles
+ *      are not generated when they are already initialized.
  *
  *  @param[in]  aoaDspCfg       DPU configuration.
  *
@@ -1016,13 +1812,43 @@ static inline void AoAProcDSP_generateTables
     DPU_AoAProcDSP_Config    *aoaDspCfg
 )
 {
-    /* Generate twiddle factors for Doppler FFT. This is in ReIm format.*/
-    mmwavelib_gen_twiddle_smallfft_32x32((int32_t *)aoaDspCfg->res.twiddle32x32, 
-                                         aoaDspCfg->staticCfg.numDopplerBins);
+    if (aoaDspCfg->res.isTablesInitialized == false)
+    {
+        /* Generate twiddle factors for Doppler FFT. This is in ReIm format.*/
+        mmwavelib_gen_twiddle_smallfft_32x32((int32_t *)aoaDspCfg->res.twiddle32x32,
+                                             aoaDspCfg->staticCfg.numDopplerBins);
+
+        /* Generate twiddle factors for the angle FFT. This is in ReIm format.*/
+        mmwavelib_gen_twiddle_smallfft_32x32((int32_t *)aoaDspCfg->res.angleTwiddle32x32,
+                                             aoaDspCfg->staticCfg.numAngleBins);
+    }
+
+    /* Generate twiddle factors for the elevation FFT of the 2D angle FFT. This is in ReIm format.*/
+    if (aoaDspCfg->staticCfg.antGeometryCfg.enabled)
+    {
+        mmwavelib_gen_twiddle_smallfft_32x32((int32_t *)aoaDspCfg->res.elevTwiddle32x32,
+                                             aoaDspCfg->staticCfg.antGeometryCfg.numElevBins);
+    }
+
+    /* Generate Capon steering vectors a_k[n] = exp(j*2*pi*n*k/numAngleBins), matching
+       the bin to angle mapping of the azimuth FFT. */
+    if (aoaDspCfg->staticCfg.caponCfg.enabled)
+    {
+        uint32_t angleIdx, antIdx;
+        float phase;
+        float *steerVec = aoaDspCfg->res.caponSteeringVec;
 
-    /* Generate twiddle factors for the angle FFT. This is in ReIm format.*/
-    mmwavelib_gen_twiddle_smallfft_32x32((int32_t *)aoaDspCfg->res.angleTwiddle32x32, 
-                                         DPU_AOAPROCDSP_NUM_ANGLE_BINS);
+        for (angleIdx = 0; angleIdx < aoaDspCfg->staticCfg.caponCfg.numAngleBins; angleIdx++)
+        {
+            for (antIdx = 0; antIdx < aoaDspCfg->staticCfg.numVirtualAntAzim; antIdx++)
+            {
+                phase = 2.f * PI_ * (float)((antIdx * angleIdx) % aoaDspCfg->staticCfg.caponCfg.numAngleBins) /
+                        (float) aoaDspCfg->staticCfg.caponCfg.numAngleBins;
+                *steerVec++ = cossp(phase);
+                *steerVec++ = sinsp(phase);
+            }
+        }
+    }
 }
 
 /**
@@ -1064,11 +1890,652 @@ static inline void AoAProcDSP_decodeBPM(cmplx32ReIm_t *virtAntennaBuf, uint16_t
 /**
  *  @b Description
  *  @n
- *    AoA processing when there are more than one virtual antennas 
+ *    Fetches the samples of all virtual antennas of one range bin from the radar cube
+ *    (EDMA ping/pong) and computes the 2D (Doppler) FFT for each of them. The FFT output
+ *    of each virtual antenna is either written to @ref DPU_AoAProcDSP_HW_Resources::rangeBinDopplerFftBuf
+ *    (range bin grouping) or only the bin at dopplerIdx is saved to the angle FFT input.
+ *
+ *  @param[in]    aoaDspObj         DPU object
+ *  @param[in]    rangeIdx          Range bin index
+ *  @param[in]    dopplerIdx        Doppler bin saved to the angle FFT input, not used when
+ *                                  isRangeBinCached is true
+ *  @param[in]    isRangeBinCached  true: keep all Doppler bins of all virtual antennas
+ *  @param[inout] waitTime          CPU waiting time
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Success     - 0
+ *  @retval
+ *      Error       - <0
+ *
+ */
+static inline int32_t AoAProcDSP_dopplerFftRangeBin
+(
+    AOADspObj                 *aoaDspObj,
+    uint16_t                  rangeIdx,
+    uint16_t                  dopplerIdx,
+    bool                      isRangeBinCached,
+    volatile uint32_t         *waitTime
+)
+{
+    uint16_t rxAntIdx, txAntIdx;
+    uint16_t nextTransferRxIdx, nextTransferRangeIdx, nextTransferTxIdx;
+    uint32_t virtAntIdx;
+    DPU_AoAProcDSP_HW_Resources *res;
+    DPU_AoAProcDSP_StaticConfig *DPParams;
+    cmplx16ImRe_t *inpDoppFftBuf;
+    volatile uint32_t startTimeWait;
+    int32_t  retVal = 0;
+    cmplx16ImRe_t  *radarCubeBase;
+    uint32_t pingPongIdx, nextTransferIdx;
+    uint8_t channel;
+    cmplx32ReIm_t *windowingBuf;
+    cmplx32ReIm_t *twoDfftOut;
+
+    res = &aoaDspObj->res;
+    DPParams = &aoaDspObj->params;
+    radarCubeBase = (cmplx16ImRe_t *)res->radarCube.data;
+    /* Setup overlayed buffers */
+    windowingBuf  = (cmplx32ReIm_t *)res->scratch1Buff;
+    twoDfftOut    = (cmplx32ReIm_t *)res->scratch2Buff;
+
+    /* Reset ping/pong index */
+    pingPongIdx = DPU_AOAPROCDSP_PING_IDX;
+
+    /* Trigger first DMA. First transfer is for [txAntIdx=0, rxAntIdx=0, rangeIdx=(Obj range from CFAR list)].
+       Note: EDMA ping/pong scheme must support #TX antennas = 1,2,3 #RX antennas = 2,4 */
+    EDMA_setSourceAddress(res->edmaHandle,
+                          res->edmaPing.channel,
+                          (uint32_t) &radarCubeBase[rangeIdx]);
+
+    EDMA_startDmaTransfer(res->edmaHandle, res->edmaPing.channel);
+
+    for (rxAntIdx = 0; rxAntIdx < DPParams->numRxAntennas; rxAntIdx++)
+    {
+        for (txAntIdx = 0; txAntIdx < DPParams->numTxAntennas; txAntIdx++)
+        {
+            /* verify that previous DMA has completed */
+            startTimeWait = Cycleprofiler_getTimeStamp();
+            retVal = AoAProcDSP_waitInData (res, pingPongIdx);
+            if(retVal != 0)
+            {
+                goto exit;
+            }
+
+            *waitTime += Cycleprofiler_getTimeStamp() - startTimeWait;
+
+            /*Find index in radar cube for next EDMA.*/
+            nextTransferTxIdx    = txAntIdx + 1;
+            nextTransferRxIdx    = rxAntIdx;
+            nextTransferRangeIdx = rangeIdx;
+
+            if(nextTransferTxIdx == DPParams->numTxAntennas)
+            {
+               nextTransferTxIdx = 0;
+               nextTransferRxIdx++;
+               if(nextTransferRxIdx == DPParams->numRxAntennas)
+               {
+                   nextTransferRxIdx = 0;
+                   nextTransferRangeIdx++;
+               }
+            }
+
+            nextTransferIdx = (nextTransferTxIdx * DPParams->numRxAntennas * DPParams->numDopplerChirps +
+                               nextTransferRxIdx) * DPParams->numRangeBins + nextTransferRangeIdx;
+
+            /*Last computation happens when nextTransferRangeIdx reaches (rangeIdx + 1) was we are processing
+              only one range index. Therefore, do not trigger next EDMA.*/
+            if(nextTransferRangeIdx == rangeIdx)
+            {
+                /* kick off next DMA */
+                if (pingPongIdx == DPU_AOAPROCDSP_PONG_IDX)
+                {
+                    channel = res->edmaPing.channel;
+                }
+                else
+                {
+                    channel = res->edmaPong.channel;
+                }
+
+                EDMA_setSourceAddress(res->edmaHandle, channel,
+                                     (uint32_t) &radarCubeBase[nextTransferIdx]);
+
+                EDMA_startDmaTransfer(res->edmaHandle, channel);
+            }
+
+            inpDoppFftBuf = (cmplx16ImRe_t *) &res->pingPongBuf[pingPongIdx * DPParams->numDopplerChirps];
+
+            /* Remove static clutter? */
+            if (aoaDspObj->dynLocalCfg.staticClutterCfg.isEnabled)
+            {
+                AoAProcDSP_clutterRemoval(aoaDspObj, inpDoppFftBuf);
+            }
+
+            /* The windowing output buffer is the input buffer for the Doppler FFT.
+               It needs to be padded with zeroes if number of Doppler chirps is less than
+               the number of Doppler bins.*/
+            if(DPParams->numDopplerBins > DPParams->numDopplerChirps)
+            {
+                memset((void*)(&windowingBuf[DPParams->numDopplerChirps]), 0,
+                       (DPParams->numDopplerBins - DPParams->numDopplerChirps) * sizeof(cmplx32ReIm_t));
+            }
+
+            /*Up to this point samples are in ImRe format, which is the radar cube format.
+              The windowing function will do IQ swap and the Doppler FFT is computed in
+              ReIm format.*/
+            mmwavelib_windowing16x32_IQswap((int16_t *) inpDoppFftBuf,
+                                            res->windowCoeff,
+                                            (int32_t *) windowingBuf,
+                                            DPParams->numDopplerChirps);
+
+            /*From this point forward samples are in ReIm format. In particular, FFT, twiddle are all in ReIm format.*/
+            virtAntIdx = txAntIdx * DPParams->numRxAntennas + rxAntIdx;
+
+            /*DSPLIB notes for DSP_fft32x32():
+              Minimum FFT size is 16. Size must be power of 2.
+              No scaling done in FFT computation.*/
+            if (isRangeBinCached)
+            {
+                /* Keep all Doppler bins, they are picked per detection of this range bin */
+                DSP_fft32x32((int32_t *)res->twiddle32x32,
+                             DPParams->numDopplerBins,
+                             (int32_t *)windowingBuf,
+                             (int32_t *)&res->rangeBinDopplerFftBuf[virtAntIdx * DPParams->numDopplerBins]);
+            }
+            else
+            {
+                DSP_fft32x32((int32_t *)res->twiddle32x32,
+                             DPParams->numDopplerBins,
+                             (int32_t *)windowingBuf,
+                             (int32_t *)twoDfftOut);
+
+                /* Save the 2D doppler FFT output for the required doppler bin */
+                res->angleFftIn[virtAntIdx] = twoDfftOut[dopplerIdx];
+            }
+
+            pingPongIdx ^= 1;
+        }/*txAntIdx*/
+    } /* rxAntIdx */
+
+exit:
+    return retVal;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *    Copies one set of Doppler compensated virtual antenna symbols to the angle FFT
+ *    input buffer, then applies BPM decoding and RX channel compensation in place.
+ *
+ *  @param[in]    aoaDspObj     DPU object
+ *  @param[in]    symbols       Doppler compensated virtual antenna symbols
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval None
+ *
+ */
+static inline void AoAProcDSP_prepareAngleSymbols
+(
+    AOADspObj                 *aoaDspObj,
+    cmplx32ReIm_t             *symbols
+)
+{
+    DPU_AoAProcDSP_HW_Resources *res;
+    DPU_AoAProcDSP_StaticConfig *DPParams;
+
+    res = &aoaDspObj->res;
+    DPParams = &aoaDspObj->params;
+
+    memcpy((void *)&res->angleFftIn[0], (void *)symbols,
+           (DPParams->numVirtualAntAzim + DPParams->numVirtualAntElev) * sizeof(cmplx32ReIm_t));
+
+    /* BPM decoding*/
+    if(DPParams->isBpmEnabled)
+    {
+        AoAProcDSP_decodeBPM(&res->angleFftIn[0], DPParams->numRxAntennas);
+    }
+
+    /* RX channel gain/phase offset compensation. */
+    AoAProcDSP_rxChanPhaseBiasCompensation(&aoaDspObj->dynLocalCfg.compRxChanCfg.rxChPhaseComp[0],
+                                           DPParams->numVirtualAntAzim + DPParams->numVirtualAntElev,
+                                           &res->angleFftIn[0],
+                                           &res->angleFftIn[0]);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *    Angle FFTs of one set of Doppler compensated virtual antenna symbols:
+ *    BPM decoding, RX channel compensation, azimuth FFT into scratch1Buff and,
+ *    if requested, elevation FFT into elevationFftOut.
+ *
+ *  @param[in]    aoaDspObj     DPU object
+ *  @param[in]    symbols       Doppler compensated virtual antenna symbols
+ *  @param[in]    doElevation   true to also compute the elevation FFT
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval None
+ *
+ */
+static inline void AoAProcDSP_angleFft
+(
+    AOADspObj                 *aoaDspObj,
+    cmplx32ReIm_t             *symbols,
+    bool                      doElevation
+)
+{
+    DPU_AoAProcDSP_HW_Resources *res;
+    DPU_AoAProcDSP_StaticConfig *DPParams;
+    cmplx32ReIm_t  elevationSymbols[SYS_COMMON_NUM_RX_CHANNEL];
+    cmplx32ReIm_t *azimuthFftOut;
+
+    res = &aoaDspObj->res;
+    DPParams = &aoaDspObj->params;
+    azimuthFftOut = (cmplx32ReIm_t *)res->scratch1Buff;
+
+    AoAProcDSP_prepareAngleSymbols(aoaDspObj, symbols);
+
+    /* Save elevation symbols before doing Azimuth FFT */
+    doElevation = doElevation && (DPParams->numVirtualAntElev > 0);
+    if(doElevation)
+    {
+        memcpy((void*)&elevationSymbols[0],
+               (void*)&res->angleFftIn[DPParams->numVirtualAntAzim],
+               DPParams->numVirtualAntElev * sizeof(cmplx32ReIm_t));
+    }
+
+    /* Zero padding */
+    memset((void *) &res->angleFftIn[DPParams->numVirtualAntAzim], 0,
+           (DPParams->numAngleBins - DPParams->numVirtualAntAzim) * sizeof(cmplx32ReIm_t));
+
+    /* 3D-FFT (Azimuth FFT) */
+    DSP_fft32x32((int32_t *)res->angleTwiddle32x32,
+                 DPParams->numAngleBins,
+                 (int32_t *) &res->angleFftIn[0],
+                 (int32_t *) &azimuthFftOut[0]);
+
+    /* Perform 3D elevation FFT if elevation virtual antennas are present*/
+    if(doElevation)
+    {
+        /* Restore elevation symbols to FFT input buffer */
+        memcpy((void*)&res->angleFftIn[0],
+               (void*)&elevationSymbols[0],
+               DPParams->numVirtualAntElev * sizeof(cmplx32ReIm_t));
+
+        /* Zero padding */
+        memset((void *) &res->angleFftIn[DPParams->numVirtualAntElev], 0,
+               (DPParams->numAngleBins - DPParams->numVirtualAntElev) * sizeof(cmplx32ReIm_t));
+
+        /* 3D-FFT (Elevation FFT) */
+        DSP_fft32x32((int32_t *)res->angleTwiddle32x32,
+                     DPParams->numAngleBins,
+                     (int32_t *) &res->angleFftIn[0],
+                     (int32_t *) &res->elevationFftOut[0]);
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *    2D angle FFT of one set of Doppler compensated virtual antenna symbols over the
+ *    antenna map of @ref DPU_AoAProcDSP_AntennaGeometryCfg: the symbols are scattered
+ *    into the zero padded map with the antenna offset table, the azimuth FFT is
+ *    computed for each antenna row and the elevation FFT for each azimuth bin.
+ *    The largest bin of the 2D spectrum is returned.
+ *
+ *  @param[in]    aoaDspObj     DPU object
+ *  @param[in]    symbols       Doppler compensated virtual antenna symbols
+ *  @param[out]   azimIdx       Azimuth bin of the 2D spectrum peak
+ *  @param[out]   elevIdx       Elevation bin of the 2D spectrum peak
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval Power of the 2D spectrum peak
+ *
+ */
+static inline float AoAProcDSP_angleFft2D
+(
+    AOADspObj                 *aoaDspObj,
+    cmplx32ReIm_t             *symbols,
+    uint32_t                  *azimIdx,
+    uint32_t                  *elevIdx
+)
+{
+    DPU_AoAProcDSP_HW_Resources *res;
+    DPU_AoAProcDSP_StaticConfig *DPParams;
+    DPU_AoAProcDSP_AntennaGeometryCfg *geometryCfg;
+    cmplx32ReIm_t *antMap, *rowFftOut, *colFftIn, *colFftOut;
+    float *colMagSqr;
+    uint32_t numAngleBins, numElevBins, numRows, numVirtAnt;
+    uint32_t antIdx, rowIdx, colIdx, peakIdx;
+    float colMaxVal, maxVal;
+
+    res = &aoaDspObj->res;
+    DPParams = &aoaDspObj->params;
+    geometryCfg = &DPParams->antGeometryCfg;
+    numAngleBins = DPParams->numAngleBins;
+    numElevBins = geometryCfg->numElevBins;
+    numRows = geometryCfg->numRows;
+    numVirtAnt = DPParams->numVirtualAntAzim + DPParams->numVirtualAntElev;
+
+    /* Setup overlayed buffers */
+    antMap    = &res->angle2DFftBuf[0];
+    rowFftOut = &antMap[numRows * numAngleBins];
+    colFftIn  = &rowFftOut[numRows * numAngleBins];
+    colFftOut = &colFftIn[numElevBins];
+    colMagSqr = (float *)res->scratch2Buff;
+
+    AoAProcDSP_prepareAngleSymbols(aoaDspObj, symbols);
+
+    /* Scatter the virtual antennas into the zero padded antenna map */
+    memset((void *)antMap, 0, numRows * numAngleBins * sizeof(cmplx32ReIm_t));
+    for (antIdx = 0; antIdx < numVirtAnt; antIdx++)
+    {
+        antMap[aoaDspObj->antMapIdx[antIdx]] = res->angleFftIn[antIdx];
+    }
+
+    /* Azimuth FFT of each antenna row */
+    for (rowIdx = 0; rowIdx < numRows; rowIdx++)
+    {
+        DSP_fft32x32((int32_t *)res->angleTwiddle32x32,
+                     numAngleBins,
+                     (int32_t *) &antMap[rowIdx * numAngleBins],
+                     (int32_t *) &rowFftOut[rowIdx * numAngleBins]);
+    }
+
+    /* Elevation FFT of each azimuth bin and 2D peak search */
+    maxVal = -1.f;
+    for (colIdx = 0; colIdx < numAngleBins; colIdx++)
+    {
+        for (rowIdx = 0; rowIdx < numRows; rowIdx++)
+        {
+            colFftIn[rowIdx] = rowFftOut[rowIdx * numAngleBins + colIdx];
+        }
+
+        /* Zero padding */
+        memset((void *) &colFftIn[numRows], 0, (numElevBins - numRows) * sizeof(cmplx32ReIm_t));
+
+        DSP_fft32x32((int32_t *)res->elevTwiddle32x32,
+                     numElevBins,
+                     (int32_t *) &colFftIn[0],
+                     (int32_t *) &colFftOut[0]);
+
+        peakIdx = mmwavelib_powerAndMax((int32_t *)&colFftOut[0],
+                                        numElevBins,
+                                        &colMagSqr[0],
+                                        &colMaxVal);
+        if (colMaxVal > maxVal)
+        {
+            maxVal = colMaxVal;
+            *azimIdx = colIdx;
+            *elevIdx = peakIdx;
+        }
+    }
+
+    return maxVal;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Angle estimation of one detection from the peak of the 2D angle FFT over the
+ *      antenna map, see @ref DPU_AoAProcDSP_AntennaGeometryCfg.
+ *
+ *  @param[in]  aoaDspObj          Pointer to AoAProc DPU internal data Object
+ *
+ *  @param[in]  objInCfarIdx       Index of the current object in CFAR output list @ref DPIF_CFARDetList_t
+ *
+ *  @param[in]  objOutIdx          Index to the next object in the output list
+ *
+ *  @param[in]  azimIdx            Azimuth bin of the 2D spectrum peak
+ *
+ *  @param[in]  elevIdx            Elevation bin of the 2D spectrum peak
+ *
+ *  @param[in]  dopplerIdx         Signed (unwrapped) Doppler index of the object
+ *
+ *  @retval     objOutIdx          Index for the next object in the output list
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ */
+static inline uint32_t AoAProcDSP_angleEstimation2D
+(
+    AOADspObj       *aoaDspObj,
+    uint32_t        objInCfarIdx,
+    uint32_t        objOutIdx,
+    uint32_t        azimIdx,
+    uint32_t        elevIdx,
+    int32_t         dopplerIdx
+)
+{
+    int32_t  sAzimIdx, sElevIdx;
+    uint32_t numAngleBins = aoaDspObj->params.numAngleBins;
+    uint32_t numElevBins = aoaDspObj->params.antGeometryCfg.numElevBins;
+
+    sAzimIdx = (azimIdx >= numAngleBins/2) ? (int32_t)azimIdx - (int32_t)numAngleBins : (int32_t)azimIdx;
+    sElevIdx = (elevIdx >= numElevBins/2) ? (int32_t)elevIdx - (int32_t)numElevBins : (int32_t)elevIdx;
+
+    /* Antenna rows see the phase -pi * row * Wz */
+    return AoAProcDSP_pointOutput(aoaDspObj,
+                                  objOutIdx,
+                                  objInCfarIdx,
+                                  2 * (float) sAzimIdx / numAngleBins,
+                                  -2 * (float) sElevIdx / numElevBins,
+                                  true,
+                                  azimIdx,
+                                  dopplerIdx);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *    Angle processing of one CFAR detection once its 2D FFT values of all virtual
+ *    antennas are in the angle FFT input buffer: Doppler compensation, BPM decoding,
+ *    RX channel compensation, azimuth/elevation FFT and angle estimation.
+ *
+ *    When extended maximum velocity is enabled, the symbols are Doppler compensated
+ *    for each of the numTxAntennas velocity hypotheses in one pass, the azimuth
+ *    spectrum of every hypothesis is computed, and the hypothesis with the largest
+ *    azimuth peak is used for the angle estimation and for the unwrapped velocity.
+ *
+ *  @param[in]    aoaDspObj   DPU object
+ *  @param[in]    objInCfarIdx Index of the detection in the CFAR list
+ *  @param[in]    objOutIdx   Index for the next object in the output list
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval objOutIdx Index for the next object in the output list
+ *
+ */
+static inline uint32_t AoAProcDSP_angleProcessing
+(
+    AOADspObj                 *aoaDspObj,
+    uint32_t                  objInCfarIdx,
+    uint32_t                  objOutIdx
+)
+{
+    DPU_AoAProcDSP_HW_Resources *res;
+    DPU_AoAProcDSP_StaticConfig *DPParams;
+    cmplx32ReIm_t  hypothesesSymbols[SYS_COMMON_NUM_TX_ANTENNAS * SYS_COMMON_NUM_TX_ANTENNAS * SYS_COMMON_NUM_RX_CHANNEL];
+    uint32_t numVirtAnt, numHypotheses, hypothesisIdx, hypothesisMaxIdx;
+    int32_t  dopplerSignIdx, wrapStartInd;
+    float    maxVal, hypothesisMaxVal;
+
+    res = &aoaDspObj->res;
+    DPParams = &aoaDspObj->params;
+    numVirtAnt = DPParams->numVirtualAntAzim + DPParams->numVirtualAntElev;
+    dopplerSignIdx = AOA_DOPPLER_IDX_TO_SIGNED(res->cfarRngDopSnrList[objInCfarIdx].dopplerIdx,
+                                               DPParams->numDopplerBins);
+
+    if (aoaDspObj->dynLocalCfg.extMaxVelCfg.enabled && (DPParams->numTxAntennas > 1))
+    {
+        numHypotheses = DPParams->numTxAntennas;
+        wrapStartInd = - ((int32_t) (numHypotheses >> 1));
+        if (!(numHypotheses & 0x1) && (dopplerSignIdx < 0))
+        {
+            wrapStartInd++;
+        }
+    }
+    else
+    {
+        numHypotheses = 1;
+        wrapStartInd = 0;
+    }
+
+    /* When BPM is enabled, order must be:
+       2D FFT -> Doppler compensation -> BPM decoding -> RX phase compensation */
+
+    /* Doppler compensation, one set of symbols per hypothesis */
+    AoAProcDSP_dopplerCompensation(&res->angleFftIn[0],
+                               &res->cfarRngDopSnrList[objInCfarIdx],
+                               &hypothesesSymbols[0],
+                               DPParams->numTxAntennas,
+                               DPParams->numRxAntennas,
+                               DPParams->numVirtualAntAzim,
+                               DPParams->numVirtualAntElev,
+                               DPParams->numDopplerBins,
+                               numHypotheses,
+                               wrapStartInd);
+
+    /* 2D angle FFT over the antenna map: pick the hypothesis with the largest 2D peak */
+    if (DPParams->antGeometryCfg.enabled)
+    {
+        uint32_t azimIdx, elevIdx, hypothesisAzimIdx = 0, hypothesisElevIdx = 0;
+
+        hypothesisMaxIdx = 0;
+        hypothesisMaxVal = -1.f;
+        for (hypothesisIdx = 0; hypothesisIdx < numHypotheses; hypothesisIdx++)
+        {
+            maxVal = AoAProcDSP_angleFft2D(aoaDspObj, &hypothesesSymbols[hypothesisIdx * numVirtAnt],
+                                           &azimIdx, &elevIdx);
+            if (maxVal > hypothesisMaxVal)
+            {
+                hypothesisMaxVal = maxVal;
+                hypothesisMaxIdx = hypothesisIdx;
+                hypothesisAzimIdx = azimIdx;
+                hypothesisElevIdx = elevIdx;
+            }
+        }
+        dopplerSignIdx += (wrapStartInd + (int32_t) hypothesisMaxIdx) * (int32_t) DPParams->numDopplerBins;
+
+        return AoAProcDSP_angleEstimation2D(aoaDspObj,
+                                            objInCfarIdx,
+                                            objOutIdx,
+                                            hypothesisAzimIdx,
+                                            hypothesisElevIdx,
+                                            dopplerSignIdx);
+    }
+
+    /* Pick the hypothesis with the largest azimuth peak */
+    hypothesisMaxIdx = 0;
+    if (numHypotheses > 1)
+    {
+        hypothesisMaxVal = 0.f;
+        for (hypothesisIdx = 0; hypothesisIdx < numHypotheses; hypothesisIdx++)
+        {
+            AoAProcDSP_angleFft(aoaDspObj, &hypothesesSymbols[hypothesisIdx * numVirtAnt], false);
+            mmwavelib_powerAndMax((int32_t *)res->scratch1Buff,
+                                  DPParams->numAngleBins,
+                                  (float *)res->scratch2Buff,
+                                  &maxVal);
+            if (maxVal > hypothesisMaxVal)
+            {
+                hypothesisMaxVal = maxVal;
+                hypothesisMaxIdx = hypothesisIdx;
+            }
+        }
+        dopplerSignIdx += (wrapStartInd + (int32_t) hypothesisMaxIdx) * (int32_t) DPParams->numDopplerBins;
+    }
+
+    /* Azimuth and elevation FFT of the selected hypothesis */
+    AoAProcDSP_angleFft(aoaDspObj, &hypothesesSymbols[hypothesisMaxIdx * numVirtAnt], true);
+
+    /* Angle estimation*/
+    return AoAProcDSP_angleEstimationAzimElev(aoaDspObj,
+                                              objInCfarIdx,
+                                              objOutIdx,
+                                              dopplerSignIdx);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *    Orders the CFAR detections by range bin for range bin grouping, in linear time.
+ *    A list already ordered by range bin, as produced when range domain CFAR is
+ *    disabled, is used as is. Otherwise the detections are counting sorted by range
+ *    bin into @ref DPU_AoAProcDSP_HW_Resources::detObjRangeBinOrder, keeping the CFAR
+ *    list order within a range bin.
+ *
+ *  @param[in]    aoaDspObj   DPU object
+ *  @param[in]    numObjsIn   Number of objects in CFAR list
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Detection indices ordered by range bin, NULL if the CFAR list is already ordered
+ *
+ */
+static uint16_t *AoAProcDSP_orderByRangeBin
+(
+    AOADspObj                 *aoaDspObj,
+    uint32_t                  numObjsIn
+)
+{
+    DPU_AoAProcDSP_HW_Resources *res = &aoaDspObj->res;
+    uint16_t *rangeBinStart = res->detObjRangeBinOrder;
+    uint16_t *order = NULL;
+    uint32_t idx;
+    uint32_t rangeIdx;
+
+    for (idx = 1U; idx < numObjsIn; idx++)
+    {
+        if (res->cfarRngDopSnrList[idx].rangeIdx < res->cfarRngDopSnrList[idx - 1U].rangeIdx)
+        {
+            break;
+        }
+    }
+    if (idx >= numObjsIn)
+    {
+        goto exit;
+    }
+
+    /* rangeBinStart[r + 1] counts the detections of range bin r, then becomes the
+       start of range bin r + 1 in the ordered list */
+    memset((void *)rangeBinStart, 0, (aoaDspObj->params.numRangeBins + 1U) * sizeof(uint16_t));
+    for (idx = 0U; idx < numObjsIn; idx++)
+    {
+        rangeBinStart[res->cfarRngDopSnrList[idx].rangeIdx + 1U]++;
+    }
+    for (rangeIdx = 1U; rangeIdx <= aoaDspObj->params.numRangeBins; rangeIdx++)
+    {
+        rangeBinStart[rangeIdx] += rangeBinStart[rangeIdx - 1U];
+    }
+
+    order = &res->detObjRangeBinOrder[aoaDspObj->params.numRangeBins + 1U];
+    for (idx = 0U; idx < numObjsIn; idx++)
+    {
+        order[rangeBinStart[res->cfarRngDopSnrList[idx].rangeIdx]++] = (uint16_t)idx;
+    }
+
+exit:
+    return order;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *    AoA processing when there are more than one virtual antennas. If the range bin
+ *    grouping buffers are provided, the radar cube samples of each range bin are
+ *    fetched and Doppler FFT processed once for all CFAR detections of that range bin,
+ *    otherwise each detection is processed on its own.
  *
  *  @param[in]    aoaDspObj   DPU object
  *  @param[in]    numObjsIn   Number of objects in CFAR list
  *  @param[out]   numObjsOut  Number of detected objects in the output list
+ *  @param[out]   numRangeBinFetches Number of range bins fetched from the radar cube
  *  @param[inout] waitTime    CPU waiting time
  *
  *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
@@ -1084,223 +2551,100 @@ static inline uint32_t AoAProcDSP_processMultipleVirtualAntennas
     AOADspObj                 *aoaDspObj,
     uint32_t                  numObjsIn,
     uint32_t                  *numObjsOut,
+    uint32_t                  *numRangeBinFetches,
     volatile uint32_t         *waitTime
 )
 {
-    uint16_t idx, rxAntIdx, rangeIdx, txAntIdx, dopplerIdx; 
-    uint16_t nextTransferRxIdx, nextTransferRangeIdx, nextTransferTxIdx; 
+    uint16_t idx, objIdx, rangeIdx, dopplerIdx;
+    uint32_t virtAntIdx, numVirtAnt;
     DPU_AoAProcDSP_HW_Resources *res;
     DPU_AoAProcDSP_StaticConfig *DPParams;
-    cmplx16ImRe_t *inpDoppFftBuf;
-    cmplx32ReIm_t  elevationSymbols[SYS_COMMON_NUM_RX_CHANNEL];
     uint32_t  numObjsOutLocal = 0;
-    volatile uint32_t startTimeWait;
+    uint32_t  numFetches = 0;
     int32_t  retVal = 0;
-    cmplx16ImRe_t  *radarCubeBase;
-    uint32_t pingPongIdx, nextTransferIdx;
-    uint8_t channel;
-    cmplx32ReIm_t *windowingBuf;
-    cmplx32ReIm_t *azimuthFftOut;
-    cmplx32ReIm_t *twoDfftOut; 
+    uint16_t *order = NULL;
+    bool     isRangeBinGrouped;
 
     res = &aoaDspObj->res;
     DPParams = &aoaDspObj->params;
-    radarCubeBase = (cmplx16ImRe_t *)res->radarCube.data;
-    /* Setup overlayed buffers */
-    windowingBuf  = (cmplx32ReIm_t *)res->scratch1Buff;
-    azimuthFftOut = (cmplx32ReIm_t *)res->scratch1Buff;
-    twoDfftOut    = (cmplx32ReIm_t *)res->scratch2Buff;
+    numVirtAnt = DPParams->numTxAntennas * DPParams->numRxAntennas;
+    isRangeBinGrouped = (res->rangeBinDopplerFftBuf != NULL) && (res->detObjRangeBinOrder != NULL);
 
-    /* Angle estimation for each object */
-    for (idx = 0; idx < numObjsIn; idx++)
-    {               
-        rangeIdx   = res->cfarRngDopSnrList[idx].rangeIdx;
-        dopplerIdx = res->cfarRngDopSnrList[idx].dopplerIdx;
-        
-        /* Reset ping/pong index */
-        pingPongIdx = DPU_AOAPROCDSP_PING_IDX;
-        
-        /* Trigger first DMA. First transfer is for [txAntIdx=0, rxAntIdx=0, rangeIdx=(Obj range from CFAR list)].
-           Note: EDMA ping/pong scheme must support #TX antennas = 1,2,3 #RX antennas = 2,4 */
-        EDMA_setSourceAddress(res->edmaHandle, 
-                              res->edmaPing.channel, 
-                              (uint32_t) &radarCubeBase[rangeIdx]);
-
-        EDMA_startDmaTransfer(res->edmaHandle, res->edmaPing.channel);
+    if (isRangeBinGrouped)
+    {
+        order = AoAProcDSP_orderByRangeBin(aoaDspObj, numObjsIn);
 
-        for (rxAntIdx = 0; rxAntIdx < DPParams->numRxAntennas; rxAntIdx++)
+        /* Detections of a range bin are consecutive in the ordered list */
+        idx = 0;
+        while (idx < numObjsIn)
         {
-            for (txAntIdx = 0; txAntIdx < DPParams->numTxAntennas; txAntIdx++)
+            objIdx = (order != NULL) ? order[idx] : idx;
+            rangeIdx = res->cfarRngDopSnrList[objIdx].rangeIdx;
+
+            retVal = AoAProcDSP_dopplerFftRangeBin(aoaDspObj, rangeIdx, 0U, true, waitTime);
+            if (retVal != 0)
             {
-                /* verify that previous DMA has completed */
-                startTimeWait = Cycleprofiler_getTimeStamp();
-                retVal = AoAProcDSP_waitInData (res, pingPongIdx);
-                if(retVal != 0)
-                {
-                    goto exit;
-                }    
+                goto exit;
+            }
+            numFetches++;
 
-                *waitTime += Cycleprofiler_getTimeStamp() - startTimeWait;
-                
-                /*Find index in radar cube for next EDMA.*/ 
-                nextTransferTxIdx    = txAntIdx + 1;
-                nextTransferRxIdx    = rxAntIdx;
-                nextTransferRangeIdx = rangeIdx;
-                
-                if(nextTransferTxIdx == DPParams->numTxAntennas)
+            /* Process all detections of this range bin from the local buffer */
+            do
+            {
+                dopplerIdx = res->cfarRngDopSnrList[objIdx].dopplerIdx;
+                for (virtAntIdx = 0; virtAntIdx < numVirtAnt; virtAntIdx++)
                 {
-                   nextTransferTxIdx = 0;
-                   nextTransferRxIdx++;
-                   if(nextTransferRxIdx == DPParams->numRxAntennas)
-                   {
-                       nextTransferRxIdx = 0;
-                       nextTransferRangeIdx++;
-                   }
+                    res->angleFftIn[virtAntIdx] = res->rangeBinDopplerFftBuf[virtAntIdx * DPParams->numDopplerBins + dopplerIdx];
                 }
-                
-                nextTransferIdx = (nextTransferTxIdx * DPParams->numRxAntennas * DPParams->numDopplerChirps + 
-                                   nextTransferRxIdx) * DPParams->numRangeBins + nextTransferRangeIdx;
-                
-                /*Last computation happens when nextTransferRangeIdx reaches (rangeIdx + 1) was we are processing
-                  only one range index. Therefore, do not trigger next EDMA.*/
-                if(nextTransferRangeIdx == rangeIdx)
-                {
-                    /* kick off next DMA */
-                    if (pingPongIdx == DPU_AOAPROCDSP_PONG_IDX)
-                    {
-                        channel = res->edmaPing.channel;
-                    }
-                    else
-                    {
-                        channel = res->edmaPong.channel;
-                    }
-                    
-                    EDMA_setSourceAddress(res->edmaHandle, channel,
-                                         (uint32_t) &radarCubeBase[nextTransferIdx]);
-                                         
-                    EDMA_startDmaTransfer(res->edmaHandle, channel);
-                }    
-                
-                inpDoppFftBuf = (cmplx16ImRe_t *) &res->pingPongBuf[pingPongIdx * DPParams->numDopplerChirps];
 
-                /* Remove static clutter? */
-                if (aoaDspObj->dynLocalCfg.staticClutterCfg.isEnabled)
+                numObjsOutLocal = AoAProcDSP_angleProcessing(aoaDspObj,
+                                                             objIdx,
+                                                             numObjsOutLocal);
+
+                if(numObjsOutLocal >= res->detObjOutMaxSize)
                 {
-                    AoAProcDSP_clutterRemoval(DPParams, inpDoppFftBuf);
+                    /*Stop processing CFAR list as the limit for number of detected objects was reached*/
+                    goto exit;
                 }
-                
-                /* The windowing output buffer is the input buffer for the Doppler FFT. 
-                   It needs to be padded with zeroes if number of Doppler chirps is less than 
-                   the number of Doppler bins.*/
-                if(DPParams->numDopplerBins > DPParams->numDopplerChirps)
+
+                idx++;
+                if (idx < numObjsIn)
                 {
-                    memset((void*)(&windowingBuf[DPParams->numDopplerChirps]), 0,
-                           (DPParams->numDopplerBins - DPParams->numDopplerChirps) * sizeof(cmplx32ReIm_t));
+                    objIdx = (order != NULL) ? order[idx] : idx;
                 }
+            } while ((idx < numObjsIn) && (res->cfarRngDopSnrList[objIdx].rangeIdx == rangeIdx));
+        }
+    }
+    else
+    {
+        /* Angle estimation for each object */
+        for (idx = 0; idx < numObjsIn; idx++)
+        {
+            rangeIdx   = res->cfarRngDopSnrList[idx].rangeIdx;
+            dopplerIdx = res->cfarRngDopSnrList[idx].dopplerIdx;
 
-                /*Up to this point samples are in ImRe format, which is the radar cube format.
-                  The windowing function will do IQ swap and the Doppler FFT is computed in
-                  ReIm format.*/                                
-                mmwavelib_windowing16x32_IQswap((int16_t *) inpDoppFftBuf,
-                                                res->windowCoeff,
-                                                (int32_t *) windowingBuf,
-                                                DPParams->numDopplerChirps); 
+            retVal = AoAProcDSP_dopplerFftRangeBin(aoaDspObj, rangeIdx, dopplerIdx, false, waitTime);
+            if (retVal != 0)
+            {
+                goto exit;
+            }
+            numFetches++;
 
-                /*From this point forward samples are in ReIm format. In particular, FFT, twiddle are all in ReIm format.*/                                
-        
-                /*DSPLIB notes for DSP_fft32x32():
-                  Minimum FFT size is 16. Size must be power of 2. 
-                  No scaling done in FFT computation.*/
-                DSP_fft32x32((int32_t *)res->twiddle32x32,
-                             DPParams->numDopplerBins,
-                             (int32_t *)windowingBuf,
-                             (int32_t *)twoDfftOut);
-                             
-                /* Save the 2D doppler FFT output for the required doppler bin */  
-                res->angleFftIn[txAntIdx * DPParams->numRxAntennas + rxAntIdx] = twoDfftOut[dopplerIdx];
-                        
-                pingPongIdx ^= 1;
-            }/*txAntIdx*/
-        } /* rxAntIdx */
-                
-        /* When BPM is enabled, order must be:
-           2D FFT -> Doppler compensation -> BPM decoding -> RX phase compensation */
-
-        /* Doppler compensation. */           
-        AoAProcDSP_dopplerCompensation(1,
-                                   &res->angleFftIn[0],
-                                   &res->cfarRngDopSnrList[idx],
-                                   &res->angleFftIn[0],
-                                   DPParams->numTxAntennas,
-                                   DPParams->numRxAntennas,
-                                   DPParams->numVirtualAntAzim,
-                                   DPParams->numVirtualAntElev,
-                                   DPParams->numDopplerBins);
-
-        /* BPM decoding*/
-        if(DPParams->isBpmEnabled)
-        {
-            AoAProcDSP_decodeBPM(&res->angleFftIn[0], DPParams->numRxAntennas);
-        }                       
-        
-        /* RX channel gain/phase offset compensation. */
-        AoAProcDSP_rxChanPhaseBiasCompensation(&aoaDspObj->dynLocalCfg.compRxChanCfg.rxChPhaseComp[0],
-                                               DPParams->numVirtualAntAzim + DPParams->numVirtualAntElev,
-                                               &res->angleFftIn[0],
-                                               &res->angleFftIn[0]);
-                
-        /* Save elevation symbols before doing Azimuth FFT */
-        if(DPParams->numVirtualAntElev > 0)
-        {
-            memcpy((void*)&elevationSymbols[0],
-                   (void*)&res->angleFftIn[DPParams->numVirtualAntAzim],
-                   DPParams->numVirtualAntElev * sizeof(cmplx32ReIm_t));
-        }    
-        
-        /* Zero padding */
-        memset((void *) &res->angleFftIn[DPParams->numVirtualAntAzim], 0,
-               (DPU_AOAPROCDSP_NUM_ANGLE_BINS - DPParams->numVirtualAntAzim) * sizeof(cmplx32ReIm_t));
-               
-        /* 3D-FFT (Azimuth FFT) */
-        DSP_fft32x32((int32_t *)res->angleTwiddle32x32,
-                     DPU_AOAPROCDSP_NUM_ANGLE_BINS,
-                     (int32_t *) &res->angleFftIn[0],
-                     (int32_t *) &azimuthFftOut[0]);
-        
-        /* Perform 3D elevation FFT if elevation virtual antennas are present*/
-        if(DPParams->numVirtualAntElev > 0)
-        {
-            /* Restore elevation symbols to FFT input buffer */
-            memcpy((void*)&res->angleFftIn[0],
-                   (void*)&elevationSymbols[0],
-                   DPParams->numVirtualAntElev * sizeof(cmplx32ReIm_t));
-                   
-            /* Zero padding */
-            memset((void *) &res->angleFftIn[DPParams->numVirtualAntElev], 0,
-                   (DPU_AOAPROCDSP_NUM_ANGLE_BINS - DPParams->numVirtualAntElev) * sizeof(cmplx32ReIm_t));
-
-            /* 3D-FFT (Elevation FFT) */
-            DSP_fft32x32((int32_t *)res->angleTwiddle32x32,
-                         DPU_AOAPROCDSP_NUM_ANGLE_BINS,
-                         (int32_t *) &res->angleFftIn[0],
-                         (int32_t *) &res->elevationFftOut[0]);
-        }    
-
-        /* Angle estimation*/
-        numObjsOutLocal = AoAProcDSP_angleEstimationAzimElev(aoaDspObj,
-                                                             idx,
-                                                             numObjsOutLocal);
-        
-        if(numObjsOutLocal >= res->detObjOutMaxSize)
-        {
-            /*Stop processing CFAR list as the limit for number of detected objects was reached*/
-            goto exit;
-        }
-        
-    }/* for (idx = 0; idx < numObjsIn; idx++) */
+            numObjsOutLocal = AoAProcDSP_angleProcessing(aoaDspObj,
+                                                         idx,
+                                                         numObjsOutLocal);
+
+            if(numObjsOutLocal >= res->detObjOutMaxSize)
+            {
+                /*Stop processing CFAR list as the limit for number of detected objects was reached*/
+                goto exit;
+            }
+        }/* for (idx = 0; idx < numObjsIn; idx++) */
+    }
 
 exit:
     *numObjsOut = numObjsOutLocal;
+    *numRangeBinFetches = numFetches;
     return retVal;
 }
 
@@ -1361,8 +2705,21 @@ int32_t DPU_AoAProcDSP_config
         goto exit;
     }
 
-    /* Check if number of doppler chirps is a multiple of 4. Limitation of mmwavelib */
-    if((aoaDspCfg->staticCfg.numDopplerChirps & 3) != 0)
+    /* Check if number of angle bins is a power of 2 within the supported range and
+       large enough to hold the azimuth and elevation virtual antennas */
+    if((aoaDspCfg->staticCfg.numAngleBins < DPU_AOAPROCDSP_MIN_NUM_ANGLE_BINS) ||
+       (aoaDspCfg->staticCfg.numAngleBins > DPU_AOAPROCDSP_MAX_NUM_ANGLE_BINS) ||
+       ((aoaDspCfg->staticCfg.numAngleBins & (aoaDspCfg->staticCfg.numAngleBins - 1U)) != 0) ||
+       (aoaDspCfg->staticCfg.numAngleBins < aoaDspCfg->staticCfg.numVirtualAntAzim) ||
+       (aoaDspCfg->staticCfg.numAngleBins < aoaDspCfg->staticCfg.numVirtualAntElev))
+    {
+        retVal = DPU_AOAPROCDSP_ENUMANGLEBINS;
+        goto exit;
+    }
+
+    /* Check if number of doppler chirps is a multiple of 2 (symmetric window and
+       8 byte aligned pong buffer) */
+    if((aoaDspCfg->staticCfg.numDopplerChirps & 1) != 0)
     {
         retVal = DPU_AOAPROCDSP_ENUMDOPCHIRPS;
         goto exit;
@@ -1396,6 +2753,19 @@ int32_t DPU_AoAProcDSP_config
         retVal= DPU_AOAPROCDSP_EINVAL;
         goto exit;
     }
+
+    if ((aoaDspCfg->res.detObjOutCompactHeader != NULL) && (aoaDspCfg->res.detObjOutCompact == NULL))
+    {
+        retVal= DPU_AOAPROCDSP_EINVAL;
+        goto exit;
+    }
+
+    if (MEM_IS_NOT_ALIGN(aoaDspCfg->res.detObjOutCompact,
+                        DPU_AOAPROCDSP_POINT_CLOUD_COMPACT_BYTE_ALIGNMENT))
+    {
+        retVal = DPU_AOAPROCDSP_ENOMEMALIGN_BUFF;
+        goto exit;
+    }
     
     if (MEM_IS_NOT_ALIGN(aoaDspCfg->res.cfarRngDopSnrList,
                         DPU_AOAPROCDSP_CFAR_DET_LIST_BYTE_ALIGNMENT))
@@ -1428,7 +2798,8 @@ int32_t DPU_AoAProcDSP_config
         MEM_IS_NOT_ALIGN(aoaDspCfg->res.angleFftIn,           DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT) ||
         MEM_IS_NOT_ALIGN(aoaDspCfg->res.elevationFftOut,      DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT) ||
         MEM_IS_NOT_ALIGN(aoaDspCfg->res.scratch1Buff,         DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT) ||
-        MEM_IS_NOT_ALIGN(aoaDspCfg->res.scratch2Buff,         DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT))
+        MEM_IS_NOT_ALIGN(aoaDspCfg->res.scratch2Buff,         DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT) ||
+        MEM_IS_NOT_ALIGN(aoaDspCfg->res.rangeBinDopplerFftBuf, DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT))
     {
         retVal = DPU_AOAPROCDSP_ENOMEMALIGN_BUFF;
         goto exit;
@@ -1437,17 +2808,30 @@ int32_t DPU_AoAProcDSP_config
     /* check sizes for the scratch buffers provided by application */
     if((aoaDspCfg->res.windowSize          < (sizeof(int32_t) * aoaDspCfg->staticCfg.numDopplerChirps) / 2) ||
        (aoaDspCfg->res.pingPongSize        < 2 * sizeof(cmplx16ImRe_t) * aoaDspCfg->staticCfg.numDopplerChirps) ||
-       (aoaDspCfg->res.angleTwiddleSize    < sizeof(cmplx32ReIm_t) * DPU_AOAPROCDSP_NUM_ANGLE_BINS) ||
+       (aoaDspCfg->res.angleTwiddleSize    < sizeof(cmplx32ReIm_t) * aoaDspCfg->staticCfg.numAngleBins) ||
        (aoaDspCfg->res.twiddleSize         < sizeof(cmplx32ReIm_t) * aoaDspCfg->staticCfg.numDopplerBins) ||
-       (aoaDspCfg->res.angleFftInSize      < sizeof(cmplx32ReIm_t) * DPU_AOAPROCDSP_NUM_ANGLE_BINS) ||
-       (aoaDspCfg->res.elevationFftOutSize < sizeof(cmplx32ReIm_t) * DPU_AOAPROCDSP_NUM_ANGLE_BINS) ||
+       (aoaDspCfg->res.angleFftInSize      < sizeof(cmplx32ReIm_t) * aoaDspCfg->staticCfg.numAngleBins) ||
+       (aoaDspCfg->res.elevationFftOutSize < sizeof(cmplx32ReIm_t) * aoaDspCfg->staticCfg.numAngleBins) ||
        (aoaDspCfg->res.scratch1Size        < MAX(sizeof(cmplx32ReIm_t) * aoaDspCfg->staticCfg.numDopplerBins,
-                                                     sizeof(cmplx32ReIm_t) * DPU_AOAPROCDSP_NUM_ANGLE_BINS)) ||
+                                                     sizeof(cmplx32ReIm_t) * aoaDspCfg->staticCfg.numAngleBins)) ||
        (aoaDspCfg->res.scratch2Size        < MAX(sizeof(cmplx32ReIm_t) * aoaDspCfg->staticCfg.numDopplerBins,
-                                                     sizeof(float) * DPU_AOAPROCDSP_NUM_ANGLE_BINS)))
+                                                     sizeof(float) * aoaDspCfg->staticCfg.numAngleBins)))
+    {
+            retVal = DPU_AOAPROCDSP_ESCRATCHSIZE;
+            goto exit;
+    }
+
+    /* check sizes of the optional range bin grouping buffers */
+    if ((aoaDspCfg->res.rangeBinDopplerFftBuf != NULL) && (aoaDspCfg->res.detObjRangeBinOrder != NULL))
     {
+        if ((aoaDspCfg->res.rangeBinDopplerFftBufSize < sizeof(cmplx32ReIm_t) * aoaDspCfg->staticCfg.numTxAntennas *
+                                                        aoaDspCfg->staticCfg.numRxAntennas * aoaDspCfg->staticCfg.numDopplerBins) ||
+            (aoaDspCfg->res.detObjRangeBinOrderSize < aoaDspCfg->staticCfg.numRangeBins + 1U +
+                                                      aoaDspCfg->res.cfarRngDopSnrListSize))
+        {
             retVal = DPU_AOAPROCDSP_ESCRATCHSIZE;
             goto exit;
+        }
     }
 
     /* Check Heatmap configuration */
@@ -1467,13 +2851,77 @@ int32_t DPU_AoAProcDSP_config
         goto exit;
     }
     
+    if (aoaDspCfg->dynCfg.multiObjBeamFormingCfg->maxNumPeaks > DPU_AOAPROC_MAX_NUM_PEAKS)
+    {
+        retVal = DPU_AOAPROCDSP_EMULTIPEAKCFG;
+        goto exit;
+    }
+
+    retVal = AoAProcDSP_validateHeatMapUpdateCfg(&aoaDspCfg->dynCfg.heatMapUpdateCfg,
+                                                 &aoaDspCfg->res,
+                                                 aoaDspCfg->staticCfg.numRangeBins);
+    if (retVal != 0)
+    {
+        goto exit;
+    }
+
+    /* Check Capon heat map configuration and buffers */
+    if (aoaDspCfg->staticCfg.caponCfg.enabled)
+    {
+        if ((aoaDspCfg->staticCfg.numVirtualAntAzim < 2) ||
+            (aoaDspCfg->staticCfg.numVirtualAntAzim > DPU_AOAPROCDSP_CAPON_MAX_NUM_ANT) ||
+            (aoaDspCfg->staticCfg.caponCfg.numAngleBins < 2) ||
+            (aoaDspCfg->staticCfg.caponCfg.numAngleBins > DPU_AOAPROCDSP_MAX_NUM_ANGLE_BINS) ||
+            !(aoaDspCfg->staticCfg.caponCfg.diagLoading >= 0.f))
+        {
+            retVal = DPU_AOAPROCDSP_ECAPONCFG;
+            goto exit;
+        }
+
+        if (!aoaDspCfg->res.caponSnapshotBuf ||
+            !aoaDspCfg->res.caponSteeringVec ||
+            !aoaDspCfg->res.caponHeatMap ||
+            (aoaDspCfg->res.caponSnapshotBufSize < sizeof(cmplx16ImRe_t) * aoaDspCfg->staticCfg.numVirtualAntAzim *
+                                                   aoaDspCfg->staticCfg.numDopplerChirps) ||
+            (aoaDspCfg->res.caponSteeringVecSize < 2 * sizeof(float) * aoaDspCfg->staticCfg.numVirtualAntAzim *
+                                                   aoaDspCfg->staticCfg.caponCfg.numAngleBins) ||
+            (aoaDspCfg->res.caponHeatMapSize < (uint32_t)aoaDspCfg->staticCfg.numRangeBins *
+                                               aoaDspCfg->staticCfg.caponCfg.numAngleBins))
+        {
+            retVal = DPU_AOAPROCDSP_ENOMEM__CAPON;
+            goto exit;
+        }
+
+        if (MEM_IS_NOT_ALIGN(aoaDspCfg->res.caponSnapshotBuf, DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT) ||
+            MEM_IS_NOT_ALIGN(aoaDspCfg->res.caponSteeringVec, DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT) ||
+            MEM_IS_NOT_ALIGN(aoaDspCfg->res.caponHeatMap,     DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT))
+        {
+            retVal = DPU_AOAPROCDSP_ENOMEMALIGN_BUFF;
+            goto exit;
+        }
+    }
+
+    /* Check antenna geometry and build the antenna map of the 2D angle FFT */
+    retVal = AoAProcDSP_configAntGeometry(aoaDspCfg, &aoaDspObj->antMapIdx[0]);
+    if (retVal != 0)
+    {
+        goto exit;
+    }
+
     aoaDspObj->res = aoaDspCfg->res;
     aoaDspObj->params = aoaDspCfg->staticCfg;
+    DPU_StaticClutterProc_kernelInit(&aoaDspObj->clutterKernelCfg, aoaDspCfg->staticCfg.numDopplerChirps);
 
     aoaDspObj->dynLocalCfg.compRxChanCfg  = *aoaDspCfg->dynCfg.compRxChanCfg;
     aoaDspObj->dynLocalCfg.multiObjBeamFormingCfg = *aoaDspCfg->dynCfg.multiObjBeamFormingCfg;
     aoaDspObj->dynLocalCfg.prepareRangeAzimuthHeatMap  = aoaDspCfg->dynCfg.prepareRangeAzimuthHeatMap;
     aoaDspObj->dynLocalCfg.staticClutterCfg = aoaDspCfg->dynCfg.staticClutterCfg;
+    aoaDspObj->dynLocalCfg.angleInterpCfg = aoaDspCfg->dynCfg.angleInterpCfg;
+    aoaDspObj->dynLocalCfg.extMaxVelCfg = *aoaDspCfg->dynCfg.extMaxVelCfg;
+    aoaDspObj->dynLocalCfg.heatMapUpdateCfg = aoaDspCfg->dynCfg.heatMapUpdateCfg;
+    aoaDspObj->heatMapValid = false;
+    aoaDspObj->skipHeatMapRefresh = false;
+    aoaDspObj->heatMapRangePhase = 0;
     AoAProcDSP_ConvertFov(aoaDspObj, aoaDspCfg->dynCfg.fovAoaCfg);
     
     /* Generate twiddle tables */
@@ -1504,6 +2952,9 @@ uint32_t DPU_AoAProcDSP_process
     uint16_t            idx;
     float               range;
     uint32_t            numObjsOut = 0;
+    uint32_t            numRangeBinFetches = 0;
+    uint32_t            numHeatMapRangeBins = 0;
+    bool                skipHeatMapRefresh;
 
     AOADspObj *aoaDspObj;
     DPU_AoAProcDSP_HW_Resources *res;
@@ -1518,11 +2969,22 @@ uint32_t DPU_AoAProcDSP_process
     res = &aoaDspObj->res;
     DPParams = &aoaDspObj->params;
 
+    /* The skip request applies to this frame only */
+    skipHeatMapRefresh = aoaDspObj->skipHeatMapRefresh;
+    aoaDspObj->skipHeatMapRefresh = false;
+
     startTime = Cycleprofiler_getTimeStamp();
 
+    if (res->detObjOutCompactHeader != NULL)
+    {
+        AoAProcDSP_compactHeaderInit(aoaDspObj);
+    }
+
     if (numObjsIn == 0U)
     {
         outParams->numAoADetectedPoints = numObjsIn;
+        outParams->numRangeBinFetches = 0;
+        outParams->numHeatMapRangeBins = 0;
         outParams->stats.waitTime = 0;
         outParams->stats.processingTime = 0;
         retVal = 0;
@@ -1530,10 +2992,12 @@ uint32_t DPU_AoAProcDSP_process
     }
 
     /* Azimuth heap map */
-    if ((aoaDspObj->dynLocalCfg.prepareRangeAzimuthHeatMap) && (DPParams->numVirtualAntAzim > 1))
+    if ((aoaDspObj->dynLocalCfg.prepareRangeAzimuthHeatMap) && (DPParams->numVirtualAntAzim > 1) &&
+        (skipHeatMapRefresh == false))
     {
         retVal = AoAProcDSP_RangeAzimuthHeatmap(aoaDspObj,
-                                                &waitTime);
+                                                &waitTime,
+                                                &numHeatMapRangeBins);
         if (retVal != 0)
         {
             goto exit;
@@ -1565,19 +3029,27 @@ uint32_t DPU_AoAProcDSP_process
                                        DPParams->numDopplerBins);
             res->detObjOutSideInfo[idx].snr = res->cfarRngDopSnrList[idx].snr;
             res->detObjOutSideInfo[idx].noise = res->cfarRngDopSnrList[idx].noise;
+            AoAProcDSP_compactPointOutput(aoaDspObj, idx);
         }
         numObjsOut = numObjsIn;
     }
     else
     {
-        retVal = AoAProcDSP_processMultipleVirtualAntennas(aoaDspObj, numObjsIn, &numObjsOut, &waitTime);        
+        retVal = AoAProcDSP_processMultipleVirtualAntennas(aoaDspObj, numObjsIn, &numObjsOut, &numRangeBinFetches, &waitTime);
         if (retVal != 0)
         {
             goto exit;
         }
     }
 
+    if (res->detObjOutCompactHeader != NULL)
+    {
+        res->detObjOutCompactHeader->numPoints = (uint16_t)numObjsOut;
+    }
+
     outParams->numAoADetectedPoints = numObjsOut;
+    outParams->numRangeBinFetches = numRangeBinFetches;
+    outParams->numHeatMapRangeBins = numHeatMapRangeBins;
     outParams->stats.waitTime = waitTime;
     outParams->stats.processingTime = Cycleprofiler_getTimeStamp() - startTime - waitTime;
 
@@ -1627,6 +3099,11 @@ int32_t DPU_AoAProcDSP_control
                retVal = DPU_AOAPROCDSP_EINVAL;
                goto exit;
            }
+           else if (((DPU_AoAProc_MultiObjBeamFormingCfg *)arg)->maxNumPeaks > DPU_AOAPROC_MAX_NUM_PEAKS)
+           {
+               retVal = DPU_AOAPROCDSP_EMULTIPEAKCFG;
+               goto exit;
+           }
            else
            {
                /* Save configuration */
@@ -1670,6 +3147,9 @@ int32_t DPU_AoAProcDSP_control
 
                 /* Save configuration */
                 memcpy((void *)&aoaDspObj->dynLocalCfg.prepareRangeAzimuthHeatMap, arg, argSize);
+
+                /* Range bins were not refreshed while disabled */
+                aoaDspObj->heatMapValid = false;
            }
        }
        break;
@@ -1689,6 +3169,126 @@ int32_t DPU_AoAProcDSP_control
            }
        }
        break;
+
+       case DPU_AoAProcDSP_Cmd_AngleInterpCfg:
+       {
+           if((argSize != sizeof(DPU_AoAProc_AngleInterpCfg)) ||
+              (arg == NULL))
+           {
+               retVal = DPU_AOAPROCDSP_EINVAL;
+               goto exit;
+           }
+           else
+           {
+               /* Save configuration */
+               memcpy((void *)&aoaDspObj->dynLocalCfg.angleInterpCfg, (void *)arg, argSize);
+           }
+       }
+       break;
+       case DPU_AoAProcDSP_Cmd_ExtMaxVelocityCfg:
+       {
+           if((argSize != sizeof(DPU_AoAProc_ExtendedMaxVelocityCfg)) ||
+              (arg == NULL))
+           {
+               retVal = DPU_AOAPROCDSP_EINVAL;
+               goto exit;
+           }
+           else
+           {
+               /* Save configuration */
+               memcpy((void *)&aoaDspObj->dynLocalCfg.extMaxVelCfg, (void *)arg, argSize);
+           }
+       }
+       break;
+       case DPU_AoAProcDSP_Cmd_HeatMapUpdateCfg:
+       {
+           if((argSize != sizeof(DPU_AoAProc_HeatMapUpdateCfg)) ||
+              (arg == NULL))
+           {
+               retVal = DPU_AOAPROCDSP_EINVAL;
+               goto exit;
+           }
+
+           retVal = AoAProcDSP_validateHeatMapUpdateCfg((DPU_AoAProc_HeatMapUpdateCfg *)arg,
+                                                        &aoaDspObj->res,
+                                                        aoaDspObj->params.numRangeBins);
+           if (retVal != 0)
+           {
+               goto exit;
+           }
+
+           /* Save configuration and refresh all range bins in the next frame */
+           memcpy((void *)&aoaDspObj->dynLocalCfg.heatMapUpdateCfg, (void *)arg, argSize);
+           aoaDspObj->heatMapValid = false;
+           aoaDspObj->heatMapRangePhase = 0;
+       }
+       break;
+       case DPU_AoAProcDSP_Cmd_SkipHeatMapRefresh:
+       {
+           if((argSize != sizeof(bool)) ||
+              (arg == NULL))
+           {
+               retVal = DPU_AOAPROCDSP_EINVAL;
+               goto exit;
+           }
+
+           /* Cleared by the next process call, the heat map stays valid */
+           memcpy((void *)&aoaDspObj->skipHeatMapRefresh, arg, argSize);
+       }
+       break;
+       case DPU_AoAProcDSP_Cmd_RadarCubeCfg:
+       {
+           DPIF_RadarCube *radarCube = (DPIF_RadarCube *)arg;
+
+           if((argSize != sizeof(DPIF_RadarCube)) ||
+              (radarCube == NULL) ||
+              (radarCube->data == NULL) ||
+              (radarCube->dataSize != aoaDspObj->res.radarCube.dataSize))
+           {
+               retVal = DPU_AOAPROCDSP_EINVAL;
+               goto exit;
+           }
+           if (radarCube->datafmt != DPIF_RADARCUBE_FORMAT_1)
+           {
+               retVal = DPU_AOAPROCDSP_EINVAL__RADARCUBE_DATAFORMAT;
+               goto exit;
+           }
+
+           /* EDMA source addresses are set from the radar cube base for every transfer.
+              The heat map is kept, its range bins are refreshed from the new cube. */
+           aoaDspObj->res.radarCube = *radarCube;
+       }
+       break;
+
+       case DPU_AoAProcDSP_Cmd_PointCloudOutCfg:
+       {
+           DPU_AoAProcDSP_PointCloudOutCfg *outCfg = (DPU_AoAProcDSP_PointCloudOutCfg *)arg;
+
+           if((argSize != sizeof(DPU_AoAProcDSP_PointCloudOutCfg)) ||
+              (outCfg == NULL) ||
+              (outCfg->detObjOut == NULL) ||
+              (outCfg->detObjOutSideInfo == NULL))
+           {
+               retVal = DPU_AOAPROCDSP_EINVAL;
+               goto exit;
+           }
+           if (MEM_IS_NOT_ALIGN(outCfg->detObjOut,
+                               DPU_AOAPROCDSP_POINT_CLOUD_CARTESIAN_BYTE_ALIGNMENT))
+           {
+               retVal = DPU_AOAPROCDSP_ENOMEMALIGN_POINT_CLOUD_CARTESIAN;
+               goto exit;
+           }
+           if (MEM_IS_NOT_ALIGN(outCfg->detObjOutSideInfo,
+                               DPU_AOAPROCDSP_POINT_CLOUD_SIDE_INFO_BYTE_ALIGNMENT))
+           {
+               retVal = DPU_AOAPROCDSP_ENOMEMALIGN_POINT_CLOUD_SIDE_INFO;
+               goto exit;
+           }
+
+           aoaDspObj->res.detObjOut = outCfg->detObjOut;
+           aoaDspObj->res.detObjOutSideInfo = outCfg->detObjOutSideInfo;
+       }
+       break;
        
        default:
            retVal = DPU_AOAPROCDSP_EINVAL;
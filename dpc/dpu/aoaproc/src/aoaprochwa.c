@@ -1449,6 +1449,55 @@ int32_t AoAProcHWA_dataPathWait2DFFTDetObj(SemaphoreP_Handle semaHandle)
     return((int32_t) SemaphoreP_pend(semaHandle, SemaphoreP_WAIT_FOREVER));
 }
 
+/**
+ *  @b Description
+ *  @n
+ *      Estimates the sub-bin offset of an azimuth FFT peak by fitting a parabola
+ *      through the magnitudes of the peak bin and its two (cyclic) neighbours.
+ *
+ *  @param[in] azimuthMag   Magnitude of the azimuth FFT output
+ *
+ *  @param[in] peakIdx      Index of the peak bin
+ *
+ *  @param[in] numAngleBins Number of angle FFT bins (power of 2)
+ *
+ *  @retval Offset of the interpolated peak from peakIdx, in bins within [-0.5, 0.5]
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ */
+static inline float AoAProcHWA_interpolatePeak
+(
+    uint16_t    *azimuthMag,
+    uint32_t    peakIdx,
+    uint32_t    numAngleBins
+)
+{
+    float magLeft, magPeak, magRight;
+    float denom;
+    float delta = 0.f;
+
+    magLeft  = (float) azimuthMag[(peakIdx - 1U) & (numAngleBins - 1U)];
+    magPeak  = (float) azimuthMag[peakIdx];
+    magRight = (float) azimuthMag[(peakIdx + 1U) & (numAngleBins - 1U)];
+
+    denom = magLeft - 2.f * magPeak + magRight;
+    if (denom < 0.f)
+    {
+        delta = 0.5f * (magLeft - magRight) / denom;
+        if (delta > 0.5f)
+        {
+            delta = 0.5f;
+        }
+        else if (delta < -0.5f)
+        {
+            delta = -0.5f;
+        }
+    }
+
+    return delta;
+}
+
 /**
  *  @b Description
  *  @n
@@ -1492,7 +1541,7 @@ uint32_t AoAProcHWA_XYZestimation
 {
     int32_t         sMaxIdx;
     float           temp;
-    float           Wx, Wz;
+    float           Wx, WxBin, Wz;
     float           range;
     float           limitScale;
     float           x, y, z;
@@ -1540,7 +1589,15 @@ uint32_t AoAProcHWA_XYZestimation
         sMaxIdx = maxIdx;
     }
 
-    Wx = 2 * (float) sMaxIdx / numAngleBins;
+    WxBin = 2 * (float) sMaxIdx / numAngleBins;
+    Wx = WxBin;
+
+    /* Sub-bin azimuth interpolation */
+    if (aoaHwaObj->dynLocalCfg.angleInterpCfg.enabled)
+    {
+        Wx += 2 * AoAProcHWA_interpolatePeak(&aoaHwaObj->azimuthFftOutMagBuf[pingPongIdx][hypothesisIdx * numAngleBins],
+                                             maxIdx, numAngleBins) / numAngleBins;
+    }
     /* Check if it is within configured field of view */
 
     x = range * Wx;
@@ -1552,8 +1609,11 @@ uint32_t AoAProcHWA_XYZestimation
         peakElevIm = (float) azimFFTPtr[maxIdx + numHypotheses*numAngleBins].imag;
         peakElevRe = (float) azimFFTPtr[maxIdx + numHypotheses*numAngleBins].real;
 
+        /* Both FFT outputs are taken at the peak bin, their sub-bin phase terms cancel and the
+         * phase difference is referenced to the bin centre: use WxBin, the interpolated Wx
+         * would bias Wz by 2 * (Wx - WxBin) */
         Wz = atan2(peakAzimIm * peakElevRe - peakAzimRe * peakElevIm,
-                   peakAzimRe * peakElevRe + peakAzimIm * peakElevIm)/PI_ + (2 * Wx);
+                   peakAzimRe * peakElevRe + peakAzimIm * peakElevIm)/PI_ + (2 * WxBin);
 
         if (Wz > 1)
         {
@@ -1765,6 +1825,95 @@ static void aoaHwa_dopplerCompensation
     }
 }
 
+/**
+ *  @b  Description
+ *  @n
+ *      Function finds the additional azimuth peaks for multi object beam forming.
+ *      Local maxima above the threshold are first collected over the angle spectrum
+ *      in a branch free loop, then the strongest ones are kept with a partial
+ *      insertion sort.
+ *
+ *  @param[in]  azimuthMag      Azimuth FFT output magnitude, numAngleBins samples
+ *  @param[in]  numAngleBins    Azimuth FFT size
+ *  @param[in]  maxIdx          Index of the strongest peak, excluded from the search
+ *  @param[in]  threshold       Minimum magnitude of a reported peak
+ *  @param[in]  maxNumPeaks     Maximum number of additional peaks to report
+ *  @param[out] peakIdxList     Indices of the additional peaks, in decreasing magnitude
+ *
+ *  @retval     Number of additional peaks found
+ *
+ *  \ingroup    DPU_AOAPROC_INTERNAL_FUNCTION
+ *
+ */
+static uint32_t AoAProcHWA_multiPeakSearch
+(
+    const uint16_t *azimuthMag,
+    uint32_t        numAngleBins,
+    uint32_t        maxIdx,
+    uint32_t        threshold,
+    uint32_t        maxNumPeaks,
+    uint16_t        *peakIdxList
+)
+{
+    uint16_t candIdxList[DPU_AOAPROCHWA_NUM_ANGLE_BINS / 2U + 2U];
+    uint32_t numCand, numPeaks;
+    uint32_t i, j, idx;
+    uint32_t isPeak;
+    uint32_t val;
+
+    if (maxNumPeaks == 0)
+    {
+        return 0;
+    }
+
+    /* Circular neighbours of the first bin */
+    val = azimuthMag[0];
+    isPeak = (val > azimuthMag[numAngleBins - 1]) & (val >= azimuthMag[1]) & (val > threshold);
+    candIdxList[0] = 0;
+    numCand = isPeak;
+
+    /* Local maxima of the inner bins, the list only advances on a peak */
+    for (i = 1; i < numAngleBins - 1; i++)
+    {
+        val = azimuthMag[i];
+        isPeak = (val > azimuthMag[i - 1]) & (val >= azimuthMag[i + 1]) & (val > threshold);
+        candIdxList[numCand] = (uint16_t) i;
+        numCand += isPeak;
+    }
+
+    /* Circular neighbours of the last bin */
+    val = azimuthMag[numAngleBins - 1];
+    isPeak = (val > azimuthMag[numAngleBins - 2]) & (val >= azimuthMag[0]) & (val > threshold);
+    candIdxList[numCand] = (uint16_t) (numAngleBins - 1);
+    numCand += isPeak;
+
+    /* Keep the strongest maxNumPeaks candidates, sorted by decreasing magnitude */
+    numPeaks = 0;
+    for (i = 0; i < numCand; i++)
+    {
+        idx = candIdxList[i];
+        if (idx == maxIdx)
+        {
+            continue;
+        }
+        val = azimuthMag[idx];
+        if ((numPeaks == maxNumPeaks) && (val <= azimuthMag[peakIdxList[numPeaks - 1]]))
+        {
+            continue;
+        }
+        if (numPeaks < maxNumPeaks)
+        {
+            numPeaks++;
+        }
+        for (j = numPeaks - 1; (j > 0) && (val > azimuthMag[peakIdxList[j - 1]]); j--)
+        {
+            peakIdxList[j] = peakIdxList[j - 1];
+        }
+        peakIdxList[j] = (uint16_t) idx;
+    }
+
+    return numPeaks;
+}
 
 /**
  *  @b  Description
@@ -1866,61 +2015,26 @@ static uint32_t AoAProcHWA_angleEstimationAzimElev
     /* Multi peak azimuzth search?*/
     if (aoaHwaObj->dynLocalCfg.multiObjBeamFormingCfg.enabled)
     {
-        uint32_t leftSearchIdx;
-        uint32_t rightSearchIdx;
-        uint32_t secondSearchLen;
-        uint32_t iModAzimLen;
-        uint32_t maxVal2;
-        int32_t k;
-        uint32_t t;
-        uint16_t azimIdx = maxIdx;
-        uint16_t* azimuthMag = &azimFFTAbsPtr[hypothesisMaxIdx * numAngleBins];
-
-        /* Find right edge of the first peak */
-        t = azimIdx;
-        leftSearchIdx = (t + 1) & (numAngleBins-1);
-        k = numAngleBins;
-        while ((azimuthMag[t] >= azimuthMag[leftSearchIdx]) && (k > 0))
-        {
-            t = (t + 1) & (numAngleBins-1);
-            leftSearchIdx = (leftSearchIdx + 1) & (numAngleBins-1);
-            k--;
-        }
+        DPU_AoAProc_MultiObjBeamFormingCfg *bfCfg = &aoaHwaObj->dynLocalCfg.multiObjBeamFormingCfg;
+        uint16_t peakIdxList[DPU_AOAPROC_MAX_NUM_PEAKS];
+        uint32_t numPeaks, peakIdx;
+        uint32_t maxNumPeaks = (bfCfg->maxNumPeaks == 0) ? 2U : bfCfg->maxNumPeaks;
 
-        /* Find left edge of the first peak */
-        t = azimIdx;
-        rightSearchIdx = (t - 1) & (numAngleBins-1);
-        k = numAngleBins;
-        while ((azimuthMag[t] >= azimuthMag[rightSearchIdx]) && (k > 0))
-        {
-            t = (t - 1) & (numAngleBins-1);
-            rightSearchIdx = (rightSearchIdx - 1) & (numAngleBins-1);
-            k--;
-        }
+        numPeaks = AoAProcHWA_multiPeakSearch(&azimFFTAbsPtr[hypothesisMaxIdx * numAngleBins],
+                                              numAngleBins,
+                                              maxIdx,
+                                              (uint32_t)(maxVal * bfCfg->multiPeakThrsScal),
+                                              maxNumPeaks - 1,
+                                              peakIdxList);
 
-        secondSearchLen = ((rightSearchIdx - leftSearchIdx) & (numAngleBins-1)) + 1;
-        /* Find second peak */
-        maxVal2 = azimuthMag[leftSearchIdx];
-        azimIdx = leftSearchIdx;
-        for (t = leftSearchIdx; t < (leftSearchIdx + secondSearchLen); t++)
-        {
-            iModAzimLen = t & (numAngleBins-1);
-            if (azimuthMag[iModAzimLen] > maxVal2)
-            {
-                azimIdx = iModAzimLen;
-                maxVal2 = azimuthMag[iModAzimLen];
-            }
-        }
-        /* Is second peak greater than threshold? */
-        if ( (maxVal2 >( ((uint32_t)(maxVal * aoaHwaObj->dynLocalCfg.multiObjBeamFormingCfg.multiPeakThrsScal)))) && (objOutIdx < maxNumObj) )
+        /* Estimate x,y,z for the additional peaks */
+        for (peakIdx = 0; (peakIdx < numPeaks) && (objOutIdx < maxNumObj); peakIdx++)
         {
-
-            /* Estimate x,y,z for second peak */
             objOutIdx = AoAProcHWA_XYZestimation(aoaHwaObj,
                                                  pingPongIdx,
                                                  objInIdx,
                                                  objOutIdx,
-                                                 azimIdx,
+                                                 peakIdxList[peakIdx],
                                                  dopplerSignIdx,
                                                  hypothesisMaxIdx);
         }
@@ -2344,6 +2458,12 @@ int32_t DPU_AoAProcHWA_config
         goto exit;
     }
 #endif
+    if (aoaHwaCfg->dynCfg.multiObjBeamFormingCfg->maxNumPeaks > DPU_AOAPROC_MAX_NUM_PEAKS)
+    {
+        retVal = DPU_AOAPROCHWA_EMULTIPEAKCFG;
+        goto exit;
+    }
+
     aoaHwaObj->res = aoaHwaCfg->res;
     aoaHwaObj->params = aoaHwaCfg->staticCfg;
 
@@ -2353,6 +2473,7 @@ int32_t DPU_AoAProcHWA_config
     AoAProcHWA_ConvertFov(aoaHwaObj, aoaHwaCfg->dynCfg.fovAoaCfg);
 
     aoaHwaObj->dynLocalCfg.extMaxVelCfg = *aoaHwaCfg->dynCfg.extMaxVelCfg;
+    aoaHwaObj->dynLocalCfg.angleInterpCfg = aoaHwaCfg->dynCfg.angleInterpCfg;
 
     /* Allocate buffers for ping and pong paths: */
     for (i = 0; i < DPU_AOAPROCHWA_NUM_LOCAL_SCRATCH_BUFFERS; i++)
@@ -2696,6 +2817,11 @@ int32_t DPU_AoAProcHWA_control
                retVal = DPU_AOAPROCHWA_EINVAL;
                goto exit;
            }
+           else if (((DPU_AoAProc_MultiObjBeamFormingCfg *)arg)->maxNumPeaks > DPU_AOAPROC_MAX_NUM_PEAKS)
+           {
+               retVal = DPU_AOAPROCHWA_EMULTIPEAKCFG;
+               goto exit;
+           }
            else
            {
                /* Save configuration */
@@ -2718,6 +2844,21 @@ int32_t DPU_AoAProcHWA_control
            }
        }
        break;
+       case DPU_AoAProcHWA_Cmd_AngleInterpCfg:
+       {
+           if((argSize != sizeof(DPU_AoAProc_AngleInterpCfg)) ||
+              (arg == NULL))
+           {
+               retVal = DPU_AOAPROCHWA_EINVAL;
+               goto exit;
+           }
+           else
+           {
+               /* Save configuration */
+               memcpy((void *)&aoaHwaObj->dynLocalCfg.angleInterpCfg, arg, argSize);
+           }
+       }
+       break;
        case DPU_AoAProcHWA_Cmd_CompRxChannelBiasCfg:
        {
            if((argSize != sizeof(DPU_AoAProc_compRxChannelBiasCfg)) ||
@@ -70,6 +70,16 @@
 #include <ti/utils/cycleprofiler/cycle_profiler.h> 
 #include <ti/datapath/dpc/dpu/aoaproc/aoaprocdsp.h>
 #include <ti/utils/mathutils/mathutils.h>
+
+/* C674x mathlib */
+/* Suppress the mathlib.h warnings
+ *  #48-D: incompatible redefinition of macro "TRUE"
+ *  #48-D: incompatible redefinition of macro "FALSE"
+ */
+#pragma diag_push
+#pragma diag_suppress 48
+#include <ti/mathlib/mathlib.h>
+#pragma diag_pop
 #include <ti/utils/randomdatagenerator/gen_rand_data.h>
 
 
@@ -109,6 +119,25 @@
 #define TEST_ANTENNA_LOOP 5   /* number of tx/rx combination */
 #define TEST_DOPPLER_BIN_SIZE 6 
 #define TEST_RANGE_BIN_SIZE 7   //tested range bin size from 16 to 512
+#define TEST_ANGLE_BIN_SIZE 4   //tested angle fft size from 32 to 256
+#define TEST_FAST_MATH_NUM_SAMPLES 1000
+#define TEST_MULTIPEAK_NUM_CASES 6
+#define MULTIPEAK_THRESHOLD 0.30f
+#define MAX_FAST_MATH_ERROR 1e-5f  //absolute error of atan2sp, sinsp, cossp against libm
+#define MAX_FAST_MATH_SQRT_REL_ERROR 1e-6f  //relative error of sqrtsp against libm
+#define TEST_CAPON_NUM_ANGLE_BINS 64
+#define TEST_CAPON_MAX_NUM_RANGE_BINS 64
+#define TEST_CAPON_DIAG_LOADING 0.01f
+#define TEST_HEATMAP_DECIMATION 4
+#define TEST_GEOMETRY_NUM_ELEV_BINS 16
+#define TEST_GEOMETRY_NUM_LAYOUTS 2
+#define TEST_GEOMETRY_MAX_NUM_ROWS 3
+#define TEST_HEATMAP_DETMATRIX_SIZE (64 * 64)
+#define TEST_HEATMAP_CHANGE_THRESHOLD 256   //1 in log2 magnitude, Q8
+#define TEST_ANGLE_INTERP_NUM_TARGETS 4
+#define TEST_ANGLE_INTERP_MAX_WZ_ERROR 0.005f  //sub-bin bias of 2 * (Wx - WxBin) is about 0.025
+#define TEST_GROUPING_NUM_DET 8             /* detections of the range bin grouping test */
+#define TEST_GROUPING_MAX_NUM_DOPPLER_BINS 64
 
 #define PI 3.141592653589793
 
@@ -137,6 +166,16 @@ DPIF_PointCloudCartesian aoaDetObj[TEST_MAX_NUM_CFARDETOBJ_DPU * 2];
 #pragma DATA_ALIGN(aoaDetObjSideInfo, DPU_AOAPROCDSP_POINT_CLOUD_SIDE_INFO_BYTE_ALIGNMENT);
 DPIF_PointCloudSideInfo aoaDetObjSideInfo[TEST_MAX_NUM_CFARDETOBJ_DPU * 2];
 
+/* AOA DPU compact point cloud output */
+#pragma DATA_SECTION(aoaDetObjCompactHeader, ".l2data");
+DPU_AoAProc_PointCloudCompactHeader aoaDetObjCompactHeader;
+
+#pragma DATA_SECTION(aoaDetObjCompact, ".l2data");
+#pragma DATA_ALIGN(aoaDetObjCompact, DPU_AOAPROCDSP_POINT_CLOUD_COMPACT_BYTE_ALIGNMENT);
+DPU_AoAProc_PointCloudCompact aoaDetObjCompact[TEST_MAX_NUM_CFARDETOBJ_DPU * 2];
+
+DPU_AoAProc_PointCloudDecoded aoaDetObjDecoded[TEST_MAX_NUM_CFARDETOBJ_DPU * 2];
+
 /* AOA DPU heat map outout */
 #if (defined (SOC_XWR18XX))
 #pragma DATA_SECTION(staticHeatmap, ".l3ram");
@@ -171,7 +210,7 @@ cmplx16ImRe_t aoapingPongBuf[TEST_MAX_NUM_DOPPLER_BINS * 2];
 
 #pragma DATA_SECTION(aoaangleTwiddle32x32, ".l2data");
 #pragma DATA_ALIGN(aoaangleTwiddle32x32, DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
-cmplx32ReIm_t aoaangleTwiddle32x32[DPU_AOAPROCDSP_NUM_ANGLE_BINS];
+cmplx32ReIm_t aoaangleTwiddle32x32[DPU_AOAPROCDSP_MAX_NUM_ANGLE_BINS];
 
 #pragma DATA_SECTION(aoatwiddle32x32, ".l2data");
 #pragma DATA_ALIGN(aoatwiddle32x32, DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
@@ -187,11 +226,52 @@ cmplx32ReIm_t aoascratch2Buff[TEST_MAX_NUM_DOPPLER_BINS];
 
 #pragma DATA_SECTION(aoaangleFftIn, ".l2data");
 #pragma DATA_ALIGN(aoaangleFftIn, DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
-cmplx32ReIm_t aoaangleFftIn[DPU_AOAPROCDSP_NUM_ANGLE_BINS];
+cmplx32ReIm_t aoaangleFftIn[DPU_AOAPROCDSP_MAX_NUM_ANGLE_BINS];
 
 #pragma DATA_SECTION(aoaelevationFftOut, ".l2data");
 #pragma DATA_ALIGN(aoaelevationFftOut, DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
-cmplx32ReIm_t aoaelevationFftOut[DPU_AOAPROCDSP_NUM_ANGLE_BINS];
+cmplx32ReIm_t aoaelevationFftOut[DPU_AOAPROCDSP_MAX_NUM_ANGLE_BINS];
+
+#pragma DATA_SECTION(aoaCaponSnapshotBuf, ".l2data");
+#pragma DATA_ALIGN(aoaCaponSnapshotBuf, DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
+cmplx16ImRe_t aoaCaponSnapshotBuf[DPU_AOAPROCDSP_CAPON_MAX_NUM_ANT * TEST_MAX_NUM_DOPPLER_BINS];
+
+#pragma DATA_SECTION(aoaCaponSteeringVec, ".l2data");
+#pragma DATA_ALIGN(aoaCaponSteeringVec, DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
+float aoaCaponSteeringVec[2 * DPU_AOAPROCDSP_CAPON_MAX_NUM_ANT * TEST_CAPON_NUM_ANGLE_BINS];
+
+#pragma DATA_SECTION(aoaCaponHeatMap, ".l3ram");
+#pragma DATA_ALIGN(aoaCaponHeatMap, DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
+float aoaCaponHeatMap[TEST_CAPON_MAX_NUM_RANGE_BINS * TEST_CAPON_NUM_ANGLE_BINS];
+
+#pragma DATA_SECTION(aoaAngle2DFftBuf, ".l2data");
+#pragma DATA_ALIGN(aoaAngle2DFftBuf, DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
+cmplx32ReIm_t aoaAngle2DFftBuf[2 * TEST_GEOMETRY_MAX_NUM_ROWS * TEST_AOA_FFTSIZE + 2 * TEST_GEOMETRY_NUM_ELEV_BINS];
+
+#pragma DATA_SECTION(aoaElevTwiddle32x32, ".l2data");
+#pragma DATA_ALIGN(aoaElevTwiddle32x32, DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
+cmplx32ReIm_t aoaElevTwiddle32x32[TEST_GEOMETRY_NUM_ELEV_BINS];
+
+#pragma DATA_SECTION(groupingDetObjList, ".l2data");
+#pragma DATA_ALIGN(groupingDetObjList, DPU_AOAPROCDSP_CFAR_DET_LIST_BYTE_ALIGNMENT);
+DPIF_CFARDetList groupingDetObjList[TEST_GROUPING_NUM_DET];
+
+#pragma DATA_SECTION(aoaRangeBinDopplerFftBuf, ".l2data");
+#pragma DATA_ALIGN(aoaRangeBinDopplerFftBuf, DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
+cmplx32ReIm_t aoaRangeBinDopplerFftBuf[TEST_MAX_NUMVIRTUALANTE * TEST_GROUPING_MAX_NUM_DOPPLER_BINS];
+
+#pragma DATA_SECTION(aoaDetObjRangeBinOrder, ".l2data");
+uint16_t aoaDetObjRangeBinOrder[TEST_MAX_NUM_RANGE_BIN_HEATMAP + 1 + TEST_GROUPING_NUM_DET];
+
+/* point cloud of the detection by detection run of the range bin grouping test */
+DPIF_PointCloudCartesian groupingDetObjRef[TEST_GROUPING_NUM_DET];
+uint8_t groupingAzimIdxRef[TEST_GROUPING_NUM_DET];
+
+#pragma DATA_SECTION(testDetMatrix, ".l3ram");
+uint16_t testDetMatrix[TEST_HEATMAP_DETMATRIX_SIZE];
+
+#pragma DATA_SECTION(testHeatMapRefEnergy, ".l2data");
+uint16_t testHeatMapRefEnergy[TEST_MAX_NUM_RANGE_BIN_HEATMAP];
 
 /* EDMA resource partitioning */
 #define EDMA_SHADOW_LNK_PARAM_BASE_ID                      EDMA_NUM_DMA_CHANNELS
@@ -257,11 +337,19 @@ DPU_AoAProcDSP_Handle        aoaProcHandle;
 DPU_AoAProc_FovAoaCfg        aoaDynFovCfg;
 DPU_AoAProc_compRxChannelBiasCfg aoaDynOutCompRxCfg;
 DPU_AoAProc_MultiObjBeamFormingCfg aoaDynBmCfg;
+DPU_AoAProc_ExtendedMaxVelocityCfg aoaDynExtMaxVelCfg;
 DPU_AoAProcDSP_OutParams outAoaProc;
 
 
 aoaProcDpuTestConfig_t    aoaTestCfg;
 uint32_t testCount;
+uint8_t multiPeakTestDone = 0;
+uint8_t extMaxVelTestDone = 0;  /* bit n set once tested with n Tx antennas */
+uint8_t caponTestDone = 0;
+uint8_t heatMapUpdateTestDone = 0;
+uint8_t antGeometryTestDone = 0;
+uint8_t rangeBinGroupingTestDone = 0;
+uint8_t angleInterpTestDone = 0;
  
 
 /**
@@ -420,6 +508,8 @@ void aoaProc_test_dpuConfig()
 
     /* aoa output buffer set*/
     aoaCfg.res.detObjOutSideInfo = aoaDetObjSideInfo;
+    aoaCfg.res.detObjOutCompactHeader = &aoaDetObjCompactHeader;
+    aoaCfg.res.detObjOutCompact = aoaDetObjCompact;
     aoaCfg.res.detObjOutMaxSize = TEST_MAX_NUM_CFARDETOBJ_DPU;
     aoaCfg.res.azimuthStaticHeatMap = staticHeatmap;
     aoaCfg.res.detObj2dAzimIdx = aoaDetObjAzimIdx;
@@ -437,12 +527,12 @@ void aoaProc_test_dpuConfig()
     /* sizes */
     aoaCfg.res.windowSize          = sizeof(int32_t) * TEST_MAX_NUM_DOPPLER_BINS;
     aoaCfg.res.pingPongSize        = 2 * sizeof(cmplx16ImRe_t) * TEST_MAX_NUM_DOPPLER_BINS;
-    aoaCfg.res.angleTwiddleSize    = sizeof(cmplx32ReIm_t) * DPU_AOAPROCDSP_NUM_ANGLE_BINS;
+    aoaCfg.res.angleTwiddleSize    = sizeof(cmplx32ReIm_t) * DPU_AOAPROCDSP_MAX_NUM_ANGLE_BINS;
     aoaCfg.res.twiddleSize         = sizeof(cmplx32ReIm_t) * TEST_MAX_NUM_DOPPLER_BINS;
     aoaCfg.res.scratch1Size        = sizeof(cmplx32ReIm_t) * TEST_MAX_NUM_DOPPLER_BINS;
     aoaCfg.res.scratch2Size        = sizeof(cmplx32ReIm_t) * TEST_MAX_NUM_DOPPLER_BINS;
-    aoaCfg.res.angleFftInSize      = sizeof(cmplx32ReIm_t) * DPU_AOAPROCDSP_NUM_ANGLE_BINS;
-    aoaCfg.res.elevationFftOutSize = sizeof(cmplx32ReIm_t) * DPU_AOAPROCDSP_NUM_ANGLE_BINS;
+    aoaCfg.res.angleFftInSize      = sizeof(cmplx32ReIm_t) * DPU_AOAPROCDSP_MAX_NUM_ANGLE_BINS;
+    aoaCfg.res.elevationFftOutSize = sizeof(cmplx32ReIm_t) * DPU_AOAPROCDSP_MAX_NUM_ANGLE_BINS;
 
     aoaCfg.dynCfg.fovAoaCfg = &aoaDynFovCfg;
 
@@ -461,8 +551,11 @@ void aoaProc_test_dpuConfig()
     aoaCfg.dynCfg.compRxChanCfg = &aoaDynOutCompRxCfg;
    
     aoaDynBmCfg.enabled = false;        //default, will overwirte by each test
+    aoaDynBmCfg.maxNumPeaks = 0;        //strongest and second peak
     aoaDynBmCfg.multiPeakThrsScal = TWOPEAK_POSITIVE_THRESHOLD;
     aoaCfg.dynCfg.multiObjBeamFormingCfg = &aoaDynBmCfg;
+    aoaDynExtMaxVelCfg.enabled = 0;
+    aoaCfg.dynCfg.extMaxVelCfg = &aoaDynExtMaxVelCfg;
     aoaCfg.dynCfg.staticClutterCfg.isEnabled = false;
 
 }
@@ -498,6 +591,7 @@ void Test_setProfile(aoaProcDpuTestConfig_t * testConfig)
     staticCfgPtr->numRangeBins = testConfig->numRangeBins;
     staticCfgPtr->numDopplerChirps = testConfig->numChirps;
     staticCfgPtr->numDopplerBins = testConfig->numDopplerBins;
+    staticCfgPtr->numAngleBins = TEST_AOA_FFTSIZE;
 
     /* hard code range step, and dopplerStep*/
     staticCfgPtr->rangeStep = 1.0f;
@@ -1169,6 +1263,62 @@ void Test_aoaDpu_cubaDataGen(aoaProcDpuTestConfig_t * testConfig)
 
    
 }
+/**
+*  @b Description
+*  @n
+*   Decode the compact point cloud of the last run and check it against the float
+*   output, the error must be within half a quantization step.
+*
+*  @retval None
+*
+*/
+void Test_compactPointCloud(void)
+{
+    uint32_t ii, numDecoded;
+    float xyzTol, velocityTol, err, maxXyzErr, maxVelocityErr;
+    uint8_t testPass = 1;
+
+    numDecoded = DPU_AoAProc_compactPointCloudDecode(&aoaDetObjCompactHeader, aoaDetObjCompact,
+                                                     aoaDetObjDecoded, TEST_MAX_NUM_CFARDETOBJ_DPU * 2);
+    if ((numDecoded != outAoaProc.numAoADetectedPoints) || (aoaDetObjCompactHeader.numPoints != numDecoded))
+    {
+        testPass = 0;
+    }
+
+    /* half a step plus the float rounding of the decoded value */
+    xyzTol = 0.5f / (float)(1U << aoaDetObjCompactHeader.xyzFracBits) * 1.001f;
+    velocityTol = 0.5f / (float)(1U << aoaDetObjCompactHeader.velocityFracBits) * 1.001f;
+    maxXyzErr = 0;
+    maxVelocityErr = 0;
+
+    for (ii = 0; ii < numDecoded; ii++)
+    {
+        err = MAX(MAX(fabs(aoaDetObjDecoded[ii].x - aoaDetObj[ii].x), fabs(aoaDetObjDecoded[ii].y - aoaDetObj[ii].y)),
+                  fabs(aoaDetObjDecoded[ii].z - aoaDetObj[ii].z));
+        maxXyzErr = MAX(maxXyzErr, err);
+        err = fabs(aoaDetObjDecoded[ii].velocity - aoaDetObj[ii].velocity);
+        maxVelocityErr = MAX(maxVelocityErr, err);
+
+        if ((abs(aoaDetObjDecoded[ii].snr - aoaDetObjSideInfo[ii].snr) > (DPU_AOAPROC_COMPACT_SNR_STEP / 2)) ||
+            (abs(aoaDetObjDecoded[ii].noise - aoaDetObjSideInfo[ii].noise) > (DPU_AOAPROC_COMPACT_SNR_STEP / 2)))
+        {
+            testPass = 0;
+        }
+    }
+    if ((maxXyzErr > xyzTol) || (maxVelocityErr > velocityTol))
+    {
+        testPass = 0;
+    }
+
+    if (testPass == 0)
+    {
+        finalResults = 0;
+    }
+    System_printf("Compact point cloud : %d points, Q%d/Q%d, max error xyz %f m velocity %f m/s %s\n",
+                  numDecoded, aoaDetObjCompactHeader.xyzFracBits, aoaDetObjCompactHeader.velocityFracBits,
+                  maxXyzErr, maxVelocityErr, testPass ? "PASS" : "FAIL");
+}
+
 /**
 *  @b Description
 *  @n
@@ -1511,181 +1661,1383 @@ void Test_printResults(aoaProcDpuTestConfig_t * testConfig)
 /**
 *  @b Description
 *  @n
-*     Generate 2D windowing coefficients.
+*     Run the last generated test case with each supported angle FFT size, without
+*     and with sub-bin azimuth interpolation. The azimuth of every output object is
+*     compared against the reference generated on the 64 point grid, which is off-bin
+*     for the 32 point FFT. Without interpolation the error must be within half a bin
+*     of the tested size, with interpolation within a tenth of a bin. Cycles per
+*     detection are reported for each case.
 *
 *  @retval None
 *
 */
-void Test_window2DCoef_gen(uint32_t numSamples, uint8_t winType, int32_t *winPtr)
+void Test_angleFftSizeSweep(aoaProcDpuTestConfig_t * testConfig)
 {
-    float ephyR, ephyI;
-    float phi = 2 * PI_ / ((float)numSamples - 1);
+    uint32_t ii, kk, interp;
+    int32_t retVal;
+    int16_t aoaSignPeakIdx;
+    float Wx, range;
+    float sineErr, maxSineErr, maxSineErrAllowed;
+    uint8_t testPass;
+    uint16_t numAngleBin[TEST_ANGLE_BIN_SIZE] = {32, 64, 128, 256};
 
+    if ((testConfig->numTxAntennas * testConfig->numRxAntennas == 1) || (testConfig->twoPeaksFlag))
+    {
+        return;
+    }
 
-    uint32_t ii;
-    float a0;
-    float winValue;
-    int32_t winValueFixed;
-    float cosValue, sinValue;
-    float temp;
+    System_printf("Angle FFT size sweep, %d detections\n", testConfig->numCfarDetObj);
+    for (interp = 0; interp < 2; interp++)
+    {
+        for (kk = 0; kk < TEST_ANGLE_BIN_SIZE; kk++)
+        {
+            testPass = 1;
+            Test_setProfile(testConfig);
+            aoaCfg.staticCfg.numAngleBins = numAngleBin[kk];
+            aoaCfg.dynCfg.angleInterpCfg.enabled = interp;
+            memset(staticHeatmap, 0, sizeof(cmplx16ImRe_t)*TEST_MAX_NUM_RANGE_BIN_HEATMAP * 8);
+            retVal = DPU_AoAProcDSP_config(aoaProcHandle, &aoaCfg);
+            if (retVal < 0)
+            {
+                System_printf("AOA DPU failed to configure angle FFT size %d. Error %d.\n", numAngleBin[kk], retVal);
+                finalResults = 0;
+                continue;
+            }
+            retVal = DPU_AoAProcDSP_process(aoaProcHandle, testConfig->numCfarDetObj, &outAoaProc);
+            if ((retVal < 0) || (outAoaProc.numAoADetectedPoints != testConfig->numAoaOutObj))
+            {
+                System_printf("AOA DPU angle FFT size %d failed. Error %d, aoaOut=%d\n", numAngleBin[kk], retVal,
+                              outAoaProc.numAoADetectedPoints);
+                finalResults = 0;
+                continue;
+            }
 
+            maxSineErr = 0.f;
+            for (ii = 0; ii < testConfig->numCfarDetObj; ii++)
+            {
+                if (interp)
+                {
+                    /* interpolated azimuth is only visible in the x coordinate */
+                    range = testConfig->cfarDetObjRangeIdx[ii] * aoaCfg.staticCfg.rangeStep - aoaDynOutCompRxCfg.rangeBias;
+                    if (range < 1.f)
+                        continue;
+                    Wx = aoaCfg.res.detObjOut[ii].x / range;
+                }
+                else
+                {
+                    if (aoaCfg.res.detObj2dAzimIdx[ii] >= numAngleBin[kk] / 2)
+                        aoaSignPeakIdx = aoaCfg.res.detObj2dAzimIdx[ii] - numAngleBin[kk];
+                    else
+                        aoaSignPeakIdx = aoaCfg.res.detObj2dAzimIdx[ii];
+                    Wx = 2.f * aoaSignPeakIdx / (float)numAngleBin[kk];
+                }
 
-    cosValue = 1.f;
-    sinValue = 0.f;
+                sineErr = fabs(Wx - 2.f * testConfig->aoaSignedAzimPeakIdxRef[ii] / (float)TEST_AOA_FFTSIZE);
+                if (sineErr > maxSineErr)
+                    maxSineErr = sineErr;
+            }
 
-    ephyR = cos(phi);
-    ephyI = sin(phi);
-    a0 = 0.5f;
+            maxSineErrAllowed = interp ? (0.2f / numAngleBin[kk]) : (1.01f / numAngleBin[kk]);
+            if (maxSineErr > maxSineErrAllowed)
+            {
+                finalResults = 0;
+                testPass = 0;
+            }
 
+            System_printf("  angle FFT %d, interp %d : max sine error %f, %d cycles per detection %s\n",
+                          numAngleBin[kk], interp, maxSineErr,
+                          outAoaProc.stats.processingTime / testConfig->numCfarDetObj, testPass ? "PASS" : "FAIL");
+        }
+    }
 
-    if (winType == 1)
+    aoaCfg.dynCfg.angleInterpCfg.enabled = 0;
+}
+
+/**
+*  @b Description
+*  @n
+*     Multi object beam forming with up to N peaks. A single detection is generated
+*     with several equal amplitude targets in the same range/Doppler bin, and the DPU
+*     must report min(number of targets, maxNumPeaks) objects, each within one bin of a
+*     distinct target. Runs once, on the first 2 Tx 4 Rx test case without BPM, and
+*     reports cycles per detection for every case.
+*
+*  @retval None
+*
+*/
+void Test_multiPeakBeamForming(aoaProcDpuTestConfig_t * testConfig)
+{
+    uint32_t ii, jj, kk, txAntIdx, tt;
+    uint32_t radarCubeIdx;
+    uint16_t rangeIdx;
+    int32_t retVal;
+    int16_t aoaSignPeakIdx;
+    float real, imag, phase;
+    uint8_t testPass, matched[5];
+    uint32_t numExpected;
+    const uint8_t numTargets[TEST_MULTIPEAK_NUM_CASES] = {2, 3, 3, 4, 4, 5};
+    const uint8_t maxNumPeaks[TEST_MULTIPEAK_NUM_CASES] = {2, 0, 4, 4, 3, 5};
+    const int16_t targetIdx[TEST_MULTIPEAK_NUM_CASES][5] = {{-12, 12},
+                                                             {-20, 0, 20},
+                                                             {-20, 0, 20},
+                                                             {-24, -8, 8, 24},
+                                                             {-24, -8, 8, 24},
+                                                             {-26, -13, 0, 13, 26}};
+
+    if (multiPeakTestDone || (testConfig->numTxAntennas != 2) || (testConfig->numRxAntennas != 4) ||
+        testConfig->bpmFlag)
     {
-        for (ii = 0; ii < numSamples; ii++)
-        {
-            winPtr[ii] = (1 << 17) - 1; //rec window, for debug
-        }
+        return;
     }
-    else
+    multiPeakTestDone = 1;
+
+    System_printf("Multi peak beam forming, threshold %f\n", MULTIPEAK_THRESHOLD);
+    rangeIdx = testConfig->numRangeBins / 2;
+    for (tt = 0; tt < TEST_MULTIPEAK_NUM_CASES; tt++)
     {
-        /* hanning window */
-        for (ii = 0; ii < numSamples; ii++)
-        {
-            winValue = a0 * (1.f - cosValue);       //0.5*(1-cos(2*pi*n/N-1))
+        testPass = 1;
 
-            winValue = winValue * (1 << 17) + 0.5;     //Q17 format
-            winValueFixed = (uint32_t)winValue;
-            if (winValueFixed >= (1 << 17))
+        /* noise free targets at Doppler bin 0 */
+        memset(testRadarCube, 0, sizeof(cmplx16ImRe_t) * testConfig->numRangeBins * testConfig->numChirps * testConfig->numTxAntennas * testConfig->numRxAntennas);
+        for (txAntIdx = 0; txAntIdx < testConfig->numTxAntennas; txAntIdx++)
+        {
+            for (jj = 0; jj < testConfig->numRxAntennas; jj++)
             {
-                winValueFixed = (1 << 17) - 1;
+                real = 0.f;
+                imag = 0.f;
+                for (kk = 0; kk < numTargets[tt]; kk++)
+                {
+                    phase = 2.f * PI * (txAntIdx * testConfig->numRxAntennas + jj) * (float)targetIdx[tt][kk] / (float)TEST_AOA_FFTSIZE;
+                    real += 500.f * cosf(phase);
+                    imag += 500.f * sinf(phase);
+                }
+                for (ii = 0; ii < testConfig->numChirps; ii++)
+                {
+                    radarCubeIdx = txAntIdx * testConfig->numChirps * testConfig->numRxAntennas *  testConfig->numRangeBins;
+                    radarCubeIdx += (ii * testConfig->numRxAntennas * testConfig->numRangeBins);
+                    radarCubeIdx += (jj * testConfig->numRangeBins);
+                    radarCubeIdx += rangeIdx;
+                    testRadarCube[radarCubeIdx].real = (int16_t)MATHUTILS_ROUND_FLOAT(real);
+                    testRadarCube[radarCubeIdx].imag = (int16_t)MATHUTILS_ROUND_FLOAT(imag);
+                }
             }
-            temp = cosValue;
-            cosValue = cosValue * ephyR - sinValue * ephyI;
-            sinValue = temp * ephyI + sinValue * ephyR;
+        }
 
-            //winPtr[ii] = (1<<17) - 1; //rec window, for debug
-            winPtr[ii] = winValueFixed;
+        Test_setProfile(testConfig);
+        cfarDetObjList[0].rangeIdx = rangeIdx;
+        cfarDetObjList[0].dopplerIdx = 0;
+        aoaCfg.res.cfarRngDopSnrListSize = 1;
+        aoaCfg.dynCfg.prepareRangeAzimuthHeatMap = false;
+        aoaDynBmCfg.enabled = 1;
+        aoaDynBmCfg.maxNumPeaks = maxNumPeaks[tt];
+        aoaDynBmCfg.multiPeakThrsScal = MULTIPEAK_THRESHOLD;
+
+        retVal = DPU_AoAProcDSP_config(aoaProcHandle, &aoaCfg);
+        if (retVal == 0)
+        {
+            retVal = DPU_AoAProcDSP_process(aoaProcHandle, 1, &outAoaProc);
+        }
+
+        numExpected = (maxNumPeaks[tt] == 0) ? 2 : maxNumPeaks[tt];
+        if (numExpected > numTargets[tt])
+            numExpected = numTargets[tt];
+        if ((retVal < 0) || (outAoaProc.numAoADetectedPoints != numExpected))
+        {
+            System_printf("  %d targets, max %d peaks : error %d, aoaOut=%d, ref=%d FAIL\n", numTargets[tt], maxNumPeaks[tt],
+                          retVal, outAoaProc.numAoADetectedPoints, numExpected);
+            finalResults = 0;
+            continue;
+        }
+
+        /* every output must match a distinct target */
+        memset(matched, 0, sizeof(matched));
+        for (ii = 0; ii < outAoaProc.numAoADetectedPoints; ii++)
+        {
+            if (aoaCfg.res.detObj2dAzimIdx[ii] >= TEST_AOA_FFTSIZE / 2)
+                aoaSignPeakIdx = aoaCfg.res.detObj2dAzimIdx[ii] - TEST_AOA_FFTSIZE;
+            else
+                aoaSignPeakIdx = aoaCfg.res.detObj2dAzimIdx[ii];
+
+            for (kk = 0; kk < numTargets[tt]; kk++)
+            {
+                if (!matched[kk] && (abs(aoaSignPeakIdx - targetIdx[tt][kk]) <= 1))
+                {
+                    matched[kk] = 1;
+                    break;
+                }
+            }
+            if (kk == numTargets[tt])
+            {
+                System_printf("  %d targets, output %d azimuth index %d does not match a target\n", numTargets[tt], ii, aoaSignPeakIdx);
+                finalResults = 0;
+                testPass = 0;
+            }
         }
+
+        System_printf("  %d targets, max %d peaks : %d objects, %d cycles per detection %s\n", numTargets[tt], maxNumPeaks[tt],
+                      outAoaProc.numAoADetectedPoints, outAoaProc.stats.processingTime, testPass ? "PASS" : "FAIL");
     }
 
+    aoaDynBmCfg.maxNumPeaks = 0;
 }
 
-
 /**
 *  @b Description
 *  @n
-*     test main task  : Generate the radar cuba data based on the test configuration, and generate the cfar detected
-*                       object list. The cuba data and the detected object list are sent to AOA dpu. The DPU outputs
-*                       the deteced object azimth and elevation angle, which are checked against the test configuration.
-*                       If the differece is within the error threshold, the test is declared PASS, otherwise, it is declared
-*                       FAIL. The tests cover 5 TX/RX antenna setups, 1/1, 1/2, 1/4, 2/4 and 3/4. 
+*     Extended maximum velocity. A single target moving faster than the unambiguous
+*     velocity is generated for every Doppler hypothesis of the antenna configuration,
+*     with Doppler indices on both sides of zero. With the feature enabled the DPU must
+*     report the unwrapped Doppler index as velocity (dopplerStep is 1) and the target
+*     azimuth. Runs once per number of Tx antennas (2 and 3), 4 Rx, without BPM.
 *
 *  @retval None
 *
 */
-
-void Test_task(UArg arg0, UArg arg1)
+void Test_extMaxVelocity(aoaProcDpuTestConfig_t * testConfig)
 {
-    uint32_t ii, jj, kk, kk1;
-   
-    char featureName[200];
-    uint16_t numAntennas[TEST_ANTENNA_LOOP][2] = {
-        /* numTx, numRx*/
-        {1, 1},
-        {1, 2},
-        {1, 4},
-        {2, 4},
-        {3, 4}
-    };
-    
-    uint32_t numDopplerBin[TEST_DOPPLER_BIN_SIZE] = {16, 32, 64, 128, 256, 512};
-    uint32_t numRangeBin[TEST_RANGE_BIN_SIZE] = { 16, 32, 64, 128, 256, 512, 1024 };
-    uint32_t numTests;
-    int32_t   retVal;
-    uint16_t dopplerLoopStep;
-    uint16_t numRangeBinSize;
-    uint16_t idx;
-    uint32_t maxNumChirps,mm;
-    
-    finalResults = 1;
-    System_printf("...... Initialization ...... \n");
-
-    /* edma, dpu inialization */
-    aoaProc_test_Edmainit();
-    aoaProc_test_dpuInit();
-
-    /* aoa dpu config*/
-    aoaProc_test_dpuConfig();
-    
-    System_printf("aoa Proc DPU Test start ...... \n");
-    
-    /*for tx/rx1,1, only run 3 doppler size, each with 1 range bin size */
-    numTests = 9; 
-    /* antenne combination * doppler size, 2 range bin size, for each doppler bin size, chirp even, odd, maximum */
-#if (defined (SOC_XWR16XX))
-    numTests += (TEST_ANTENNA_LOOP - 2) * TEST_DOPPLER_BIN_SIZE * 2 * 3;
-#endif
-#if ( (defined (SOC_XWR68XX)) ||  (defined (SOC_XWR18XX)))    
-    numTests += (TEST_ANTENNA_LOOP - 1) * TEST_DOPPLER_BIN_SIZE * 2 * 3;
-#endif
-   
-    printf("\n...... %d Tests to be run .......\n\n", numTests);
+    uint32_t ii, jj, txAntIdx, tt, hh;
+    uint32_t radarCubeIdx;
+    uint16_t rangeIdx;
+    int32_t retVal;
+    int16_t aoaSignPeakIdx;
+    int32_t dopplerSignIdx, trueDopplerIdx, wrapStartInd;
+    float phase;
+    uint8_t testPass;
+    const int16_t azimIdx = 9;
+    const int16_t dopplerRefIdx[2] = {5, -7};
+
+    if ((testConfig->numTxAntennas < 2) || (testConfig->numRxAntennas != 4) || testConfig->bpmFlag ||
+        (extMaxVelTestDone & (1U << testConfig->numTxAntennas)))
+    {
+        return;
+    }
+    extMaxVelTestDone |= (1U << testConfig->numTxAntennas);
 
-    testCount = 0;
-#if (defined (SOC_XWR16XX))
-    for (ii = 0; ii < TEST_ANTENNA_LOOP - 1; ii++) /* antenna loop, for 16xx, not support tx=3 */
+    System_printf("Extended maximum velocity, %d Tx\n", testConfig->numTxAntennas);
+    rangeIdx = testConfig->numRangeBins / 2;
+    for (tt = 0; tt < 2; tt++)
     {
-#endif
-#if ( (defined (SOC_XWR68XX)) ||  (defined (SOC_XWR18XX)))
-     for (ii = 0; ii < TEST_ANTENNA_LOOP; ii++) /* antenna loop */
-     {
-#endif
-        dopplerLoopStep = 1;
-        numRangeBinSize = 2;
-        if (ii == 0)
+        dopplerSignIdx = dopplerRefIdx[tt];
+        wrapStartInd = - ((int32_t) (testConfig->numTxAntennas >> 1));
+        if (!(testConfig->numTxAntennas & 0x1) && (dopplerSignIdx < 0))
         {
-            dopplerLoopStep = 2;
-            numRangeBinSize = 1; //for 1tx, 1rx, 1 range bin size
+            wrapStartInd++;
         }
-       
-        for (jj = 0; jj < TEST_DOPPLER_BIN_SIZE; jj += dopplerLoopStep) /* doppler size loop*/
-        {
-            aoaTestCfg.numTxAntennas = numAntennas[ii][0];
-            aoaTestCfg.numRxAntennas = numAntennas[ii][1];
-            aoaTestCfg.numDopplerBins = numDopplerBin[jj];       //NOT TEST OVERSAMPLING
 
-            maxNumChirps = 16384 / aoaTestCfg.numTxAntennas / aoaTestCfg.numRxAntennas / 4;
-            if (maxNumChirps > aoaTestCfg.numDopplerBins)
-                maxNumChirps = aoaTestCfg.numDopplerBins;
+        for (hh = 0; hh < testConfig->numTxAntennas; hh++)
+        {
+            testPass = 1;
+            trueDopplerIdx = dopplerSignIdx + (wrapStartInd + (int32_t)hh) * testConfig->numDopplerBins;
 
-            for (mm = 0; mm < 3; mm++)
+            /* noise free target, chirps of the Tx antennas are interleaved in time */
+            memset(testRadarCube, 0, sizeof(cmplx16ImRe_t) * testConfig->numRangeBins * testConfig->numChirps * testConfig->numTxAntennas * testConfig->numRxAntennas);
+            for (ii = 0; ii < testConfig->numChirps; ii++)
             {
-                for (kk = 0; kk < numRangeBinSize; kk++) /* range bin size loop, random pick range bin size */
+                for (txAntIdx = 0; txAntIdx < testConfig->numTxAntennas; txAntIdx++)
                 {
-                    /* randomly find the range bin sizes*/
-                    if ((aoaTestCfg.numTxAntennas == 1)) //||( (aoaTestCfg.numTxAntennas == 2) &&(aoaTestCfg.numRangeBins==2)))
+                    for (jj = 0; jj < testConfig->numRxAntennas; jj++)
                     {
-                        if (aoaTestCfg.numDopplerBins <= 16)
-                        {
-                            kk1 = testCount + kk * 5;
-                            kk1 = test_modCalc(kk1, TEST_RANGE_BIN_SIZE); 
-                        }
+                        phase = 2.f * PI * (float)trueDopplerIdx * (ii * testConfig->numTxAntennas + txAntIdx) / testConfig->numDopplerBins / testConfig->numTxAntennas;
+                        if (txAntIdx < 2)
+                            phase += 2.f * PI * (txAntIdx * testConfig->numRxAntennas + jj) * (float)azimIdx / (float)TEST_AOA_FFTSIZE;
                         else
-                        {
-                            kk1 = testCount + kk * ((TEST_RANGE_BIN_SIZE + 1 - jj) / 2);
-                            kk1 = test_modCalc(kk1, (TEST_RANGE_BIN_SIZE + 1 - jj));  
-                        }
-                    }
-                    else 
-                    {
-                        kk1 = testCount + kk * ((TEST_RANGE_BIN_SIZE - 1 - jj) / 2);
-                        kk1 = test_modCalc(kk1, (TEST_RANGE_BIN_SIZE - 1 - jj));  //maximum range size is 256,... 
+                            phase += 2.f * PI * (2 + jj) * (float)azimIdx / (float)TEST_AOA_FFTSIZE;
+
+                        radarCubeIdx = txAntIdx * testConfig->numChirps * testConfig->numRxAntennas *  testConfig->numRangeBins;
+                        radarCubeIdx += (ii * testConfig->numRxAntennas * testConfig->numRangeBins);
+                        radarCubeIdx += (jj * testConfig->numRangeBins);
+                        radarCubeIdx += rangeIdx;
+                        testRadarCube[radarCubeIdx].real = (int16_t)MATHUTILS_ROUND_FLOAT(500.f * cosf(phase));
+                        testRadarCube[radarCubeIdx].imag = (int16_t)MATHUTILS_ROUND_FLOAT(500.f * sinf(phase));
                     }
-                    aoaTestCfg.numRangeBins = numRangeBin[kk1];
+                }
+            }
 
-                    /* set up the number of chirps <= doppler bin size*/
-                    aoaTestCfg.numChirps = aoaTestCfg.numDopplerBins;
-                    
-                   if (aoaTestCfg.numDopplerBins == 16)
+            Test_setProfile(testConfig);
+            cfarDetObjList[0].rangeIdx = rangeIdx;
+            cfarDetObjList[0].dopplerIdx = (uint16_t)(dopplerSignIdx & (testConfig->numDopplerBins - 1));
+            aoaCfg.res.cfarRngDopSnrListSize = 1;
+            aoaCfg.dynCfg.prepareRangeAzimuthHeatMap = false;
+            aoaDynExtMaxVelCfg.enabled = 1;
+
+            retVal = DPU_AoAProcDSP_config(aoaProcHandle, &aoaCfg);
+            if (retVal == 0)
+            {
+                retVal = DPU_AoAProcDSP_process(aoaProcHandle, 1, &outAoaProc);
+            }
+            if ((retVal < 0) || (outAoaProc.numAoADetectedPoints != 1))
+            {
+                System_printf("  Doppler %d : error %d, aoaOut=%d FAIL\n", trueDopplerIdx, retVal, outAoaProc.numAoADetectedPoints);
+                finalResults = 0;
+                continue;
+            }
+
+            if (aoaCfg.res.detObj2dAzimIdx[0] >= TEST_AOA_FFTSIZE / 2)
+                aoaSignPeakIdx = aoaCfg.res.detObj2dAzimIdx[0] - TEST_AOA_FFTSIZE;
+            else
+                aoaSignPeakIdx = aoaCfg.res.detObj2dAzimIdx[0];
+
+            if ((aoaCfg.res.detObjOut[0].velocity != (float)trueDopplerIdx) || (aoaSignPeakIdx != azimIdx))
+            {
+                finalResults = 0;
+                testPass = 0;
+            }
+
+            System_printf("  Doppler %d : aoaOut vel=%f azim=%d, %d cycles %s\n", trueDopplerIdx,
+                          aoaCfg.res.detObjOut[0].velocity, aoaSignPeakIdx,
+                          outAoaProc.stats.processingTime, testPass ? "PASS" : "FAIL");
+        }
+    }
+
+    aoaDynExtMaxVelCfg.enabled = 0;
+}
+
+/**
+*  @b Description
+*  @n
+*     2D angle FFT over an antenna geometry table, 3Tx 4Rx. For each layout a noise free
+*     target is generated at the antenna positions of the table, where the antenna at
+*     (row, col) sees the phase pi * (col * Wx - row * Wz), and the reported azimuth bin and
+*     elevation must match. The first layout is the azimuth/elevation layout of the default
+*     processing, which is run as well for comparison of the results and cycles. Runs once.
+*
+*  @retval None
+*
+*/
+void Test_antennaGeometry(aoaProcDpuTestConfig_t * testConfig)
+{
+    uint32_t ii, jj, txAntIdx, layoutIdx, virtAntIdx;
+    uint32_t radarCubeIdx, defaultCycles;
+    uint16_t rangeIdx;
+    int32_t retVal;
+    int16_t aoaSignPeakIdx;
+    float phase, Wz, defaultWz;
+    uint8_t testPass;
+    const int16_t azimIdx = 6;
+    const int16_t elevIdx = -2;
+    const int16_t dopplerIdx = 3;
+    const uint8_t numRows[TEST_GEOMETRY_NUM_LAYOUTS] = {2, 3};
+    /* azimuth row + elevation row (xWR14xx EVM), 3 x 4 rectangular array */
+    const uint8_t antRow[TEST_GEOMETRY_NUM_LAYOUTS][12] = {{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1},
+                                                           {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2}};
+    const uint8_t antCol[TEST_GEOMETRY_NUM_LAYOUTS][12] = {{0, 1, 2, 3, 4, 5, 6, 7, 2, 3, 4, 5},
+                                                           {0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3}};
+
+    if (antGeometryTestDone || (testConfig->numTxAntennas != 3) || (testConfig->numRxAntennas != 4) ||
+        testConfig->bpmFlag)
+    {
+        return;
+    }
+    antGeometryTestDone = 1;
+
+    System_printf("2D angle FFT over antenna geometry\n");
+    rangeIdx = testConfig->numRangeBins / 2;
+    Wz = -2.f * (float)elevIdx / (float)TEST_GEOMETRY_NUM_ELEV_BINS;
+    defaultWz = 0.f;
+    defaultCycles = 0;
+
+    for (layoutIdx = 0; layoutIdx < TEST_GEOMETRY_NUM_LAYOUTS; layoutIdx++)
+    {
+        testPass = 1;
+
+        /* noise free target, chirps of the Tx antennas are interleaved in time */
+        memset(testRadarCube, 0, sizeof(cmplx16ImRe_t) * testConfig->numRangeBins * testConfig->numChirps * testConfig->numTxAntennas * testConfig->numRxAntennas);
+        for (ii = 0; ii < testConfig->numChirps; ii++)
+        {
+            for (txAntIdx = 0; txAntIdx < testConfig->numTxAntennas; txAntIdx++)
+            {
+                for (jj = 0; jj < testConfig->numRxAntennas; jj++)
+                {
+                    virtAntIdx = txAntIdx * testConfig->numRxAntennas + jj;
+                    phase = 2.f * PI * (float)dopplerIdx * (ii * testConfig->numTxAntennas + txAntIdx) / testConfig->numDopplerBins / testConfig->numTxAntennas;
+                    phase += 2.f * PI * (float)antCol[layoutIdx][virtAntIdx] * (float)azimIdx / (float)TEST_AOA_FFTSIZE;
+                    phase -= PI * (float)antRow[layoutIdx][virtAntIdx] * Wz;
+
+                    radarCubeIdx = txAntIdx * testConfig->numChirps * testConfig->numRxAntennas *  testConfig->numRangeBins;
+                    radarCubeIdx += (ii * testConfig->numRxAntennas * testConfig->numRangeBins);
+                    radarCubeIdx += (jj * testConfig->numRangeBins);
+                    radarCubeIdx += rangeIdx;
+                    testRadarCube[radarCubeIdx].real = (int16_t)MATHUTILS_ROUND_FLOAT(500.f * cosf(phase));
+                    testRadarCube[radarCubeIdx].imag = (int16_t)MATHUTILS_ROUND_FLOAT(500.f * sinf(phase));
+                }
+            }
+        }
+
+        Test_setProfile(testConfig);
+        cfarDetObjList[0].rangeIdx = rangeIdx;
+        cfarDetObjList[0].dopplerIdx = dopplerIdx;
+        aoaCfg.res.cfarRngDopSnrListSize = 1;
+        aoaCfg.dynCfg.prepareRangeAzimuthHeatMap = false;
+        aoaDynBmCfg.enabled = 0;
+        aoaDynExtMaxVelCfg.enabled = 0;
+
+        /* default processing of the azimuth/elevation layout */
+        if (layoutIdx == 0)
+        {
+            retVal = DPU_AoAProcDSP_config(aoaProcHandle, &aoaCfg);
+            if (retVal == 0)
+            {
+                retVal = DPU_AoAProcDSP_process(aoaProcHandle, 1, &outAoaProc);
+            }
+            if ((retVal == 0) && (outAoaProc.numAoADetectedPoints == 1))
+            {
+                defaultWz = aoaCfg.res.detObjElevationAngle[0];
+                defaultCycles = outAoaProc.stats.processingTime;
+            }
+        }
+
+        aoaCfg.staticCfg.antGeometryCfg.enabled = 1;
+        aoaCfg.staticCfg.antGeometryCfg.numRows = numRows[layoutIdx];
+        aoaCfg.staticCfg.antGeometryCfg.numElevBins = TEST_GEOMETRY_NUM_ELEV_BINS;
+        for (virtAntIdx = 0; virtAntIdx < 12; virtAntIdx++)
+        {
+            aoaCfg.staticCfg.antGeometryCfg.antPos[virtAntIdx].row = antRow[layoutIdx][virtAntIdx];
+            aoaCfg.staticCfg.antGeometryCfg.antPos[virtAntIdx].col = antCol[layoutIdx][virtAntIdx];
+        }
+        aoaCfg.res.angle2DFftBuf = aoaAngle2DFftBuf;
+        aoaCfg.res.angle2DFftBufSize = sizeof(aoaAngle2DFftBuf);
+        aoaCfg.res.elevTwiddle32x32 = aoaElevTwiddle32x32;
+        aoaCfg.res.elevTwiddleSize = sizeof(aoaElevTwiddle32x32);
+
+        retVal = DPU_AoAProcDSP_config(aoaProcHandle, &aoaCfg);
+        if (retVal == 0)
+        {
+            retVal = DPU_AoAProcDSP_process(aoaProcHandle, 1, &outAoaProc);
+        }
+
+        memset(&aoaCfg.staticCfg.antGeometryCfg, 0, sizeof(aoaCfg.staticCfg.antGeometryCfg));
+        aoaCfg.res.angle2DFftBuf = NULL;
+        aoaCfg.res.elevTwiddle32x32 = NULL;
+
+        if ((retVal < 0) || (outAoaProc.numAoADetectedPoints != 1))
+        {
+            System_printf("  layout %d : error %d, aoaOut=%d FAIL\n", layoutIdx, retVal, outAoaProc.numAoADetectedPoints);
+            finalResults = 0;
+            continue;
+        }
+
+        if (aoaCfg.res.detObj2dAzimIdx[0] >= TEST_AOA_FFTSIZE / 2)
+            aoaSignPeakIdx = aoaCfg.res.detObj2dAzimIdx[0] - TEST_AOA_FFTSIZE;
+        else
+            aoaSignPeakIdx = aoaCfg.res.detObj2dAzimIdx[0];
+
+        if ((aoaSignPeakIdx != azimIdx) || (fabs(aoaCfg.res.detObjElevationAngle[0] - Wz) > 1e-3f) ||
+            (aoaCfg.res.detObjOut[0].velocity != (float)dopplerIdx * aoaCfg.staticCfg.dopplerStep))
+        {
+            finalResults = 0;
+            testPass = 0;
+        }
+
+        System_printf("  layout %d (%d rows) : azim=%d Wz=%f (expected %f), %d cycles %s\n", layoutIdx,
+                      numRows[layoutIdx], aoaSignPeakIdx, aoaCfg.res.detObjElevationAngle[0], Wz,
+                      outAoaProc.stats.processingTime, testPass ? "PASS" : "FAIL");
+    }
+    System_printf("  default processing : Wz=%f, %d cycles\n", defaultWz, defaultCycles);
+}
+
+/**
+*  @b Description
+*  @n
+*     Compare the range bins [0, numRangeBins) of the azimuth heat map against the
+*     reference. If refreshMask is not NULL, range bins with refreshMask[r] == 0 must
+*     still be zero (not refreshed).
+*
+*  @retval 1 if matching, 0 otherwise
+*
+*/
+uint8_t Test_heatMapCompare(aoaProcDpuTestConfig_t * testConfig, uint8_t *refreshMask)
+{
+    uint32_t ii, jj, numAzimVirtualAnt, idx;
+    int32_t diffReal, diffImag;
+    uint8_t match = 1;
+
+    numAzimVirtualAnt = aoaCfg.staticCfg.numVirtualAntAzim;
+    for (ii = 0; ii < testConfig->numRangeBins; ii++)
+    {
+        for (jj = 0; jj < numAzimVirtualAnt; jj++)
+        {
+            idx = ii * numAzimVirtualAnt + jj;
+            if ((refreshMask != NULL) && (refreshMask[ii] == 0))
+            {
+                if ((staticHeatmap[idx].real != 0) || (staticHeatmap[idx].imag != 0))
+                {
+                    match = 0;
+                }
+                continue;
+            }
+            diffReal = abs(staticHeatmapRef[idx].real - staticHeatmap[idx].real);
+            diffImag = abs(staticHeatmapRef[idx].imag - staticHeatmap[idx].imag);
+            if ((diffReal > MAX_HEATMAP_ERROR) || (diffImag > MAX_HEATMAP_ERROR))
+            {
+                match = 0;
+            }
+        }
+    }
+    return match;
+}
+
+/**
+*  @b Description
+*  @n
+*     Incremental range-azimuth heat map test on the radar cube and heat map reference
+*     of the current test case.\n
+*     Round robin: after the full refresh of the first frame, the heat map is cleared and
+*     each following frame must refresh 1/decimation of the range bins; after decimation
+*     frames the heat map must match the full heat map again.\n
+*     On change: after the first (full) frame the heat map is cleared, the zero Doppler
+*     detection matrix values of a few range bins are moved above and below the
+*     threshold and only the range bins above it must be refreshed.\n
+*     The heat map cycles per frame of the modes are reported. Runs once.
+*
+*  @retval None
+*
+*/
+void Test_heatMapUpdate(aoaProcDpuTestConfig_t * testConfig)
+{
+    uint32_t ii, frameIdx, fullCycles, rrCycles, numUpdated;
+    int32_t retVal;
+    uint8_t testPass = 1;
+    uint8_t refreshMask[TEST_MAX_NUM_RANGE_BIN_HEATMAP];
+    const uint16_t changedRangeIdx[3] = {1, 5, 11};
+
+    if (heatMapUpdateTestDone || !testConfig->heatMapFlag || testConfig->bpmFlag ||
+        (testConfig->numRangeBins < 16) ||
+        (testConfig->numRangeBins * testConfig->numDopplerBins > TEST_HEATMAP_DETMATRIX_SIZE))
+    {
+        return;
+    }
+    heatMapUpdateTestDone = 1;
+
+    System_printf("Incremental heat map, %d range bins\n", testConfig->numRangeBins);
+
+    /* Round robin */
+    Test_setProfile(testConfig);
+    aoaCfg.dynCfg.heatMapUpdateCfg.mode = DPU_AOAPROC_HEATMAP_UPDATE_ROUND_ROBIN;
+    aoaCfg.dynCfg.heatMapUpdateCfg.decimation = TEST_HEATMAP_DECIMATION;
+    memset(staticHeatmap, 0, sizeof(cmplx16ImRe_t)*TEST_MAX_NUM_RANGE_BIN_HEATMAP * 8);
+    retVal = DPU_AoAProcDSP_config(aoaProcHandle, &aoaCfg);
+    if (retVal == 0)
+    {
+        retVal = DPU_AoAProcDSP_process(aoaProcHandle, testConfig->numCfarDetObj, &outAoaProc);
+    }
+    if ((retVal < 0) || (outAoaProc.numHeatMapRangeBins != testConfig->numRangeBins) ||
+        !Test_heatMapCompare(testConfig, NULL))
+    {
+        testPass = 0;
+    }
+    fullCycles = outAoaProc.stats.processingTime;
+
+    memset(staticHeatmap, 0, sizeof(cmplx16ImRe_t)*TEST_MAX_NUM_RANGE_BIN_HEATMAP * 8);
+    memset(refreshMask, 0, sizeof(refreshMask));
+    rrCycles = 0;
+    for (frameIdx = 0; frameIdx < TEST_HEATMAP_DECIMATION; frameIdx++)
+    {
+        retVal = DPU_AoAProcDSP_process(aoaProcHandle, testConfig->numCfarDetObj, &outAoaProc);
+        numUpdated = 0;
+        for (ii = frameIdx; ii < testConfig->numRangeBins; ii += TEST_HEATMAP_DECIMATION)
+        {
+            refreshMask[ii] = 1;
+            numUpdated++;
+        }
+        if ((retVal < 0) || (outAoaProc.numHeatMapRangeBins != numUpdated) ||
+            !Test_heatMapCompare(testConfig, refreshMask))
+        {
+            testPass = 0;
+        }
+        rrCycles += outAoaProc.stats.processingTime;
+    }
+    System_printf("  round robin 1/%d : full %d cycles, %d cycles per frame\n", TEST_HEATMAP_DECIMATION,
+                  fullCycles, rrCycles / TEST_HEATMAP_DECIMATION);
+
+    /* On change */
+    for (ii = 0; ii < testConfig->numRangeBins * testConfig->numDopplerBins; ii++)
+    {
+        testDetMatrix[ii] = 1000;
+    }
+    aoaCfg.res.detMatrix.datafmt = DPIF_DETMATRIX_FORMAT_1;
+    aoaCfg.res.detMatrix.data = testDetMatrix;
+    aoaCfg.res.detMatrix.dataSize = testConfig->numRangeBins * testConfig->numDopplerBins * sizeof(uint16_t);
+    aoaCfg.res.heatMapRefEnergy = testHeatMapRefEnergy;
+    aoaCfg.res.heatMapRefEnergySize = TEST_MAX_NUM_RANGE_BIN_HEATMAP;
+    aoaCfg.dynCfg.heatMapUpdateCfg.mode = DPU_AOAPROC_HEATMAP_UPDATE_ON_CHANGE;
+    aoaCfg.dynCfg.heatMapUpdateCfg.changeThreshold = TEST_HEATMAP_CHANGE_THRESHOLD;
+    retVal = DPU_AoAProcDSP_config(aoaProcHandle, &aoaCfg);
+    if (retVal == 0)
+    {
+        retVal = DPU_AoAProcDSP_process(aoaProcHandle, testConfig->numCfarDetObj, &outAoaProc);
+    }
+    if ((retVal < 0) || (outAoaProc.numHeatMapRangeBins != testConfig->numRangeBins))
+    {
+        testPass = 0;
+    }
+
+    /* two range bins above the threshold, one below, one with a non zero Doppler change */
+    memset(staticHeatmap, 0, sizeof(cmplx16ImRe_t)*TEST_MAX_NUM_RANGE_BIN_HEATMAP * 8);
+    memset(refreshMask, 0, sizeof(refreshMask));
+    testDetMatrix[changedRangeIdx[0] * testConfig->numDopplerBins] += 2 * TEST_HEATMAP_CHANGE_THRESHOLD;
+    testDetMatrix[changedRangeIdx[1] * testConfig->numDopplerBins] -= 2 * TEST_HEATMAP_CHANGE_THRESHOLD;
+    testDetMatrix[changedRangeIdx[2] * testConfig->numDopplerBins] += TEST_HEATMAP_CHANGE_THRESHOLD / 2;
+    testDetMatrix[changedRangeIdx[2] * testConfig->numDopplerBins + 1] += 2 * TEST_HEATMAP_CHANGE_THRESHOLD;
+    refreshMask[changedRangeIdx[0]] = 1;
+    refreshMask[changedRangeIdx[1]] = 1;
+    retVal = DPU_AoAProcDSP_process(aoaProcHandle, testConfig->numCfarDetObj, &outAoaProc);
+    if ((retVal < 0) || (outAoaProc.numHeatMapRangeBins != 2) || !Test_heatMapCompare(testConfig, refreshMask))
+    {
+        testPass = 0;
+    }
+
+    /* unchanged since the last refresh */
+    retVal = DPU_AoAProcDSP_process(aoaProcHandle, testConfig->numCfarDetObj, &outAoaProc);
+    if ((retVal < 0) || (outAoaProc.numHeatMapRangeBins != 0))
+    {
+        testPass = 0;
+    }
+    System_printf("  on change : %d cycles per frame without changes\n", outAoaProc.stats.processingTime);
+
+    memset(&aoaCfg.dynCfg.heatMapUpdateCfg, 0, sizeof(aoaCfg.dynCfg.heatMapUpdateCfg));
+    memset(&aoaCfg.res.detMatrix, 0, sizeof(aoaCfg.res.detMatrix));
+    aoaCfg.res.heatMapRefEnergy = NULL;
+    aoaCfg.res.heatMapRefEnergySize = 0;
+
+    if (!testPass)
+    {
+        finalResults = 0;
+    }
+    System_printf("  %s\n", testPass ? "PASS" : "FAIL");
+}
+
+/**
+*  @b Description
+*  @n
+*     Capon heat map test. Two targets with different Doppler (uncorrelated over the
+*     frame) and azimuth are placed in one range bin, all other range bins are empty.
+*     The two strongest local maxima of the Capon spectrum of that range bin must be at
+*     the target azimuth bins and the empty range bins must be zero. The heat map is
+*     run with and without Capon to report the Capon cycles per range bin.
+*     Runs once, 2 Tx 4 Rx without BPM.
+*
+*  @retval None
+*
+*/
+void Test_caponHeatMap(aoaProcDpuTestConfig_t * testConfig)
+{
+    uint32_t ii, jj, txAntIdx, kk, tt;
+    uint32_t radarCubeIdx, numAngleBins;
+    uint16_t rangeIdx;
+    int32_t retVal;
+    int32_t peakIdx[2], signIdx;
+    uint32_t cyclesOff, cyclesOn;
+    float phase, real, imag, prev, next, val;
+    float peakVal[2];
+    float *rangeHeatMap;
+    uint8_t testPass = 1;
+    const int16_t azimIdx[2] = {9, -20};
+    const int16_t dopplerIdx[2] = {1, 3};
+    const float amplitude[2] = {500.f, 300.f};
+
+    if (caponTestDone || (testConfig->numTxAntennas != 2) || (testConfig->numRxAntennas != 4) ||
+        testConfig->bpmFlag || (testConfig->numRangeBins > TEST_CAPON_MAX_NUM_RANGE_BINS))
+    {
+        return;
+    }
+    caponTestDone = 1;
+
+    System_printf("Capon heat map, %d range bins\n", testConfig->numRangeBins);
+    rangeIdx = testConfig->numRangeBins / 2;
+    numAngleBins = TEST_CAPON_NUM_ANGLE_BINS;
+
+    memset(testRadarCube, 0, sizeof(cmplx16ImRe_t) * testConfig->numRangeBins * testConfig->numChirps * testConfig->numTxAntennas * testConfig->numRxAntennas);
+    for (ii = 0; ii < testConfig->numChirps; ii++)
+    {
+        for (txAntIdx = 0; txAntIdx < testConfig->numTxAntennas; txAntIdx++)
+        {
+            for (jj = 0; jj < testConfig->numRxAntennas; jj++)
+            {
+                real = 0.f;
+                imag = 0.f;
+                for (tt = 0; tt < 2; tt++)
+                {
+                    phase = 2.f * PI * (float)(dopplerIdx[tt] * ii) / (float)testConfig->numChirps;
+                    phase += 2.f * PI * (txAntIdx * testConfig->numRxAntennas + jj) * (float)azimIdx[tt] / (float)numAngleBins;
+                    real += amplitude[tt] * cosf(phase);
+                    imag += amplitude[tt] * sinf(phase);
+                }
+                radarCubeIdx = txAntIdx * testConfig->numChirps * testConfig->numRxAntennas *  testConfig->numRangeBins;
+                radarCubeIdx += (ii * testConfig->numRxAntennas * testConfig->numRangeBins);
+                radarCubeIdx += (jj * testConfig->numRangeBins);
+                radarCubeIdx += rangeIdx;
+                testRadarCube[radarCubeIdx].real = (int16_t)MATHUTILS_ROUND_FLOAT(real);
+                testRadarCube[radarCubeIdx].imag = (int16_t)MATHUTILS_ROUND_FLOAT(imag);
+            }
+        }
+    }
+
+    /* Reference run without Capon */
+    Test_setProfile(testConfig);
+    cfarDetObjList[0].rangeIdx = rangeIdx;
+    cfarDetObjList[0].dopplerIdx = dopplerIdx[0];
+    aoaCfg.res.cfarRngDopSnrListSize = 1;
+    aoaCfg.dynCfg.prepareRangeAzimuthHeatMap = true;
+    retVal = DPU_AoAProcDSP_config(aoaProcHandle, &aoaCfg);
+    if (retVal == 0)
+    {
+        retVal = DPU_AoAProcDSP_process(aoaProcHandle, 1, &outAoaProc);
+    }
+    cyclesOff = outAoaProc.stats.processingTime;
+
+    aoaCfg.staticCfg.caponCfg.enabled = 1;
+    aoaCfg.staticCfg.caponCfg.numAngleBins = numAngleBins;
+    aoaCfg.staticCfg.caponCfg.diagLoading = TEST_CAPON_DIAG_LOADING;
+    aoaCfg.res.caponSnapshotBuf = aoaCaponSnapshotBuf;
+    aoaCfg.res.caponSnapshotBufSize = sizeof(aoaCaponSnapshotBuf);
+    aoaCfg.res.caponSteeringVec = aoaCaponSteeringVec;
+    aoaCfg.res.caponSteeringVecSize = sizeof(aoaCaponSteeringVec);
+    aoaCfg.res.caponHeatMap = aoaCaponHeatMap;
+    aoaCfg.res.caponHeatMapSize = TEST_CAPON_MAX_NUM_RANGE_BINS * TEST_CAPON_NUM_ANGLE_BINS;
+    memset(aoaCaponHeatMap, 0xFF, sizeof(aoaCaponHeatMap));
+    if (retVal == 0)
+    {
+        retVal = DPU_AoAProcDSP_config(aoaProcHandle, &aoaCfg);
+    }
+    if (retVal == 0)
+    {
+        retVal = DPU_AoAProcDSP_process(aoaProcHandle, 1, &outAoaProc);
+    }
+    cyclesOn = outAoaProc.stats.processingTime;
+
+    aoaCfg.staticCfg.caponCfg.enabled = 0;
+    aoaCfg.res.caponSnapshotBuf = NULL;
+    aoaCfg.res.caponSteeringVec = NULL;
+    aoaCfg.res.caponHeatMap = NULL;
+
+    if (retVal < 0)
+    {
+        System_printf("  error %d FAIL\n", retVal);
+        finalResults = 0;
+        return;
+    }
+
+    /* two strongest local maxima of the target range bin */
+    rangeHeatMap = &aoaCaponHeatMap[rangeIdx * numAngleBins];
+    peakIdx[0] = peakIdx[1] = -1;
+    peakVal[0] = peakVal[1] = 0.f;
+    for (kk = 0; kk < numAngleBins; kk++)
+    {
+        val = rangeHeatMap[kk];
+        prev = rangeHeatMap[(kk + numAngleBins - 1) % numAngleBins];
+        next = rangeHeatMap[(kk + 1) % numAngleBins];
+        if ((val > prev) && (val >= next))
+        {
+            if (val > peakVal[0])
+            {
+                peakVal[1] = peakVal[0];
+                peakIdx[1] = peakIdx[0];
+                peakVal[0] = val;
+                peakIdx[0] = kk;
+            }
+            else if (val > peakVal[1])
+            {
+                peakVal[1] = val;
+                peakIdx[1] = kk;
+            }
+        }
+    }
+    for (tt = 0; tt < 2; tt++)
+    {
+        signIdx = (peakIdx[tt] >= (int32_t)numAngleBins / 2) ? peakIdx[tt] - (int32_t)numAngleBins : peakIdx[tt];
+        if (signIdx != azimIdx[tt])
+        {
+            testPass = 0;
+        }
+        System_printf("  peak %d : bin %d (expected %d), power %f\n", tt, signIdx, azimIdx[tt], peakVal[tt]);
+    }
+
+    /* empty range bins */
+    for (ii = 0; ii < testConfig->numRangeBins; ii++)
+    {
+        if (ii == rangeIdx)
+        {
+            continue;
+        }
+        for (kk = 0; kk < numAngleBins; kk++)
+        {
+            if (aoaCaponHeatMap[ii * numAngleBins + kk] != 0.f)
+            {
+                testPass = 0;
+            }
+        }
+    }
+
+    if (!testPass)
+    {
+        finalResults = 0;
+    }
+    System_printf("  %d cycles per range bin %s\n", (cyclesOn - cyclesOff) / testConfig->numRangeBins,
+                  testPass ? "PASS" : "FAIL");
+}
+
+/**
+*  @b Description
+*  @n
+*     Sub-bin azimuth interpolation with elevation, 3Tx 4Rx. Noise free targets are
+*     generated off the 64 point angle grid, at 0.4 bin from the nearest bin, each with
+*     an elevation. Without interpolation the azimuth error must be within half a bin,
+*     with interpolation within a tenth of a bin. In both cases z / range must match the
+*     generated elevation sine: the elevation phase difference is taken at the azimuth
+*     peak bin, so it is referenced to the bin centre and must not take the sub-bin
+*     offset of the interpolated azimuth. Runs once.
+*
+*  @retval None
+*
+*/
+void Test_angleInterp(aoaProcDpuTestConfig_t * testConfig)
+{
+    uint32_t ii, jj, txAntIdx, tt, interp;
+    uint32_t radarCubeIdx;
+    uint16_t rangeIdx;
+    int32_t retVal;
+    float phase, range, Wx, Wz, WxErr, WzErr;
+    uint8_t testPass;
+    const float azimBin[TEST_ANGLE_INTERP_NUM_TARGETS] = {9.4f, -7.6f, 3.4f, -12.4f};
+    const float elevSine[TEST_ANGLE_INTERP_NUM_TARGETS] = {0.3f, -0.2f, 0.1f, -0.35f};
+
+    if (angleInterpTestDone || (testConfig->numTxAntennas != 3) || (testConfig->numRxAntennas != 4) ||
+        testConfig->bpmFlag)
+    {
+        return;
+    }
+    angleInterpTestDone = 1;
+
+    System_printf("Angle interpolation with elevation\n");
+    rangeIdx = testConfig->numRangeBins / 2;
+    range = (float)rangeIdx - aoaDynOutCompRxCfg.rangeBias;
+    for (tt = 0; tt < TEST_ANGLE_INTERP_NUM_TARGETS; tt++)
+    {
+        /* noise free target at Doppler bin 0 */
+        memset(testRadarCube, 0, sizeof(cmplx16ImRe_t) * testConfig->numRangeBins * testConfig->numChirps * testConfig->numTxAntennas * testConfig->numRxAntennas);
+        for (ii = 0; ii < testConfig->numChirps; ii++)
+        {
+            for (txAntIdx = 0; txAntIdx < testConfig->numTxAntennas; txAntIdx++)
+            {
+                for (jj = 0; jj < testConfig->numRxAntennas; jj++)
+                {
+                    if (txAntIdx < 2)
+                        phase = 2.f * PI * (txAntIdx * testConfig->numRxAntennas + jj) * azimBin[tt] / (float)TEST_AOA_FFTSIZE;
+                    else
+                        phase = 2.f * PI * (2 + jj) * azimBin[tt] / (float)TEST_AOA_FFTSIZE - PI * elevSine[tt];
+
+                    radarCubeIdx = txAntIdx * testConfig->numChirps * testConfig->numRxAntennas *  testConfig->numRangeBins;
+                    radarCubeIdx += (ii * testConfig->numRxAntennas * testConfig->numRangeBins);
+                    radarCubeIdx += (jj * testConfig->numRangeBins);
+                    radarCubeIdx += rangeIdx;
+                    testRadarCube[radarCubeIdx].real = (int16_t)MATHUTILS_ROUND_FLOAT(500.f * cosf(phase));
+                    testRadarCube[radarCubeIdx].imag = (int16_t)MATHUTILS_ROUND_FLOAT(500.f * sinf(phase));
+                }
+            }
+        }
+
+        for (interp = 0; interp < 2; interp++)
+        {
+            testPass = 1;
+            Test_setProfile(testConfig);
+            cfarDetObjList[0].rangeIdx = rangeIdx;
+            cfarDetObjList[0].dopplerIdx = 0;
+            aoaCfg.res.cfarRngDopSnrListSize = 1;
+            aoaCfg.dynCfg.prepareRangeAzimuthHeatMap = false;
+            aoaCfg.dynCfg.angleInterpCfg.enabled = interp;
+            aoaDynBmCfg.enabled = 0;
+
+            retVal = DPU_AoAProcDSP_config(aoaProcHandle, &aoaCfg);
+            if (retVal == 0)
+            {
+                retVal = DPU_AoAProcDSP_process(aoaProcHandle, 1, &outAoaProc);
+            }
+            if ((retVal < 0) || (outAoaProc.numAoADetectedPoints != 1))
+            {
+                System_printf("  azimuth bin %f, interp %d : error %d, aoaOut=%d FAIL\n", azimBin[tt], interp, retVal,
+                              outAoaProc.numAoADetectedPoints);
+                finalResults = 0;
+                continue;
+            }
+
+            Wx = aoaCfg.res.detObjOut[0].x / range;
+            Wz = aoaCfg.res.detObjOut[0].z / range;
+            WxErr = fabs(Wx - 2.f * azimBin[tt] / (float)TEST_AOA_FFTSIZE);
+            WzErr = fabs(Wz - elevSine[tt]);
+            if ((WxErr > (interp ? (0.2f / TEST_AOA_FFTSIZE) : (1.01f / TEST_AOA_FFTSIZE))) ||
+                (WzErr > TEST_ANGLE_INTERP_MAX_WZ_ERROR))
+            {
+                finalResults = 0;
+                testPass = 0;
+            }
+
+            System_printf("  azimuth bin %f, interp %d : Wx error %f, Wz error %f %s\n", azimBin[tt], interp,
+                          WxErr, WzErr, testPass ? "PASS" : "FAIL");
+        }
+    }
+
+    aoaCfg.dynCfg.angleInterpCfg.enabled = 0;
+}
+
+/**
+*  @b Description
+*  @n
+*     Range bin grouping. A CFAR list with repeated range bins, not ordered by range bin,
+*     is processed detection by detection and then with the range bin grouping buffers.
+*     The grouped point cloud must be the detection by detection point cloud ordered by
+*     range bin, in CFAR list order within a range bin, and each range bin must be
+*     fetched once. The same list sorted by range bin, which is used without reordering,
+*     is run as well. Runs once.
+*
+*  @retval None
+*
+*/
+void Test_rangeBinGrouping(aoaProcDpuTestConfig_t * testConfig)
+{
+    uint32_t ii, jj, ll, numDistinct, orderIdx;
+    uint32_t order[TEST_GROUPING_NUM_DET];
+    int32_t retVal;
+    uint8_t testPass;
+    DPIF_CFARDetList tmpDet;
+    uint16_t rangeIdx;
+    /* range bin offset and Doppler index of the detections */
+    const uint16_t rangeOffset[TEST_GROUPING_NUM_DET] = {3, 0, 3, 1, 0, 3, 1, 2};
+    const uint16_t dopplerIdx[TEST_GROUPING_NUM_DET] = {1, 2, 5, 0, 7, 9, 3, 4};
+
+    if (rangeBinGroupingTestDone || (testConfig->numTxAntennas * testConfig->numRxAntennas < 8) ||
+        testConfig->bpmFlag || (testConfig->numDopplerBins > TEST_GROUPING_MAX_NUM_DOPPLER_BINS) ||
+        (testConfig->numRangeBins > TEST_MAX_NUM_RANGE_BIN_HEATMAP))
+    {
+        return;
+    }
+    rangeBinGroupingTestDone = 1;
+
+    System_printf("Range bin grouping\n");
+    rangeIdx = testConfig->numRangeBins / 4;
+    for (ii = 0; ii < TEST_GROUPING_NUM_DET; ii++)
+    {
+        groupingDetObjList[ii].rangeIdx = rangeIdx + rangeOffset[ii];
+        groupingDetObjList[ii].dopplerIdx = dopplerIdx[ii] & (testConfig->numDopplerBins - 1);
+        groupingDetObjList[ii].snr = 10;
+        groupingDetObjList[ii].noise = 10;
+    }
+
+    Test_setProfile(testConfig);
+    aoaCfg.res.cfarRngDopSnrList = groupingDetObjList;
+    aoaCfg.res.cfarRngDopSnrListSize = TEST_GROUPING_NUM_DET;
+    aoaCfg.res.detObjOutMaxSize = TEST_GROUPING_NUM_DET;
+    aoaCfg.dynCfg.prepareRangeAzimuthHeatMap = false;
+    aoaDynBmCfg.enabled = 0;
+    aoaDynFovCfg.minAzimuthDeg = -90.;
+    aoaDynFovCfg.maxAzimuthDeg = 90.;
+    aoaDynFovCfg.minElevationDeg = -90.;
+    aoaDynFovCfg.maxElevationDeg = 90.;
+
+    /* unsorted list, then the same list sorted by range bin */
+    for (ll = 0; ll < 2; ll++)
+    {
+        testPass = 1;
+
+        /* detection by detection reference */
+        aoaCfg.res.rangeBinDopplerFftBuf = NULL;
+        aoaCfg.res.detObjRangeBinOrder = NULL;
+        retVal = DPU_AoAProcDSP_config(aoaProcHandle, &aoaCfg);
+        if (retVal == 0)
+        {
+            retVal = DPU_AoAProcDSP_process(aoaProcHandle, TEST_GROUPING_NUM_DET, &outAoaProc);
+        }
+        if ((retVal < 0) || (outAoaProc.numAoADetectedPoints != TEST_GROUPING_NUM_DET) ||
+            (outAoaProc.numRangeBinFetches != TEST_GROUPING_NUM_DET))
+        {
+            System_printf("  reference: error %d, aoaOut=%d FAIL\n", retVal, outAoaProc.numAoADetectedPoints);
+            finalResults = 0;
+            break;
+        }
+        memcpy(groupingDetObjRef, aoaCfg.res.detObjOut, sizeof(groupingDetObjRef));
+        memcpy(groupingAzimIdxRef, aoaCfg.res.detObj2dAzimIdx, sizeof(groupingAzimIdxRef));
+
+        /* expected order: stable by range bin */
+        numDistinct = 0;
+        orderIdx = 0;
+        for (rangeIdx = 0; rangeIdx < testConfig->numRangeBins; rangeIdx++)
+        {
+            jj = orderIdx;
+            for (ii = 0; ii < TEST_GROUPING_NUM_DET; ii++)
+            {
+                if (groupingDetObjList[ii].rangeIdx == rangeIdx)
+                {
+                    order[orderIdx++] = ii;
+                }
+            }
+            if (orderIdx > jj)
+            {
+                numDistinct++;
+            }
+        }
+
+        /* too small order buffer must be rejected */
+        aoaCfg.res.rangeBinDopplerFftBuf = aoaRangeBinDopplerFftBuf;
+        aoaCfg.res.rangeBinDopplerFftBufSize = sizeof(aoaRangeBinDopplerFftBuf);
+        aoaCfg.res.detObjRangeBinOrder = aoaDetObjRangeBinOrder;
+        aoaCfg.res.detObjRangeBinOrderSize = testConfig->numRangeBins + TEST_GROUPING_NUM_DET;
+        if (DPU_AoAProcDSP_config(aoaProcHandle, &aoaCfg) != DPU_AOAPROCDSP_ESCRATCHSIZE)
+        {
+            System_printf("  order buffer size not checked FAIL\n");
+            testPass = 0;
+        }
+
+        aoaCfg.res.detObjRangeBinOrderSize = testConfig->numRangeBins + 1 + TEST_GROUPING_NUM_DET;
+        retVal = DPU_AoAProcDSP_config(aoaProcHandle, &aoaCfg);
+        if (retVal == 0)
+        {
+            retVal = DPU_AoAProcDSP_process(aoaProcHandle, TEST_GROUPING_NUM_DET, &outAoaProc);
+        }
+        if ((retVal < 0) || (outAoaProc.numAoADetectedPoints != TEST_GROUPING_NUM_DET))
+        {
+            System_printf("  grouped: error %d, aoaOut=%d FAIL\n", retVal, outAoaProc.numAoADetectedPoints);
+            finalResults = 0;
+            break;
+        }
+
+        for (ii = 0; ii < TEST_GROUPING_NUM_DET; ii++)
+        {
+            jj = order[ii];
+            if ((aoaCfg.res.detObjOut[ii].x != groupingDetObjRef[jj].x) ||
+                (aoaCfg.res.detObjOut[ii].y != groupingDetObjRef[jj].y) ||
+                (aoaCfg.res.detObjOut[ii].z != groupingDetObjRef[jj].z) ||
+                (aoaCfg.res.detObjOut[ii].velocity != groupingDetObjRef[jj].velocity) ||
+                (aoaCfg.res.detObj2dAzimIdx[ii] != groupingAzimIdxRef[jj]))
+            {
+                testPass = 0;
+            }
+        }
+        if (outAoaProc.numRangeBinFetches != numDistinct)
+        {
+            testPass = 0;
+        }
+
+        if (!testPass)
+        {
+            finalResults = 0;
+        }
+        System_printf("  %s list: %d range bin fetches for %d detections %s\n", (ll == 0) ? "unsorted" : "sorted",
+                      outAoaProc.numRangeBinFetches, TEST_GROUPING_NUM_DET, testPass ? "PASS" : "FAIL");
+
+        /* sort the list by range bin for the second run */
+        for (ii = 1; ii < TEST_GROUPING_NUM_DET; ii++)
+        {
+            tmpDet = groupingDetObjList[ii];
+            for (jj = ii; (jj > 0) && (groupingDetObjList[jj - 1].rangeIdx > tmpDet.rangeIdx); jj--)
+            {
+                groupingDetObjList[jj] = groupingDetObjList[jj - 1];
+            }
+            groupingDetObjList[jj] = tmpDet;
+        }
+    }
+
+    aoaCfg.res.rangeBinDopplerFftBuf = NULL;
+    aoaCfg.res.rangeBinDopplerFftBufSize = 0;
+    aoaCfg.res.detObjRangeBinOrder = NULL;
+    aoaCfg.res.detObjRangeBinOrderSize = 0;
+    aoaCfg.res.detObjOutMaxSize = TEST_MAX_NUM_CFARDETOBJ_DPU;
+    aoaCfg.res.cfarRngDopSnrList = cfarDetObjList;
+}
+
+/**
+*  @b Description
+*  @n
+*     Compare the mathlib functions used by the AoA DPU (sqrtsp, atan2sp, sinsp, cossp)
+*     against libm over the input ranges seen in the peak interpolation, XYZ estimation
+*     and Doppler compensation, against the error bounds stated in aoaprocdsp.c, and
+*     report the cycles per call of both.
+*
+*  @retval None
+*
+*/
+void Test_fastMathCheck(void)
+{
+    uint32_t ii;
+    uint32_t startTime, fastCycles, libmCycles;
+    float x, y;
+    float err, maxErr[4] = {0.f, 0.f, 0.f, 0.f};
+    volatile float acc = 0.f;
+    const char *funcName[4] = {"sqrtsp", "atan2sp", "sinsp", "cossp"};
+    uint8_t testPass = 1;
+
+    /* accuracy: relative error of sqrt over 1 - Wz^2 in [0, 1) and over log spaced inputs
+       from 1e-6 to 1e19, which covers the object range squared and the magnitude squared
+       of the 32 bit azimuth FFT output; absolute error of atan2 of any phase and of sin/cos
+       over one period */
+    for (ii = 0; ii < TEST_FAST_MATH_NUM_SAMPLES; ii++)
+    {
+        x = (float)(ii + 1) / TEST_FAST_MATH_NUM_SAMPLES;
+        err = fabs(sqrtsp(x) - sqrtf(x)) / sqrtf(x);
+        if (err > maxErr[0])
+            maxErr[0] = err;
+
+        x = powf(10.f, -6.f + 25.f * ii / TEST_FAST_MATH_NUM_SAMPLES);
+        err = fabs(sqrtsp(x) - sqrtf(x)) / sqrtf(x);
+        if (err > maxErr[0])
+            maxErr[0] = err;
+
+        x = 2.f * PI * ii / TEST_FAST_MATH_NUM_SAMPLES - PI;
+        y = 1000.f * cosf(x);
+        err = fabs(atan2sp(1000.f * sinf(x), y) - atan2f(1000.f * sinf(x), y));
+        if ((err > maxErr[1]) && (err < PI))  /* +pi and -pi are the same angle */
+            maxErr[1] = err;
+
+        err = fabs(sinsp(x) - sinf(x));
+        if (err > maxErr[2])
+            maxErr[2] = err;
+
+        err = fabs(cossp(x) - cosf(x));
+        if (err > maxErr[3])
+            maxErr[3] = err;
+    }
+
+    if (sqrtsp(0.f) != 0.f)
+    {
+        maxErr[0] = 1.f;
+    }
+
+    if (maxErr[0] > MAX_FAST_MATH_SQRT_REL_ERROR)
+    {
+        testPass = 0;
+        finalResults = 0;
+    }
+    for (ii = 1; ii < 4; ii++)
+    {
+        if (maxErr[ii] > MAX_FAST_MATH_ERROR)
+        {
+            testPass = 0;
+            finalResults = 0;
+        }
+    }
+
+    System_printf("Fast math max error : sqrt %e relative, atan2 %e, sin %e, cos %e absolute %s\n",
+                  maxErr[0], maxErr[1], maxErr[2], maxErr[3], testPass ? "PASS" : "FAIL");
+
+    /* cycles per call */
+    for (ii = 0; ii < 4; ii++)
+    {
+        uint32_t jj;
+
+        startTime = Cycleprofiler_getTimeStamp();
+        for (jj = 1; jj <= TEST_FAST_MATH_NUM_SAMPLES; jj++)
+        {
+            x = (float)jj / TEST_FAST_MATH_NUM_SAMPLES;
+            if (ii == 0)
+                acc += sqrtsp(x);
+            else if (ii == 1)
+                acc += atan2sp(x, 1.f - x);
+            else if (ii == 2)
+                acc += sinsp(x);
+            else
+                acc += cossp(x);
+        }
+        fastCycles = Cycleprofiler_getTimeStamp() - startTime;
+
+        startTime = Cycleprofiler_getTimeStamp();
+        for (jj = 1; jj <= TEST_FAST_MATH_NUM_SAMPLES; jj++)
+        {
+            x = (float)jj / TEST_FAST_MATH_NUM_SAMPLES;
+            if (ii == 0)
+                acc += sqrtf(x);
+            else if (ii == 1)
+                acc += atan2f(x, 1.f - x);
+            else if (ii == 2)
+                acc += sinf(x);
+            else
+                acc += cosf(x);
+        }
+        libmCycles = Cycleprofiler_getTimeStamp() - startTime;
+
+        System_printf("  %s : %d cycles per call, libm %d cycles per call\n", funcName[ii],
+                      fastCycles / TEST_FAST_MATH_NUM_SAMPLES, libmCycles / TEST_FAST_MATH_NUM_SAMPLES);
+    }
+}
+
+/**
+*  @b Description
+*  @n
+*     Generate 2D windowing coefficients.
+*
+*  @retval None
+*
+*/
+void Test_window2DCoef_gen(uint32_t numSamples, uint8_t winType, int32_t *winPtr)
+{
+    float ephyR, ephyI;
+    float phi = 2 * PI_ / ((float)numSamples - 1);
+
+
+    uint32_t ii;
+    float a0;
+    float winValue;
+    int32_t winValueFixed;
+    float cosValue, sinValue;
+    float temp;
+
+
+    cosValue = 1.f;
+    sinValue = 0.f;
+
+    ephyR = cos(phi);
+    ephyI = sin(phi);
+    a0 = 0.5f;
+
+
+    if (winType == 1)
+    {
+        for (ii = 0; ii < numSamples; ii++)
+        {
+            winPtr[ii] = (1 << 17) - 1; //rec window, for debug
+        }
+    }
+    else
+    {
+        /* hanning window */
+        for (ii = 0; ii < numSamples; ii++)
+        {
+            winValue = a0 * (1.f - cosValue);       //0.5*(1-cos(2*pi*n/N-1))
+
+            winValue = winValue * (1 << 17) + 0.5;     //Q17 format
+            winValueFixed = (uint32_t)winValue;
+            if (winValueFixed >= (1 << 17))
+            {
+                winValueFixed = (1 << 17) - 1;
+            }
+            temp = cosValue;
+            cosValue = cosValue * ephyR - sinValue * ephyI;
+            sinValue = temp * ephyI + sinValue * ephyR;
+
+            //winPtr[ii] = (1<<17) - 1; //rec window, for debug
+            winPtr[ii] = winValueFixed;
+        }
+    }
+
+}
+
+
+/**
+*  @b Description
+*  @n
+*     test main task  : Generate the radar cuba data based on the test configuration, and generate the cfar detected
+*                       object list. The cuba data and the detected object list are sent to AOA dpu. The DPU outputs
+*                       the deteced object azimth and elevation angle, which are checked against the test configuration.
+*                       If the differece is within the error threshold, the test is declared PASS, otherwise, it is declared
+*                       FAIL. The tests cover 5 TX/RX antenna setups, 1/1, 1/2, 1/4, 2/4 and 3/4. 
+*
+*  @retval None
+*
+*/
+
+void Test_task(UArg arg0, UArg arg1)
+{
+    uint32_t ii, jj, kk, kk1;
+   
+    char featureName[200];
+    uint16_t numAntennas[TEST_ANTENNA_LOOP][2] = {
+        /* numTx, numRx*/
+        {1, 1},
+        {1, 2},
+        {1, 4},
+        {2, 4},
+        {3, 4}
+    };
+    
+    uint32_t numDopplerBin[TEST_DOPPLER_BIN_SIZE] = {16, 32, 64, 128, 256, 512};
+    uint32_t numRangeBin[TEST_RANGE_BIN_SIZE] = { 16, 32, 64, 128, 256, 512, 1024 };
+    uint32_t numTests;
+    int32_t   retVal;
+    uint16_t dopplerLoopStep;
+    uint16_t numRangeBinSize;
+    uint16_t idx;
+    uint32_t maxNumChirps,mm;
+    
+    finalResults = 1;
+    System_printf("...... Initialization ...... \n");
+
+    /* edma, dpu inialization */
+    aoaProc_test_Edmainit();
+    aoaProc_test_dpuInit();
+
+    /* aoa dpu config*/
+    aoaProc_test_dpuConfig();
+
+    /* accuracy and cycles of the mathlib functions used by the DPU */
+    Test_fastMathCheck();
+    
+    System_printf("aoa Proc DPU Test start ...... \n");
+    
+    /*for tx/rx1,1, only run 3 doppler size, each with 1 range bin size */
+    numTests = 9; 
+    /* antenne combination * doppler size, 2 range bin size, for each doppler bin size, chirp even, odd, maximum */
+#if (defined (SOC_XWR16XX))
+    numTests += (TEST_ANTENNA_LOOP - 2) * TEST_DOPPLER_BIN_SIZE * 2 * 3;
+#endif
+#if ( (defined (SOC_XWR68XX)) ||  (defined (SOC_XWR18XX)))    
+    numTests += (TEST_ANTENNA_LOOP - 1) * TEST_DOPPLER_BIN_SIZE * 2 * 3;
+#endif
+   
+    printf("\n...... %d Tests to be run .......\n\n", numTests);
+
+    testCount = 0;
+#if (defined (SOC_XWR16XX))
+    for (ii = 0; ii < TEST_ANTENNA_LOOP - 1; ii++) /* antenna loop, for 16xx, not support tx=3 */
+    {
+#endif
+#if ( (defined (SOC_XWR68XX)) ||  (defined (SOC_XWR18XX)))
+     for (ii = 0; ii < TEST_ANTENNA_LOOP; ii++) /* antenna loop */
+     {
+#endif
+        dopplerLoopStep = 1;
+        numRangeBinSize = 2;
+        if (ii == 0)
+        {
+            dopplerLoopStep = 2;
+            numRangeBinSize = 1; //for 1tx, 1rx, 1 range bin size
+        }
+       
+        for (jj = 0; jj < TEST_DOPPLER_BIN_SIZE; jj += dopplerLoopStep) /* doppler size loop*/
+        {
+            aoaTestCfg.numTxAntennas = numAntennas[ii][0];
+            aoaTestCfg.numRxAntennas = numAntennas[ii][1];
+            aoaTestCfg.numDopplerBins = numDopplerBin[jj];       //NOT TEST OVERSAMPLING
+
+            maxNumChirps = 16384 / aoaTestCfg.numTxAntennas / aoaTestCfg.numRxAntennas / 4;
+            if (maxNumChirps > aoaTestCfg.numDopplerBins)
+                maxNumChirps = aoaTestCfg.numDopplerBins;
+
+            for (mm = 0; mm < 3; mm++)
+            {
+                for (kk = 0; kk < numRangeBinSize; kk++) /* range bin size loop, random pick range bin size */
+                {
+                    /* randomly find the range bin sizes*/
+                    if ((aoaTestCfg.numTxAntennas == 1)) //||( (aoaTestCfg.numTxAntennas == 2) &&(aoaTestCfg.numRangeBins==2)))
+                    {
+                        if (aoaTestCfg.numDopplerBins <= 16)
+                        {
+                            kk1 = testCount + kk * 5;
+                            kk1 = test_modCalc(kk1, TEST_RANGE_BIN_SIZE); 
+                        }
+                        else
+                        {
+                            kk1 = testCount + kk * ((TEST_RANGE_BIN_SIZE + 1 - jj) / 2);
+                            kk1 = test_modCalc(kk1, (TEST_RANGE_BIN_SIZE + 1 - jj));  
+                        }
+                    }
+                    else 
+                    {
+                        kk1 = testCount + kk * ((TEST_RANGE_BIN_SIZE - 1 - jj) / 2);
+                        kk1 = test_modCalc(kk1, (TEST_RANGE_BIN_SIZE - 1 - jj));  //maximum range size is 256,... 
+                    }
+                    aoaTestCfg.numRangeBins = numRangeBin[kk1];
+
+                    /* set up the number of chirps <= doppler bin size*/
+                    aoaTestCfg.numChirps = aoaTestCfg.numDopplerBins;
+                    
+                   if (aoaTestCfg.numDopplerBins == 16)
                         aoaTestCfg.numChirps = 16 - ((mm + kk) & 0x7);
                     else
                     {
@@ -1699,7 +3051,7 @@ void Test_task(UArg arg0, UArg arg1)
                         }
 
                     }
-                    aoaTestCfg.numChirps = aoaTestCfg.numChirps / 4 * 4; //must be multiple of 4
+                    aoaTestCfg.numChirps = aoaTestCfg.numChirps / 2 * 2; //must be multiple of 2
 
                     /* multiple peaks */
                     aoaTestCfg.twoPeaksFlag = 0;
@@ -1807,6 +3159,7 @@ void Test_task(UArg arg0, UArg arg1)
                      {
                          System_printf("Check the AOA output :  ");
                          Test_printResults(&aoaTestCfg);
+                         Test_compactPointCloud();
                         
                          /* run one more time for min/max angle checking */
                          if (aoaTestCfg.minmaxAngleFlag)
@@ -1822,6 +3175,33 @@ void Test_task(UArg arg0, UArg arg1)
                         
                          }
                         
+                         /* incremental heat map, once; uses the radar cube of this test */
+                         Test_heatMapUpdate(&aoaTestCfg);
+
+                         /* range bin grouping against detection by detection, once */
+                         Test_rangeBinGrouping(&aoaTestCfg);
+
+                         /* angle FFT size sweep on the last Doppler size of each antenna configuration */
+                         if ((jj == TEST_DOPPLER_BIN_SIZE - 1) && (mm == 0) && (kk == 0))
+                         {
+                             Test_angleFftSizeSweep(&aoaTestCfg);
+                         }
+
+                         /* N peak multi object beam forming, once */
+                         Test_multiPeakBeamForming(&aoaTestCfg);
+
+                         /* extended maximum velocity, once per number of Tx antennas */
+                         Test_extMaxVelocity(&aoaTestCfg);
+
+                         /* Capon heat map, once */
+                         Test_caponHeatMap(&aoaTestCfg);
+
+                         /* 2D angle FFT over an antenna geometry table, once */
+                         Test_antennaGeometry(&aoaTestCfg);
+
+                         /* sub-bin azimuth interpolation with elevation, once */
+                         Test_angleInterp(&aoaTestCfg);
+
                          System_printf("Test #%d finished!\n\r", testCount);
                      }
                     
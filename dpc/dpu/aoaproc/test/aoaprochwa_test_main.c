@@ -108,6 +108,8 @@
 #define TWOPEAK_POSITIVE_THRESHOLD 0.65f
 #define TWOPEAK_NEGTIVE_THRESHOLD 0.95f
 #define CUBADATA_PHASE_SHIFT 8.f
+#define TEST_ANGLE_INTERP_NUM_TARGETS 4
+#define TEST_ANGLE_INTERP_MAX_WZ_ERROR 0.005f  //sub-bin bias of 2 * (Wx - WxBin) is about 0.025
 #define TEST_ANTENNA_LOOP 5   /* number of tx/rx combination */
 #define TEST_DOPPLER_BIN_SIZE 9 // test doppler size covers from 2 to 512, tests for doppler bin = 1024 is added at the end */
 #define TEST_RANGE_BIN_SIZE 7   //tested range bin size from 16 to 1024
@@ -339,6 +341,7 @@ HWA_Handle  hwaHandle;
 MCPI_LOGBUF_INIT(128);
 
 uint8_t finalResults;
+uint8_t angleInterpTestDone = 0;
 
 DPU_AoAProcHWA_Config        aoaCfg;
 DPU_AoAProcHWA_Handle        aoaProcHandle;
@@ -1917,6 +1920,111 @@ void Test_printResults(aoaProcDpuTestConfig_t * testConfig)
     System_printf("\n");
 }
 
+/**
+*  @b Description
+*  @n
+*     Sub-bin azimuth interpolation with elevation, 3Tx 4Rx. Noise free targets are
+*     generated off the 64 point angle grid, at 0.4 bin from the nearest bin, each with
+*     an elevation. Without interpolation the azimuth error must be within half a bin,
+*     with interpolation within a tenth of a bin. In both cases z / range must match the
+*     generated elevation sine, the elevation phase difference being referenced to the
+*     azimuth peak bin centre. Runs once.
+*
+*  @retval None
+*
+*/
+void Test_angleInterp(aoaProcDpuTestConfig_t * testConfig)
+{
+    uint32_t ii, jj, txAntIdx, tt, interp;
+    uint32_t radarCubeIdx;
+    uint16_t rangeIdx;
+    int32_t retVal;
+    float phase, range, Wx, Wz, WxErr, WzErr;
+    uint8_t testPass;
+    const float azimBin[TEST_ANGLE_INTERP_NUM_TARGETS] = {9.4f, -7.6f, 3.4f, -12.4f};
+    const float elevSine[TEST_ANGLE_INTERP_NUM_TARGETS] = {0.3f, -0.2f, 0.1f, -0.35f};
+
+    if (angleInterpTestDone || (testConfig->numTxAntennas != 3) || (testConfig->numRxAntennas != 4) ||
+        (testConfig->numDopplerBins > 64))
+    {
+        return;
+    }
+    angleInterpTestDone = 1;
+
+    System_printf("Angle interpolation with elevation\n");
+    rangeIdx = testConfig->numRangeBins / 2;
+    range = (float)rangeIdx - aoaDynOutCompRxCfg.rangeBias;
+    for (tt = 0; tt < TEST_ANGLE_INTERP_NUM_TARGETS; tt++)
+    {
+        /* noise free target at Doppler bin 0 */
+        memset(testRadarCube, 0, sizeof(cmplx16ImRe_t) * testConfig->numRangeBins * testConfig->numChirps * testConfig->numTxAntennas * testConfig->numRxAntennas);
+        for (ii = 0; ii < testConfig->numChirps; ii++)
+        {
+            for (txAntIdx = 0; txAntIdx < testConfig->numTxAntennas; txAntIdx++)
+            {
+                for (jj = 0; jj < testConfig->numRxAntennas; jj++)
+                {
+                    if (txAntIdx < 2)
+                        phase = 2.f * PI * (txAntIdx * testConfig->numRxAntennas + jj) * azimBin[tt] / (float)TEST_AOA_FFTSIZE;
+                    else
+                        phase = 2.f * PI * (2 + jj) * azimBin[tt] / (float)TEST_AOA_FFTSIZE - PI * elevSine[tt];
+
+                    radarCubeIdx = txAntIdx * testConfig->numChirps * testConfig->numRxAntennas *  testConfig->numRangeBins;
+                    radarCubeIdx += (ii * testConfig->numRxAntennas * testConfig->numRangeBins);
+                    radarCubeIdx += (jj * testConfig->numRangeBins);
+                    radarCubeIdx += rangeIdx;
+                    testRadarCube[radarCubeIdx].real = (int16_t)MATHUTILS_ROUND_FLOAT(500.f * cosf(phase));
+                    testRadarCube[radarCubeIdx].imag = (int16_t)MATHUTILS_ROUND_FLOAT(500.f * sinf(phase));
+                }
+            }
+        }
+
+        for (interp = 0; interp < 2; interp++)
+        {
+            testPass = 1;
+            pCfarDetObjList = &cfarDetObjList[0];
+            pAoaDetObj = &aoaDetObj[0];
+            Test_setProfile(testConfig);
+            cfarDetObjList[0].rangeIdx = rangeIdx;
+            cfarDetObjList[0].dopplerIdx = 0;
+            aoaCfg.res.cfarRngDopSnrListSize = 1;
+            aoaCfg.dynCfg.prepareRangeAzimuthHeatMap = false;
+            aoaCfg.dynCfg.angleInterpCfg.enabled = interp;
+            aoaDynBmCfg.enabled = 0;
+            extMaxVelCfg.enabled = 0;
+
+            retVal = DPU_AoAProcHWA_config(aoaProcHandle, &aoaCfg);
+            if (retVal == 0)
+            {
+                retVal = DPU_AoAProcHWA_process(aoaProcHandle, 1, &outAoaProc);
+            }
+            if ((retVal < 0) || (outAoaProc.numAoADetectedPoints != 1))
+            {
+                System_printf("  azimuth bin %f, interp %d : error %d, aoaOut=%d FAIL\n", azimBin[tt], interp, retVal,
+                              outAoaProc.numAoADetectedPoints);
+                finalResults = 0;
+                continue;
+            }
+
+            Wx = aoaCfg.res.detObjOut[0].x / range;
+            Wz = aoaCfg.res.detObjOut[0].z / range;
+            WxErr = fabs(Wx - 2.f * azimBin[tt] / (float)TEST_AOA_FFTSIZE);
+            WzErr = fabs(Wz - elevSine[tt]);
+            if ((WxErr > (interp ? (0.2f / TEST_AOA_FFTSIZE) : (1.01f / TEST_AOA_FFTSIZE))) ||
+                (WzErr > TEST_ANGLE_INTERP_MAX_WZ_ERROR))
+            {
+                finalResults = 0;
+                testPass = 0;
+            }
+
+            System_printf("  azimuth bin %f, interp %d : Wx error %f, Wz error %f %s\n", azimBin[tt], interp,
+                          WxErr, WzErr, testPass ? "PASS" : "FAIL");
+        }
+    }
+
+    aoaCfg.dynCfg.angleInterpCfg.enabled = 0;
+}
+
 /**
 *  @b Description
 *  @n
@@ -2377,6 +2485,9 @@ void Test_task(UArg arg0, UArg arg1)
 
                         }
 
+                        /* sub-bin azimuth interpolation with elevation, once */
+                        Test_angleInterp(&aoaTestCfg);
+
                         System_printf("Test #%d finished!\n\r", testCount);
                     }
                     
@@ -18,6 +18,7 @@ DSPAOAPROC_DSS_TEST_STD_LIBS = $(C674_COMMON_STD_LIB)								\
                         -llibtestlogger_$(MMWAVE_SDK_DEVICE_TYPE).$(C674_LIB_EXT) \
 						-llibaoaproc_dsp_$(MMWAVE_SDK_DEVICE_TYPE).$(C674_LIB_EXT) \
                			-ldsplib.ae64P	\
+                        -lmathlib.$(C674_LIB_EXT) 				\
                         -llibmmwavealg_$(MMWAVE_SDK_DEVICE_TYPE).$(C674_LIB_EXT) 
                         
 ifneq ($(filter $(MMWAVE_SDK_DEVICE_TYPE),xwr18xx xwr68xx), )
@@ -32,6 +33,7 @@ DSPAOAPROC_DSS_TEST_LOC_LIBS = $(C674_COMMON_LOC_LIB)								\
 						-i$(MMWAVE_SDK_INSTALL_PATH)/ti/datapath/dpc/dpu/aoaproc/lib \
 						-i$(MMWAVE_SDK_INSTALL_PATH)/ti/datapath/dpedma/lib \
               			-i$(C64Px_DSPLIB_INSTALL_PATH)/packages/ti/dsplib/lib \
+                        -i$(C674x_MATHLIB_INSTALL_PATH)/packages/ti/mathlib/lib \
                         -i$(MMWAVE_SDK_INSTALL_PATH)/ti/alg/mmwavelib/lib
 
 
@@ -68,7 +70,8 @@ dspDssRTSC: $(DSPAOAPROC_DSS_TEST_CFG)
 # Build Unit Test:
 ###################################################################################
 aoaDspDssTest: BUILD_CONFIGPKG=$(DSPAOAPROC_DSS_TEST_CONFIGPKG)
-aoaDspDssTest: C674_CFLAGS += --cmd_file=$(BUILD_CONFIGPKG)/compiler.opt
+aoaDspDssTest: C674_CFLAGS += --cmd_file=$(BUILD_CONFIGPKG)/compiler.opt \
+                               -i$(C674x_MATHLIB_INSTALL_PATH)/packages
 aoaDspDssTest: C674_CFLAGS := $(filter-out $(OPTIMIZE_FOR_SPEED_OPTIONS),$(C674_CFLAGS))
 aoaDspDssTest: buildDirectories dspDssRTSC $(DSPAOAPROC_DSS_TEST_OBJECTS)
 	$(C674_LD) $(C674_LDFLAGS) $(DSPAOAPROC_DSS_TEST_LOC_LIBS) $(DSPAOAPROC_DSS_TEST_STD_LIBS) \
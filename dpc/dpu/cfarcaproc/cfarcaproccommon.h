@@ -223,6 +223,12 @@
  * like threshold scale and window/guard lengths to be set. The CFAR detection processing in
  * the Doppler domain can be bypassed by setting doppler direction's detection threshold to zero.
  *
+ * The threshold scale can optionally vary with range through a piecewise constant profile
+ * (@ref DPU_CFARCAProcDSP_DynamicConfig::rangeThresholdProfile or
+ * @ref DPU_CFARCAProcDSP_Cmd_RangeThresholdProfileCfg). The profile is expanded into a per range bin
+ * threshold table (@ref DPU_CFARCAProcDSP_HW_Resources::cfarThresholdLut) at the first processing
+ * call after a configuration change.
+ *
  * @subsection cfarcadsp_apis CFARCA DSP APIs
  *
  * - @ref DPU_CFARCAProcDSP_init DPU initialization function.
@@ -239,7 +245,8 @@
  *      - @ref DPU_CFARCAProcDSP_Cmd_CfarRangeCfg,
  *      - @ref DPU_CFARCAProcDSP_Cmd_CfarDopplerCfg,
  *      - @ref DPU_CFARCAProcDSP_Cmd_FovRangeCfg,
- *      - @ref DPU_CFARCAProcDSP_Cmd_FovDopplerCfg
+ *      - @ref DPU_CFARCAProcDSP_Cmd_FovDopplerCfg,
+ *      - @ref DPU_CFARCAProcDSP_Cmd_RangeThresholdProfileCfg
  *
  *  Full API details can be seen at @ref CFARCA_PROC_DPU_EXTERNAL */
 
@@ -305,6 +312,14 @@ extern "C" {
 /*! @brief Peak grouping scheme of CFAR detected objects based only on peaks of neighboring cells that are already detected by CFAR */
 #define DPU_CFAR_PEAK_GROUPING_CFAR_PEAK_BASED  2
 
+/*! @brief Peak grouping scheme based on local maximum of neighboring cells taken from detection matrix,
+ *         evaluated for whole range lines within the range domain CFAR pass. Same criterion as
+ *         @ref DPU_CFAR_PEAK_GROUPING_DET_MATRIX_BASED without a separate grouping pass.
+ *         The neighbor Doppler lines are brought in by synchronous EDMA transfers, up to
+ *         three per Doppler line with detections, so it pays off for dense detection
+ *         lists only. Only supported on the DSP version (cfarcaprocdsp.h) */
+#define DPU_CFAR_PEAK_GROUPING_LOCAL_MAX_FUSED  3
+
 /*! @brief  Convert peak/noise value to log10 value in 0.1dB
        Since, val = log2(|.|)* 2^Qformat = log10(|.|) / log10(2) * 2^Qformat
        Equation: output = 1/0.1 * 10log10(|.|^2) = 10 * [ val * 20log10(2) / 2^Qformat ] = val * 6.0 / 2^Qformat * 10
@@ -355,6 +370,91 @@ typedef struct DPU_CFARCAProc_CfarCfg_t
 
 } DPU_CFARCAProc_CfarCfg;
 
+/*! @brief Maximum number of segments of the range dependent CFAR threshold profile */
+#define DPU_CFARCAPROC_MAX_NUM_THRESHOLD_SEGMENTS   8U
+
+/**
+ * @brief
+ *  Segment of the range dependent CFAR threshold profile
+ *
+ * @details
+ *  The structure holds the CFAR threshold scales applied to all range bins
+ *  whose range lies at or below @ref rangeMax and above the @ref rangeMax of the
+ *  previous segment.
+ */
+typedef struct DPU_CFARCAProc_ThresholdSegment_t
+{
+    /*! @brief    Upper range limit of the segment in meters */
+    float          rangeMax;
+
+    /*! @brief    CFAR threshold scale in range domain for range bins of the segment */
+    uint16_t       thresholdScaleRange;
+
+    /*! @brief    CFAR threshold scale in Doppler domain for range bins of the segment */
+    uint16_t       thresholdScaleDoppler;
+} DPU_CFARCAProc_ThresholdSegment;
+
+/**
+ * @brief
+ *  Range dependent CFAR threshold profile configuration
+ *
+ * @details
+ *  The structure holds a piecewise constant threshold profile over range. When enabled,
+ *  the threshold scale of each range bin is taken from the segment covering the bin
+ *  instead of @ref DPU_CFARCAProc_CfarCfg::thresholdScale. Range bins beyond the last
+ *  segment use @ref DPU_CFARCAProc_CfarCfg::thresholdScale of the respective domain.
+ *  The CFAR in a domain is still enabled/disabled through
+ *  @ref DPU_CFARCAProc_CfarCfg::thresholdScale of that domain.
+ *  The noise averaging (@ref DPU_CFARCAProc_CfarCfg::noiseDivShift) is not part
+ *  of the profile because it is tied to the noise window length which is common to all range bins.
+ */
+typedef struct DPU_CFARCAProc_RangeThresholdProfileCfg_t
+{
+    /*! @brief    Profile 0-disabled, 1-enabled */
+    uint8_t        enabled;
+
+    /*! @brief    Number of valid segments, must be <= @ref DPU_CFARCAPROC_MAX_NUM_THRESHOLD_SEGMENTS.
+     *            Segments must be in increasing order of @ref DPU_CFARCAProc_ThresholdSegment::rangeMax */
+    uint8_t        numSegments;
+
+    /*! @brief    Profile segments */
+    DPU_CFARCAProc_ThresholdSegment segment[DPU_CFARCAPROC_MAX_NUM_THRESHOLD_SEGMENTS];
+} DPU_CFARCAProc_RangeThresholdProfileCfg;
+
+/**
+ * @brief
+ *  CFAR noise floor map configuration
+ *
+ * @details
+ *  The structure holds the configuration of the frame to frame persistent noise floor
+ *  map used by the Doppler domain CFAR. The map holds one noise floor per range bin and
+ *  Doppler region. It is updated with a first order IIR filter from the sliding window noise
+ *  estimate of every cell under test:
+ *
+ *      map = map + (regionNoise - map) / 2^alphaShift
+ *
+ *  When the map is enabled, Doppler domain detection compares each cell under test against
+ *  the map instead of its sliding window estimate, which makes the noise floor
+ *  steady from frame to frame. The noise estimation pass is only run every
+ *  @ref refreshPeriod frames, the frames in between only apply the threshold.
+ */
+typedef struct DPU_CFARCAProc_NoiseMapCfg_t
+{
+    /*! @brief    Noise map 0-disabled, 1-enabled */
+    uint8_t        enabled;
+
+    /*! @brief    Log2 of number of Doppler regions per range bin, must not exceed
+     *            log2 of number of Doppler bins */
+    uint8_t        log2NumDopplerRegions;
+
+    /*! @brief    IIR filter coefficient as shift, 0 - map is replaced by the
+     *            estimate of the latest refresh */
+    uint8_t        alphaShift;
+
+    /*! @brief    Number of frames between two noise estimation passes, 1 - every frame */
+    uint8_t        refreshPeriod;
+} DPU_CFARCAProc_NoiseMapCfg;
+
 /**
  * @brief
  *  Data processing Unit statistics
@@ -101,6 +101,26 @@ extern "C" {
  */
 #define DPU_CFARCAPROCDSP_DOPPLER_DET_OUT_BIT_MASK_BYTE_ALIGNMENT    (sizeof(uint32_t))
 
+/*! @brief Alignment for memory allocation purpose. There is CPU access of cfarThresholdLut
+ *         in the implementation.
+ */
+#define DPU_CFARCAPROCDSP_THRESHOLD_LUT_BYTE_ALIGNMENT    (sizeof(uint16_t))
+
+/**
+ * @brief   Noise floor map buffer byte alignment
+ */
+#define DPU_CFARCAPROCDSP_NOISE_MAP_BYTE_ALIGNMENT    (sizeof(uint16_t))
+
+/**
+ * @brief   Local maximum line buffer and mask byte alignment
+ */
+#define DPU_CFARCAPROCDSP_LOCAL_MAX_BYTE_ALIGNMENT    (sizeof(uint32_t))
+
+/**
+ * @brief   Maximum number of range tiles merged by @ref DPU_CFARCAProcDSP_mergeTileDetList
+ */
+#define DPU_CFARCAPROCDSP_MAX_NUM_RANGE_TILES    16U
+
 /**
 @}
 */
@@ -130,6 +150,22 @@ extern "C" {
  */
 #define DPU_CFARCAPROCDSP_EINVAL_EBUFFER_SIZE (DP_ERRNO_CFARCA_PROC_BASE-4)
 
+/**
+ * @brief   Error Code: Invalid range threshold profile configuration
+ */
+#define DPU_CFARCAPROCDSP_EINVAL__THRESHOLD_PROFILE             (DP_ERRNO_CFARCA_PROC_BASE-5)
+
+/**
+ * @brief   Error Code: Invalid noise floor map configuration
+ */
+#define DPU_CFARCAPROCDSP_EINVAL__NOISE_MAP                     (DP_ERRNO_CFARCA_PROC_BASE-6)
+
+/**
+ * @brief   Error Code: Invalid range tile configuration, or CFAR peak based grouping
+ *          enabled with range tiles
+ */
+#define DPU_CFARCAPROCDSP_EINVAL__RANGE_TILE                    (DP_ERRNO_CFARCA_PROC_BASE-7)
+
 /**
  * @brief   Error Code: Out of memory when allocating using MemoryP_osal
  */
@@ -175,6 +211,21 @@ extern "C" {
  */
 #define DPU_CFARCAPROCDSP_ENOMEM__INSUFFICIENT_SCRATCH_BUFFER    (DP_ERRNO_CFARCA_PROC_BASE-18)
 
+/**
+ * @brief   Error Code: Memory not aligned for @ref DPU_CFARCAProcDSP_HW_Resources::cfarThresholdLut
+ */
+#define DPU_CFARCAPROCDSP_ENOMEMALIGN_THRESHOLD_LUT             (DP_ERRNO_CFARCA_PROC_BASE-19)
+
+/**
+ * @brief   Error Code: Memory not aligned for noise floor map
+ */
+#define DPU_CFARCAPROCDSP_ENOMEMALIGN_NOISE_MAP                 (DP_ERRNO_CFARCA_PROC_BASE-21)
+
+/**
+ * @brief   Error Code: Memory not aligned for local maximum buffers
+ */
+#define DPU_CFARCAPROCDSP_ENOMEMALIGN_LOCAL_MAX                 (DP_ERRNO_CFARCA_PROC_BASE-22)
+
 /**
  * @brief   Error Code: Internal error
  */
@@ -211,7 +262,10 @@ extern "C" {
      DPU_CFARCAProcDSP_Cmd_FovRangeCfg,
 
      /*! @brief Command to update field of view in Doppler domain, minimum and maximum Doppler limits */
-     DPU_CFARCAProcDSP_Cmd_FovDopplerCfg
+     DPU_CFARCAProcDSP_Cmd_FovDopplerCfg,
+
+     /*! @brief Command to update range dependent CFAR threshold profile */
+     DPU_CFARCAProcDSP_Cmd_RangeThresholdProfileCfg
 }DPU_CFARCAProcDSP_Cmd;
 
 
@@ -276,6 +330,46 @@ typedef struct DPU_CFARCAProcDSP_HW_Resources_t
     /*! @brief      Scratch buffer size for cfar peak grouping.
      *              size = 4 * @ref cfarRngDopSnrListSize * sizeof(uint16_t) */
     uint32_t            cfarScrachBufferSize;
+
+    /*! @brief      Per range bin CFAR threshold table, first half for range domain and
+     *              second half for Doppler domain. It is generated by the DPU from
+     *              the thresholds and the range threshold profile and must persist
+     *              between calls of @ref DPU_CFARCAProcDSP_process. Must be aligned to
+     *              @ref DPU_CFARCAPROCDSP_THRESHOLD_LUT_BYTE_ALIGNMENT */
+    uint16_t            *cfarThresholdLut;
+
+    /*! @brief      Threshold table size in bytes, must be
+     *              numRangeBins * sizeof(uint16_t) * 2 */
+    uint32_t            cfarThresholdLutSize;
+
+    /*! @brief      Noise floor map, range bin major. Only needed when
+     *              @ref DPU_CFARCAProcDSP_StaticConfig::noiseMapCfg is enabled.
+     *              It must persist across frames and must not be shared with
+     *              other sub-frames. Must be aligned to
+     *              @ref DPU_CFARCAPROCDSP_NOISE_MAP_BYTE_ALIGNMENT */
+    uint16_t            *cfarNoiseMap;
+
+    /*! @brief      Noise floor map size in bytes, must be at least
+     *              numRangeBins * 2^log2NumDopplerRegions * sizeof(uint16_t) */
+    uint32_t            cfarNoiseMapSize;
+
+    /*! @brief      Scratch buffer holding three Doppler lines of the detection matrix and their
+     *              column maximum. Only needed for @ref DPU_CFAR_PEAK_GROUPING_LOCAL_MAX_FUSED.
+     *              Must be aligned to @ref DPU_CFARCAPROCDSP_LOCAL_MAX_BYTE_ALIGNMENT */
+    uint16_t            *cfarLocalMaxLineBuffer;
+
+    /*! @brief      Local maximum line buffer size in bytes, must be at least
+     *              (4 * numRangeBins + 4) * sizeof(uint16_t) */
+    uint32_t            cfarLocalMaxLineBufferSize;
+
+    /*! @brief      Scratch bit mask of local maximum cells of one Doppler line. Only needed for
+     *              @ref DPU_CFAR_PEAK_GROUPING_LOCAL_MAX_FUSED. Must be aligned to
+     *              @ref DPU_CFARCAPROCDSP_LOCAL_MAX_BYTE_ALIGNMENT */
+    uint32_t            *cfarLocalMaxMask;
+
+    /*! @brief      Local maximum bit mask size in number of uint32_t words, must be at least
+     *              (numRangeBins + 31) / 32 */
+    uint32_t            cfarLocalMaxMaskSize;
 } DPU_CFARCAProcDSP_HW_Resources;
 
 /**
@@ -301,6 +395,10 @@ typedef struct DPU_CFARCAProcDSP_DynamicConfig_t
 
     /*! @brief      Field of view configuration in Doppler domain */
     DPU_CFARCAProc_FovCfg *fovDoppler;
+
+    /*! @brief      Range dependent threshold profile configuration, NULL means
+     *              profile is disabled */
+    DPU_CFARCAProc_RangeThresholdProfileCfg *rangeThresholdProfile;
 } DPU_CFARCAProcDSP_DynamicConfig;
 
 /**
@@ -329,6 +427,28 @@ typedef struct DPU_CFARCAProcDSP_StaticConfig_t
 
     /*! @brief  Doppler conversion factor for Doppler FFT index to m/s */
     float       dopplerStep;
+
+    /*! @brief  Noise floor map configuration */
+    DPU_CFARCAProc_NoiseMapCfg noiseMapCfg;
+
+    /*! @brief  Flag to reset the noise floor map, 1 - the map is rebuilt from the first
+     *          processed frame. Set to 0 when reconfiguring the DPU on sub-frame switch
+     *          to keep the map learned in earlier frames. */
+    uint8_t     resetNoiseMap;
+
+    /*! @brief  First range bin of the range tile processed by this instance, must be even */
+    uint16_t    rangeTileStartIdx;
+
+    /*! @brief  Number of range bins of the range tile, must be even.
+     *          0 - the instance processes all range bins.
+     *          Detections are reported only inside the tile, range domain CFAR
+     *          additionally reads guardLen + winLen halo bins on each side of the tile,
+     *          so instances working on adjacent tiles of the same detection matrix
+     *          produce together the same detections as one instance over all range bins,
+     *          see @ref DPU_CFARCAProcDSP_mergeTileDetList.
+     *          @ref DPU_CFAR_PEAK_GROUPING_CFAR_PEAK_BASED grouping cannot be used with tiles,
+     *          it only sees the detections of its own tile. */
+    uint16_t    numRangeTileBins;
 } DPU_CFARCAProcDSP_StaticConfig;
 
 /**
@@ -371,6 +491,11 @@ typedef struct DPU_CFARCAProcDSP_OutParams_t
 
     /*! @brief      Number of CFAR detected points*/
     uint32_t                numCfarDetectedPoints;
+
+    /*! @brief      Flag indicating the noise floor map was refreshed in this call, i.e.
+     *              the full noise estimation pass was run. Processing time of calls without
+     *              refresh shows the saving of threshold only frames. */
+    bool                    isNoiseMapRefreshed;
 }DPU_CFARCAProcDSP_OutParams;
 
 /**
@@ -413,6 +538,16 @@ int32_t DPU_CFARCAProcDSP_deinit
     DPU_CFARCAProcDSP_Handle handle
 );
 
+int32_t DPU_CFARCAProcDSP_mergeTileDetList
+(
+    DPIF_CFARDetList    *detList,
+    uint32_t            detListSize,
+    DPIF_CFARDetList    *tileDetList[],
+    uint32_t            numTileDet[],
+    uint32_t            numTiles,
+    bool                isDopplerMajor
+);
+
 #ifdef __cplusplus
 }
 #endif
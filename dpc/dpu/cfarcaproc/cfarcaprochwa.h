@@ -438,6 +438,16 @@ typedef struct DPU_CFARCAProcHWA_OutParams_t
 
     /*! @brief      Number of CFAR detected points*/
     uint32_t numCfarDetectedPoints;
+
+    /*! @brief      Number of peaks reported by the Doppler domain CFAR paramset before they
+     *              are combined with the range domain, 0 if Doppler domain CFAR is disabled.
+     *              Can exceed hwaMemOutDopplerSize, only that many records are kept. */
+    uint32_t numDopplerCfarPeaks;
+
+    /*! @brief      Number of peaks reported by the range domain CFAR paramset before they
+     *              are combined with the Doppler domain. Can exceed hwaMemOutRangeSize,
+     *              only that many records are kept. */
+    uint32_t numRangeCfarPeaks;
 }DPU_CFARCAProcHWA_OutParams;
 
 /**
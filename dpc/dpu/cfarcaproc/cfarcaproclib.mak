@@ -36,6 +36,16 @@ CFARCAPROC_HWA_R4F_DRV_LIB  = lib/libcfarcaproc_hwa_$(MMWAVE_SDK_DEVICE_TYPE).$(
 CFARCAPROC_HWA_C674_DRV_LIB = lib/libcfarcaproc_hwa_$(MMWAVE_SDK_DEVICE_TYPE).$(C674_LIB_EXT)
 CFARCAPROC_DSP_C674_DRV_LIB = lib/libcfarcaproc_dsp_$(MMWAVE_SDK_DEVICE_TYPE).$(C674_LIB_EXT)
 
+###################################################################################
+# Build options:
+#     CFARCAPROCHWA_SW_EMULATION=1 builds the HWA library with the CFAR parameter
+#     sets run in software instead of on the HWA
+###################################################################################
+ifeq ($(CFARCAPROCHWA_SW_EMULATION), 1)
+cfarcaprocHWALib: R4F_CFLAGS += --define=CFARCAPROCHWA_SW_EMULATION
+cfarcaprocHWALib: C674_CFLAGS += --define=CFARCAPROCHWA_SW_EMULATION
+endif
+
 ###################################################################################
 # Library Build:
 #     - Build the R4 & DSP Library
@@ -85,6 +85,19 @@
 extern "C" {
 #endif
 
+/*! @brief Number of Doppler lines held for local maximum peak grouping (center line and its two neighbors)
+ *
+ *  \ingroup DPU_CFARCAPROC_INTERNAL_DEFINITION
+ */
+#define CFARCADSP_NUM_LOCAL_MAX_LINES       3U
+
+/*! @brief Bias mapping two packed unsigned 16-bit samples to signed order, so that they
+ *         can be compared with the signed packed 16-bit intrinsics
+ *
+ *  \ingroup DPU_CFARCAPROC_INTERNAL_DEFINITION
+ */
+#define CFARCADSP_U16X2_SIGN_BIAS           0x80008000U
+
 /*!
  *  @brief    Field of view indices as integers. For range domain values are [0
  *
@@ -129,6 +142,32 @@ typedef struct CFARCADspObj_t
     /*! @brief      Static Configuration */
     DPU_CFARCAProcDSP_StaticConfig staticCfg;
 
+    /*! @brief      Range dependent threshold profile configuration */
+    DPU_CFARCAProc_RangeThresholdProfileCfg rangeThresholdProfile;
+
+    /*! @brief      Flag indicating @ref DPU_CFARCAProcDSP_HW_Resources::cfarThresholdLut
+     *              matches current thresholds and profile. It is cleared by
+     *              configuration changes and the table is regenerated at the
+     *              beginning of the next processing call. */
+    bool                isThresholdLutValid;
+
+    /*! @brief      Flag indicating the noise floor map holds no valid estimate yet,
+     *              the next refresh initializes it without filtering */
+    bool                isNoiseMapEmpty;
+
+    /*! @brief      Number of frames processed since last noise floor map refresh */
+    uint32_t            noiseMapFrameCnt;
+
+    /*! @brief      First range bin of the range tile */
+    uint16_t            tileStartIdx;
+
+    /*! @brief      Range bin following the last range bin of the range tile */
+    uint16_t            tileEndIdx;
+
+    /*! @brief      Doppler line held by each slot of the local maximum line buffer,
+     *              -1 if the slot is empty */
+    int32_t             localMaxLineTag[CFARCADSP_NUM_LOCAL_MAX_LINES];
+
     /*!@brief       Peak grouping internal buffer - Range index */
     uint16_t            *detObjRangeIdxBuf;
 
@@ -142,6 +142,30 @@ typedef struct CFARHwaObj_t
 
 }CFARHwaObj;
 
+/**
+ *  @b Description
+ *  @n
+ *      Software emulation of one HWA CFAR parameter set over the detection matrix,
+ *      producing the HWA output records in the HWA order. Used by the DPU when built
+ *      with CFARCAPROCHWA_SW_EMULATION and by the unit test to check the HWA output.
+ *
+ *  @param[in]  detMat          Detection matrix (@ref DPIF_DETMATRIX_FORMAT_1)
+ *  @param[in]  numRangeBins    Number of range bins
+ *  @param[in]  numDopplerBins  Number of Doppler bins
+ *  @param[in]  cfarCfg         CFAR configuration
+ *  @param[out] outList         Output detection list
+ *  @param[in]  outListSize     Size of the output detection list
+ *  @param[in]  cfarDomain      @ref DPU_CFAR_RANGE_DOMAIN or @ref DPU_CFAR_DOPPLER_DOMAIN
+ *
+ *  @retval Number of detected points, may exceed outListSize as the HWA peak count
+ */
+uint32_t CFARHWA_emulateCFAR(const uint16_t *detMat,
+                             uint32_t numRangeBins,
+                             uint32_t numDopplerBins,
+                             DPU_CFARCAProc_CfarCfg *cfarCfg,
+                             DPU_CFARCAProcHWA_CfarDetOutput *outList,
+                             uint32_t outListSize,
+                             uint8_t cfarDomain);
 
 
 #ifdef __cplusplus
@@ -69,7 +69,9 @@
 static int32_t CFARCADSP_configEDMADopplerDomain
 (
     DPU_CFARCAProcDSP_HW_Resources *pRes,
-    DPU_CFARCAProcDSP_StaticConfig  *staticCfg
+    DPU_CFARCAProcDSP_StaticConfig  *staticCfg,
+    uint32_t                        tileStartIdx,
+    uint32_t                        numTileBins
 );
 static int32_t CFARCADSP_configEDMARangeDomain
 (
@@ -105,7 +107,8 @@ static bool CFARCADSP_isObjectDetectedOnDopplerLine
 (
     uint32_t dopplerIdx,
     uint32_t numDopplerBins,
-    uint32_t numRangeBins,
+    uint32_t rangeStartIdx,
+    uint32_t rangeEndIdx,
     uint32_t *cfarDetOutBitMask
 );
 static void CFARCADSP_setCfarDetMaskLine
@@ -115,15 +118,31 @@ static void CFARCADSP_setCfarDetMaskLine
     uint32_t numDopplerBins,
     uint32_t *cfarDetOutBitMask
 );
+static uint8_t CFARCADSP_getPeakGroupingScheme
+(
+    CFARCADspObj      *cfarObj
+);
+static bool CFARCADSP_isCfarPeakBasedGrouping
+(
+    DPU_CFARCAProc_CfarCfg *cfarCfg
+);
 static uint32_t CFARCADSP_peakGrouping
 (
     CFARCADspObj      *cfarObj,
     uint16_t          numDetectedObjs
 );
+static uint16_t *CFARCADSP_getLocalMaxLine
+(
+    CFARCADspObj    *cfarObj,
+    uint32_t        dopplerLine,
+    uint32_t        centerLine,
+    uint32_t        *waitingTime
+);
 static int32_t CFARCADSP_processDopplerDomain
 (
     CFARCADspObj    *cfarObj,
     uint8_t         peakGrpingEn,
+    uint8_t         noiseMapRefreshEn,
     uint32_t        *waitingTime,
     int32_t         *errCode
 );
@@ -131,6 +150,7 @@ static int32_t CFARCADSP_processRangeDomain
 (
     CFARCADspObj    *cfarObj,
     uint8_t         peakGrpingEn,
+    uint8_t         localMaxEn,
     uint32_t        *waitingTime,
     uint32_t        numDetObjDoppler
 );
@@ -141,21 +161,43 @@ static uint32_t CFARCADSP_cfarCadBwrap(const uint16_t inp[restrict],
                                 uint32_t guardLen, uint32_t noiseLen,
                                 uint16_t noise[restrict]);
 
+static void CFARCADSP_noiseMapUpdateLine(const uint16_t inp[restrict],
+                                uint32_t len, uint32_t const2,
+                                uint32_t guardLen, uint32_t noiseLen,
+                                uint32_t log2RegionLen, uint32_t alphaShift,
+                                uint16_t noiseMap[restrict]);
+
+static uint32_t CFARCADSP_cfarNoiseMapThreshold(const uint16_t inp[restrict],
+                                uint16_t out[restrict], uint32_t len,
+                                uint32_t const1, uint32_t log2RegionLen,
+                                const uint16_t noiseMap[restrict],
+                                uint16_t noise[restrict]);
+
 static uint32_t CFARCADSP_cfarCadB_SOGO(const uint16_t inp[restrict],
                             uint16_t out[restrict], uint32_t len,
                             uint16_t cfartype,
-                            uint32_t const1, uint32_t const2,
+                            const uint16_t thr[restrict], uint32_t const2,
                             uint32_t guardLen, uint32_t noiseLen,
                             uint16_t noise[restrict]);
 
+static void CFARCADSP_localMaxMaskLine(const uint16_t lower[restrict],
+                            const uint16_t center[restrict],
+                            const uint16_t upper[restrict],
+                            uint32_t len,
+                            uint8_t dopplerGrpEn, uint8_t rangeGrpEn,
+                            uint16_t colMax[restrict],
+                            uint32_t mask[restrict]);
+
 /**
  *  @b Description
  *  @n
  *      Configures EDMA in CFAR Doppler domain.Each tranfer copies all doppler
- *      bins, it repeats for all range bins in ping/pong manner.
+ *      bins, it repeats for all range bins of the range tile in ping/pong manner.
  *
  *  @param[in] pRes         Pointer to hardware resources
  *  @param[in] staticCfg    Pointer to static configuration
+ *  @param[in] tileStartIdx First range bin of the range tile
+ *  @param[in] numTileBins  Number of range bins of the range tile
  *
  *  \ingroup    DPU_CFARCAPROC_INTERNAL_FUNCTION
  *
@@ -168,20 +210,25 @@ static uint32_t CFARCADSP_cfarCadB_SOGO(const uint16_t inp[restrict],
 static int32_t CFARCADSP_configEDMADopplerDomain
 (
     DPU_CFARCAProcDSP_HW_Resources *pRes,
-    DPU_CFARCAProcDSP_StaticConfig  *staticCfg
+    DPU_CFARCAProcDSP_StaticConfig  *staticCfg,
+    uint32_t                        tileStartIdx,
+    uint32_t                        numTileBins
 )
 {
     int32_t errorCode = EDMA_NO_ERROR;
     DPEDMA_syncACfg     syncACfg;
+    uint32_t            tileAddr;
 
     /* Common EDMA setting between ping and pong */
     syncACfg.aCount      = staticCfg->numDopplerBins * sizeof(uint16_t);
-    syncACfg.bCount      = (staticCfg->numRangeBins) /2;
+    syncACfg.bCount      = numTileBins /2;
     syncACfg.srcBIdx     = syncACfg.aCount * 2;
     syncACfg.dstBIdx     = 0;
 
+    tileAddr = (uint32_t)pRes->detMatrix.data + tileStartIdx * syncACfg.aCount;
+
     /* Ping source and destination setting */
-    syncACfg.srcAddress  = (uint32_t)pRes->detMatrix.data;
+    syncACfg.srcAddress  = tileAddr;
     syncACfg.destAddress = (uint32_t)pRes->localDetMatrixBuffer;
 
     errorCode = DPEDMA_configSyncA_singleFrame(pRes->edmaHandle,
@@ -199,9 +246,9 @@ static int32_t CFARCADSP_configEDMADopplerDomain
     }
 
     /* Pong source and destination setting */
-    syncACfg.srcAddress  = (uint32_t)pRes->detMatrix.data + syncACfg.aCount;
+    syncACfg.srcAddress  = tileAddr + syncACfg.aCount;
     syncACfg.destAddress = (uint32_t)pRes->localDetMatrixBuffer + syncACfg.aCount;
-    syncACfg.bCount      = (staticCfg->numRangeBins)/2;
+    syncACfg.bCount      = numTileBins/2;
 
     errorCode = DPEDMA_configSyncA_singleFrame(pRes->edmaHandle,
                                    &pRes->edmaInPong,
@@ -419,6 +466,104 @@ static void CFARCADSP_fovConvertDoppler
     fovDopplerIdxCfg->maxIdx = (int16_t) doppler;
 }
 
+/**
+ *  @b Description
+ *  @n  Validates range dependent threshold profile configuration
+ *
+ *  @param[in] profileCfg   Pointer to threshold profile configuration
+ *
+ *  \ingroup    DPU_CFARCAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Success     - 0
+ *  @retval
+ *      Error       - <0
+ *
+ */
+static int32_t CFARCADSP_validateThresholdProfile
+(
+    DPU_CFARCAProc_RangeThresholdProfileCfg *profileCfg
+)
+{
+    int32_t  retVal = 0;
+    uint32_t segIdx;
+
+    if (profileCfg->enabled)
+    {
+        if ((profileCfg->numSegments == 0U) ||
+            (profileCfg->numSegments > DPU_CFARCAPROC_MAX_NUM_THRESHOLD_SEGMENTS))
+        {
+            retVal = DPU_CFARCAPROCDSP_EINVAL__THRESHOLD_PROFILE;
+            goto exit;
+        }
+
+        for (segIdx = 1U; segIdx < profileCfg->numSegments; segIdx++)
+        {
+            if (profileCfg->segment[segIdx].rangeMax <= profileCfg->segment[segIdx - 1U].rangeMax)
+            {
+                retVal = DPU_CFARCAPROCDSP_EINVAL__THRESHOLD_PROFILE;
+                goto exit;
+            }
+        }
+    }
+
+exit:
+    return(retVal);
+}
+
+/**
+ *  @b Description
+ *  @n  Generates the per range bin threshold table from the CFAR thresholds
+ *      and the range dependent threshold profile. The range domain CFAR kernel
+ *      reads the threshold of each cell under test from the first half of the table,
+ *      the Doppler domain CFAR takes the threshold of the whole range line from
+ *      the second half, so the profile costs no additional branch per cell.
+ *
+ *  @param[in] cfarObj   Pointer to CFAR DPU object
+ *
+ *  \ingroup    DPU_CFARCAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      None
+ *
+ */
+static void CFARCADSP_genThresholdLut
+(
+    CFARCADspObj    *cfarObj
+)
+{
+    DPU_CFARCAProc_RangeThresholdProfileCfg *profileCfg = &cfarObj->rangeThresholdProfile;
+    uint16_t    *thrRange = cfarObj->res.cfarThresholdLut;
+    uint16_t    *thrDoppler = &cfarObj->res.cfarThresholdLut[cfarObj->staticCfg.numRangeBins];
+    uint32_t    rangeIdx = 0U;
+    uint32_t    segIdx;
+    uint32_t    segEndIdx;
+
+    if (profileCfg->enabled)
+    {
+        for (segIdx = 0U; segIdx < profileCfg->numSegments; segIdx++)
+        {
+            segEndIdx = (uint32_t)(profileCfg->segment[segIdx].rangeMax / cfarObj->staticCfg.rangeStep + 0.5);
+            segEndIdx = MIN(segEndIdx + 1U, cfarObj->staticCfg.numRangeBins);
+
+            for ( ; rangeIdx < segEndIdx; rangeIdx++)
+            {
+                thrRange[rangeIdx] = profileCfg->segment[segIdx].thresholdScaleRange;
+                thrDoppler[rangeIdx] = profileCfg->segment[segIdx].thresholdScaleDoppler;
+            }
+        }
+    }
+
+    /* Remaining range bins use thresholds of the CFAR configuration */
+    for ( ; rangeIdx < cfarObj->staticCfg.numRangeBins; rangeIdx++)
+    {
+        thrRange[rangeIdx] = cfarObj->cfarCfgRange.thresholdScale;
+        thrDoppler[rangeIdx] = cfarObj->cfarCfgDoppler.thresholdScale;
+    }
+
+    cfarObj->isThresholdLutValid = true;
+}
+
 /**
  *  @b Description
  *  @n  Saves configuration parameters to CFAR instance
@@ -453,6 +598,18 @@ static void CFARCADSP_saveConfiguration
                             &cfarDspObj->fovRange);
     CFARCADSP_adjustCfarCfg(&cfarDspObj->cfarCfgRange);
     CFARCADSP_adjustCfarCfg(&cfarDspObj->cfarCfgDoppler);
+
+    if (cfarDspCfg->dynCfg.rangeThresholdProfile != NULL)
+    {
+        cfarDspObj->rangeThresholdProfile = *cfarDspCfg->dynCfg.rangeThresholdProfile;
+    }
+    else
+    {
+        memset((void *)&cfarDspObj->rangeThresholdProfile, 0, sizeof(DPU_CFARCAProc_RangeThresholdProfileCfg));
+    }
+
+    /* Threshold table may be shared with other sub-frames, regenerate it before next processing */
+    cfarDspObj->isThresholdLutValid = false;
 }
 
 /**
@@ -462,7 +619,8 @@ static void CFARCADSP_saveConfiguration
  *
  *  @param[in] dopplerIdx           Doppler index
  *  @param[in] numDopplerBins       Number of Doppler bins (must be power of 2)
- *  @param[in] numRangeBins         Number of Range bins (must be power of 2)
+ *  @param[in] rangeStartIdx        First range bin to be checked
+ *  @param[in] rangeEndIdx          Range bin following the last range bin to be checked
  *  @param[in] cfarDetOutBitMask    Pointer to output bit mask (compressed list)
  *
  *  \ingroup    DPU_CFARCAPROC_INTERNAL_FUNCTION
@@ -476,7 +634,8 @@ static bool CFARCADSP_isObjectDetectedOnDopplerLine
 (
     uint32_t dopplerIdx,
     uint32_t numDopplerBins,
-    uint32_t numRangeBins,
+    uint32_t rangeStartIdx,
+    uint32_t rangeEndIdx,
     uint32_t *cfarDetOutBitMask
 )
 {
@@ -485,7 +644,7 @@ static bool CFARCADSP_isObjectDetectedOnDopplerLine
     uint32_t rangeIdx;
     bool   detected = false;
 
-    for(rangeIdx = 0; rangeIdx < numRangeBins;rangeIdx++)
+    for(rangeIdx = rangeStartIdx; rangeIdx < rangeEndIdx;rangeIdx++)
     {
         bitIndex = rangeIdx * numDopplerBins + dopplerIdx;
         word = bitIndex >> 5;
@@ -743,6 +902,134 @@ static uint32_t CFARCADSP_cfarCadBwrap(const uint16_t inp[restrict],
 
 }  /* CFARCADSP_cfarCadBwrap */
 
+/*!*****************************************************************************************************************
+ * \brief
+ * Function Name       :    CFARCADSP_noiseMapUpdateLine
+ *
+ * \par
+ * <b>Description</b>  :    Updates the noise floor map of one range line. The noise of each cell under test is
+ *                          estimated the same way as in @ref CFARCADSP_cfarCadBwrap (two sided, wrap around),
+ *                          averaged over each Doppler region and filtered into the map with a first order IIR:
+ *                          map = map + (regionNoise - map) >> alphaShift.
+ *
+ * @param[in]               inp      : input array (16 bit unsigned numbers)
+ * @param[in]               len      : number of elements in input array, must be power of 2
+ * @param[in]               const2   : noise sum divisor shift, noise = noise sum /(2^(const2))
+ * @param[in]               guardLen : one sided guard length
+ * @param[in]               noiseLen : one sided Noise length
+ * @param[in]               log2RegionLen : log2 of number of cells per Doppler region
+ * @param[in]               alphaShift    : IIR filter coefficient shift, 0 replaces the map entry
+ *
+ * @param[in,out]           noiseMap : noise floor of each Doppler region of the range line
+ *
+ * @return                  None
+ *
+ * @pre                     Input (inp) and noise map (noiseMap) arrays are non-aliased.
+ * @ingroup                 DPU_CFARCAPROC_INTERNAL_FUNCTION
+ *
+ *******************************************************************************************************************
+ */
+static void CFARCADSP_noiseMapUpdateLine(const uint16_t inp[restrict],
+                                uint32_t len, uint32_t const2,
+                                uint32_t guardLen, uint32_t noiseLen,
+                                uint32_t log2RegionLen, uint32_t alphaShift,
+                                uint16_t noiseMap[restrict])
+{
+    uint32_t idx, idxLeftNext, idxLeftPrev, idxRightNext, idxRightPrev;
+    uint32_t idxCUT, regionIdx;
+    uint32_t sumLeft, sumRight, regionSum;
+    uint32_t idxMask = len - 1U;
+    uint32_t regionMask = (1U << log2RegionLen) - 1U;
+    int32_t  diff;
+
+    /*initializations for CUT 0 */
+    sumLeft = 0U;
+    sumRight = 0U;
+    regionSum = 0U;
+    for (idx = 1U; idx <= noiseLen; idx++)
+    {
+        sumLeft += inp[len - guardLen - idx];
+        sumRight += inp[idx + guardLen];
+    }
+
+    idxLeftPrev = len - guardLen - noiseLen;
+    idxLeftNext = len - guardLen;
+    idxRightPrev = 1U + guardLen;
+    idxRightNext = 1U + guardLen + noiseLen;
+
+    for (idxCUT = 0U; idxCUT < len; idxCUT++)
+    {
+        regionSum += (sumLeft + sumRight) >> const2;
+
+        /* Last cell of the region: filter region average into the map */
+        if ((idxCUT & regionMask) == regionMask)
+        {
+            regionIdx = idxCUT >> log2RegionLen;
+            diff = (int32_t)(regionSum >> log2RegionLen) - (int32_t)noiseMap[regionIdx];
+            noiseMap[regionIdx] = (uint16_t)((int32_t)noiseMap[regionIdx] + (diff >> alphaShift));
+            regionSum = 0U;
+        }
+
+        /* Slide windows to next CUT, indices wrap around */
+        sumLeft = (sumLeft + inp[idxLeftNext & idxMask]) - inp[idxLeftPrev & idxMask];
+        idxLeftNext++;
+        idxLeftPrev++;
+        sumRight = (sumRight + inp[idxRightNext & idxMask]) - inp[idxRightPrev & idxMask];
+        idxRightNext++;
+        idxRightPrev++;
+    }
+}  /* CFARCADSP_noiseMapUpdateLine */
+
+/*!*****************************************************************************************************************
+ * \brief
+ * Function Name       :    CFARCADSP_cfarNoiseMapThreshold
+ *
+ * \par
+ * <b>Description</b>  :    Performs CFAR detection on an 16-bit unsigned input vector against the noise floor map.
+ *                          The input values are assumed to be in lograthimic scale. Cell under test is detected
+ *                          when it is greater than the noise floor of its Doppler region plus const1. No noise
+ *                          window is evaluated, so the cost is one compare per cell.
+ *
+ * @param[in]               inp      : input array (16 bit unsigned numbers)
+ * @param[out]              out      : output array with indices of detected peaks (zero based counting)
+ * @param[in]               len      : number of elements in input array
+ * @param[in]               const1   : detection threshold added to the noise floor
+ * @param[in]               log2RegionLen : log2 of number of cells per Doppler region
+ * @param[in]               noiseMap : noise floor of each Doppler region of the range line
+ *
+ * @param[out]              noise    : output array with each detected peak's noise floor
+ *
+ * @return                  Number of detected peaks (i.e length of out)
+ *
+ * @pre                     Input (inp) and Output (out) arrays are non-aliased.
+ * @ingroup                 DPU_CFARCAPROC_INTERNAL_FUNCTION
+ *
+ *******************************************************************************************************************
+ */
+static uint32_t CFARCADSP_cfarNoiseMapThreshold(const uint16_t inp[restrict],
+                                uint16_t out[restrict], uint32_t len,
+                                uint32_t const1, uint32_t log2RegionLen,
+                                const uint16_t noiseMap[restrict],
+                                uint16_t noise[restrict])
+{
+    uint32_t idxCUT, outIdx;
+    uint32_t regionNoise;
+
+    outIdx = 0U;
+    for (idxCUT = 0U; idxCUT < len; idxCUT++)
+    {
+        regionNoise = noiseMap[idxCUT >> log2RegionLen];
+        if ((uint32_t) (inp[idxCUT]) > (regionNoise + const1))
+        {
+            out[outIdx] = (uint16_t)idxCUT;
+            noise[outIdx] = (uint16_t)regionNoise;
+            outIdx++;
+        }
+    }
+
+    return (outIdx);
+}  /* CFARCADSP_cfarNoiseMapThreshold */
+
 
 /*!*****************************************************************************************************************
  * \brief
@@ -760,10 +1047,12 @@ static uint32_t CFARCADSP_cfarCadBwrap(const uint16_t inp[restrict],
  *                                        CFAR_CA; use sum of both sides then average.
  *                                        CFAR_CASO; use smaller of the left and right side.
  *                                        CFAR_CAGO; use greater of the left and right side.
- * @param[in]               const1,const2 : used to compare the Cell Under Test (CUT) to the sum of the noise cells:
- *                                          [noise sum /(2^(const2-1))]+const1 for one sided comparison
+ * @param[in]               thr, const2 : used to compare the Cell Under Test (CUT) to the sum of the noise cells:
+ *                                          [noise sum /(2^(const2-1))]+thr[CUT] for one sided comparison
  *                                          (at the begining and end of the input vector).
- *                                          [noise sum /(2^(const2))]+const1 for two sided comparison
+ *                                          [noise sum /(2^(const2))]+thr[CUT] for two sided comparison.
+ *                                        thr is the per cell threshold table of len elements, it
+ *                                        replaces the scalar threshold at the cost of one load per cell.
  * @param[in]               guardLen    : one sided guard length
  * @param[in]               noiseLen    : one sided noise length
  *
@@ -780,7 +1069,7 @@ static uint32_t CFARCADSP_cfarCadBwrap(const uint16_t inp[restrict],
 static uint32_t CFARCADSP_cfarCadB_SOGO(const uint16_t inp[restrict],
                             uint16_t out[restrict], uint32_t len,
                             uint16_t cfartype,
-                            uint32_t const1, uint32_t const2,
+                            const uint16_t thr[restrict], uint32_t const2,
                             uint32_t guardLen, uint32_t noiseLen,
                             uint16_t noise[restrict])
 {
@@ -800,7 +1089,7 @@ static uint32_t CFARCADSP_cfarCadB_SOGO(const uint16_t inp[restrict],
     /*********************************************************************************************/
     /* One-sided comparision for the first segment (for the first noiseLen+gaurdLen samples */
     idxCUT = 0;
-    if ((uint32_t) inp[idxCUT] > ((sumRight >> (const2 - 1U)) + const1))
+    if ((uint32_t) inp[idxCUT] > ((sumRight >> (const2 - 1U)) + thr[idxCUT]))
     {
         out[outIdx] = (uint16_t)idxCUT;
         noise[outIdx] = sumRight >> (const2-1U);
@@ -823,7 +1112,7 @@ static uint32_t CFARCADSP_cfarCadB_SOGO(const uint16_t inp[restrict],
             idxLeftNext++;
         }
 
-        if ((uint32_t) inp[idxCUT] > ((sumRight >> (const2 - 1U)) + const1))
+        if ((uint32_t) inp[idxCUT] > ((sumRight >> (const2 - 1U)) + thr[idxCUT]))
         {
             out[outIdx] = (uint16_t)idxCUT;
             noise[outIdx] = sumRight >> (const2-1U);
@@ -841,7 +1130,7 @@ static uint32_t CFARCADSP_cfarCadB_SOGO(const uint16_t inp[restrict],
     if (cfartype == CFAR_CA)
     {
         sum = sumRight + sumLeft;
-        if ((uint32_t) inp[idxCUT] > ((sum >> const2) + const1))
+        if ((uint32_t) inp[idxCUT] > ((sum >> const2) + thr[idxCUT]))
         {
             out[outIdx] = (uint16_t)idxCUT;
             noise[outIdx] = sum >> const2;
@@ -860,7 +1149,7 @@ static uint32_t CFARCADSP_cfarCadB_SOGO(const uint16_t inp[restrict],
             idxRightPrev++;
             sum = sumLeft + sumRight;
 
-            if ((uint32_t) (inp[idxCUT]) > ((sum >> const2) + const1))
+            if ((uint32_t) (inp[idxCUT]) > ((sum >> const2) + thr[idxCUT]))
             {
                 out[outIdx] = (uint16_t)idxCUT;
                 noise[outIdx] = sum >> const2;
@@ -872,7 +1161,7 @@ static uint32_t CFARCADSP_cfarCadB_SOGO(const uint16_t inp[restrict],
     else if (cfartype == CFAR_CASO)
     {
         sum = (sumLeft < sumRight) ? sumLeft:sumRight;
-        if ((uint32_t) inp[idxCUT] > ((sum >> (const2-1U)) + const1))
+        if ((uint32_t) inp[idxCUT] > ((sum >> (const2-1U)) + thr[idxCUT]))
         {
             out[outIdx] = (uint16_t)idxCUT;
             noise[outIdx] = sum >> (const2-1U);
@@ -892,7 +1181,7 @@ static uint32_t CFARCADSP_cfarCadB_SOGO(const uint16_t inp[restrict],
 
             sum = (sumLeft < sumRight) ? sumLeft:sumRight;
 
-            if ((uint32_t) (inp[idxCUT]) > ((sum >> (const2-1U)) + const1))
+            if ((uint32_t) (inp[idxCUT]) > ((sum >> (const2-1U)) + thr[idxCUT]))
             {
                 out[outIdx] = (uint16_t)idxCUT;
                 noise[outIdx] = sum >> (const2-1U);
@@ -904,7 +1193,7 @@ static uint32_t CFARCADSP_cfarCadB_SOGO(const uint16_t inp[restrict],
     else /*CFAR_CAGO*/
     {
         sum = (sumLeft > sumRight) ? sumLeft:sumRight;
-        if ((uint32_t) inp[idxCUT] > ((sum >> (const2-1U)) + const1))
+        if ((uint32_t) inp[idxCUT] > ((sum >> (const2-1U)) + thr[idxCUT]))
         {
             out[outIdx] = (uint16_t)idxCUT;
             noise[outIdx] = sum >> (const2-1U);
@@ -925,7 +1214,7 @@ static uint32_t CFARCADSP_cfarCadB_SOGO(const uint16_t inp[restrict],
 
             sum = (sumLeft > sumRight) ? sumLeft:sumRight;
 
-            if ((uint32_t) (inp[idxCUT]) > ((sum >> (const2-1U)) + const1))
+            if ((uint32_t) (inp[idxCUT]) > ((sum >> (const2-1U)) + thr[idxCUT]))
             {
                 out[outIdx] = (uint16_t)idxCUT;
                 noise[outIdx] = sum >> (const2-1U);
@@ -942,7 +1231,7 @@ static uint32_t CFARCADSP_cfarCadB_SOGO(const uint16_t inp[restrict],
         sumLeft = (sumLeft + inp[idxLeftNext]) - inp[idxLeftPrev];
         idxLeftNext++;
         idxLeftPrev++;
-        if ((uint32_t) inp[idxCUT] > ((sumLeft >> (const2 - 1U)) + const1))
+        if ((uint32_t) inp[idxCUT] > ((sumLeft >> (const2 - 1U)) + thr[idxCUT]))
         {
             out[outIdx] = (uint16_t)idxCUT;
             noise[outIdx] = sumLeft >> (const2-1U);
@@ -956,6 +1245,152 @@ static uint32_t CFARCADSP_cfarCadB_SOGO(const uint16_t inp[restrict],
 
 }  /* CFARCADSP_cfarCadB_SOGO */
 
+/*!*****************************************************************************************************************
+ * \brief
+ * Function Name       :    CFARCADSP_localMaxMaskLine
+ *
+ * \par
+ * <b>Description</b>  :    Computes the local maximum bit mask of one Doppler line of the detection matrix.
+ *                          A cell is a local maximum if it is not smaller than any of its neighbors: the cells
+ *                          of the two adjacent Doppler lines (Doppler direction grouping), the adjacent range
+ *                          cells (range direction grouping) or all 8 neighbors (both directions). The column
+ *                          maximum across Doppler lines is taken first, then the maximum over three adjacent
+ *                          columns, both on two packed samples per instruction. Cells beyond the first and last
+ *                          range bin are treated as zero.
+ *
+ * @param[in]               lower    : previous Doppler line (16 bit unsigned numbers)
+ * @param[in]               center   : Doppler line under test (16 bit unsigned numbers)
+ * @param[in]               upper    : next Doppler line (16 bit unsigned numbers)
+ * @param[in]               len      : number of range bins, must be even
+ * @param[in]               dopplerGrpEn : compare against lower and upper Doppler lines
+ * @param[in]               rangeGrpEn   : compare against adjacent range bins
+ * @param[out]              colMax   : scratch of len + 4 samples for column maximum
+ * @param[out]              mask     : output bit mask, bit (idx & 31) of word (idx >> 5) is set for a
+ *                                     local maximum at range bin idx
+ *
+ * @return                  None
+ *
+ * @pre                     Lines and colMax are aligned to 4 bytes and non-aliased.
+ * @ingroup                 DPU_CFARCAPROC_INTERNAL_FUNCTION
+ *
+ *******************************************************************************************************************
+ */
+static void CFARCADSP_localMaxMaskLine(const uint16_t lower[restrict],
+                            const uint16_t center[restrict],
+                            const uint16_t upper[restrict],
+                            uint32_t len,
+                            uint8_t dopplerGrpEn, uint8_t rangeGrpEn,
+                            uint16_t colMax[restrict],
+                            uint32_t mask[restrict])
+{
+    uint32_t idx;
+    uint32_t centerPair, winPair, notPeak;
+
+    /* colMax[2] holds range bin 0, guard samples below and above the line are
+       the smallest biased value */
+    colMax[1] = (uint16_t)CFARCADSP_U16X2_SIGN_BIAS;
+    colMax[len + 2U] = (uint16_t)CFARCADSP_U16X2_SIGN_BIAS;
+
+    /* Column maximum across Doppler lines, kept in biased domain */
+    if (dopplerGrpEn)
+    {
+        for (idx = 0U; idx < len; idx += 2U)
+        {
+            _amem4(&colMax[idx + 2U]) = _max2(_max2(_amem4_const(&lower[idx]) ^ CFARCADSP_U16X2_SIGN_BIAS,
+                                                    _amem4_const(&center[idx]) ^ CFARCADSP_U16X2_SIGN_BIAS),
+                                              _amem4_const(&upper[idx]) ^ CFARCADSP_U16X2_SIGN_BIAS);
+        }
+    }
+    else
+    {
+        for (idx = 0U; idx < len; idx += 2U)
+        {
+            _amem4(&colMax[idx + 2U]) = _amem4_const(&center[idx]) ^ CFARCADSP_U16X2_SIGN_BIAS;
+        }
+    }
+
+    memset((void *)mask, 0, ((len + 31U) >> 5U) * sizeof(uint32_t));
+
+    /* Cell is a peak unless the window maximum is strictly greater */
+    if (rangeGrpEn)
+    {
+        for (idx = 0U; idx < len; idx += 2U)
+        {
+            centerPair = _amem4_const(&center[idx]) ^ CFARCADSP_U16X2_SIGN_BIAS;
+            winPair = _max2(_max2(_mem4_const(&colMax[idx + 1U]), _amem4_const(&colMax[idx + 2U])),
+                            _mem4_const(&colMax[idx + 3U]));
+            notPeak = _cmpgt2(winPair, centerPair);
+            mask[idx >> 5U] |= ((~notPeak) & 0x3U) << (idx & 31U);
+        }
+    }
+    else
+    {
+        for (idx = 0U; idx < len; idx += 2U)
+        {
+            centerPair = _amem4_const(&center[idx]) ^ CFARCADSP_U16X2_SIGN_BIAS;
+            winPair = _amem4_const(&colMax[idx + 2U]);
+            notPeak = _cmpgt2(winPair, centerPair);
+            mask[idx >> 5U] |= ((~notPeak) & 0x3U) << (idx & 31U);
+        }
+    }
+}  /* CFARCADSP_localMaxMaskLine */
+
+/**
+ *  @b Description
+ *  @n
+ *     Returns the active peak grouping scheme, range direction configuration
+ *     takes precedence when grouping is enabled in both directions.
+ *
+ *  @param[in] cfarObj              Pointer to CFAR DPU object
+ *
+ *  \ingroup    DPU_CFARCAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Peak grouping scheme
+ *
+ */
+static uint8_t CFARCADSP_getPeakGroupingScheme
+(
+    CFARCADspObj      *cfarObj
+)
+{
+    uint8_t scheme;
+
+    if(cfarObj->cfarCfgRange.peakGroupingEn)
+    {
+        scheme = cfarObj->cfarCfgRange.peakGroupingScheme;
+    }
+    else
+    {
+        scheme = cfarObj->cfarCfgDoppler.peakGroupingScheme;
+    }
+
+    return(scheme);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *     Checks if a CFAR configuration enables peak grouping based on the CFAR
+ *     detections only, which cannot be used with range tiles.
+ *
+ *  @param[in] cfarCfg              Pointer to CFAR configuration
+ *
+ *  \ingroup    DPU_CFARCAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      true if @ref DPU_CFAR_PEAK_GROUPING_CFAR_PEAK_BASED grouping is enabled
+ *
+ */
+static bool CFARCADSP_isCfarPeakBasedGrouping
+(
+    DPU_CFARCAProc_CfarCfg *cfarCfg
+)
+{
+    return((cfarCfg->peakGroupingEn != 0U) &&
+           (cfarCfg->peakGroupingScheme == DPU_CFAR_PEAK_GROUPING_CFAR_PEAK_BASED));
+}
+
 /**
  *  @b Description
  *  @n
@@ -981,13 +1416,13 @@ static uint32_t CFARCADSP_peakGrouping
     uint16_t index;
     uint8_t scheme;
 
-    if(cfarObj->cfarCfgRange.peakGroupingEn)
-    {
-        scheme = cfarObj->cfarCfgRange.peakGroupingScheme;
-    }
-    else
+    scheme = CFARCADSP_getPeakGroupingScheme(cfarObj);
+
+    /* Without range domain CFAR there is no pass to fuse with, fall back to the
+       equivalent detection matrix based scheme */
+    if (scheme == DPU_CFAR_PEAK_GROUPING_LOCAL_MAX_FUSED)
     {
-        scheme = cfarObj->cfarCfgDoppler.peakGroupingScheme;
+        scheme = DPU_CFAR_PEAK_GROUPING_DET_MATRIX_BASED;
     }
 
     if (scheme == DPU_CFAR_PEAK_GROUPING_CFAR_PEAK_BASED)
@@ -1049,6 +1484,8 @@ static uint32_t CFARCADSP_peakGrouping
  *
  *  @param[in] cfarObj          Pointer to CFAR DPU object
  *  @param[in] peakGrpingEn     Peak grouping enable flag
+ *  @param[in] noiseMapRefreshEn Noise floor map refresh flag, run noise estimation pass
+ *                              and update the map before detection
  *  @param[in] waitingTime      Pointer to waiting time involved during CFAR processing
  *  @param[in] errCode          Pointer to errCode to be populated during CFAR processing
  *
@@ -1062,6 +1499,7 @@ static int32_t CFARCADSP_processDopplerDomain
 (
     CFARCADspObj    *cfarObj,
     uint8_t         peakGrpingEn,
+    uint8_t         noiseMapRefreshEn,
     uint32_t        *waitingTime,
     int32_t         *errCode
 )
@@ -1084,8 +1522,8 @@ static int32_t CFARCADSP_processDopplerDomain
 
     memset (cfarObj->res.cfarDopplerDetOutBitMask, 0x0, cfarObj->res.cfarDopplerDetOutBitMaskSize * sizeof(uint32_t));
 
-    /* Loop through all range bins for CFAR detection */
-    rangeIdx = 0;
+    /* Loop through all range bins of the range tile for CFAR detection */
+    rangeIdx = cfarObj->tileStartIdx;
     do
     {
         uint16_t *currDetMatrixBuffer;
@@ -1108,16 +1546,49 @@ static int32_t CFARCADSP_processDopplerDomain
         CFARCADSP_waitEDMATransComplete(cfarObj->res.edmaHandle, edmaChannel);
         *waitingTime += Cycleprofiler_getTimeStamp() - startTimeWait;
 
-        /* CFAR-detecton on range line: search doppler peak among numDopplerBins samples */
-        numDetObjPerCfar = CFARCADSP_cfarCadBwrap(
-                currDetMatrixBuffer,
-                cfarObj->res.cfarDetOutBuffer,
-                cfarObj->staticCfg.numDopplerBins,
-                cfarObj->cfarCfgDoppler.thresholdScale,
-                cfarObj->cfarCfgDoppler.noiseDivShift,
-                cfarObj->cfarCfgDoppler.guardLen,
-                cfarObj->cfarCfgDoppler.winLen,
-                cfarObj->detObjPeakIdxBuf);
+        if (cfarObj->staticCfg.noiseMapCfg.enabled)
+        {
+            uint16_t *noiseMapLine;
+
+            noiseMapLine = &cfarObj->res.cfarNoiseMap[rangeIdx << cfarObj->staticCfg.noiseMapCfg.log2NumDopplerRegions];
+
+            if (noiseMapRefreshEn)
+            {
+                /* First refresh after reset takes the estimate without filtering */
+                CFARCADSP_noiseMapUpdateLine(
+                        currDetMatrixBuffer,
+                        cfarObj->staticCfg.numDopplerBins,
+                        cfarObj->cfarCfgDoppler.noiseDivShift,
+                        cfarObj->cfarCfgDoppler.guardLen,
+                        cfarObj->cfarCfgDoppler.winLen,
+                        cfarObj->staticCfg.log2NumDopplerBins - cfarObj->staticCfg.noiseMapCfg.log2NumDopplerRegions,
+                        cfarObj->isNoiseMapEmpty ? 0U : cfarObj->staticCfg.noiseMapCfg.alphaShift,
+                        noiseMapLine);
+            }
+
+            /* CFAR-detecton on range line against noise floor map */
+            numDetObjPerCfar = CFARCADSP_cfarNoiseMapThreshold(
+                    currDetMatrixBuffer,
+                    cfarObj->res.cfarDetOutBuffer,
+                    cfarObj->staticCfg.numDopplerBins,
+                    cfarObj->res.cfarThresholdLut[cfarObj->staticCfg.numRangeBins + rangeIdx],
+                    cfarObj->staticCfg.log2NumDopplerBins - cfarObj->staticCfg.noiseMapCfg.log2NumDopplerRegions,
+                    noiseMapLine,
+                    cfarObj->detObjPeakIdxBuf);
+        }
+        else
+        {
+            /* CFAR-detecton on range line: search doppler peak among numDopplerBins samples */
+            numDetObjPerCfar = CFARCADSP_cfarCadBwrap(
+                    currDetMatrixBuffer,
+                    cfarObj->res.cfarDetOutBuffer,
+                    cfarObj->staticCfg.numDopplerBins,
+                    cfarObj->res.cfarThresholdLut[cfarObj->staticCfg.numRangeBins + rangeIdx],
+                    cfarObj->cfarCfgDoppler.noiseDivShift,
+                    cfarObj->cfarCfgDoppler.guardLen,
+                    cfarObj->cfarCfgDoppler.winLen,
+                    cfarObj->detObjPeakIdxBuf);
+        }
 
         for (detIndex = 0; detIndex < numDetObjPerCfar; detIndex++)
         {
@@ -1167,18 +1638,106 @@ static int32_t CFARCADSP_processDopplerDomain
         rangeIdx++;
 
         /* Trigger next EDMA if it is not the last range Bins */
-        if(rangeIdx < (cfarObj->staticCfg.numRangeBins - 1))
+        if(rangeIdx < (cfarObj->tileEndIdx - 1))
         {
             if ((*errCode = EDMA_startDmaTransfer(cfarObj->res.edmaHandle, edmaChannel)) != EDMA_NO_ERROR)
             {
                 goto exit;
             }
         }
-    }while(rangeIdx < cfarObj->staticCfg.numRangeBins);
+    }while(rangeIdx < cfarObj->tileEndIdx);
 exit:
     return numDetObjDoppler;
 }
 
+/**
+ *  @b Description
+ *  @n
+ *     Returns a Doppler line of the detection matrix from the local maximum line buffer.
+ *     If the line is not held yet it is brought in by EDMA into a slot that does not hold
+ *     the center line or one of its neighbors, so lines shared by consecutive center
+ *     lines are transferred only once. Each transfer is waited for synchronously: when
+ *     consecutive Doppler lines hold detections only the upper neighbor is new (one wait
+ *     per line, as for the detection matrix based scheme), an isolated line costs up to
+ *     three waits.
+ *
+ *  @param[in] cfarObj          Pointer to CFAR DPU object
+ *  @param[in] dopplerLine      Doppler line to be returned
+ *  @param[in] centerLine       Doppler line currently under test
+ *  @param[in] waitingTime      Pointer to waiting time involved during CFAR processing
+ *
+ *  \ingroup    DPU_CFARCAPROC_INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Success     - Pointer to the local copy of the Doppler line
+ *  @retval
+ *      Error       - NULL
+ *
+ */
+static uint16_t *CFARCADSP_getLocalMaxLine
+(
+    CFARCADspObj    *cfarObj,
+    uint32_t        dopplerLine,
+    uint32_t        centerLine,
+    uint32_t        *waitingTime
+)
+{
+    uint16_t            *linePtr = NULL;
+    uint32_t            slotIdx;
+    uint32_t            dopplerMask = cfarObj->staticCfg.numDopplerBins - 1U;
+    uint32_t            distance;
+    uint32_t            srcAddr;
+    volatile uint32_t   startTimeWait;
+
+    for (slotIdx = 0U; slotIdx < CFARCADSP_NUM_LOCAL_MAX_LINES; slotIdx++)
+    {
+        if (cfarObj->localMaxLineTag[slotIdx] == (int32_t)dopplerLine)
+        {
+            linePtr = &cfarObj->res.cfarLocalMaxLineBuffer[slotIdx * cfarObj->staticCfg.numRangeBins];
+            goto exit;
+        }
+    }
+
+    /* Pick a slot not holding the center line or its neighbors */
+    for (slotIdx = 0U; slotIdx < CFARCADSP_NUM_LOCAL_MAX_LINES; slotIdx++)
+    {
+        if (cfarObj->localMaxLineTag[slotIdx] < 0)
+        {
+            break;
+        }
+
+        distance = ((uint32_t)cfarObj->localMaxLineTag[slotIdx] - centerLine + 1U) & dopplerMask;
+        if (distance > 2U)
+        {
+            break;
+        }
+    }
+
+    linePtr = &cfarObj->res.cfarLocalMaxLineBuffer[slotIdx * cfarObj->staticCfg.numRangeBins];
+    srcAddr = dopplerLine * sizeof(uint16_t) + (uint32_t)cfarObj->res.detMatrix.data;
+
+    CFARCADSP_configEDMARangeDomain(cfarObj->res.edmaHandle,
+                                    &cfarObj->res.edmaInPing,
+                                    &cfarObj->staticCfg,
+                                    srcAddr,
+                                    (uint32_t)linePtr);
+
+    if (EDMA_startDmaTransfer(cfarObj->res.edmaHandle, cfarObj->res.edmaInPing.channel) != EDMA_NO_ERROR)
+    {
+        linePtr = NULL;
+        goto exit;
+    }
+
+    startTimeWait = Cycleprofiler_getTimeStamp();
+    CFARCADSP_waitEDMATransComplete(cfarObj->res.edmaHandle, cfarObj->res.edmaInPing.channel);
+    *waitingTime += Cycleprofiler_getTimeStamp() - startTimeWait;
+
+    cfarObj->localMaxLineTag[slotIdx] = (int32_t)dopplerLine;
+
+exit:
+    return(linePtr);
+}
+
 /**
  *  @b Description
  *  @n
@@ -1186,6 +1745,8 @@ exit:
  *
  *  @param[in] cfarObj          Pointer to CFAR DPU object
  *  @param[in] peakGrpingEn     Peak grouping enable flag
+ *  @param[in] localMaxEn       Local maximum peak grouping fused with range domain CFAR,
+ *                              detections that are not local maxima are dropped here
  *  @param[in] waitingTime      Pointer to waiting time involved during CFAR processing
  *  @param[in] numDetObjDoppler  Number of detected object in doppler domain
  *
@@ -1199,6 +1760,7 @@ static int32_t CFARCADSP_processRangeDomain
 (
     CFARCADspObj    *cfarObj,
     uint8_t         peakGrpingEn,
+    uint8_t         localMaxEn,
     uint32_t        *waitingTime,
     uint32_t        numDetObjDoppler
 )
@@ -1213,9 +1775,23 @@ static int32_t CFARCADSP_processRangeDomain
     uint16_t            loopIndex = 0;
     uint16_t            oneDopplerBinSize;
     int16_t             dopplerSgnIdx;
+    uint32_t            haloLen;
+    uint32_t            haloStartIdx;
+    uint32_t            haloEndIdx;
 
     oneDopplerBinSize = cfarObj->staticCfg.numRangeBins * sizeof(uint16_t);
 
+    /* Range tile is extended by the one sided noise window on both sides */
+    haloLen = cfarObj->cfarCfgRange.guardLen + cfarObj->cfarCfgRange.winLen;
+    haloStartIdx = (cfarObj->tileStartIdx > haloLen) ? (cfarObj->tileStartIdx - haloLen) : 0U;
+    haloEndIdx = MIN(cfarObj->tileEndIdx + haloLen, cfarObj->staticCfg.numRangeBins);
+
+    /* Detection matrix is new, local maximum line buffer holds no line */
+    for (detIdx = 0; detIdx < CFARCADSP_NUM_LOCAL_MAX_LINES; detIdx++)
+    {
+        cfarObj->localMaxLineTag[detIdx] = -1;
+    }
+
     /* Starting from first dopplerLine */
     dopplerLine = 0;
 
@@ -1224,7 +1800,8 @@ static int32_t CFARCADSP_processRangeDomain
         /* Check if any bits are set for a particular doppler line */
         if(CFARCADSP_isObjectDetectedOnDopplerLine(dopplerLine,
                                                cfarObj->staticCfg.numDopplerBins,
-                                               cfarObj->staticCfg.numRangeBins,
+                                               cfarObj->tileStartIdx,
+                                               cfarObj->tileEndIdx,
                                                cfarObj->res.cfarDopplerDetOutBitMask) == false)
         {
             /* No objects are found on doppler line , skip to next doppler line */
@@ -1238,37 +1815,70 @@ static int32_t CFARCADSP_processRangeDomain
            dopplerSgnIdx = dopplerSgnIdx - (int32_t)cfarObj->staticCfg.numDopplerBins;
         }
 
-        /* Calculate source address in detMatrix for a doppler Line with detected objects */
-        srcAddr = dopplerLine*sizeof(uint16_t) + (uint32_t)cfarObj->res.detMatrix.data;
-
-        /* When loopIndex is even, use Ping buffer. Otherwise use pong buffer */
-        localBufferAddr = (uint32_t)cfarObj->res.localDetMatrixBuffer + (loopIndex %2) *oneDopplerBinSize;
+        if (localMaxEn)
+        {
+            uint16_t *centerLine;
+            uint16_t *lowerLine;
+            uint16_t *upperLine;
+            uint32_t dopplerMask = cfarObj->staticCfg.numDopplerBins - 1U;
+
+            /* Bring in the doppler line, and its neighbors for Doppler direction grouping */
+            centerLine = CFARCADSP_getLocalMaxLine(cfarObj, dopplerLine, dopplerLine, waitingTime);
+            lowerLine = centerLine;
+            upperLine = centerLine;
+            if (cfarObj->cfarCfgDoppler.peakGroupingEn)
+            {
+                lowerLine = CFARCADSP_getLocalMaxLine(cfarObj, (dopplerLine - 1U) & dopplerMask, dopplerLine, waitingTime);
+                upperLine = CFARCADSP_getLocalMaxLine(cfarObj, (dopplerLine + 1U) & dopplerMask, dopplerLine, waitingTime);
+            }
+            if ((centerLine == NULL) || (lowerLine == NULL) || (upperLine == NULL))
+            {
+                goto exit;
+            }
 
-        /* Setup EDMA to bring in detection matrix for the dopplerLine */
-        CFARCADSP_configEDMARangeDomain(cfarObj->res.edmaHandle,
-                                            &cfarObj->res.edmaInPing,
-                                            &cfarObj->staticCfg,
-                                            srcAddr,
-                                            localBufferAddr);
+            CFARCADSP_localMaxMaskLine(lowerLine, centerLine, upperLine,
+                                       cfarObj->staticCfg.numRangeBins,
+                                       cfarObj->cfarCfgDoppler.peakGroupingEn,
+                                       cfarObj->cfarCfgRange.peakGroupingEn,
+                                       &cfarObj->res.cfarLocalMaxLineBuffer[CFARCADSP_NUM_LOCAL_MAX_LINES * cfarObj->staticCfg.numRangeBins],
+                                       cfarObj->res.cfarLocalMaxMask);
 
-        if (( EDMA_startDmaTransfer(cfarObj->res.edmaHandle, cfarObj->res.edmaInPing.channel)) != EDMA_NO_ERROR)
-        {
-            goto exit;
+            localBufferAddr = (uint32_t)centerLine;
         }
+        else
+        {
+            /* Calculate source address in detMatrix for a doppler Line with detected objects */
+            srcAddr = dopplerLine*sizeof(uint16_t) + (uint32_t)cfarObj->res.detMatrix.data;
 
-        /* Wait for DMA transfer of current dopple line to complete */
-        startTimeWait = Cycleprofiler_getTimeStamp();
-        CFARCADSP_waitEDMATransComplete(cfarObj->res.edmaHandle, cfarObj->res.edmaInPing.channel);
-        *waitingTime += Cycleprofiler_getTimeStamp() - startTimeWait;
+            /* When loopIndex is even, use Ping buffer. Otherwise use pong buffer */
+            localBufferAddr = (uint32_t)cfarObj->res.localDetMatrixBuffer + (loopIndex %2) *oneDopplerBinSize;
+
+            /* Setup EDMA to bring in detection matrix for the dopplerLine */
+            CFARCADSP_configEDMARangeDomain(cfarObj->res.edmaHandle,
+                                                &cfarObj->res.edmaInPing,
+                                                &cfarObj->staticCfg,
+                                                srcAddr,
+                                                localBufferAddr);
+
+            if (( EDMA_startDmaTransfer(cfarObj->res.edmaHandle, cfarObj->res.edmaInPing.channel)) != EDMA_NO_ERROR)
+            {
+                goto exit;
+            }
 
-        /* Do CFAR search for range peak among numRangeBins samples for the doppler line*/
+            /* Wait for DMA transfer of current dopple line to complete */
+            startTimeWait = Cycleprofiler_getTimeStamp();
+            CFARCADSP_waitEDMATransComplete(cfarObj->res.edmaHandle, cfarObj->res.edmaInPing.channel);
+            *waitingTime += Cycleprofiler_getTimeStamp() - startTimeWait;
+        }
+
+        /* Do CFAR search for range peak among range tile samples including halo for the doppler line*/
         numDetObj = CFARCADSP_cfarCadB_SOGO(
-                (uint16_t *)localBufferAddr,
+                &((uint16_t *)localBufferAddr)[haloStartIdx],
                 cfarObj->res.cfarDetOutBuffer,
-                cfarObj->staticCfg.numRangeBins,
+                haloEndIdx - haloStartIdx,
                 cfarObj->cfarCfgRange.averageMode,
-                cfarObj->cfarCfgRange.thresholdScale,
-                cfarObj->cfarCfgRange.noiseDivShift, 
+                &cfarObj->res.cfarThresholdLut[haloStartIdx],
+                cfarObj->cfarCfgRange.noiseDivShift,
                 cfarObj->cfarCfgRange.guardLen,
                 cfarObj->cfarCfgRange.winLen,
                 cfarObj->detObjPeakIdxBuf);
@@ -1281,7 +1891,13 @@ static int32_t CFARCADSP_processRangeDomain
                 uint16_t *cfarDetList = (uint16_t *)cfarObj->res.cfarDetOutBuffer;
                 uint16_t *detMat = (uint16_t *)localBufferAddr;
 
-                rangeIdx = cfarDetList[detIdx];
+                rangeIdx = cfarDetList[detIdx] + haloStartIdx;
+
+                if ((rangeIdx < cfarObj->tileStartIdx) || (rangeIdx >= cfarObj->tileEndIdx))
+                {
+                    /* Halo bin, reported by the instance owning the neighboring range tile */
+                    continue;
+                }
 
                 /* Is the object in Doppler Domain as well? */
                 if(CFARCADSP_isObjectDetected( rangeIdx,
@@ -1293,6 +1909,13 @@ static int32_t CFARCADSP_processRangeDomain
                     continue;
                 }
 
+                if ((localMaxEn) &&
+                    ((cfarObj->res.cfarLocalMaxMask[rangeIdx >> 5U] & (1U << (rangeIdx & 31U))) == 0U))
+                {
+                    /* Not a local maximum, object is grouped into a neighboring peak */
+                    continue;
+                }
+
                 if ((rangeIdx >= cfarObj->fovRange.minIdx) &&
                    (rangeIdx <= cfarObj->fovRange.maxIdx) &&
                    (dopplerSgnIdx >= cfarObj->fovDoppler.minIdx) &&
@@ -1302,6 +1925,12 @@ static int32_t CFARCADSP_processRangeDomain
 
                     /* Calculate noise */
                     noisedB = CFARCADSP_CONV_PEAK_TO_LOG((float)cfarObj->detObjPeakIdxBuf[detIdx], DPIF_DETMATRIX_DATA_QFORMAT);
+                    if (localMaxEn)
+                    {
+                        /* SNR from the truncated noise, as in the grouping pass of the
+                           detection matrix based scheme */
+                        noisedB = (float)((int16_t)noisedB);
+                    }
                     if(peakGrpingEn)
                     {
                         cfarObj->detObjRangeIdxBuf[numDetObjIndex] = rangeIdx;
@@ -1419,6 +2048,7 @@ int32_t DPU_CFARCAProcDSP_config
        (pRes->cfarDetOutBuffer == NULL) ||
        (pRes->cfarDopplerDetOutBitMask == NULL) ||
        (pRes->cfarRngDopSnrList == NULL) ||
+       (pRes->cfarThresholdLut == NULL) ||
        (pRes->detMatrix.data == NULL))
     {
         retVal = DPU_CFARCAPROCDSP_EINVAL_EBUFFER_POINTER;
@@ -1474,6 +2104,13 @@ int32_t DPU_CFARCAProcDSP_config
         goto exit;
     }
 
+    if MEM_IS_NOT_ALIGN(pRes->cfarThresholdLut,
+                        DPU_CFARCAPROCDSP_THRESHOLD_LUT_BYTE_ALIGNMENT)
+    {
+        retVal = DPU_CFARCAPROCDSP_ENOMEMALIGN_THRESHOLD_LUT;
+        goto exit;
+    }
+
     /* Check if input scratch memory for bit mask is sufficient */
     if ((pRes->cfarDopplerDetOutBitMaskSize * 32U) <
                 (staticCfg->numDopplerBins * staticCfg->numRangeBins))
@@ -1485,6 +2122,7 @@ int32_t DPU_CFARCAProcDSP_config
     /* Validating buffer size */
     if( (pRes->localDetMatrixBufferSize < MAX(staticCfg->numDopplerBins, staticCfg->numRangeBins) * sizeof(uint16_t) * 2U) ||
        (pRes->cfarDetOutBufferSize < MAX(staticCfg->numDopplerBins, staticCfg->numRangeBins) * sizeof(uint16_t)) ||
+       (pRes->cfarThresholdLutSize < staticCfg->numRangeBins * sizeof(uint16_t) * 2U) ||
        (pRes->detMatrix.dataSize < staticCfg->numRangeBins * staticCfg->numDopplerBins * sizeof(uint16_t)))
     {
         retVal = DPU_CFARCAPROCDSP_EINVAL_EBUFFER_SIZE;
@@ -1494,7 +2132,8 @@ int32_t DPU_CFARCAProcDSP_config
     /* Validate peak grouping parameters */
     if(((cfarcaCfg->dynCfg.cfarCfgRange->peakGroupingEn) &&
       (cfarcaCfg->dynCfg.cfarCfgRange->peakGroupingScheme != DPU_CFAR_PEAK_GROUPING_DET_MATRIX_BASED)) &&
-      (cfarcaCfg->dynCfg.cfarCfgRange->peakGroupingScheme != DPU_CFAR_PEAK_GROUPING_CFAR_PEAK_BASED))
+      (cfarcaCfg->dynCfg.cfarCfgRange->peakGroupingScheme != DPU_CFAR_PEAK_GROUPING_CFAR_PEAK_BASED) &&
+      (cfarcaCfg->dynCfg.cfarCfgRange->peakGroupingScheme != DPU_CFAR_PEAK_GROUPING_LOCAL_MAX_FUSED))
     {
         retVal = DPU_CFARCAPROCDSP_EINVAL;
         goto exit;
@@ -1502,14 +2141,111 @@ int32_t DPU_CFARCAProcDSP_config
 
     if(((cfarcaCfg->dynCfg.cfarCfgDoppler->peakGroupingEn) &&
       (cfarcaCfg->dynCfg.cfarCfgDoppler->peakGroupingScheme != DPU_CFAR_PEAK_GROUPING_DET_MATRIX_BASED)) &&
-      (cfarcaCfg->dynCfg.cfarCfgDoppler->peakGroupingScheme != DPU_CFAR_PEAK_GROUPING_CFAR_PEAK_BASED))
+      (cfarcaCfg->dynCfg.cfarCfgDoppler->peakGroupingScheme != DPU_CFAR_PEAK_GROUPING_CFAR_PEAK_BASED) &&
+      (cfarcaCfg->dynCfg.cfarCfgDoppler->peakGroupingScheme != DPU_CFAR_PEAK_GROUPING_LOCAL_MAX_FUSED))
     {
         retVal = DPU_CFARCAPROCDSP_EINVAL;
         goto exit;
     }
 
+    if (cfarcaCfg->dynCfg.rangeThresholdProfile != NULL)
+    {
+        retVal = CFARCADSP_validateThresholdProfile(cfarcaCfg->dynCfg.rangeThresholdProfile);
+        if (retVal != 0)
+        {
+            goto exit;
+        }
+    }
+
+    if (cfarcaCfg->staticCfg.noiseMapCfg.enabled)
+    {
+        if ((cfarcaCfg->staticCfg.noiseMapCfg.log2NumDopplerRegions > cfarcaCfg->staticCfg.log2NumDopplerBins) ||
+            (cfarcaCfg->staticCfg.noiseMapCfg.refreshPeriod == 0U) ||
+            (cfarcaCfg->staticCfg.noiseMapCfg.alphaShift >= 16U))
+        {
+            retVal = DPU_CFARCAPROCDSP_EINVAL__NOISE_MAP;
+            goto exit;
+        }
+
+        if ((pRes->cfarNoiseMap == NULL) ||
+            (pRes->cfarNoiseMapSize < ((uint32_t)cfarcaCfg->staticCfg.numRangeBins <<
+                                       cfarcaCfg->staticCfg.noiseMapCfg.log2NumDopplerRegions) * sizeof(uint16_t)))
+        {
+            retVal = DPU_CFARCAPROCDSP_EINVAL_EBUFFER_SIZE;
+            goto exit;
+        }
+
+        if MEM_IS_NOT_ALIGN(pRes->cfarNoiseMap,
+                            DPU_CFARCAPROCDSP_NOISE_MAP_BYTE_ALIGNMENT)
+        {
+            retVal = DPU_CFARCAPROCDSP_ENOMEMALIGN_NOISE_MAP;
+            goto exit;
+        }
+    }
+
+    if (((cfarcaCfg->dynCfg.cfarCfgRange->peakGroupingEn) &&
+         (cfarcaCfg->dynCfg.cfarCfgRange->peakGroupingScheme == DPU_CFAR_PEAK_GROUPING_LOCAL_MAX_FUSED)) ||
+        ((cfarcaCfg->dynCfg.cfarCfgDoppler->peakGroupingEn) &&
+         (cfarcaCfg->dynCfg.cfarCfgDoppler->peakGroupingScheme == DPU_CFAR_PEAK_GROUPING_LOCAL_MAX_FUSED)))
+    {
+        if ((pRes->cfarLocalMaxLineBuffer == NULL) ||
+            (pRes->cfarLocalMaxMask == NULL) ||
+            (pRes->cfarLocalMaxLineBufferSize < (4U * cfarcaCfg->staticCfg.numRangeBins + 4U) * sizeof(uint16_t)) ||
+            (pRes->cfarLocalMaxMaskSize < ((cfarcaCfg->staticCfg.numRangeBins + 31U) >> 5U)))
+        {
+            retVal = DPU_CFARCAPROCDSP_EINVAL_EBUFFER_SIZE;
+            goto exit;
+        }
+
+        if ((MEM_IS_NOT_ALIGN(pRes->cfarLocalMaxLineBuffer, DPU_CFARCAPROCDSP_LOCAL_MAX_BYTE_ALIGNMENT)) ||
+            (MEM_IS_NOT_ALIGN(pRes->cfarLocalMaxMask, DPU_CFARCAPROCDSP_LOCAL_MAX_BYTE_ALIGNMENT)))
+        {
+            retVal = DPU_CFARCAPROCDSP_ENOMEMALIGN_LOCAL_MAX;
+            goto exit;
+        }
+    }
+
+    if ((cfarcaCfg->staticCfg.numRangeTileBins != 0U) &&
+        (((cfarcaCfg->staticCfg.rangeTileStartIdx & 0x1U) != 0U) ||
+         ((cfarcaCfg->staticCfg.numRangeTileBins & 0x1U) != 0U) ||
+         ((uint32_t)cfarcaCfg->staticCfg.rangeTileStartIdx + cfarcaCfg->staticCfg.numRangeTileBins >
+          cfarcaCfg->staticCfg.numRangeBins)))
+    {
+        retVal = DPU_CFARCAPROCDSP_EINVAL__RANGE_TILE;
+        goto exit;
+    }
+
+    /* CFAR peak based grouping only sees the detections of the tile, it would not give the
+       untiled result at the tile edges */
+    if ((cfarcaCfg->staticCfg.numRangeTileBins != 0U) &&
+        (CFARCADSP_isCfarPeakBasedGrouping(cfarcaCfg->dynCfg.cfarCfgRange) ||
+         CFARCADSP_isCfarPeakBasedGrouping(cfarcaCfg->dynCfg.cfarCfgDoppler)))
+    {
+        retVal = DPU_CFARCAPROCDSP_EINVAL__RANGE_TILE;
+        goto exit;
+    }
+
     CFARCADSP_saveConfiguration(cfarDspObj, cfarcaCfg);
 
+    if (cfarcaCfg->staticCfg.numRangeTileBins != 0U)
+    {
+        cfarDspObj->tileStartIdx = cfarcaCfg->staticCfg.rangeTileStartIdx;
+        cfarDspObj->tileEndIdx = cfarcaCfg->staticCfg.rangeTileStartIdx + cfarcaCfg->staticCfg.numRangeTileBins;
+    }
+    else
+    {
+        cfarDspObj->tileStartIdx = 0U;
+        cfarDspObj->tileEndIdx = cfarcaCfg->staticCfg.numRangeBins;
+    }
+
+    if ((cfarcaCfg->staticCfg.noiseMapCfg.enabled) && (cfarcaCfg->staticCfg.resetNoiseMap))
+    {
+        /* Range lines not reached in first refresh keep a floor that allows no detection */
+        memset((void *)pRes->cfarNoiseMap, 0xFF, pRes->cfarNoiseMapSize);
+        cfarDspObj->isNoiseMapEmpty = true;
+        cfarDspObj->noiseMapFrameCnt = 0U;
+    }
+
     /* The scrach buffer will be used for peak grouping and cfar noise buffer */
     if((pRes->cfarScrachBuffer == NULL) ||
       (pRes->cfarScrachBufferSize < pRes->cfarRngDopSnrListSize * sizeof(uint16_t) * 4U ))
@@ -1560,6 +2296,8 @@ int32_t DPU_CFARCAProcDSP_process
     volatile uint32_t   startTime;
     uint32_t            waitTimeLocal = 0;
     uint8_t             peakGrpingEn = 0;
+    uint8_t             noiseMapRefreshEn = 0;
+    uint8_t             localMaxEn = 0;
 
     if (handle == NULL)
     {
@@ -1573,20 +2311,54 @@ int32_t DPU_CFARCAProcDSP_process
     if ( (cfarDspObj->cfarCfgRange.peakGroupingEn) || (cfarDspObj->cfarCfgDoppler.peakGroupingEn))
     {
         peakGrpingEn = 1;
+
+        /* Local maximum grouping is fused into the range domain CFAR pass */
+        if ((CFARCADSP_getPeakGroupingScheme(cfarDspObj) == DPU_CFAR_PEAK_GROUPING_LOCAL_MAX_FUSED) &&
+            (cfarDspObj->cfarCfgRange.thresholdScale > 0))
+        {
+            localMaxEn = 1;
+        }
     }
     startTime = Cycleprofiler_getTimeStamp();
 
+    if (cfarDspObj->isThresholdLutValid == false)
+    {
+        CFARCADSP_genThresholdLut(cfarDspObj);
+    }
+
     /* CFARCA Peak search along doppler line */
     if (cfarDspObj->cfarCfgDoppler.thresholdScale > 0)
     {
+        /* Noise floor map is refreshed once every refreshPeriod frames */
+        if (cfarDspObj->staticCfg.noiseMapCfg.enabled)
+        {
+            if ((cfarDspObj->isNoiseMapEmpty) || (cfarDspObj->noiseMapFrameCnt == 0U))
+            {
+                noiseMapRefreshEn = 1;
+            }
+
+            cfarDspObj->noiseMapFrameCnt++;
+            if (cfarDspObj->noiseMapFrameCnt >= cfarDspObj->staticCfg.noiseMapCfg.refreshPeriod)
+            {
+                cfarDspObj->noiseMapFrameCnt = 0U;
+            }
+        }
+
         /* Configure EDMA */
-        retVal = CFARCADSP_configEDMADopplerDomain(pRes, &cfarDspObj->staticCfg);
+        retVal = CFARCADSP_configEDMADopplerDomain(pRes, &cfarDspObj->staticCfg,
+                                                   cfarDspObj->tileStartIdx,
+                                                   cfarDspObj->tileEndIdx - cfarDspObj->tileStartIdx);
         if (retVal != 0)
         {
             goto exit;
         }
 
-        numObjs = CFARCADSP_processDopplerDomain(cfarDspObj, peakGrpingEn, &waitTimeLocal, &retVal);
+        numObjs = CFARCADSP_processDopplerDomain(cfarDspObj, peakGrpingEn, noiseMapRefreshEn, &waitTimeLocal, &retVal);
+
+        if (noiseMapRefreshEn)
+        {
+            cfarDspObj->isNoiseMapEmpty = false;
+        }
     }
     else
     {
@@ -1597,7 +2369,9 @@ int32_t DPU_CFARCAProcDSP_process
     /* CFARCA Peak search along range line*/
     if (cfarDspObj->cfarCfgRange.thresholdScale > 0)
     {
-        numObjs = CFARCADSP_processRangeDomain(cfarDspObj, peakGrpingEn, &waitTimeLocal, numObjs);
+        /* With fused local maximum grouping, range domain outputs the final list */
+        numObjs = CFARCADSP_processRangeDomain(cfarDspObj, (localMaxEn ? 0U : peakGrpingEn), localMaxEn,
+                                               &waitTimeLocal, numObjs);
     }
 
     if (numObjs > pRes->cfarRngDopSnrListSize)
@@ -1605,8 +2379,8 @@ int32_t DPU_CFARCAProcDSP_process
         numObjs = pRes->cfarRngDopSnrListSize;
     }
 
-    /* CFARCA peak Grouping */
-    if ( (cfarDspObj->cfarCfgRange.peakGroupingEn) || (cfarDspObj->cfarCfgDoppler.peakGroupingEn))
+    /* CFARCA peak Grouping, already done for fused local maximum scheme */
+    if ((peakGrpingEn) && (localMaxEn == 0U))
     {
         numObjs = CFARCADSP_peakGrouping(cfarDspObj, numObjs);
     }
@@ -1614,6 +2388,7 @@ int32_t DPU_CFARCAProcDSP_process
     cfarDspObj->numProcess++;
 
     outParams->numCfarDetectedPoints = numObjs;
+    outParams->isNoiseMapRefreshed = (noiseMapRefreshEn != 0U);
     outParams->stats.waitTime = waitTimeLocal;
     outParams->stats.processingTime = Cycleprofiler_getTimeStamp() - startTime - waitTimeLocal;
     outParams->stats.numProcess = cfarDspObj->numProcess;
@@ -1671,16 +2446,31 @@ int32_t DPU_CFARCAProcDSP_control
             }
             else if( (cfarcaCfg->peakGroupingEn) &&
                    ((cfarcaCfg->peakGroupingScheme != DPU_CFAR_PEAK_GROUPING_DET_MATRIX_BASED) &&
-                   (cfarcaCfg->peakGroupingScheme != DPU_CFAR_PEAK_GROUPING_CFAR_PEAK_BASED)))
+                   (cfarcaCfg->peakGroupingScheme != DPU_CFAR_PEAK_GROUPING_CFAR_PEAK_BASED) &&
+                   (cfarcaCfg->peakGroupingScheme != DPU_CFAR_PEAK_GROUPING_LOCAL_MAX_FUSED)))
             {
                 retVal = DPU_CFARCAPROCDSP_EINVAL;
                 goto exit;
             }
+            else if( (cfarcaCfg->peakGroupingEn) &&
+                     (cfarcaCfg->peakGroupingScheme == DPU_CFAR_PEAK_GROUPING_LOCAL_MAX_FUSED) &&
+                     ((cfarDspObj->res.cfarLocalMaxLineBuffer == NULL) || (cfarDspObj->res.cfarLocalMaxMask == NULL)))
+            {
+                retVal = DPU_CFARCAPROCDSP_EINVAL;
+                goto exit;
+            }
+            else if( (cfarDspObj->staticCfg.numRangeTileBins != 0U) &&
+                     CFARCADSP_isCfarPeakBasedGrouping(cfarcaCfg))
+            {
+                retVal = DPU_CFARCAPROCDSP_EINVAL__RANGE_TILE;
+                goto exit;
+            }
             else
             {
                 /* Save configuration */
                 memcpy((void *)&cfarDspObj->cfarCfgRange, arg, argSize);   
                 CFARCADSP_adjustCfarCfg(&cfarDspObj->cfarCfgRange);
+                cfarDspObj->isThresholdLutValid = false;
             }
         }
         break;
@@ -1695,11 +2485,25 @@ int32_t DPU_CFARCAProcDSP_control
             }
             else if( (cfarcaCfg->peakGroupingEn) &&
                    ((cfarcaCfg->peakGroupingScheme != DPU_CFAR_PEAK_GROUPING_DET_MATRIX_BASED) &&
-                   (cfarcaCfg->peakGroupingScheme != DPU_CFAR_PEAK_GROUPING_CFAR_PEAK_BASED)))
+                   (cfarcaCfg->peakGroupingScheme != DPU_CFAR_PEAK_GROUPING_CFAR_PEAK_BASED) &&
+                   (cfarcaCfg->peakGroupingScheme != DPU_CFAR_PEAK_GROUPING_LOCAL_MAX_FUSED)))
             {
                 retVal = DPU_CFARCAPROCDSP_EINVAL;
                 goto exit;
             }
+            else if( (cfarcaCfg->peakGroupingEn) &&
+                     (cfarcaCfg->peakGroupingScheme == DPU_CFAR_PEAK_GROUPING_LOCAL_MAX_FUSED) &&
+                     ((cfarDspObj->res.cfarLocalMaxLineBuffer == NULL) || (cfarDspObj->res.cfarLocalMaxMask == NULL)))
+            {
+                retVal = DPU_CFARCAPROCDSP_EINVAL;
+                goto exit;
+            }
+            else if( (cfarDspObj->staticCfg.numRangeTileBins != 0U) &&
+                     CFARCADSP_isCfarPeakBasedGrouping(cfarcaCfg))
+            {
+                retVal = DPU_CFARCAPROCDSP_EINVAL__RANGE_TILE;
+                goto exit;
+            }
             else
             {
                 /* Save configuration */
@@ -1707,6 +2511,7 @@ int32_t DPU_CFARCAProcDSP_control
                 /* DPU assumes that Doppler is always CFAR-CA but following code
                    is added for generality */
                 CFARCADSP_adjustCfarCfg(&cfarDspObj->cfarCfgDoppler);
+                cfarDspObj->isThresholdLutValid = false;
             }
         }
         break;
@@ -1744,6 +2549,26 @@ int32_t DPU_CFARCAProcDSP_control
             }
         }
         break;
+        case DPU_CFARCAProcDSP_Cmd_RangeThresholdProfileCfg:
+        {
+            if((argSize != sizeof(DPU_CFARCAProc_RangeThresholdProfileCfg)) ||
+               (arg == NULL))
+            {
+                retVal = DPU_CFARCAPROCDSP_EINVAL;
+                goto exit;
+            }
+
+            retVal = CFARCADSP_validateThresholdProfile((DPU_CFARCAProc_RangeThresholdProfileCfg *)arg);
+            if (retVal != 0)
+            {
+                goto exit;
+            }
+
+            /* Save configuration, table is regenerated in next processing call */
+            memcpy((void *)&cfarDspObj->rangeThresholdProfile, arg, argSize);
+            cfarDspObj->isThresholdLutValid = false;
+        }
+        break;
 
         default:
             retVal = DPU_CFARCAPROCDSP_EINVAL;
@@ -1783,3 +2608,107 @@ int32_t DPU_CFARCAProcDSP_deinit(DPU_CFARCAProcDSP_Handle handle)
     }
     return (retVal);
 }
+
+/**
+ *  @b Description
+ *  @n
+ *      The function merges the detection lists produced by CFARCAProcDSP instances that
+ *   were each configured for one range tile (@ref DPU_CFARCAProcDSP_StaticConfig::rangeTileStartIdx)
+ *   into a single list. Each tile list is already sorted, the merge picks the smallest
+ *   (Doppler, range) or (range, Doppler) index pair across all tiles so that the merged list
+ *   has the same order as the list produced by a single untiled instance.
+ *
+ *  @param[out] detList          Merged detection list
+ *  @param[in]  detListSize      Maximum number of entries in merged detection list
+ *  @param[in]  tileDetList      Array of tile detection lists
+ *  @param[in]  numTileDet       Array of number of detections in each tile detection list
+ *  @param[in]  numTiles         Number of tiles, up to @ref DPU_CFARCAPROCDSP_MAX_NUM_RANGE_TILES
+ *  @param[in]  isDopplerMajor   true: tile lists are sorted by Doppler index first (range domain
+ *                               CFAR enabled), false: sorted by range index first.
+ *
+ *  \ingroup    DPU_CFARCAPROC_EXTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Success     - Number of detections in merged list
+ *  @retval
+ *      Error       - <0
+ */
+int32_t DPU_CFARCAProcDSP_mergeTileDetList
+(
+    DPIF_CFARDetList    *detList,
+    uint32_t            detListSize,
+    DPIF_CFARDetList    *tileDetList[],
+    uint32_t            numTileDet[],
+    uint32_t            numTiles,
+    bool                isDopplerMajor
+)
+{
+    int32_t     retVal = 0;
+    uint32_t    tileCursor[DPU_CFARCAPROCDSP_MAX_NUM_RANGE_TILES];
+    uint32_t    tileIdx;
+    uint32_t    minTileIdx;
+    uint32_t    key;
+    uint32_t    minKey;
+    uint32_t    numDetObj = 0U;
+    DPIF_CFARDetList *det;
+
+    if ((detList == NULL) || (tileDetList == NULL) || (numTileDet == NULL) ||
+        (numTiles == 0U) || (numTiles > DPU_CFARCAPROCDSP_MAX_NUM_RANGE_TILES))
+    {
+        retVal = DPU_CFARCAPROCDSP_EINVAL;
+        goto exit;
+    }
+
+    for (tileIdx = 0U; tileIdx < numTiles; tileIdx++)
+    {
+        if ((tileDetList[tileIdx] == NULL) && (numTileDet[tileIdx] != 0U))
+        {
+            retVal = DPU_CFARCAPROCDSP_EINVAL;
+            goto exit;
+        }
+        tileCursor[tileIdx] = 0U;
+    }
+
+    while (numDetObj < detListSize)
+    {
+        minTileIdx = numTiles;
+        minKey = 0xFFFFFFFFU;
+
+        for (tileIdx = 0U; tileIdx < numTiles; tileIdx++)
+        {
+            if (tileCursor[tileIdx] < numTileDet[tileIdx])
+            {
+                det = &tileDetList[tileIdx][tileCursor[tileIdx]];
+                if (isDopplerMajor)
+                {
+                    key = ((uint32_t)(uint16_t)det->dopplerIdx << 16U) | (uint32_t)det->rangeIdx;
+                }
+                else
+                {
+                    key = ((uint32_t)det->rangeIdx << 16U) | (uint32_t)(uint16_t)det->dopplerIdx;
+                }
+
+                if ((minTileIdx == numTiles) || (key < minKey))
+                {
+                    minKey = key;
+                    minTileIdx = tileIdx;
+                }
+            }
+        }
+
+        if (minTileIdx == numTiles)
+        {
+            /* All tile lists consumed */
+            break;
+        }
+
+        detList[numDetObj] = tileDetList[minTileIdx][tileCursor[minTileIdx]];
+        tileCursor[minTileIdx]++;
+        numDetObj++;
+    }
+
+    retVal = (int32_t)numDetObj;
+
+exit:
+    return (retVal);
+}
@@ -65,6 +65,11 @@
 
 //#define DBG_CFAR_HWA_OBJ_DPU
 
+/* CFARCAPROCHWA_SW_EMULATION, defined by building the library with
+ * CFARCAPROCHWA_SW_EMULATION=1, runs the CFAR parameter sets in software
+ * (@ref CFARHWA_emulateCFAR) instead of on the HWA. HWA and EDMA are not used
+ * and the hwaMemOutDoppler/hwaMemOutRange buffers can be located in any memory. */
+
 #ifdef DBG_CFAR_HWA_OBJ_DPU
 CFARHwaObj         *cfarHwaObj;
 volatile CFARHwaObj *gCfarHwaObj[RL_MAX_SUBFRAMES] = {NULL};
@@ -211,6 +216,276 @@ exit:
     return (retVal);
 }
 
+/**
+ *  @b Description
+ *  @n
+ *      Software emulation of one HWA CFAR line (one REG_BCNT iteration) as programmed
+ *      by @ref HWAutil_configCFAR: log input, CA/CAGO/CASO noise averaging with guard
+ *      cells, cyclic or non-cyclic edges and optional peak grouping. In non-cyclic mode
+ *      the cells at the edges use only the noise window that lies inside the line.
+ *
+ *  \ingroup    DPU_CFARCAPROC_INTERNAL_FUNCTION
+ *
+ *  @param[in]  line            Pointer to first sample of the line
+ *  @param[in]  stride          Distance in samples between two consecutive cells
+ *  @param[in]  len             Number of cells in the line
+ *  @param[in]  cfarCfg         CFAR configuration
+ *  @param[in]  iterNum         Iteration number reported in the output records
+ *  @param[out] outList         Output detection list
+ *  @param[in]  outListSize     Maximum number of records written to the output list
+ *  @param[in]  numDet          Number of detections found on previous lines
+ *
+ *  @retval Number of detections including previous lines
+ */
+static uint32_t CFARHWA_emulateCfarLine(const uint16_t *line,
+                                        uint32_t stride,
+                                        int32_t len,
+                                        DPU_CFARCAProc_CfarCfg *cfarCfg,
+                                        uint32_t iterNum,
+                                        DPU_CFARCAProcHWA_CfarDetOutput *outList,
+                                        uint32_t outListSize,
+                                        uint32_t numDet)
+{
+    int32_t     cellIdx;
+    int32_t     idx;
+    int32_t     guardLen = (int32_t)cfarCfg->guardLen;
+    int32_t     winLen = (int32_t)cfarCfg->winLen;
+    int32_t     halfLen = guardLen + winLen;
+    uint32_t    leftSum = 0U;
+    uint32_t    rightSum = 0U;
+    uint32_t    noise;
+    uint32_t    oneSideShift;
+    uint32_t    cut;
+    bool        leftValid;
+    bool        rightValid;
+    bool        isCyclic = (cfarCfg->cyclicMode != 0U);
+
+    /* In CA mode noiseDivShift accounts for both windows */
+    if ((cfarCfg->averageMode == 0U) && (cfarCfg->noiseDivShift > 0U))
+    {
+        oneSideShift = cfarCfg->noiseDivShift - 1U;
+    }
+    else
+    {
+        oneSideShift = cfarCfg->noiseDivShift;
+    }
+
+    /* Noise windows of cell 0 */
+    for (idx = guardLen + 1; idx <= halfLen; idx++)
+    {
+        if (idx < len)
+        {
+            rightSum += line[idx * stride];
+        }
+    }
+    if (isCyclic)
+    {
+        for (idx = len - halfLen; idx < len - guardLen; idx++)
+        {
+            leftSum += line[idx * stride];
+        }
+    }
+
+    for (cellIdx = 0; cellIdx < len; cellIdx++)
+    {
+        if (cellIdx > 0)
+        {
+            /* Slide both windows by one cell */
+            idx = cellIdx + halfLen;
+            if (idx >= len)
+            {
+                idx -= len;
+                if (!isCyclic)
+                {
+                    idx = -1;
+                }
+            }
+            if (idx >= 0)
+            {
+                rightSum += line[idx * stride];
+            }
+
+            idx = cellIdx + guardLen;
+            if (idx >= len)
+            {
+                idx -= len;
+                if (!isCyclic)
+                {
+                    idx = -1;
+                }
+            }
+            if (idx >= 0)
+            {
+                rightSum -= line[idx * stride];
+            }
+
+            idx = cellIdx - guardLen - 1;
+            if (idx < 0)
+            {
+                idx = isCyclic ? (idx + len) : -1;
+            }
+            if (idx >= 0)
+            {
+                leftSum += line[idx * stride];
+            }
+
+            idx = cellIdx - halfLen - 1;
+            if (idx < 0)
+            {
+                idx = isCyclic ? (idx + len) : -1;
+            }
+            if (idx >= 0)
+            {
+                leftSum -= line[idx * stride];
+            }
+        }
+
+        leftValid = isCyclic || (cellIdx >= halfLen);
+        rightValid = isCyclic || ((cellIdx + halfLen) < len);
+
+        if (leftValid && rightValid)
+        {
+            if (cfarCfg->averageMode == 0U)
+            {
+                noise = (leftSum + rightSum) >> cfarCfg->noiseDivShift;
+            }
+            else if (cfarCfg->averageMode == 1U)
+            {
+                noise = MAX(leftSum, rightSum) >> cfarCfg->noiseDivShift;
+            }
+            else
+            {
+                noise = MIN(leftSum, rightSum) >> cfarCfg->noiseDivShift;
+            }
+        }
+        else if (rightValid)
+        {
+            noise = rightSum >> oneSideShift;
+        }
+        else if (leftValid)
+        {
+            noise = leftSum >> oneSideShift;
+        }
+        else
+        {
+            continue;
+        }
+
+        cut = line[cellIdx * stride];
+        if (cut <= (noise + cfarCfg->thresholdScale))
+        {
+            continue;
+        }
+
+        if (cfarCfg->peakGroupingEn)
+        {
+            /* Cell has to be greater than both neighbors, edge neighbors wrap in cyclic mode */
+            if (cellIdx > 0)
+            {
+                if (cut <= line[(cellIdx - 1) * stride])
+                {
+                    continue;
+                }
+            }
+            else if (isCyclic && (cut <= line[(len - 1) * stride]))
+            {
+                continue;
+            }
+
+            if (cellIdx < (len - 1))
+            {
+                if (cut <= line[(cellIdx + 1) * stride])
+                {
+                    continue;
+                }
+            }
+            else if (isCyclic && (cut <= line[0]))
+            {
+                continue;
+            }
+        }
+
+        /* HWA counts all detections but writes only up to the destination size */
+        if (numDet < outListSize)
+        {
+            outList[numDet].noise = noise;
+            outList[numDet].cellIdx = (uint32_t)cellIdx;
+            outList[numDet].iterNum = iterNum;
+            outList[numDet].reserved = 0U;
+        }
+        numDet++;
+    }
+
+    return numDet;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Software emulation of the HWA CFAR parameter set configured by
+ *      @ref HWAutil_configCFAR. Runs CFAR over all lines of the detection matrix in
+ *      the requested domain and produces the same @ref DPU_CFARCAProcHWA_CfarDetOutput
+ *      records in the same order as the HWA, so the output can be fed to
+ *      @ref CFARHWA_convHwaCfarDetListToDetMask and @ref CFARHWA_cfarRange_AND_cfarDoppler.
+ *      The returned count emulates the CFAR peak count register.
+ *
+ *  \ingroup    DPU_CFARCAPROC_INTERNAL_FUNCTION
+ *
+ *  @param[in]  detMat          Detection matrix (@ref DPIF_DETMATRIX_FORMAT_1)
+ *  @param[in]  numRangeBins    Number of range bins
+ *  @param[in]  numDopplerBins  Number of Doppler bins
+ *  @param[in]  cfarCfg         CFAR configuration
+ *  @param[out] outList         Output detection list
+ *  @param[in]  outListSize     Size of the output detection list
+ *  @param[in]  cfarDomain      0: CFAR in range domain, 1: CFAR in Doppler domain
+ *
+ *  @retval Number of detected points (may exceed outListSize)
+ */
+uint32_t CFARHWA_emulateCFAR(const uint16_t *detMat,
+                             uint32_t numRangeBins,
+                             uint32_t numDopplerBins,
+                             DPU_CFARCAProc_CfarCfg *cfarCfg,
+                             DPU_CFARCAProcHWA_CfarDetOutput *outList,
+                             uint32_t outListSize,
+                             uint8_t cfarDomain)
+{
+    uint32_t    iterNum;
+    uint32_t    numDet = 0U;
+
+    if (cfarDomain == DPU_CFAR_RANGE_DOMAIN)
+    {
+        /* Iterate over Doppler bins, cells are range bins */
+        for (iterNum = 0U; iterNum < numDopplerBins; iterNum++)
+        {
+            numDet = CFARHWA_emulateCfarLine(&detMat[iterNum],
+                                             numDopplerBins,
+                                             (int32_t)numRangeBins,
+                                             cfarCfg,
+                                             iterNum,
+                                             outList,
+                                             outListSize,
+                                             numDet);
+        }
+    }
+    else
+    {
+        /* Iterate over range bins, cells are Doppler bins */
+        for (iterNum = 0U; iterNum < numRangeBins; iterNum++)
+        {
+            numDet = CFARHWA_emulateCfarLine(&detMat[iterNum * numDopplerBins],
+                                             1U,
+                                             (int32_t)numDopplerBins,
+                                             cfarCfg,
+                                             iterNum,
+                                             outList,
+                                             outListSize,
+                                             numDet);
+        }
+    }
+
+    return numDet;
+}
+
 /**
  *  @b Description
  *  @n
@@ -709,7 +984,11 @@ DPU_CFARCAProcHWA_Handle DPU_CFARCAProcHWA_init
     SemaphoreP_Params  semParams;
     *errCode = 0;
 
+#ifdef CFARCAPROCHWA_SW_EMULATION
+    if (initCfg == NULL)
+#else
     if ((initCfg == NULL) || (initCfg->hwaHandle == NULL))
+#endif
     {
         *errCode = DPU_CFARCAPROCHWA_EINVAL;
         goto exit;
@@ -846,6 +1125,7 @@ int32_t DPU_CFARCAProcHWA_config
 
    CFARHWA_saveConfiguration(cfarHwaObj, cfarHwaCfg);
 
+#ifndef CFARCAPROCHWA_SW_EMULATION
    if (cfarHwaObj->cfarCfgDoppler.thresholdScale > 0)
    {
        /**************************************/
@@ -891,6 +1171,7 @@ int32_t DPU_CFARCAProcHWA_config
    {
        goto exit;
    }
+#endif
 
 exit:
    return retVal;
@@ -927,7 +1208,39 @@ int32_t DPU_CFARCAProcHWA_process
 
     startTime = Cycleprofiler_getTimeStamp();
 
+    outParams->numDopplerCfarPeaks = 0U;
+    outParams->numRangeCfarPeaks = 0U;
 
+#ifdef CFARCAPROCHWA_SW_EMULATION
+    if (cfarHwaObj->cfarCfgDoppler.thresholdScale > 0)
+    {
+        memset (pRes->cfarDopplerDetOutBitMask, 0x0, pRes->cfarDopplerDetOutBitMaskSize * sizeof(uint32_t));
+
+        outParams->numDopplerCfarPeaks = CFARHWA_emulateCFAR(pRes->detMatrix.data,
+                                                             staticCfg->numRangeBins,
+                                                             staticCfg->numDopplerBins,
+                                                             &cfarHwaObj->cfarCfgDoppler,
+                                                             (DPU_CFARCAProcHWA_CfarDetOutput *) pRes->hwaMemOutDoppler,
+                                                             pRes->hwaMemOutDopplerSize,
+                                                             DPU_CFAR_DOPPLER_DOMAIN);
+        cfarHwaObj->numHwaCfarObjs = (uint16_t)MIN(outParams->numDopplerCfarPeaks, pRes->hwaMemOutDopplerSize);
+
+        CFARHWA_convHwaCfarDetListToDetMask((DPU_CFARCAProcHWA_CfarDetOutput * ) pRes->hwaMemOutDoppler,
+                                           staticCfg->numDopplerBins,
+                                           cfarHwaObj->numHwaCfarObjs,
+                                           DPU_CFAR_DOPPLER_DOMAIN,
+                                           pRes->cfarDopplerDetOutBitMask);
+    }
+
+    outParams->numRangeCfarPeaks = CFARHWA_emulateCFAR(pRes->detMatrix.data,
+                                                      staticCfg->numRangeBins,
+                                                      staticCfg->numDopplerBins,
+                                                      &cfarHwaObj->cfarCfgRange,
+                                                      (DPU_CFARCAProcHWA_CfarDetOutput *) pRes->hwaMemOutRange,
+                                                      pRes->hwaMemOutRangeSize,
+                                                      DPU_CFAR_RANGE_DOMAIN);
+    cfarHwaObj->numHwaCfarObjs = (uint16_t)MIN(outParams->numRangeCfarPeaks, pRes->hwaMemOutRangeSize);
+#else
     /**********************************************/
     /* ENABLE NUMLOOPS DONE INTERRUPT FROM HWA */
     /**********************************************/
@@ -964,6 +1277,7 @@ int32_t DPU_CFARCAProcHWA_process
         waitTimeLocal += Cycleprofiler_getTimeStamp() - startTime1;
 
         HWA_readCFARPeakCountReg(cfarHwaObj->hwaHandle, (uint8_t *) &cfarHwaObj->numHwaCfarObjs, sizeof(uint16_t));
+        outParams->numDopplerCfarPeaks = cfarHwaObj->numHwaCfarObjs;
         if (cfarHwaObj->numHwaCfarObjs > cfarHwaObj->res.hwaMemOutDopplerSize)
         {
             cfarHwaObj->numHwaCfarObjs = cfarHwaObj->res.hwaMemOutDopplerSize;
@@ -1012,10 +1326,12 @@ int32_t DPU_CFARCAProcHWA_process
     HWA_readCFARPeakCountReg(cfarHwaObj->hwaHandle,
                              (uint8_t *) &cfarHwaObj->numHwaCfarObjs,
                              sizeof(uint16_t));
+    outParams->numRangeCfarPeaks = cfarHwaObj->numHwaCfarObjs;
     if (cfarHwaObj->numHwaCfarObjs > cfarHwaObj->res.hwaMemOutRangeSize)
     {
         cfarHwaObj->numHwaCfarObjs = cfarHwaObj->res.hwaMemOutRangeSize;
     }
+#endif
 
     if (cfarHwaObj->cfarCfgDoppler.thresholdScale > 0)
     {
@@ -1043,6 +1359,7 @@ int32_t DPU_CFARCAProcHWA_process
     numObjs = cfarHwaObj->numHwaCfarObjs;
     cfarHwaObj->numProcess++;
 
+#ifndef CFARCAPROCHWA_SW_EMULATION
     /* Disable the HWA */
     retVal = HWA_enable(cfarHwaObj->hwaHandle, 0);
     if (retVal != 0)
@@ -1050,10 +1367,13 @@ int32_t DPU_CFARCAProcHWA_process
         numObjs = 0U;
         goto exit;
     }
+#endif
 
 
     outParams->numCfarDetectedPoints = numObjs;
+#ifndef CFARCAPROCHWA_SW_EMULATION
     HWA_disableDoneInterrupt(cfarHwaObj->hwaHandle);
+#endif
     outParams->stats.waitTime = waitTimeLocal;
     outParams->stats.processingTime = Cycleprofiler_getTimeStamp() - startTime - waitTimeLocal;
     outParams->stats.numProcess = cfarHwaObj->numProcess;
@@ -1096,6 +1416,7 @@ int32_t DPU_CFARCAProcHWA_control
                 /* Save configuration */
                 memcpy((void *)&cfarHwaObj->cfarCfgRange, arg, argSize);
 
+#ifndef CFARCAPROCHWA_SW_EMULATION
                 /**************************************/
                 /* CFAR RANGE DOMAIN                */
                 /**************************************/
@@ -1113,6 +1434,7 @@ int32_t DPU_CFARCAProcHWA_control
                 {
                   goto exit;
                 }
+#endif
             }
         }
         break;
@@ -1129,6 +1451,7 @@ int32_t DPU_CFARCAProcHWA_control
                 /* Save configuration */
                 memcpy((void *)&cfarHwaObj->cfarCfgDoppler, arg, argSize);
 
+#ifndef CFARCAPROCHWA_SW_EMULATION
                 /**************************************/
                 /* CFAR DOPPLER DOMAIN                */
                 /**************************************/
@@ -1146,6 +1469,7 @@ int32_t DPU_CFARCAProcHWA_control
                 {
                   goto exit;
                 }
+#endif
             }
         }
         break;
@@ -0,0 +1,1326 @@
+/**
+ *   @file  cfarprocdsp_test_main.c
+ *
+ *   @brief
+ *      Unit Test code for DSP CFARCA DPU.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+/* BIOS/XDC Include Files. */
+#include <xdc/std.h>
+#include <xdc/cfg/global.h>
+#include <xdc/runtime/IHeap.h>
+#include <xdc/runtime/System.h>
+#include <xdc/runtime/Error.h>
+#include <xdc/runtime/Memory.h>
+#include <ti/sysbios/BIOS.h>
+#include <ti/sysbios/knl/Task.h>
+#define DebugP_ASSERT_ENABLED 1
+#include <ti/drivers/osal/DebugP.h>
+#include <ti/common/sys_common.h>
+#include <ti/drivers/osal/MemoryP.h>
+#include <ti/drivers/edma/edma.h>
+#include <ti/drivers/soc/soc.h>
+#include <ti/utils/testlogger/logger.h>
+#include <ti/utils/cycleprofiler/cycle_profiler.h>
+#include <ti/alg/mmwavelib/mmwavelib.h>
+#include <ti/datapath/dpc/dpu/cfarcaproc/cfarcaprocdsp.h>
+#include <ti/utils/randomdatagenerator/gen_rand_data.h>
+
+
+/* EDMA resource partitioning */
+#define EDMA_SHADOW_LNK_PARAM_BASE_ID       EDMA_NUM_DMA_CHANNELS
+
+/* EDMA channels */
+#define TEST_EDMA_CFARPROC_IN_PING          EDMA_TPCC0_REQ_FREE_4
+#define TEST_EDMA_CFARPROC_IN_PONG          EDMA_TPCC0_REQ_FREE_5
+
+/*EDMA shadow channels*/
+#define TEST_EDMA_CFARPROC_IN_PING_SHADOW   (EDMA_SHADOW_LNK_PARAM_BASE_ID + 4U)
+#define TEST_EDMA_CFARPROC_IN_PONG_SHADOW   (EDMA_SHADOW_LNK_PARAM_BASE_ID + 5U)
+
+#define TEST_MAX_NUM_RANGE_BINS     256
+#define TEST_MAX_NUM_DOPPLER_BINS   64
+#define TEST_MAX_DETMATRIX_SIZE     (TEST_MAX_NUM_RANGE_BINS * TEST_MAX_NUM_DOPPLER_BINS)
+#define TEST_MAX_LINE_SIZE          (TEST_MAX_NUM_RANGE_BINS)
+
+/* Size of detection list, larger than the number of targets so that no detection is lost */
+#define TEST_MAX_NUM_DET            128
+
+/* Number of targets injected in the detection matrix */
+#define TEST_NUM_TARGETS            24
+
+/* Detection matrix noise floor and spread of the noise cells, spread is kept below
+   the smallest threshold so that only the injected targets can be detected */
+#define TEST_NOISE_FLOOR            2000
+#define TEST_NOISE_SPREAD           256
+
+/* Range and Doppler resolution used to convert the field of view and the profile */
+#define TEST_RANGE_STEP             0.044f
+#define TEST_DOPPLER_STEP           0.12f
+
+/* CFAR thresholds of the configuration, used outside of the threshold profile */
+#define TEST_THRESHOLD_RANGE        900
+#define TEST_THRESHOLD_DOPPLER      900
+
+/* Threshold profile: near segment detects weaker targets, middle segment suppresses all
+   targets, far segment is less sensitive than the flat configuration */
+#define TEST_THRESHOLD_NEAR         400
+#define TEST_THRESHOLD_SUPPRESS     6000
+#define TEST_THRESHOLD_FAR          1500
+
+#define TEST_RANGE_BIN_ARRAY_SIZE   3
+#define TEST_DOPP_BIN_ARRAY_SIZE    3
+#define TEST_AVG_MODE_ARRAY_SIZE    3
+
+/* Peak grouping directions of the grouping scheme comparison: both, range only, Doppler only */
+#define TEST_GROUPING_ARRAY_SIZE    3
+
+/* Number of range tiles of the tiled run */
+#define TEST_NUM_RANGE_TILES        3
+
+/* Noise floor map run: frames of the run, frame at which the noise floor of the scene
+   steps up and the size of the step. The step is kept below the Doppler threshold so that
+   the lagging map does not detect noise cells. */
+#define TEST_NOISE_MAP_NUM_FRAMES       48
+#define TEST_NOISE_MAP_STEP_FRAME       4
+#define TEST_NOISE_MAP_STEP             400
+#define TEST_NOISE_MAP_LOG2_REGIONS     2
+#define TEST_NOISE_MAP_ALPHA_SHIFT      1
+#define TEST_NOISE_MAP_REFRESH_PERIOD   4
+#define TEST_NOISE_MAP_SIZE             (TEST_MAX_NUM_RANGE_BINS << TEST_NOISE_MAP_LOG2_REGIONS)
+
+/* Detection matrix, range major: [numRangeBins][numDopplerBins] */
+#pragma DATA_SECTION(testDetMatrix, ".l3ram");
+#pragma DATA_ALIGN(testDetMatrix, 8);
+uint16_t testDetMatrix[TEST_MAX_DETMATRIX_SIZE];
+
+/* Reference Doppler domain detection flags, same layout as detection matrix */
+#pragma DATA_SECTION(refDopplerDetFlag, ".l3ram");
+uint8_t refDopplerDetFlag[TEST_MAX_DETMATRIX_SIZE];
+
+#pragma DATA_SECTION(cfarDetList, ".l2data");
+#pragma DATA_ALIGN(cfarDetList, 8);
+DPIF_CFARDetList cfarDetList[TEST_MAX_NUM_DET];
+
+#pragma DATA_SECTION(refDetList, ".l2data");
+#pragma DATA_ALIGN(refDetList, 8);
+DPIF_CFARDetList refDetList[TEST_MAX_NUM_DET];
+
+#pragma DATA_SECTION(tileDetListBuf, ".l2data");
+#pragma DATA_ALIGN(tileDetListBuf, 8);
+DPIF_CFARDetList tileDetListBuf[TEST_NUM_RANGE_TILES][TEST_MAX_NUM_DET];
+
+#pragma DATA_SECTION(cfarDopplerDetOutBitMask, ".l2data");
+#pragma DATA_ALIGN(cfarDopplerDetOutBitMask, 8);
+uint32_t cfarDopplerDetOutBitMask[TEST_MAX_DETMATRIX_SIZE / 32];
+
+#pragma DATA_SECTION(localDetMatrixBuffer, ".l1data");
+#pragma DATA_ALIGN(localDetMatrixBuffer, 8);
+uint16_t localDetMatrixBuffer[TEST_MAX_LINE_SIZE * 2];
+
+#pragma DATA_SECTION(cfarDetOutBuffer, ".l2data");
+#pragma DATA_ALIGN(cfarDetOutBuffer, 8);
+uint16_t cfarDetOutBuffer[TEST_MAX_LINE_SIZE * 2];
+
+#pragma DATA_SECTION(cfarScratchBuffer, ".l2data");
+#pragma DATA_ALIGN(cfarScratchBuffer, 8);
+uint16_t cfarScratchBuffer[TEST_MAX_NUM_DET * 4];
+
+#pragma DATA_SECTION(cfarLocalMaxLineBuffer, ".l2data");
+#pragma DATA_ALIGN(cfarLocalMaxLineBuffer, 8);
+uint16_t cfarLocalMaxLineBuffer[TEST_MAX_NUM_RANGE_BINS * 4 + 4];
+
+#pragma DATA_SECTION(cfarLocalMaxMask, ".l1data");
+#pragma DATA_ALIGN(cfarLocalMaxMask, 8);
+uint32_t cfarLocalMaxMask[(TEST_MAX_NUM_RANGE_BINS + 31) / 32];
+
+#pragma DATA_SECTION(cfarThresholdLut, ".l2data");
+#pragma DATA_ALIGN(cfarThresholdLut, 8);
+uint16_t cfarThresholdLut[TEST_MAX_NUM_RANGE_BINS * 2];
+
+#pragma DATA_SECTION(cfarNoiseMap, ".l2data");
+#pragma DATA_ALIGN(cfarNoiseMap, 8);
+uint16_t cfarNoiseMap[TEST_NOISE_MAP_SIZE];
+
+/* Reference per range bin thresholds */
+uint16_t refThrRange[TEST_MAX_NUM_RANGE_BINS];
+uint16_t refThrDoppler[TEST_MAX_NUM_RANGE_BINS];
+
+/* Reference noise floor map and region averages of the current frame */
+uint16_t refNoiseMap[TEST_NOISE_MAP_SIZE];
+uint16_t refNoiseRegionAvg[TEST_NOISE_MAP_SIZE];
+
+typedef struct cfarProcDpuTestConfig {
+
+    uint32_t numRangeBins;
+    uint32_t numDopplerBins;
+    uint8_t  averageMode;       /* range domain CFAR averaging mode */
+}cfarProcDpuTestConfig_t;
+
+SOC_Handle  socHandle;
+EDMA_Handle edmaHandle;
+
+/* test configuration */
+DPU_CFARCAProcDSP_Config    cfarProcDpuCfg;
+DPU_CFARCAProcDSP_Handle    cfarProcDpuHandle;
+DPU_CFARCAProcDSP_OutParams outParams;
+
+DPU_CFARCAProc_CfarCfg      cfarCfgRange;
+DPU_CFARCAProc_CfarCfg      cfarCfgDoppler;
+DPU_CFARCAProc_FovCfg       fovRange;
+DPU_CFARCAProc_FovCfg       fovDoppler;
+DPU_CFARCAProc_RangeThresholdProfileCfg thresholdProfile;
+
+MCPI_LOGBUF_INIT(9216);
+
+uint8_t finalResults;
+
+
+void MmwDemo_EDMA_errorCallbackFxn(EDMA_Handle handle, EDMA_errorInfo_t *errorInfo)
+{
+    DebugP_assert(0);
+}
+
+void MmwDemo_EDMA_transferControllerErrorCallbackFxn(EDMA_Handle handle,
+    EDMA_transferControllerErrorInfo_t *errorInfo)
+{
+    DebugP_assert(0);
+}
+
+void cfarProc_test_edmainit()
+{
+    uint8_t             edmaNumInstances;
+    uint8_t             inst;
+    EDMA_instanceInfo_t edmaInstanceInfo;
+    EDMA_errorConfig_t  errorConfig;
+    int32_t             errorCode;
+
+    /* Initialize the EDMA */
+    edmaNumInstances = EDMA_getNumInstances();
+    for (inst = 0; inst < edmaNumInstances; inst++)
+    {
+        errorCode = EDMA_init(inst);
+        if (errorCode != EDMA_NO_ERROR)
+        {
+            System_printf("Debug: EDMA instance %d initialization returned error %d\n", inst, errorCode);
+            DebugP_assert(0);
+            return;
+        }
+    }
+
+    edmaHandle = EDMA_open(0, &errorCode, &edmaInstanceInfo);
+    if (edmaHandle == NULL)
+    {
+        System_printf("Error: Unable to open the EDMA Instance err:%d\n", errorCode);
+        DebugP_assert(0);
+        return;
+    }
+
+    errorConfig.isConfigAllEventQueues = true;
+    errorConfig.isConfigAllTransferControllers = true;
+    errorConfig.isEventQueueThresholdingEnabled = true;
+    errorConfig.eventQueueThreshold = EDMA_EVENT_QUEUE_THRESHOLD_MAX;
+    errorConfig.isEnableAllTransferControllerErrors = true;
+    errorConfig.callbackFxn = MmwDemo_EDMA_errorCallbackFxn;
+    errorConfig.transferControllerCallbackFxn = MmwDemo_EDMA_transferControllerErrorCallbackFxn;
+    if ((errorCode = EDMA_configErrorMonitoring(edmaHandle, &errorConfig)) != EDMA_NO_ERROR)
+    {
+        System_printf("Error: EDMA_configErrorMonitoring() failed with errorCode = %d\n", errorCode);
+        DebugP_assert(0);
+        return;
+    }
+}
+
+void cfarProc_test_dpuInit()
+{
+    int32_t errorCode;
+
+    cfarProcDpuHandle = DPU_CFARCAProcDSP_init(&errorCode);
+    if (cfarProcDpuHandle == NULL)
+    {
+        System_printf("CFAR DPU failed to initialize. Error %d.\n", errorCode);
+        DebugP_assert(0);
+        return;
+    }
+    System_printf("CFAR DPU handle 0x%x.\n", (unsigned int)cfarProcDpuHandle);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Fills the DPU configuration for a test case. Range and Doppler CFAR are both
+ *      enabled, peak grouping is disabled so that every detection of the reference
+ *      is reported, and the field of view covers the whole detection matrix.
+ */
+void Test_setProfile(cfarProcDpuTestConfig_t *testConfig)
+{
+    DPU_CFARCAProcDSP_HW_Resources *hwRes = &cfarProcDpuCfg.res;
+    uint32_t log2NumDopplerBins = 0;
+
+    while ((1U << log2NumDopplerBins) < testConfig->numDopplerBins)
+    {
+        log2NumDopplerBins++;
+    }
+
+    memset((void *)&cfarProcDpuCfg, 0, sizeof(DPU_CFARCAProcDSP_Config));
+
+    /* Static configuration */
+    cfarProcDpuCfg.staticCfg.log2NumDopplerBins = log2NumDopplerBins;
+    cfarProcDpuCfg.staticCfg.numRangeBins = testConfig->numRangeBins;
+    cfarProcDpuCfg.staticCfg.numDopplerBins = testConfig->numDopplerBins;
+    cfarProcDpuCfg.staticCfg.rangeStep = TEST_RANGE_STEP;
+    cfarProcDpuCfg.staticCfg.dopplerStep = TEST_DOPPLER_STEP;
+
+    /* Range domain CFAR, noiseDivShift is given for one side of the window */
+    memset((void *)&cfarCfgRange, 0, sizeof(DPU_CFARCAProc_CfarCfg));
+    cfarCfgRange.thresholdScale = TEST_THRESHOLD_RANGE;
+    cfarCfgRange.averageMode = testConfig->averageMode;
+    cfarCfgRange.winLen = 8;
+    cfarCfgRange.guardLen = 2;
+    cfarCfgRange.noiseDivShift = (testConfig->averageMode == CFAR_CA) ? 4 : 3;
+    cfarCfgRange.cyclicMode = 0;
+    cfarCfgRange.peakGroupingScheme = DPU_CFAR_PEAK_GROUPING_DET_MATRIX_BASED;
+    cfarCfgRange.peakGroupingEn = 0;
+
+    /* Doppler domain CFAR, cyclic cell averaging */
+    memset((void *)&cfarCfgDoppler, 0, sizeof(DPU_CFARCAProc_CfarCfg));
+    cfarCfgDoppler.thresholdScale = TEST_THRESHOLD_DOPPLER;
+    cfarCfgDoppler.averageMode = CFAR_CA;
+    cfarCfgDoppler.winLen = 4;
+    cfarCfgDoppler.guardLen = 1;
+    cfarCfgDoppler.noiseDivShift = 3;
+    cfarCfgDoppler.cyclicMode = 1;
+    cfarCfgDoppler.peakGroupingScheme = DPU_CFAR_PEAK_GROUPING_DET_MATRIX_BASED;
+    cfarCfgDoppler.peakGroupingEn = 0;
+
+    fovRange.min = 0.f;
+    fovRange.max = (float)testConfig->numRangeBins * TEST_RANGE_STEP;
+    fovDoppler.min = -(float)(testConfig->numDopplerBins / 2) * TEST_DOPPLER_STEP;
+    fovDoppler.max = (float)(testConfig->numDopplerBins / 2) * TEST_DOPPLER_STEP;
+
+    cfarProcDpuCfg.dynCfg.cfarCfgRange = &cfarCfgRange;
+    cfarProcDpuCfg.dynCfg.cfarCfgDoppler = &cfarCfgDoppler;
+    cfarProcDpuCfg.dynCfg.fovRange = &fovRange;
+    cfarProcDpuCfg.dynCfg.fovDoppler = &fovDoppler;
+
+    /* Threshold profile is not given at configuration, it is set by control command */
+    cfarProcDpuCfg.dynCfg.rangeThresholdProfile = NULL;
+
+    /* Hardware resources */
+    hwRes->edmaHandle = edmaHandle;
+    hwRes->edmaInPing.channel = TEST_EDMA_CFARPROC_IN_PING;
+    hwRes->edmaInPing.channelShadow = TEST_EDMA_CFARPROC_IN_PING_SHADOW;
+    hwRes->edmaInPing.eventQueue = 0;
+    hwRes->edmaInPong.channel = TEST_EDMA_CFARPROC_IN_PONG;
+    hwRes->edmaInPong.channelShadow = TEST_EDMA_CFARPROC_IN_PONG_SHADOW;
+    hwRes->edmaInPong.eventQueue = 0;
+
+    hwRes->detMatrix.datafmt = DPIF_DETMATRIX_FORMAT_1;
+    hwRes->detMatrix.data = (void *)testDetMatrix;
+    hwRes->detMatrix.dataSize = testConfig->numRangeBins * testConfig->numDopplerBins * sizeof(uint16_t);
+
+    hwRes->cfarRngDopSnrList = cfarDetList;
+    hwRes->cfarRngDopSnrListSize = TEST_MAX_NUM_DET;
+
+    hwRes->cfarDopplerDetOutBitMask = cfarDopplerDetOutBitMask;
+    hwRes->cfarDopplerDetOutBitMaskSize = (testConfig->numRangeBins * testConfig->numDopplerBins) / 32;
+
+    hwRes->localDetMatrixBuffer = localDetMatrixBuffer;
+    hwRes->localDetMatrixBufferSize = sizeof(localDetMatrixBuffer);
+
+    hwRes->cfarDetOutBuffer = cfarDetOutBuffer;
+    hwRes->cfarDetOutBufferSize = sizeof(cfarDetOutBuffer);
+
+    hwRes->cfarScrachBuffer = cfarScratchBuffer;
+    hwRes->cfarScrachBufferSize = sizeof(cfarScratchBuffer);
+
+    hwRes->cfarThresholdLut = cfarThresholdLut;
+    hwRes->cfarThresholdLutSize = sizeof(cfarThresholdLut);
+
+    /* Local maximum buffers, used once the fused peak grouping scheme is selected */
+    hwRes->cfarLocalMaxLineBuffer = cfarLocalMaxLineBuffer;
+    hwRes->cfarLocalMaxLineBufferSize = sizeof(cfarLocalMaxLineBuffer);
+    hwRes->cfarLocalMaxMask = cfarLocalMaxMask;
+    hwRes->cfarLocalMaxMaskSize = sizeof(cfarLocalMaxMask) / sizeof(uint32_t);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Sets a threshold profile of three segments covering the first three quarters
+ *      of the range bins, the last quarter keeps the thresholds of the CFAR configuration.
+ *      Segment ends fall between range bins to exercise the conversion to range bins.
+ */
+void Test_setThresholdProfile(cfarProcDpuTestConfig_t *testConfig)
+{
+    float quarter = (float)(testConfig->numRangeBins / 4) * TEST_RANGE_STEP;
+
+    memset((void *)&thresholdProfile, 0, sizeof(DPU_CFARCAProc_RangeThresholdProfileCfg));
+    thresholdProfile.enabled = 1;
+    thresholdProfile.numSegments = 3;
+
+    thresholdProfile.segment[0].rangeMax = quarter - 0.3f * TEST_RANGE_STEP;
+    thresholdProfile.segment[0].thresholdScaleRange = TEST_THRESHOLD_NEAR;
+    thresholdProfile.segment[0].thresholdScaleDoppler = TEST_THRESHOLD_NEAR;
+
+    thresholdProfile.segment[1].rangeMax = 2.f * quarter + 0.3f * TEST_RANGE_STEP;
+    thresholdProfile.segment[1].thresholdScaleRange = TEST_THRESHOLD_SUPPRESS;
+    thresholdProfile.segment[1].thresholdScaleDoppler = TEST_THRESHOLD_SUPPRESS;
+
+    thresholdProfile.segment[2].rangeMax = 3.f * quarter;
+    thresholdProfile.segment[2].thresholdScaleRange = TEST_THRESHOLD_FAR;
+    thresholdProfile.segment[2].thresholdScaleDoppler = TEST_THRESHOLD_FAR;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Expands the threshold profile into the reference per range bin thresholds.
+ *      Segment i covers the range bins up to and including round(rangeMax / rangeStep)
+ *      not covered by the previous segments.
+ */
+void Test_genThresholdRef(cfarProcDpuTestConfig_t *testConfig, DPU_CFARCAProc_RangeThresholdProfileCfg *profile)
+{
+    uint32_t rangeIdx = 0;
+    uint32_t segIdx;
+    uint32_t segEndIdx;
+
+    if ((profile != NULL) && (profile->enabled))
+    {
+        for (segIdx = 0; segIdx < profile->numSegments; segIdx++)
+        {
+            segEndIdx = (uint32_t)(profile->segment[segIdx].rangeMax / TEST_RANGE_STEP + 0.5) + 1U;
+            if (segEndIdx > testConfig->numRangeBins)
+            {
+                segEndIdx = testConfig->numRangeBins;
+            }
+
+            for ( ; rangeIdx < segEndIdx; rangeIdx++)
+            {
+                refThrRange[rangeIdx] = profile->segment[segIdx].thresholdScaleRange;
+                refThrDoppler[rangeIdx] = profile->segment[segIdx].thresholdScaleDoppler;
+            }
+        }
+    }
+
+    for ( ; rangeIdx < testConfig->numRangeBins; rangeIdx++)
+    {
+        refThrRange[rangeIdx] = cfarCfgRange.thresholdScale;
+        refThrDoppler[rangeIdx] = cfarCfgDoppler.thresholdScale;
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Generates the detection matrix: a noise floor with random spread and single cell
+ *      targets spread over the whole range, each range interval holding one target.
+ *      Target amplitudes above the noise floor cycle through values below, between and
+ *      above the thresholds used by the test.
+ */
+void Test_genDetMatrix(cfarProcDpuTestConfig_t *testConfig)
+{
+    uint32_t numRangeBins = testConfig->numRangeBins;
+    uint32_t numDopplerBins = testConfig->numDopplerBins;
+    uint32_t rangeInterval = numRangeBins / TEST_NUM_TARGETS;
+    uint32_t idx, targetIdx;
+    uint32_t rangeIdx, dopplerIdx;
+    const uint16_t targetAmplitude[4] = {700, 1200, 2500, 5000};
+
+    for (idx = 0; idx < numRangeBins * numDopplerBins; idx++)
+    {
+        testDetMatrix[idx] = TEST_NOISE_FLOOR + (uint16_t)(RandSimple() % TEST_NOISE_SPREAD);
+    }
+
+    if (rangeInterval == 0)
+    {
+        rangeInterval = 1;
+    }
+
+    for (targetIdx = 0; (targetIdx < TEST_NUM_TARGETS) && (targetIdx * rangeInterval < numRangeBins); targetIdx++)
+    {
+        rangeIdx = targetIdx * rangeInterval + (uint32_t)(RandSimple() % rangeInterval);
+        dopplerIdx = (uint32_t)(RandSimple() % numDopplerBins);
+        testDetMatrix[rangeIdx * numDopplerBins + dopplerIdx] = TEST_NOISE_FLOOR + targetAmplitude[targetIdx % 4];
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Reference noise estimate of Doppler domain CFAR: cell averaging over both windows,
+ *      wrapping around the Doppler line.
+ */
+uint32_t Test_dopplerNoiseRef(cfarProcDpuTestConfig_t *testConfig, uint32_t rangeIdx, uint32_t dopplerIdx)
+{
+    uint32_t numDopplerBins = testConfig->numDopplerBins;
+    uint16_t *line = &testDetMatrix[rangeIdx * numDopplerBins];
+    uint32_t sum = 0;
+    uint32_t k;
+
+    for (k = 1; k <= cfarCfgDoppler.winLen; k++)
+    {
+        sum += line[(dopplerIdx + numDopplerBins - cfarCfgDoppler.guardLen - k) & (numDopplerBins - 1)];
+        sum += line[(dopplerIdx + cfarCfgDoppler.guardLen + k) & (numDopplerBins - 1)];
+    }
+    return (sum >> cfarCfgDoppler.noiseDivShift);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Reference noise estimate of range domain CFAR. Cells closer than guardLen + winLen
+ *      to either end of the range line use the one sided window on the other side, the
+ *      other cells combine both windows according to the averaging mode.
+ */
+uint32_t Test_rangeNoiseRef(cfarProcDpuTestConfig_t *testConfig, uint32_t rangeIdx, uint32_t dopplerIdx)
+{
+    uint32_t numDopplerBins = testConfig->numDopplerBins;
+    uint32_t guardLen = cfarCfgRange.guardLen;
+    uint32_t winLen = cfarCfgRange.winLen;
+    uint32_t haloLen = guardLen + winLen;
+    /* noiseDivShift of both windows */
+    uint32_t shift = cfarCfgRange.noiseDivShift + ((cfarCfgRange.averageMode != CFAR_CA) ? 1 : 0);
+    uint32_t sumLeft = 0;
+    uint32_t sumRight = 0;
+    uint32_t noise;
+    uint32_t k;
+
+    if (rangeIdx >= haloLen)
+    {
+        for (k = 1; k <= winLen; k++)
+        {
+            sumLeft += testDetMatrix[(rangeIdx - guardLen - k) * numDopplerBins + dopplerIdx];
+        }
+    }
+    if (rangeIdx + haloLen < testConfig->numRangeBins)
+    {
+        for (k = 1; k <= winLen; k++)
+        {
+            sumRight += testDetMatrix[(rangeIdx + guardLen + k) * numDopplerBins + dopplerIdx];
+        }
+    }
+
+    if (rangeIdx < haloLen)
+    {
+        noise = sumRight >> (shift - 1);
+    }
+    else if (rangeIdx + haloLen >= testConfig->numRangeBins)
+    {
+        noise = sumLeft >> (shift - 1);
+    }
+    else if (cfarCfgRange.averageMode == CFAR_CASO)
+    {
+        noise = ((sumLeft < sumRight) ? sumLeft : sumRight) >> (shift - 1);
+    }
+    else if (cfarCfgRange.averageMode == CFAR_CAGO)
+    {
+        noise = ((sumLeft > sumRight) ? sumLeft : sumRight) >> (shift - 1);
+    }
+    else
+    {
+        noise = (sumLeft + sumRight) >> shift;
+    }
+    return noise;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Reference CFAR: a cell is detected if it is above both its Doppler domain and
+ *      range domain noise estimate by the threshold of its range bin. The list is
+ *      generated in the order of the DPU output with range domain CFAR enabled:
+ *      Doppler line by Doppler line, range bins in increasing order.
+ *
+ *  @retval
+ *      Number of detections in the reference list
+ */
+uint32_t Test_cfarRef(cfarProcDpuTestConfig_t *testConfig)
+{
+    uint32_t numRangeBins = testConfig->numRangeBins;
+    uint32_t numDopplerBins = testConfig->numDopplerBins;
+    uint32_t rangeIdx, dopplerIdx;
+    uint32_t noise;
+    uint32_t numDet = 0;
+    uint16_t cellValue;
+
+    for (rangeIdx = 0; rangeIdx < numRangeBins; rangeIdx++)
+    {
+        for (dopplerIdx = 0; dopplerIdx < numDopplerBins; dopplerIdx++)
+        {
+            cellValue = testDetMatrix[rangeIdx * numDopplerBins + dopplerIdx];
+            noise = Test_dopplerNoiseRef(testConfig, rangeIdx, dopplerIdx);
+            refDopplerDetFlag[rangeIdx * numDopplerBins + dopplerIdx] =
+                ((uint32_t)cellValue > noise + refThrDoppler[rangeIdx]) ? 1 : 0;
+        }
+    }
+
+    for (dopplerIdx = 0; dopplerIdx < numDopplerBins; dopplerIdx++)
+    {
+        for (rangeIdx = 0; rangeIdx < numRangeBins; rangeIdx++)
+        {
+            float noisedB, snrdB;
+
+            if (refDopplerDetFlag[rangeIdx * numDopplerBins + dopplerIdx] == 0)
+            {
+                continue;
+            }
+
+            cellValue = testDetMatrix[rangeIdx * numDopplerBins + dopplerIdx];
+            noise = Test_rangeNoiseRef(testConfig, rangeIdx, dopplerIdx);
+            if ((uint32_t)cellValue <= noise + refThrRange[rangeIdx])
+            {
+                continue;
+            }
+
+            if (numDet < TEST_MAX_NUM_DET)
+            {
+                noisedB = CFARCADSP_CONV_PEAK_TO_LOG((float)noise, DPIF_DETMATRIX_DATA_QFORMAT);
+                snrdB = CFARCADSP_CONV_PEAK_TO_LOG((float)cellValue, DPIF_DETMATRIX_DATA_QFORMAT) - noisedB;
+                refDetList[numDet].rangeIdx = rangeIdx;
+                refDetList[numDet].dopplerIdx = dopplerIdx;
+                refDetList[numDet].snr = (int16_t)snrdB;
+                refDetList[numDet].noise = (int16_t)noisedB;
+            }
+            numDet++;
+        }
+    }
+    return numDet;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Compares the DPU detection list with the reference list.
+ *
+ *  @retval
+ *      1 if both lists are identical, 0 otherwise
+ */
+uint8_t Test_compareDetList(DPIF_CFARDetList *detList, uint32_t numDet, uint32_t numRefDet)
+{
+    uint32_t idx;
+
+    if (numDet != numRefDet)
+    {
+        System_printf("  number of detections %d, expected %d\n", numDet, numRefDet);
+        return 0;
+    }
+
+    for (idx = 0; idx < numDet; idx++)
+    {
+        if ((detList[idx].rangeIdx != refDetList[idx].rangeIdx) ||
+            (detList[idx].dopplerIdx != refDetList[idx].dopplerIdx) ||
+            (detList[idx].snr != refDetList[idx].snr) ||
+            (detList[idx].noise != refDetList[idx].noise))
+        {
+            System_printf("  detection %d: (%d, %d) snr %d noise %d, expected (%d, %d) snr %d noise %d\n",
+                          idx, detList[idx].rangeIdx, detList[idx].dopplerIdx,
+                          detList[idx].snr, detList[idx].noise,
+                          refDetList[idx].rangeIdx, refDetList[idx].dopplerIdx,
+                          refDetList[idx].snr, refDetList[idx].noise);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Counts the detections of the list falling in range bins whose range threshold
+ *      of the reference is thr.
+ */
+uint32_t Test_countDetAtThreshold(DPIF_CFARDetList *detList, uint32_t numDet, uint16_t thr)
+{
+    uint32_t idx;
+    uint32_t count = 0;
+
+    for (idx = 0; idx < numDet; idx++)
+    {
+        if (refThrRange[detList[idx].rangeIdx] == thr)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Adds to each detectable target of the detection matrix weaker neighbors in
+ *      range and Doppler, and for every other target a range neighbor of the same
+ *      amplitude, so that peak grouping has detections to drop and ties to resolve.
+ *      Neighbors fall in the guard cells of the target.
+ */
+void Test_addTargetNeighbors(cfarProcDpuTestConfig_t *testConfig)
+{
+    uint32_t numRangeBins = testConfig->numRangeBins;
+    uint32_t numDopplerBins = testConfig->numDopplerBins;
+    uint32_t rangeIdx, dopplerIdx;
+    uint32_t numTargets = 0;
+    uint16_t cellValue;
+
+    for (rangeIdx = 0; rangeIdx < numRangeBins - 1; rangeIdx++)
+    {
+        for (dopplerIdx = 0; dopplerIdx < numDopplerBins; dopplerIdx++)
+        {
+            cellValue = testDetMatrix[rangeIdx * numDopplerBins + dopplerIdx];
+
+            /* Targets above the thresholds only, neighbors added before are below this */
+            if (cellValue < TEST_NOISE_FLOOR + 2000)
+            {
+                continue;
+            }
+
+            testDetMatrix[rangeIdx * numDopplerBins + ((dopplerIdx + 1) & (numDopplerBins - 1))] = cellValue - 300;
+            if (numTargets & 1)
+            {
+                testDetMatrix[(rangeIdx + 1) * numDopplerBins + dopplerIdx] = cellValue;
+            }
+            else
+            {
+                testDetMatrix[(rangeIdx + 1) * numDopplerBins + dopplerIdx] = cellValue - 300;
+            }
+            numTargets++;
+
+            /* Skip the range neighbor just written */
+            rangeIdx++;
+            break;
+        }
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Runs the DPU with peak grouping enabled in the given directions with the
+ *      detection matrix based scheme, then with the fused local maximum scheme, and
+ *      compares both detection lists. Grouping must drop detections of the list
+ *      without grouping.
+ *
+ *  @retval
+ *      1 if both schemes give the same list, 0 otherwise
+ */
+uint8_t Test_compareGroupingSchemes(uint8_t rangeGrpEn, uint8_t dopplerGrpEn, uint32_t numDetNoGrouping)
+{
+    const uint8_t scheme[2] = {DPU_CFAR_PEAK_GROUPING_DET_MATRIX_BASED, DPU_CFAR_PEAK_GROUPING_LOCAL_MAX_FUSED};
+    uint32_t numDet[2];
+    uint32_t schemeIdx;
+    int32_t  retVal;
+
+    for (schemeIdx = 0; schemeIdx < 2; schemeIdx++)
+    {
+        cfarCfgRange.peakGroupingEn = rangeGrpEn;
+        cfarCfgRange.peakGroupingScheme = scheme[schemeIdx];
+        cfarCfgDoppler.peakGroupingEn = dopplerGrpEn;
+        cfarCfgDoppler.peakGroupingScheme = scheme[schemeIdx];
+
+        retVal = DPU_CFARCAProcDSP_control(cfarProcDpuHandle, DPU_CFARCAProcDSP_Cmd_CfarRangeCfg,
+                                           (void *)&cfarCfgRange, sizeof(DPU_CFARCAProc_CfarCfg));
+        if (retVal == 0)
+        {
+            retVal = DPU_CFARCAProcDSP_control(cfarProcDpuHandle, DPU_CFARCAProcDSP_Cmd_CfarDopplerCfg,
+                                               (void *)&cfarCfgDoppler, sizeof(DPU_CFARCAProc_CfarCfg));
+        }
+        if (retVal == 0)
+        {
+            retVal = DPU_CFARCAProcDSP_process(cfarProcDpuHandle, &outParams);
+        }
+        if (retVal != 0)
+        {
+            System_printf("  grouping scheme %d: failed, error %d\n", scheme[schemeIdx], retVal);
+            return 0;
+        }
+
+        numDet[schemeIdx] = outParams.numCfarDetectedPoints;
+        System_printf("  grouping scheme %d (range %d, Doppler %d): %d detections, %d cycles\n",
+                      scheme[schemeIdx], rangeGrpEn, dopplerGrpEn, numDet[schemeIdx],
+                      outParams.stats.processingTime + outParams.stats.waitTime);
+
+        if (schemeIdx == 0)
+        {
+            memcpy((void *)refDetList, (void *)cfarDetList, numDet[0] * sizeof(DPIF_CFARDetList));
+        }
+    }
+
+    if (numDet[0] >= numDetNoGrouping)
+    {
+        System_printf("  grouping dropped no detection\n");
+        return 0;
+    }
+
+    if (Test_compareDetList(cfarDetList, numDet[1], numDet[0]) == 0)
+    {
+        System_printf("  fused local maximum grouping differs from detection matrix based grouping\n");
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Runs the DPU with detection matrix based peak grouping over all range bins, then
+ *      once per range tile, and compares the merged tile lists with the untiled list.
+ *      Tiles have different sizes and each tile edge has a target whose weaker neighbor
+ *      lies in the other tile. Checks that CFAR peak based grouping is rejected with tiles.
+ *
+ *  @retval
+ *      1 if the merged list equals the untiled list, 0 otherwise
+ */
+uint8_t Test_compareRangeTiles(cfarProcDpuTestConfig_t *testConfig)
+{
+    DPU_CFARCAProcDSP_HW_Resources *hwRes = &cfarProcDpuCfg.res;
+    DPIF_CFARDetList *tileDetList[TEST_NUM_RANGE_TILES];
+    uint32_t numTileDet[TEST_NUM_RANGE_TILES];
+    uint32_t tileStartIdx[TEST_NUM_RANGE_TILES + 1];
+    uint32_t numDopplerBins = testConfig->numDopplerBins;
+    uint32_t numRefDet;
+    uint32_t tileIdx, edgeIdx;
+    int32_t  retVal;
+    uint8_t  result = 1;
+
+    tileStartIdx[0] = 0;
+    tileStartIdx[1] = testConfig->numRangeBins / 4 + 2;
+    tileStartIdx[2] = testConfig->numRangeBins / 2;
+    tileStartIdx[3] = testConfig->numRangeBins;
+
+    /* Target and weaker neighbor across each tile edge, stronger side alternates */
+    for (edgeIdx = 1; edgeIdx < TEST_NUM_RANGE_TILES; edgeIdx++)
+    {
+        testDetMatrix[(tileStartIdx[edgeIdx] - 1) * numDopplerBins + edgeIdx] =
+            TEST_NOISE_FLOOR + ((edgeIdx & 1) ? 5000 : 4700);
+        testDetMatrix[tileStartIdx[edgeIdx] * numDopplerBins + edgeIdx] =
+            TEST_NOISE_FLOOR + ((edgeIdx & 1) ? 4700 : 5000);
+    }
+
+    cfarCfgRange.peakGroupingEn = 1;
+    cfarCfgRange.peakGroupingScheme = DPU_CFAR_PEAK_GROUPING_DET_MATRIX_BASED;
+    cfarCfgDoppler.peakGroupingEn = 1;
+    cfarCfgDoppler.peakGroupingScheme = DPU_CFAR_PEAK_GROUPING_DET_MATRIX_BASED;
+
+    /* Untiled reference */
+    retVal = DPU_CFARCAProcDSP_config(cfarProcDpuHandle, &cfarProcDpuCfg);
+    if (retVal == 0)
+    {
+        retVal = DPU_CFARCAProcDSP_process(cfarProcDpuHandle, &outParams);
+    }
+    if (retVal != 0)
+    {
+        System_printf("  untiled run failed, error %d\n", retVal);
+        return 0;
+    }
+    numRefDet = outParams.numCfarDetectedPoints;
+    memcpy((void *)refDetList, (void *)cfarDetList, numRefDet * sizeof(DPIF_CFARDetList));
+
+    for (tileIdx = 0; tileIdx < TEST_NUM_RANGE_TILES; tileIdx++)
+    {
+        cfarProcDpuCfg.staticCfg.rangeTileStartIdx = tileStartIdx[tileIdx];
+        cfarProcDpuCfg.staticCfg.numRangeTileBins = tileStartIdx[tileIdx + 1] - tileStartIdx[tileIdx];
+        hwRes->cfarRngDopSnrList = tileDetListBuf[tileIdx];
+        tileDetList[tileIdx] = tileDetListBuf[tileIdx];
+        numTileDet[tileIdx] = 0;
+
+        retVal = DPU_CFARCAProcDSP_config(cfarProcDpuHandle, &cfarProcDpuCfg);
+        if (retVal == 0)
+        {
+            retVal = DPU_CFARCAProcDSP_process(cfarProcDpuHandle, &outParams);
+        }
+        if (retVal != 0)
+        {
+            System_printf("  tile %d run failed, error %d\n", tileIdx, retVal);
+            result = 0;
+            break;
+        }
+        numTileDet[tileIdx] = outParams.numCfarDetectedPoints;
+    }
+
+    if (result)
+    {
+        retVal = DPU_CFARCAProcDSP_mergeTileDetList(cfarDetList, TEST_MAX_NUM_DET, tileDetList,
+                                                    numTileDet, TEST_NUM_RANGE_TILES, true);
+        System_printf("  range tiles: %d + %d + %d detections, %d merged, %d untiled\n",
+                      numTileDet[0], numTileDet[1], numTileDet[2], retVal, numRefDet);
+        if ((retVal < 0) || (Test_compareDetList(cfarDetList, (uint32_t)retVal, numRefDet) == 0))
+        {
+            System_printf("  merged tile detection list differs from untiled list\n");
+            result = 0;
+        }
+    }
+
+    /* CFAR peak based grouping is rejected with tiles, at configuration and by control */
+    cfarCfgRange.peakGroupingScheme = DPU_CFAR_PEAK_GROUPING_CFAR_PEAK_BASED;
+    retVal = DPU_CFARCAProcDSP_config(cfarProcDpuHandle, &cfarProcDpuCfg);
+    if (retVal != DPU_CFARCAPROCDSP_EINVAL__RANGE_TILE)
+    {
+        System_printf("  CFAR peak based grouping with tiles: config returned %d\n", retVal);
+        result = 0;
+    }
+    cfarCfgRange.peakGroupingScheme = DPU_CFAR_PEAK_GROUPING_DET_MATRIX_BASED;
+    cfarCfgDoppler.peakGroupingScheme = DPU_CFAR_PEAK_GROUPING_CFAR_PEAK_BASED;
+    retVal = DPU_CFARCAProcDSP_config(cfarProcDpuHandle, &cfarProcDpuCfg);
+    if (retVal != DPU_CFARCAPROCDSP_EINVAL__RANGE_TILE)
+    {
+        System_printf("  CFAR peak based Doppler grouping with tiles: config returned %d\n", retVal);
+        result = 0;
+    }
+    cfarCfgDoppler.peakGroupingScheme = DPU_CFAR_PEAK_GROUPING_DET_MATRIX_BASED;
+    retVal = DPU_CFARCAProcDSP_config(cfarProcDpuHandle, &cfarProcDpuCfg);
+    if (retVal == 0)
+    {
+        cfarCfgRange.peakGroupingScheme = DPU_CFAR_PEAK_GROUPING_CFAR_PEAK_BASED;
+        retVal = DPU_CFARCAProcDSP_control(cfarProcDpuHandle, DPU_CFARCAProcDSP_Cmd_CfarRangeCfg,
+                                           (void *)&cfarCfgRange, sizeof(DPU_CFARCAProc_CfarCfg));
+        cfarCfgRange.peakGroupingScheme = DPU_CFAR_PEAK_GROUPING_DET_MATRIX_BASED;
+    }
+    if (retVal != DPU_CFARCAPROCDSP_EINVAL__RANGE_TILE)
+    {
+        System_printf("  CFAR peak based grouping with tiles: control returned %d\n", retVal);
+        result = 0;
+    }
+
+    /* Back to the untiled configuration */
+    cfarProcDpuCfg.staticCfg.rangeTileStartIdx = 0;
+    cfarProcDpuCfg.staticCfg.numRangeTileBins = 0;
+    hwRes->cfarRngDopSnrList = cfarDetList;
+
+    return result;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Reference noise floor map refresh: averages the Doppler domain noise estimate of
+ *      each cell over its Doppler region and filters the average into the map,
+ *      map += (avg - map) >> alphaShift. The first refresh takes the average as is.
+ */
+void Test_noiseMapRefUpdate(cfarProcDpuTestConfig_t *testConfig, uint32_t alphaShift)
+{
+    uint32_t log2RegionLen = cfarProcDpuCfg.staticCfg.log2NumDopplerBins - TEST_NOISE_MAP_LOG2_REGIONS;
+    uint32_t rangeIdx, dopplerIdx, mapIdx;
+    uint32_t regionSum;
+    int32_t  diff;
+
+    for (rangeIdx = 0; rangeIdx < testConfig->numRangeBins; rangeIdx++)
+    {
+        regionSum = 0;
+        for (dopplerIdx = 0; dopplerIdx < testConfig->numDopplerBins; dopplerIdx++)
+        {
+            regionSum += Test_dopplerNoiseRef(testConfig, rangeIdx, dopplerIdx);
+            if (((dopplerIdx + 1) & ((1U << log2RegionLen) - 1U)) == 0)
+            {
+                mapIdx = (rangeIdx << TEST_NOISE_MAP_LOG2_REGIONS) + (dopplerIdx >> log2RegionLen);
+                refNoiseRegionAvg[mapIdx] = (uint16_t)(regionSum >> log2RegionLen);
+                diff = (int32_t)refNoiseRegionAvg[mapIdx] - (int32_t)refNoiseMap[mapIdx];
+                refNoiseMap[mapIdx] = (uint16_t)((int32_t)refNoiseMap[mapIdx] + (diff >> alphaShift));
+                regionSum = 0;
+            }
+        }
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Runs the DPU with the noise floor map over several frames. The scene is stable
+ *      except for a step of the noise floor after a few frames. Checks that the noise
+ *      estimation pass runs exactly every refreshPeriod frames, that the map follows
+ *      map += (avg - map) >> alphaShift at each refresh and converges to the average of
+ *      the stepped scene, and that the threshold only frames give the same detections as
+ *      the latest frame with the full noise estimation pass. Prints the average cycles
+ *      of both kinds of frames.
+ *
+ *  @retval
+ *      1 if all checks pass, 0 otherwise
+ */
+uint8_t Test_noiseMap(cfarProcDpuTestConfig_t *testConfig)
+{
+    DPU_CFARCAProcDSP_HW_Resources *hwRes = &cfarProcDpuCfg.res;
+    uint32_t mapSize = testConfig->numRangeBins << TEST_NOISE_MAP_LOG2_REGIONS;
+    uint32_t numRefDet = 0;
+    uint32_t frameIdx, idx;
+    uint32_t numRefreshFrames = 0;
+    uint32_t refreshCycles = 0;
+    uint32_t thresholdCycles = 0;
+    uint32_t maxError = 0;
+    uint32_t error;
+    uint8_t  isRefreshFrame;
+    int32_t  retVal;
+    uint8_t  result = 1;
+
+    cfarProcDpuCfg.staticCfg.noiseMapCfg.enabled = 1;
+    cfarProcDpuCfg.staticCfg.noiseMapCfg.log2NumDopplerRegions = TEST_NOISE_MAP_LOG2_REGIONS;
+    cfarProcDpuCfg.staticCfg.noiseMapCfg.alphaShift = TEST_NOISE_MAP_ALPHA_SHIFT;
+    cfarProcDpuCfg.staticCfg.noiseMapCfg.refreshPeriod = TEST_NOISE_MAP_REFRESH_PERIOD;
+    cfarProcDpuCfg.staticCfg.resetNoiseMap = 1;
+    hwRes->cfarNoiseMap = cfarNoiseMap;
+    hwRes->cfarNoiseMapSize = mapSize * sizeof(uint16_t);
+
+    cfarCfgRange.peakGroupingEn = 0;
+    cfarCfgDoppler.peakGroupingEn = 0;
+
+    retVal = DPU_CFARCAProcDSP_config(cfarProcDpuHandle, &cfarProcDpuCfg);
+    if (retVal != 0)
+    {
+        System_printf("  noise map config failed, error %d\n", retVal);
+        result = 0;
+        goto exit;
+    }
+    memset((void *)refNoiseMap, 0xFF, mapSize * sizeof(uint16_t));
+
+    for (frameIdx = 0; frameIdx < TEST_NOISE_MAP_NUM_FRAMES; frameIdx++)
+    {
+        if (frameIdx == TEST_NOISE_MAP_STEP_FRAME)
+        {
+            for (idx = 0; idx < testConfig->numRangeBins * testConfig->numDopplerBins; idx++)
+            {
+                testDetMatrix[idx] += TEST_NOISE_MAP_STEP;
+            }
+        }
+
+        retVal = DPU_CFARCAProcDSP_process(cfarProcDpuHandle, &outParams);
+        if (retVal != 0)
+        {
+            System_printf("  noise map frame %d: process failed, error %d\n", frameIdx, retVal);
+            result = 0;
+            goto exit;
+        }
+
+        isRefreshFrame = ((frameIdx % TEST_NOISE_MAP_REFRESH_PERIOD) == 0) ? 1 : 0;
+        if (outParams.isNoiseMapRefreshed != (isRefreshFrame != 0))
+        {
+            System_printf("  noise map frame %d: refreshed %d, expected %d\n",
+                          frameIdx, outParams.isNoiseMapRefreshed, isRefreshFrame);
+            result = 0;
+        }
+
+        if (isRefreshFrame)
+        {
+            Test_noiseMapRefUpdate(testConfig, (frameIdx == 0) ? 0 : TEST_NOISE_MAP_ALPHA_SHIFT);
+            numRefreshFrames++;
+            refreshCycles += outParams.stats.processingTime + outParams.stats.waitTime;
+
+            /* Detections of the full pass are the reference of the next threshold only frames */
+            numRefDet = outParams.numCfarDetectedPoints;
+            memcpy((void *)refDetList, (void *)cfarDetList, numRefDet * sizeof(DPIF_CFARDetList));
+        }
+        else
+        {
+            thresholdCycles += outParams.stats.processingTime + outParams.stats.waitTime;
+
+            if (Test_compareDetList(cfarDetList, outParams.numCfarDetectedPoints, numRefDet) == 0)
+            {
+                System_printf("  noise map frame %d: threshold only detections differ from full CFAR\n", frameIdx);
+                result = 0;
+            }
+        }
+
+        /* Map only changes at refresh frames and follows the IIR filter exactly */
+        for (idx = 0; idx < mapSize; idx++)
+        {
+            if (cfarNoiseMap[idx] != refNoiseMap[idx])
+            {
+                System_printf("  noise map frame %d: map[%d] %d, expected %d\n",
+                              frameIdx, idx, cfarNoiseMap[idx], refNoiseMap[idx]);
+                result = 0;
+                break;
+            }
+        }
+    }
+
+    /* After the step, the map has converged to the region averages of the stepped scene */
+    for (idx = 0; idx < mapSize; idx++)
+    {
+        error = (uint32_t)abs((int32_t)cfarNoiseMap[idx] - (int32_t)refNoiseRegionAvg[idx]);
+        if (error > maxError)
+        {
+            maxError = error;
+        }
+    }
+    if (maxError >= (1U << TEST_NOISE_MAP_ALPHA_SHIFT))
+    {
+        System_printf("  noise map not converged, error %d\n", maxError);
+        result = 0;
+    }
+
+    System_printf("  noise map: full CFAR %d cycles, threshold only %d cycles (average of %d and %d frames)\n",
+                  refreshCycles / numRefreshFrames,
+                  thresholdCycles / (TEST_NOISE_MAP_NUM_FRAMES - numRefreshFrames),
+                  numRefreshFrames, TEST_NOISE_MAP_NUM_FRAMES - numRefreshFrames);
+
+exit:
+    cfarProcDpuCfg.staticCfg.noiseMapCfg.enabled = 0;
+    return result;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Runs the DPU and compares its output with the reference.
+ *
+ *  @retval
+ *      Number of DPU detections
+ */
+uint32_t Test_runAndCompare(cfarProcDpuTestConfig_t *testConfig, const char *caseName, uint8_t *result)
+{
+    int32_t  retVal;
+    uint32_t numRefDet;
+
+    numRefDet = Test_cfarRef(testConfig);
+
+    retVal = DPU_CFARCAProcDSP_process(cfarProcDpuHandle, &outParams);
+    if (retVal != 0)
+    {
+        System_printf("  %s: process failed, error %d\n", caseName, retVal);
+        *result = 0;
+        return 0;
+    }
+
+    if (Test_compareDetList(cfarDetList, outParams.numCfarDetectedPoints, numRefDet) == 0)
+    {
+        System_printf("  %s: detection list mismatch\n", caseName);
+        *result = 0;
+    }
+
+    System_printf("  %s: %d detections, %d cycles\n", caseName, outParams.numCfarDetectedPoints,
+                  outParams.stats.processingTime + outParams.stats.waitTime);
+
+    return outParams.numCfarDetectedPoints;
+}
+
+void Test_task(UArg arg0, UArg arg1)
+{
+    uint32_t numRangeBin[TEST_RANGE_BIN_ARRAY_SIZE] = {64, 128, 256};
+    uint32_t numDopplerBin[TEST_DOPP_BIN_ARRAY_SIZE] = {16, 32, 64};
+    uint8_t  averageMode[TEST_AVG_MODE_ARRAY_SIZE] = {CFAR_CA, CFAR_CAGO, CFAR_CASO};
+    uint32_t rangeIdx, dopplerIdx, modeIdx;
+    cfarProcDpuTestConfig_t testConfig;
+    char featureName[200];
+    int32_t  retVal;
+    uint32_t testCount = 0;
+    uint32_t numDet;
+    uint32_t numSuppressedFlat, numSuppressedProfile;
+    uint8_t  testResult;
+    uint32_t grpIdx;
+    const uint8_t rangeGrpEn[TEST_GROUPING_ARRAY_SIZE] = {1, 1, 0};
+    const uint8_t dopplerGrpEn[TEST_GROUPING_ARRAY_SIZE] = {1, 0, 1};
+
+    System_printf("...... Initialization ...... \n");
+
+    finalResults = 1;
+
+    /*edma, dpu inialization */
+    cfarProc_test_edmainit();
+    cfarProc_test_dpuInit();
+
+    for (rangeIdx = 0; rangeIdx < TEST_RANGE_BIN_ARRAY_SIZE; rangeIdx++)
+    {
+        for (dopplerIdx = 0; dopplerIdx < TEST_DOPP_BIN_ARRAY_SIZE; dopplerIdx++)
+        {
+            for (modeIdx = 0; modeIdx < TEST_AVG_MODE_ARRAY_SIZE; modeIdx++)
+            {
+                testResult = 1;
+                testConfig.numRangeBins = numRangeBin[rangeIdx];
+                testConfig.numDopplerBins = numDopplerBin[dopplerIdx];
+                testConfig.averageMode = averageMode[modeIdx];
+
+                System_printf("Test #%d: numRangeBins %d, numDopplerBins %d, averageMode %d\n",
+                              testCount, testConfig.numRangeBins, testConfig.numDopplerBins,
+                              testConfig.averageMode);
+
+                Test_setProfile(&testConfig);
+                Test_genDetMatrix(&testConfig);
+                Test_setThresholdProfile(&testConfig);
+
+                retVal = DPU_CFARCAProcDSP_config(cfarProcDpuHandle, &cfarProcDpuCfg);
+                if (retVal != 0)
+                {
+                    System_printf("  config failed, error %d\n", retVal);
+                    DebugP_assert(0);
+                    return;
+                }
+
+                /* Flat thresholds of the CFAR configuration */
+                Test_genThresholdRef(&testConfig, NULL);
+                numDet = Test_runAndCompare(&testConfig, "flat threshold", &testResult);
+
+                /* Detections of the flat run falling in the segment the profile suppresses */
+                Test_genThresholdRef(&testConfig, &thresholdProfile);
+                numSuppressedFlat = Test_countDetAtThreshold(cfarDetList, numDet, TEST_THRESHOLD_SUPPRESS);
+
+                /* Range dependent threshold profile */
+                retVal = DPU_CFARCAProcDSP_control(cfarProcDpuHandle, DPU_CFARCAProcDSP_Cmd_RangeThresholdProfileCfg,
+                                                   (void *)&thresholdProfile, sizeof(DPU_CFARCAProc_RangeThresholdProfileCfg));
+                if (retVal != 0)
+                {
+                    System_printf("  threshold profile control failed, error %d\n", retVal);
+                    testResult = 0;
+                }
+                numDet = Test_runAndCompare(&testConfig, "threshold profile", &testResult);
+                numSuppressedProfile = Test_countDetAtThreshold(cfarDetList, numDet, TEST_THRESHOLD_SUPPRESS);
+
+                /* Profile must have removed the targets of the suppressed segment */
+                if ((numSuppressedFlat == 0) || (numSuppressedProfile != 0))
+                {
+                    System_printf("  suppressed segment: %d detections flat, %d with profile\n",
+                                  numSuppressedFlat, numSuppressedProfile);
+                    testResult = 0;
+                }
+
+                /* Peak grouping schemes, on targets with neighbors and without profile */
+                Test_addTargetNeighbors(&testConfig);
+                thresholdProfile.enabled = 0;
+                retVal = DPU_CFARCAProcDSP_control(cfarProcDpuHandle, DPU_CFARCAProcDSP_Cmd_RangeThresholdProfileCfg,
+                                                   (void *)&thresholdProfile, sizeof(DPU_CFARCAProc_RangeThresholdProfileCfg));
+                Test_genThresholdRef(&testConfig, NULL);
+                numDet = Test_runAndCompare(&testConfig, "no grouping", &testResult);
+                if (retVal != 0)
+                {
+                    System_printf("  threshold profile control failed, error %d\n", retVal);
+                    testResult = 0;
+                }
+                for (grpIdx = 0; grpIdx < TEST_GROUPING_ARRAY_SIZE; grpIdx++)
+                {
+                    if (Test_compareGroupingSchemes(rangeGrpEn[grpIdx], dopplerGrpEn[grpIdx], numDet) == 0)
+                    {
+                        testResult = 0;
+                    }
+                }
+
+                /* Range tiles merged into one list */
+                if (Test_compareRangeTiles(&testConfig) == 0)
+                {
+                    testResult = 0;
+                }
+
+                /* Noise floor map over several frames */
+                if (Test_noiseMap(&testConfig) == 0)
+                {
+                    testResult = 0;
+                }
+
+                sprintf(featureName, "CFARCA DSP test: numRangeBins %d, numDopplerBins %d, averageMode %d",
+                        testConfig.numRangeBins, testConfig.numDopplerBins, testConfig.averageMode);
+                if (testResult)
+                {
+                    MCPI_setFeatureTestResult(featureName, MCPI_TestResult_PASS);
+                }
+                else
+                {
+                    MCPI_setFeatureTestResult(featureName, MCPI_TestResult_FAIL);
+                    finalResults = 0;
+                }
+                testCount++;
+            }
+        }
+    }
+
+    EDMA_close(edmaHandle);
+
+    retVal = DPU_CFARCAProcDSP_deinit(cfarProcDpuHandle);
+    if (retVal < 0)
+    {
+        System_printf("CFAR DPU failed to deinit. Error %d.\n", retVal);
+        DebugP_assert(0);
+        return;
+    }
+
+    System_printf("----------------------------\n");
+    System_printf("Run %d tests.\n", testCount);
+
+    if (finalResults == 1)
+    {
+        System_printf("All Tests PASSED!\n");
+        MCPI_setFeatureTestResult("CFARCA_DSP_DPU", MCPI_TestResult_PASS);
+    }
+    else
+    {
+        System_printf("Test FAILED!\n");
+        MCPI_setFeatureTestResult("CFARCA_DSP_DPU", MCPI_TestResult_FAIL);
+    }
+
+    System_printf("Test Finished\n");
+    MCPI_setTestResult();
+
+    /* Exit BIOS */
+    BIOS_exit(0);
+}
+
+
+int main (void)
+{
+    Task_Params taskParams;
+    int32_t     errCode;
+    SOC_Cfg     socCfg;
+
+    /* Initialize test logger */
+    MCPI_Initialize();
+
+    Cycleprofiler_init();
+
+    /* Initialize the SOC confiugration: */
+    memset ((void *)&socCfg, 0, sizeof(SOC_Cfg));
+
+    /* Populate the SOC configuration: */
+    socCfg.clockCfg = SOC_SysClock_INIT;
+
+    /* Initialize the SOC Module: This is done as soon as the application is started
+     * to ensure that the MPU is correctly configured. */
+    socHandle = SOC_init (&socCfg, &errCode);
+    if (socHandle == NULL)
+    {
+        System_printf ("Error: SOC Module Initialization failed [Error code %d]\n", errCode);
+        DebugP_assert(0);
+        return -1;
+    }
+
+    /* Initialize the Task Parameters. */
+    Task_Params_init(&taskParams);
+    taskParams.stackSize = 8*1024;
+    Task_create(Test_task, &taskParams, NULL);
+
+    /* Start BIOS */
+    BIOS_start();
+
+    return 0;
+}
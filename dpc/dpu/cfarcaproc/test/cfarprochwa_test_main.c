@@ -69,6 +69,7 @@
 #include <ti/utils/testlogger/logger.h>
 #include <ti/utils/cycleprofiler/cycle_profiler.h> 
 #include <ti/datapath/dpc/dpu/cfarcaproc/cfarcaprochwa.h>
+#include <ti/datapath/dpc/dpu/cfarcaproc/include/cfarcaprochwainternal.h>
 #include <ti/utils/mathutils/mathutils.h>
 #include <ti/utils/randomdatagenerator/gen_rand_data.h>
 
@@ -81,6 +82,7 @@
 #define TEST_CFAR_WIN_LEN 6
 #define TEST_CFAR_GUARD_LEN 7
 #define TEST_NOISE_THRESHOLD  800
+#define TEST_MAX_NUM_EMU_CFARDET 2048
 
 /**
 * @brief
@@ -123,6 +125,10 @@ uint8_t cfarDetObjCheck[TEST_MAX_NUM_CFARDETOBJ_DPU_LIST];
 uint32_t numDetPeaksRef;
 uint32_t numCheckPeaksRef;
 
+/* software emulated HWA CFAR range domain output */
+#pragma DATA_SECTION(cfarEmuDetOut, ".l3ram");
+DPU_CFARCAProcHWA_CfarDetOutput cfarEmuDetOut[TEST_MAX_NUM_EMU_CFARDET];
+
 #ifdef SUBSYS_MSS
 #pragma DATA_SECTION(cfarInputDataTemp, ".tcmb");
 #endif
@@ -1082,6 +1088,121 @@ void Test_printResults()
 }
 
 
+/**
+*  @b Description
+*  @n
+*   Checks that the emulation finds as many detections as the HWA reports, then compares
+*   the emulated CFAR records with the records written by the HWA, up to the size of both
+*   outputs.
+*
+*  @retval 1 if the counts and the records are identical, 0 otherwise
+*
+*/
+uint8_t Test_compareEmulatedRecords(uint32_t numEmuDet,
+                                    uint32_t numHwaDet,
+                                    DPU_CFARCAProcHWA_CfarDetOutput *hwaOut,
+                                    uint32_t hwaOutSize,
+                                    const char *domainName)
+{
+    uint32_t ii;
+    uint32_t numCheck;
+
+    if (numEmuDet != numHwaDet)
+    {
+        System_printf("\n%s emulated detections: %d, hwa: %d\n", domainName, numEmuDet, numHwaDet);
+        return 0;
+    }
+
+    numCheck = numEmuDet;
+    if (numCheck > hwaOutSize)
+    {
+        numCheck = hwaOutSize;
+    }
+    if (numCheck > TEST_MAX_NUM_EMU_CFARDET)
+    {
+        numCheck = TEST_MAX_NUM_EMU_CFARDET;
+    }
+
+    for (ii = 0; ii < numCheck; ii++)
+    {
+        if ((cfarEmuDetOut[ii].cellIdx != hwaOut[ii].cellIdx) ||
+            (cfarEmuDetOut[ii].iterNum != hwaOut[ii].iterNum) ||
+            (cfarEmuDetOut[ii].noise != hwaOut[ii].noise))
+        {
+            System_printf("\n%s emulated record %d is : cell=%d iter=%d noise=%d, hwa: cell=%d iter=%d noise=%d\n",
+                          domainName, ii,
+                          cfarEmuDetOut[ii].cellIdx, cfarEmuDetOut[ii].iterNum, cfarEmuDetOut[ii].noise,
+                          hwaOut[ii].cellIdx, hwaOut[ii].iterNum, hwaOut[ii].noise);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+*  @b Description
+*  @n
+*   Runs the software emulation of the HWA CFAR parameter sets on the same detection matrix,
+*   checks the emulated Doppler domain and range domain records against the HWA output and
+*   prints the HWA and emulation cycles.
+*
+*  @retval None
+*
+*/
+void Test_checkEmulation(cfarProcDpuTestConfig_t * testConfig)
+{
+    uint32_t startTime;
+    uint32_t emuCycles = 0;
+    uint32_t numEmuDet;
+    uint8_t testPass = 1;
+
+    if (testConfig->dopplerCfarEnabled)
+    {
+        startTime = Cycleprofiler_getTimeStamp();
+        numEmuDet = CFARHWA_emulateCFAR(testDetMatrix,
+                                        testConfig->numRangeBins,
+                                        testConfig->numDopplerBins,
+                                        &cfarDopplerCfg,
+                                        cfarEmuDetOut,
+                                        TEST_MAX_NUM_EMU_CFARDET,
+                                        DPU_CFAR_DOPPLER_DOMAIN);
+        emuCycles += Cycleprofiler_getTimeStamp() - startTime;
+
+        testPass &= Test_compareEmulatedRecords(numEmuDet,
+                                                cfarDpuOut.numDopplerCfarPeaks,
+                                                (DPU_CFARCAProcHWA_CfarDetOutput *)cfarDpuCfg.res.hwaMemOutDoppler,
+                                                cfarDpuCfg.res.hwaMemOutDopplerSize,
+                                                "doppler");
+    }
+
+    startTime = Cycleprofiler_getTimeStamp();
+    numEmuDet = CFARHWA_emulateCFAR(testDetMatrix,
+                                    testConfig->numRangeBins,
+                                    testConfig->numDopplerBins,
+                                    &cfarRangeCfg,
+                                    cfarEmuDetOut,
+                                    TEST_MAX_NUM_EMU_CFARDET,
+                                    DPU_CFAR_RANGE_DOMAIN);
+    emuCycles += Cycleprofiler_getTimeStamp() - startTime;
+
+    testPass &= Test_compareEmulatedRecords(numEmuDet,
+                                            cfarDpuOut.numRangeCfarPeaks,
+                                            (DPU_CFARCAProcHWA_CfarDetOutput *)cfarDpuCfg.res.hwaMemOutRange,
+                                            cfarDpuCfg.res.hwaMemOutRangeSize,
+                                            "range");
+
+    if (testPass)
+    {
+        System_printf(" PASS ");
+    }
+    else
+    {
+        finalResults = 0;
+        System_printf(" FAIL ");
+    }
+    System_printf(" HWA cycles: %d, emulation cycles: %d", cfarDpuOut.stats.processingTime + cfarDpuOut.stats.waitTime, emuCycles);
+}
+
 /**
 *  @b Description
 *  @n
@@ -1450,6 +1571,11 @@ void Test_task(UArg arg0, UArg arg1)
                 Test_printResults();
                 System_printf("\n");
 
+                /* check the software emulation against the HWA output */
+                System_printf("Check HWA CFAR emulation output: ");
+                Test_checkEmulation(&cfarTestCfg);
+                System_printf("\n");
+
                 /* check the cfar command */
                 if (((testCount & 0x3) == 0)  & (numCheckPeaksRef<TEST_MAX_NUM_CFARDETOBJ_DPU_LIST))
                 {
@@ -0,0 +1,94 @@
+###################################################################################
+# DSP CFAR PROC Test 
+###################################################################################
+.PHONY: cfarDspDssTest cfarDspDssTestClean
+
+###################################################################################
+# Setup the VPATH:
+###################################################################################
+vpath %.c $(MMWAVE_SDK_INSTALL_PATH)/ti/datapath/dpc/dpu/cfarcaproc/test
+vpath %.c $(MMWAVE_SDK_INSTALL_PATH)/ti/utils/randomdatagenerator
+
+###################################################################################
+# The CFAR PROC Test requires additional libraries
+###################################################################################
+DSPCFARPROC_DSS_TEST_STD_LIBS = $(C674_COMMON_STD_LIB)								\
+           				-llibedma_$(MMWAVE_SDK_DEVICE_TYPE).$(C674_LIB_EXT) 		\
+                        -llibtestlogger_$(MMWAVE_SDK_DEVICE_TYPE).$(C674_LIB_EXT) \
+						-llibcfarcaproc_dsp_$(MMWAVE_SDK_DEVICE_TYPE).$(C674_LIB_EXT) \
+                        -llibmmwavealg_$(MMWAVE_SDK_DEVICE_TYPE).$(C674_LIB_EXT) 
+                        
+ifneq ($(filter $(MMWAVE_SDK_DEVICE_TYPE),xwr18xx xwr68xx), )
+DSPCFARPROC_DSS_TEST_STD_LIBS +=	-llibdpedma_hwa_$(MMWAVE_SDK_DEVICE_TYPE).$(C674_LIB_EXT) 
+else
+DSPCFARPROC_DSS_TEST_STD_LIBS +=	-llibdpedma_base_$(MMWAVE_SDK_DEVICE_TYPE).$(C674_LIB_EXT) 
+endif                        
+                        
+DSPCFARPROC_DSS_TEST_LOC_LIBS = $(C674_COMMON_LOC_LIB)								\
+						-i$(MMWAVE_SDK_INSTALL_PATH)/ti/drivers/edma/lib 	\
+                        -i$(MMWAVE_SDK_INSTALL_PATH)/ti/utils/testlogger/lib \
+						-i$(MMWAVE_SDK_INSTALL_PATH)/ti/datapath/dpc/dpu/cfarcaproc/lib \
+						-i$(MMWAVE_SDK_INSTALL_PATH)/ti/datapath/dpedma/lib \
+                        -i$(MMWAVE_SDK_INSTALL_PATH)/ti/alg/mmwavelib/lib
+
+
+###################################################################################
+# Unit Test Files
+###################################################################################
+DSPCFARPROC_DSS_TEST_CFG	 	 = test/dss.cfg
+DSPCFARPROC_DSS_TEST_CMD       = $(MMWAVE_SDK_INSTALL_PATH)/ti/platform/$(MMWAVE_SDK_DEVICE_TYPE)
+DSPCFARPROC_DSS_TEST_CONFIGPKG = test/c674_configPkg_$(MMWAVE_SDK_DEVICE_TYPE)
+DSPCFARPROC_DSS_TEST_MAP       = test/$(MMWAVE_SDK_DEVICE_TYPE)_cfarprocdsp_dss.map
+DSPCFARPROC_DSS_TEST_OUT       = test/$(MMWAVE_SDK_DEVICE_TYPE)_cfarprocdsp_dss.$(C674_EXE_EXT)
+DSPCFARPROC_DSS_TEST_BIN       = test/$(MMWAVE_SDK_DEVICE_TYPE)_cfarprocdsp_dss.bin
+DSPCFARPROC_DSS_TEST_APP_CMD   = test/dss_cfarproc_linker.cmd
+DSPCFARPROC_DSS_TEST_SOURCES   = cfarprocdsp_test_main.c \
+									gen_rand_data.c
+								
+
+DSPCFARPROC_DSS_TEST_DEPENDS 	 = $(addprefix $(PLATFORM_OBJDIR)/, $(DSPCFARPROC_DSS_TEST_SOURCES:.c=.$(C674_DEP_EXT)))
+DSPCFARPROC_DSS_TEST_OBJECTS 	 = $(addprefix $(PLATFORM_OBJDIR)/, $(DSPCFARPROC_DSS_TEST_SOURCES:.c=.$(C674_OBJ_EXT)))
+
+OPTIMIZE_FOR_SPEED_OPTIONS := -o1 -o2 -o3 -O1 -O2 -O3
+
+
+###################################################################################
+# RTSC Configuration:
+###################################################################################
+cfarDspDssRTSC: $(DSPCFARPROC_DSS_TEST_CFG)
+	@echo 'Configuring RTSC packages...'
+	$(XS) --xdcpath="$(XDCPATH)" xdc.tools.configuro $(C674_XSFLAGS) -o $(DSPCFARPROC_DSS_TEST_CONFIGPKG) $(DSPCFARPROC_DSS_TEST_CFG)
+	@echo 'Finished configuring packages'
+	@echo ' '
+
+###################################################################################
+# Build Unit Test:
+###################################################################################
+cfarDspDssTest: BUILD_CONFIGPKG=$(DSPCFARPROC_DSS_TEST_CONFIGPKG)
+cfarDspDssTest: C674_CFLAGS += --cmd_file=$(BUILD_CONFIGPKG)/compiler.opt
+cfarDspDssTest: C674_CFLAGS := $(filter-out $(OPTIMIZE_FOR_SPEED_OPTIONS),$(C674_CFLAGS))
+cfarDspDssTest: buildDirectories cfarDspDssRTSC $(DSPCFARPROC_DSS_TEST_OBJECTS)
+	$(C674_LD) $(C674_LDFLAGS) $(DSPCFARPROC_DSS_TEST_LOC_LIBS) $(DSPCFARPROC_DSS_TEST_STD_LIBS) \
+   -l$(DSPCFARPROC_DSS_TEST_CONFIGPKG)/linker.cmd --map_file=$(DSPCFARPROC_DSS_TEST_MAP)   \
+    $(DSPCFARPROC_DSS_TEST_OBJECTS) $(PLATFORM_C674X_LINK_CMD) $(DSPCFARPROC_DSS_TEST_APP_CMD) \
+	$(C674_LD_RTS_FLAGS) -o $(DSPCFARPROC_DSS_TEST_OUT)
+	@echo '******************************************************************************'
+	@echo 'Built the DSP CFAR proc Unit Test '
+	@echo '******************************************************************************'
+
+###################################################################################
+# Cleanup Unit Test:
+###################################################################################
+cfarDspDssTestClean:
+	@echo 'Cleaning the CFAR PROC DSP Unit Test objects'
+	@$(DEL) $(DSPCFARPROC_DSS_TEST_OBJECTS) $(DSPCFARPROC_DSS_TEST_OUT) $(DSPCFARPROC_DSS_TEST_BIN)
+	@$(DEL) $(DSPCFARPROC_DSS_TEST_MAP) $(DSPCFARPROC_DSS_TEST_DEPENDS)
+	@echo 'Cleaning the CFAR PROC DSP Unit RTSC package'
+	@$(DEL) $(DSPCFARPROC_DSS_TEST_CONFIGPKG)
+	@$(DEL) $(PLATFORM_OBJDIR)
+
+###################################################################################
+# Dependency handling
+###################################################################################
+-include $(DSPCFARPROC_DSS_TEST_DEPENDS)
+
@@ -178,6 +178,19 @@
  * 
  * Both quantities above (I and II) should fit (independently) in one of the HWA M memory partitions 
  * which has a size of 16KB.\n\n
+ *
+ * **Static Clutter Removal**\n
+ * When @ref DPU_DopplerProcHWA_DynamicConfig_t::staticClutterCfg is enabled, the mean over the Doppler chirps
+ * of each virtual antenna is subtracted from the radar cube column after it lands in M0/M1 and before
+ * HWA is triggered, so the separate static clutter DPU (which moves the full radar cube in and out of
+ * local memory) is not needed. The EDMA input transfer is then not chained to the HWA trigger: the CPU waits for
+ * the column, subtracts the mean in HWA memory and triggers HWA. The arithmetic is the same as the static
+ * clutter DPU (truncated mean, saturated subtraction), so the detection matrix is identical.\n
+ * The radar cube in L3 keeps the clutter unless @ref DPU_DopplerProcHWA_StaticConfig_t::isCubeWriteBackEnabled
+ * is set, in which case the clutter removed column is written back to the radar cube with
+ * @ref DPU_DopplerProcHWA_EdmaCfg_t::edmaCubeOut, chained to the HWA trigger. Write back is needed when a later
+ * DPU (e.g. AoA) reads the radar cube. Bytes moved by EDMA per frame are reported in
+ * @ref DPU_DopplerProc_Stats_t::numEdmaBytes.\n\n
  * 
  * **Exported APIs**\n
  * DPU initialization is done through @ref DPU_DopplerProcHWA_init.\n\n
@@ -218,13 +231,13 @@
  * Besides the resources described above, other parameters required for the DPU configuration are listed
  * in @ref DPU_DopplerProcDSP_StaticConfig_t.
  * In particular, the DPU takes as input the number of Doppler chirps (numDopplerChirps), which does not
- * need to be a power of two but must be a multiple of 4. It produces a detection matrix of Doppler dimension equal to numDopplerBins
+ * need to be a power of two but must be a multiple of 2. It produces a detection matrix of Doppler dimension equal to numDopplerBins
  * which must be a power of 2 greater or equal than numDopplerChirps. Also, due to restrictions on the FFT implementation by DSPLIB,
  * numDopplerBins must be at least 16.
  *
  *   Parameter         |  Restriction  
  *  :------------------|:--------------
- *  numDopplerChirps   |  Must be a multiple of 4.   
+ *  numDopplerChirps   |  Must be a multiple of 2.   
  *  numDopplerBins     |  Must be at least 16. Must be power of two greater or equal than numDopplerChirps.      
  * \n
  * Below are details of the DPU implementation:\n\n
@@ -434,6 +447,21 @@ typedef struct DPU_DopplerProc_Edma_t
 }DPU_DopplerProc_Edma;
 
 
+/**
+ * @brief
+ *  Static clutter removal configuration
+ *
+ * @details
+ *  The structure contains the configuration for static clutter removal.
+ *
+ *  \ingroup DPU_DOPPLERPROC_EXTERNAL_DATA_STRUCTURE
+ */
+typedef struct DPU_DopplerProc_StaticClutterRemovalCfg_t
+{
+    /*! @brief Flag that indicates if static clutter removal is enabled.*/
+    bool  isEnabled;
+}DPU_DopplerProc_StaticClutterRemovalCfg;
+
 /**
  * @brief
  *  dopplerProc DPU statistics
@@ -454,6 +482,11 @@ typedef struct DPU_DopplerProc_Stats_t
     
     /*! @brief time spent waiting for EDMA transfers. Valid only for DSP version of DPU.*/
     uint32_t            waitTime;
+
+    /*! @brief Number of bytes moved by EDMA in the last processing call (radar cube in,
+               detection matrix out and, if enabled, radar cube write back).
+               Valid only for HWA version of DPU.*/
+    uint32_t            numEdmaBytes;
 }DPU_DopplerProc_Stats;
 
 #ifdef __cplusplus
@@ -122,7 +122,7 @@ extern "C" {
 #define DPU_DOPPLERPROCDSP_EBUFALIGNMENT           (DP_ERRNO_DOPPLER_PROC_BASE-10)
 
 /**
- * @brief   Error Code: Number of Doppler chirps is not a multiple of 4
+ * @brief   Error Code: Number of Doppler chirps is not a multiple of 2
  */
 #define DPU_DOPPLERPROCDSP_ENUMDOPCHIRPS           (DP_ERRNO_DOPPLER_PROC_BASE-11)
 
@@ -267,6 +267,11 @@ typedef struct DPU_DopplerProcDSP_HW_Resources_t
 
     /*! @brief      Size of the buffer for twiddle table */
     uint32_t        twiddleSize;
+
+    /*! @brief      @ref twiddle32x32 and @ref dftSinCosTable already hold the tables of this
+                    configuration, e.g. tables shared with other instances that may be processing,
+                    so #DPU_DopplerProcDSP_config does not generate them again. */
+    bool            isTablesInitialized;
   
     /*! @brief      Pointer for buffer with window coefficients. Data in this buffer needs to be preserved
                     (or recomputed) between frames. Window must be symmetric, therefore only numDopplerChirps / 2
@@ -303,7 +308,7 @@ typedef struct DPU_DopplerProcDSP_StaticConfig_t
     /*! @brief  Number of range bins */
     uint16_t    numRangeBins;
     
-    /*! @brief  Number of Doppler chirps. Must be a multiple of 4. */
+    /*! @brief  Number of Doppler chirps. Must be a multiple of 2. */
     uint16_t    numDopplerChirps;
     
     /*! @brief  Number of Doppler bins. */
@@ -318,21 +323,6 @@ typedef struct DPU_DopplerProcDSP_StaticConfig_t
     
 }DPU_DopplerProcDSP_StaticConfig;
 
-/**
- * @brief
- *  Static clutter removal configuration
- *
- * @details
- *  The structure contains the configuration for static clutter removal.
- *
- *  \ingroup DPU_DOPPLERPROC_EXTERNAL_DATA_STRUCTURE
- */
-typedef struct DPU_DopplerProc_StaticClutterRemovalCfg_t
-{
-    /*! @brief Flag that indicates if static clutter removal is enabled.*/
-    bool  isEnabled;
-}DPU_DopplerProc_StaticClutterRemovalCfg;
-
 /**
  * @brief
  *  dopplerProc dynamic configuration
@@ -371,6 +361,30 @@ typedef struct DPU_DopplerProcDSP_Config_t
     DPU_DopplerProcDSP_DynamicConfig dynCfg;    
 }DPU_DopplerProcDSP_Config;
 
+/**
+ * @brief
+ *  Range bin tile processed by the DPU
+ *
+ * @details
+ *  Restricts @ref DPU_DopplerProcDSP_process to the range bins
+ *  [startRangeBin, startRangeBin + numRangeBins). Several DPU instances, each with
+ *  its own scratch buffers and EDMA channels in @ref DPU_DopplerProcDSP_HW_Resources_t
+ *  and sharing the radar cube and the detection matrix, can process disjoint tiles
+ *  concurrently. Each tile writes only its own rows of the detection matrix, so the
+ *  result does not depend on how the tiles are scheduled.
+ *  The tile is reset to all range bins by @ref DPU_DopplerProcDSP_config.
+ *
+ *  \ingroup DPU_DOPPLERPROC_EXTERNAL_DATA_STRUCTURE
+ */
+typedef struct DPU_DopplerProcDSP_RangeTileCfg_t
+{
+    /*! @brief  First range bin of the tile */
+    uint16_t    startRangeBin;
+
+    /*! @brief  Number of range bins in the tile */
+    uint16_t    numRangeBins;
+}DPU_DopplerProcDSP_RangeTileCfg;
+
 /**
  * @brief
  *  DPU processing output parameters
@@ -400,7 +414,17 @@ typedef enum DPU_DopplerProcDSP_Cmd_e
     /*! @brief Command to update static clutter removal configuration.
         The static clutter configuration @ref DPU_DopplerProc_StaticClutterRemovalCfg_t should
         be passed as argument for this command. */
-    DPU_DopplerProcDSP_Cmd_staticClutterCfg
+    DPU_DopplerProcDSP_Cmd_staticClutterCfg,
+
+    /*! @brief Command to switch the input radar cube between frames. A @ref DPIF_RadarCube
+        of the same size and format as the configured one should be passed as argument
+        for this command. */
+    DPU_DopplerProcDSP_Cmd_radarCubeCfg,
+
+    /*! @brief Command to restrict processing to a tile of range bins.
+        The tile configuration @ref DPU_DopplerProcDSP_RangeTileCfg_t should
+        be passed as argument for this command. */
+    DPU_DopplerProcDSP_Cmd_rangeTileCfg
 }DPU_DopplerProcDSP_Cmd;
 
 DPU_DopplerProcDSP_Handle DPU_DopplerProcDSP_init(int32_t* errCode);
@@ -259,6 +259,11 @@ typedef struct DPU_DopplerProcHWA_EdmaCfg_t
     
     /*! @brief  EDMA configuration for hot signature. */
     DPU_DopplerProc_Edma edmaHotSig;
+
+    /*! @brief  EDMA configuration for writing the clutter removed samples back
+                (HWA memory -> Radar cube). Only used if static clutter removal and
+                @ref DPU_DopplerProcHWA_StaticConfig_t::isCubeWriteBackEnabled are enabled. */
+    DPU_DopplerProc_Edma edmaCubeOut;
 }DPU_DopplerProcHWA_EdmaCfg;
 
 /**
@@ -324,9 +329,30 @@ typedef struct DPU_DopplerProcHWA_StaticConfig_t
     
     /*! @brief  Log2 of number of Doppler bins */
     uint8_t     log2NumDopplerBins;
+
+    /*! @brief  When static clutter removal is enabled, write the clutter removed samples
+                back to the radar cube so that it can be used by following DPUs. */
+    bool        isCubeWriteBackEnabled;
     
 }DPU_DopplerProcHWA_StaticConfig;
 
+/**
+ * @brief
+ *  dopplerProc dynamic configuration
+ *
+ * @details
+ *  The structure is used to hold the dynamic configuration for the DPU.
+ *  It is applied by @ref DPU_DopplerProcHWA_config.
+ *
+ *  \ingroup DPU_DOPPLERPROC_EXTERNAL_DATA_STRUCTURE
+ */
+typedef struct DPU_DopplerProcHWA_DynamicConfig_t
+{   
+    /*! @brief Static clutter removal configuration.*/
+    DPU_DopplerProc_StaticClutterRemovalCfg  staticClutterCfg;
+
+}DPU_DopplerProcHWA_DynamicConfig;
+
 /**
  * @brief
  *  dopplerProc DPU configuration parameters
@@ -344,6 +370,9 @@ typedef struct DPU_DopplerProcHWA_Config_t
     
     /*! @brief Static configuration. */
     DPU_DopplerProcHWA_StaticConfig  staticCfg;
+
+    /*! @brief Dynamic configuration */
+    DPU_DopplerProcHWA_DynamicConfig dynCfg;
     
 }DPU_DopplerProcHWA_Config;
 
@@ -60,6 +60,7 @@
 /* mmWave SDK Data Path Include Files */
 #include <ti/datapath/dpif/dp_error.h>
 #include <ti/datapath/dpc/dpu/dopplerproc/dopplerprocdsp.h>
+#include <ti/datapath/dpc/dpu/staticclutterproc/staticclutterproc_kernel.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -94,6 +95,12 @@ typedef struct DPU_DopplerProcDSP_Obj_t
 
     /*! @brief Holds the value of Ceil(Log2(numVirtualAntennas))*/
     uint8_t log2VirtAnt;
+
+    /*! @brief Static clutter removal kernel configuration for numDopplerChirps samples */
+    DPU_StaticClutterProc_KernelCfg clutterKernelCfg;
+
+    /*! @brief Range bins processed by this DPU instance */
+    DPU_DopplerProcDSP_RangeTileCfg rangeTile;
 }DPU_DopplerProcDSP_Obj;
 
 
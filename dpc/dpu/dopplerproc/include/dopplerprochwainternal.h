@@ -62,6 +62,7 @@
 /* mmWave SDK Data Path Include Files */
 #include <ti/datapath/dpif/dp_error.h>
 #include <ti/datapath/dpc/dpu/dopplerproc/dopplerprochwa.h>
+#include <ti/datapath/dpc/dpu/staticclutterproc/staticclutterproc_kernel.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -114,6 +115,37 @@ typedef struct DPU_DopplerProcHWA_Obj_t
     /*! @brief  HWA memory bank addresses */
     uint32_t hwaMemBankAddr[DPU_DOPPLERPROCHWA_NUM_HWA_MEMBANKS];
 
+    /*! @brief  EDMA configuration for hot signature, triggered by CPU when
+                static clutter removal is enabled. */
+    DPU_DopplerProc_Edma edmaHotSig;
+
+    /*! @brief  EDMA configuration for radar cube write back. */
+    DPU_DopplerProc_Edma edmaCubeOut;
+
+    /*! @brief  Static clutter removal is done on the radar cube columns in HWA memory */
+    bool     isClutterRemovalEnabled;
+
+    /*! @brief  Clutter removed columns are written back to the radar cube */
+    bool     isCubeWriteBackEnabled;
+
+    /*! @brief  Number of range bins */
+    uint16_t numRangeBins;
+
+    /*! @brief  Number of Doppler chirps */
+    uint16_t numDopplerChirps;
+
+    /*! @brief  Number of transmit antennas */
+    uint16_t numTxAntennas;
+
+    /*! @brief  Number of receive antennas, i.e. sample stride of a chirp sequence */
+    uint16_t numRxAntennas;
+
+    /*! @brief  Static clutter removal kernel configuration for numDopplerChirps samples */
+    DPU_StaticClutterProc_KernelCfg clutterKernelCfg;
+
+    /*! @brief  Bytes moved by EDMA in one processing call */
+    uint32_t numEdmaBytes;
+
 }DPU_DopplerProcHWA_Obj;
 
 
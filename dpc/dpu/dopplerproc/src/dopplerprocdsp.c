@@ -166,9 +166,10 @@ static inline int32_t DPU_DopplerProcDSP_configEdma
     *  PROGRAM DMA channel to transfer data from Doppler DPU internal buffers to Detection matrix
     ******************************************************************************************/    
     syncACfg.srcAddress  = (uint32_t)&obj->cfg.hwRes.sumAbsBuf[0U];
-    syncACfg.destAddress = (uint32_t)cfg->hwRes.detMatrix.data;
+    syncACfg.destAddress = (uint32_t)&((uint16_t *)cfg->hwRes.detMatrix.data)[obj->rangeTile.startRangeBin *
+                                                                              cfg->staticCfg.numDopplerBins];
     syncACfg.aCount      = cfg->staticCfg.numDopplerBins * sizeOfDetMatrixElement;
-    syncACfg.bCount      = cfg->staticCfg.numRangeBins;
+    syncACfg.bCount      = obj->rangeTile.numRangeBins;
     syncACfg.srcBIdx     = 0U;
     syncACfg.dstBIdx     = cfg->staticCfg.numDopplerBins * sizeOfDetMatrixElement;
          
@@ -397,7 +398,7 @@ static inline void DPU_DopplerProcDSP_compensateSingleValue(uint16_t dopplerIdx,
  *  @param[in]  obj             DPU object.
  *  @param[in]  rxAntIdx        RX antenna index
  *  @param[in]  txAntIdx        TX antenna index
- *  @param[in]  rangeIdx        Range bin index
+ *  @param[in]  rangeIdx        Range bin index within the processed tile
  *  @param[in]  *waitingTime    Waiting time statistics
  *  @param[in]  fftOutIndx      Index of FFT output buffer
  *
@@ -456,7 +457,8 @@ static inline void DPU_DopplerProcDSP_log2AbsAccum
 /**
  *  @b Description
  *  @n
- *      Generate Twiddle and Sin/Cos tables used by the DPU.
+ *      Generate Twiddle and Sin/Cos tables used by the DPU, unless they are
+ *      already initialized.
  *
  *  @param[in]  obj             DPU object.
  *  @param[in]  cfg             DPU configuration.
@@ -474,13 +476,16 @@ static inline void DPU_DopplerProcDSP_generateTables
 {
     uint32_t tblIdx;
 
-    /* Generate twiddle factors for Doppler FFT. This is in ReIm format.*/
-    mmwavelib_gen_twiddle_smallfft_32x32((int32_t *)cfg->hwRes.twiddle32x32, 
-                                         cfg->staticCfg.numDopplerBins);
+    if (cfg->hwRes.isTablesInitialized == false)
+    {
+        /* Generate twiddle factors for Doppler FFT. This is in ReIm format.*/
+        mmwavelib_gen_twiddle_smallfft_32x32((int32_t *)cfg->hwRes.twiddle32x32,
+                                             cfg->staticCfg.numDopplerBins);
 
-    /* Generate SIN/COS table for single point DFT */
-    mmwavelib_dftSinCosTabelGen(cfg->staticCfg.numDopplerBins,
-                               (uint32_t *)cfg->hwRes.dftSinCosTable);
+        /* Generate SIN/COS table for single point DFT */
+        mmwavelib_dftSinCosTabelGen(cfg->staticCfg.numDopplerBins,
+                                   (uint32_t *)cfg->hwRes.dftSinCosTable);
+    }
                                
     /* Table starts from DFT size = 4*/                           
     tblIdx = 28 - _norm(cfg->staticCfg.numDopplerBins); 
@@ -551,7 +556,7 @@ static inline void DPU_DopplerProcDSP_decode2TxBPM
  *  @n
  *      This function implements static clutter removal.
  *
- *  @param[in]  cfg             DPU configuration.
+ *  @param[in]  obj             DPU object.
  *  @param[in]  inputBuf        input buffer. Clutter removal algorithm will work on this data.
  *
  *  \ingroup    DPU_DOPPLERPROC_INTERNAL_FUNCTION
@@ -560,31 +565,11 @@ static inline void DPU_DopplerProcDSP_decode2TxBPM
  */
 static inline void DPU_DopplerProcDSP_clutterRemoval
 (
-    DPU_DopplerProcDSP_Config   *cfg,
+    DPU_DopplerProcDSP_Obj      *obj,
     cmplx16ImRe_t               *inputBuf
 )
 {
-    uint32_t sumVal[2]={0};
-    cmplx32ImRe_t *pSumVal  = (cmplx32ImRe_t *) sumVal;
-    uint32_t meanVal = 0;
-    cmplx16ImRe_t *pMeanVal = (cmplx16ImRe_t *) &meanVal;
-    
-    /*Mmwavelib API requires size to be multiple of 4, which is fine because DPU allows 
-      only numDopplerChirps that is multiple of 4*/
-    mmwavelib_vecsum((int16_t *) inputBuf,
-                     (int32_t *) sumVal,
-                     (int32_t)   cfg->staticCfg.numDopplerChirps);
-
-    /*Divide by numDopplerChirps as the scratch buffer was padded to zero to make it a 
-      multiple of 4 so it does not affect the average*/    
-    pMeanVal->real = pSumVal->real / cfg->staticCfg.numDopplerChirps ;
-    pMeanVal->imag = pSumVal->imag / cfg->staticCfg.numDopplerChirps ;
-    
-    /*Lib requires size to be multiple of 4*/
-    mmwavelib_vecsubc((int16_t *) inputBuf,
-                      (int16_t *) inputBuf,
-                      (uint32_t)  meanVal,
-                      (int32_t)   cfg->staticCfg.numDopplerChirps);
+    DPU_StaticClutterProc_kernelRemoveMean(&obj->clutterKernelCfg, inputBuf);
 }
 
 /*===========================================================
@@ -699,8 +684,9 @@ int32_t DPU_DopplerProcDSP_config
         goto exit;
     }
 
-    /* Check if number of doppler chirps is a multiple of 4*/
-    if((cfg->staticCfg.numDopplerChirps & 3) != 0)
+    /* Check if number of doppler chirps is a multiple of 2 (symmetric window and
+       8 byte aligned pong buffer)*/
+    if((cfg->staticCfg.numDopplerChirps & 1) != 0)
     {
         retVal = DPU_DOPPLERPROCDSP_ENUMDOPCHIRPS;
         goto exit;
@@ -791,10 +777,15 @@ int32_t DPU_DopplerProcDSP_config
     
     /* Compute Log2 of numVirtualAntennas */
     obj->log2VirtAnt = (uint8_t) mathUtils_ceilLog2(cfg->staticCfg.numVirtualAntennas);
+    DPU_StaticClutterProc_kernelInit(&obj->clutterKernelCfg, cfg->staticCfg.numDopplerChirps);
 
     /* Save necessary parameters to DPU object that will be used during Process time */
     memcpy((void *)&obj->cfg, (void *)cfg, sizeof(DPU_DopplerProcDSP_Config));
 
+    /* Process all range bins until a tile is configured */
+    obj->rangeTile.startRangeBin = 0;
+    obj->rangeTile.numRangeBins = cfg->staticCfg.numRangeBins;
+
     /* Configure EDMA */
     retVal = DPU_DopplerProcDSP_configEdma(obj, cfg);
     if (retVal != 0)
@@ -831,6 +822,7 @@ int32_t DPU_DopplerProcDSP_process
     DPU_DopplerProcDSP_Obj *obj;
     DPU_DopplerProcDSP_Config *cfg;
     uint16_t rxAntIdx, rangeIdx, txAntIdx; 
+    uint16_t startRangeIdx, endRangeIdx;
     uint16_t nextTransferRxIdx, nextTransferRangeIdx, nextTransferTxIdx; 
     uint16_t rxAntIdxBPMPreviousBuffer, txAntIdxBPMPreviousBuffer;
     uint32_t nextTransferIdx, waitingTime, pingPongIdx;
@@ -869,11 +861,16 @@ int32_t DPU_DopplerProcDSP_process
     cfg =  &obj->cfg;
 
     pingPongIdx = DPU_DOPPLERPROCDSP_PING_IDX;
+
+    startRangeIdx = obj->rangeTile.startRangeBin;
+    endRangeIdx   = startRangeIdx + obj->rangeTile.numRangeBins;
     
-    /* trigger first DMA */
+    /* trigger first DMA, the radar cube may have been switched since configuration */
+    EDMA_setSourceAddress(cfg->hwRes.edmaCfg.edmaHandle, cfg->hwRes.edmaCfg.edmaIn.ping.channel,
+                          (uint32_t) &radarCubeBase[startRangeIdx]);
     EDMA_startDmaTransfer(cfg->hwRes.edmaCfg.edmaHandle, cfg->hwRes.edmaCfg.edmaIn.ping.channel);
 
-    for (rangeIdx = 0; rangeIdx < cfg->staticCfg.numRangeBins; rangeIdx++)
+    for (rangeIdx = startRangeIdx; rangeIdx < endRangeIdx; rangeIdx++)
     {
         for (rxAntIdx = 0; rxAntIdx < cfg->staticCfg.numRxAntennas; rxAntIdx++)
         {
@@ -909,10 +906,10 @@ int32_t DPU_DopplerProcDSP_process
                 nextTransferIdx = (nextTransferTxIdx * cfg->staticCfg.numRxAntennas * cfg->staticCfg.numDopplerChirps + 
                                    nextTransferRxIdx) * cfg->staticCfg.numRangeBins + nextTransferRangeIdx;
                 
-                /*Last computation happens when nextTransferRangeIdx reaches numRangeBins. 
-                  This indicates that, the current virtual antenna is the last one for (numRangeBins-1). 
+                /*Last computation happens when nextTransferRangeIdx reaches the end of the tile. 
+                  This indicates that, the current virtual antenna is the last one for (endRangeIdx-1). 
                   Therefore, do not trigger next EDMA.*/
-                if(nextTransferRangeIdx < cfg->staticCfg.numRangeBins)
+                if(nextTransferRangeIdx < endRangeIdx)
                 {
                     /* kick off next DMA */
                     if (pingPongIdx == DPU_DOPPLERPROCDSP_PONG_IDX)
@@ -935,7 +932,7 @@ int32_t DPU_DopplerProcDSP_process
                 /* Remove static clutter? */
                 if (cfg->dynCfg.staticClutterCfg.isEnabled)
                 {
-                    DPU_DopplerProcDSP_clutterRemoval(cfg, inpDoppFftBuf);
+                    DPU_DopplerProcDSP_clutterRemoval(obj, inpDoppFftBuf);
                 }
                 
                 /* The windowing output buffer is the input buffer for the Doppler FFT. 
@@ -990,10 +987,11 @@ int32_t DPU_DopplerProcDSP_process
                         
                         /*compute log2Abs and accumulate for PING*/
                         DPU_DopplerProcDSP_log2AbsAccum(obj, rxAntIdxBPMPreviousBuffer, 
-                                                        txAntIdxBPMPreviousBuffer, rangeIdx, &waitingTime, 0);                
+                                                        txAntIdxBPMPreviousBuffer, rangeIdx - startRangeIdx,
+                                                        &waitingTime, 0);                
                                                         
                         /*compute log2Abs and accumulate for PONG*/
-                        DPU_DopplerProcDSP_log2AbsAccum(obj, rxAntIdx, txAntIdx, rangeIdx, &waitingTime, 
+                        DPU_DopplerProcDSP_log2AbsAccum(obj, rxAntIdx, txAntIdx, rangeIdx - startRangeIdx, &waitingTime, 
                                                         cfg->staticCfg.numDopplerBins);                   
                     }
                     else
@@ -1008,7 +1006,7 @@ int32_t DPU_DopplerProcDSP_process
                 {                    
                     /*Not BPM*/
                     /*Compute log2Abs and accumulate*/                    
-                    DPU_DopplerProcDSP_log2AbsAccum(obj, rxAntIdx, txAntIdx, rangeIdx, &waitingTime, 0);                
+                    DPU_DopplerProcDSP_log2AbsAccum(obj, rxAntIdx, txAntIdx, rangeIdx - startRangeIdx, &waitingTime, 0);                
                 }
                 
                 pingPongIdx ^= 1;
@@ -1017,7 +1015,7 @@ int32_t DPU_DopplerProcDSP_process
 
         /* populate the detection matrix */
         EDMA_startDmaTransfer(cfg->hwRes.edmaCfg.edmaHandle, cfg->hwRes.edmaCfg.edmaOut.channel);
-    } /* for loop rangeIdx 0 to cfg->staticCfg.numRangeBins */
+    } /* for loop rangeIdx startRangeIdx to endRangeIdx */
     
     /*Wait for last transfer to detection matrix to complete*/
     startTimeWait = Cycleprofiler_getTimeStamp();
@@ -1103,6 +1101,50 @@ int32_t DPU_DopplerProcDSP_control
         }
         break;
 
+        case DPU_DopplerProcDSP_Cmd_radarCubeCfg:
+        {
+            DPIF_RadarCube *radarCube = (DPIF_RadarCube *)arg;
+
+            if((argSize != sizeof(DPIF_RadarCube)) ||
+               (radarCube == NULL) ||
+               (radarCube->data == NULL) ||
+               (radarCube->dataSize != obj->cfg.hwRes.radarCube.dataSize) ||
+               (radarCube->datafmt != obj->cfg.hwRes.radarCube.datafmt))
+            {
+                retVal = DPU_DOPPLERPROCDSP_EINVAL;
+                goto exit;
+            }
+            else
+            {
+                /* All EDMA source addresses are programmed from the radar cube base
+                   during processing time, so only the base needs to be updated. */
+                obj->cfg.hwRes.radarCube = *radarCube;
+            }
+        }
+        break;
+
+        case DPU_DopplerProcDSP_Cmd_rangeTileCfg:
+        {
+            DPU_DopplerProcDSP_RangeTileCfg *rangeTile = (DPU_DopplerProcDSP_RangeTileCfg *)arg;
+
+            if((argSize != sizeof(DPU_DopplerProcDSP_RangeTileCfg)) ||
+               (rangeTile == NULL) ||
+               (rangeTile->numRangeBins == 0U) ||
+               ((uint32_t)rangeTile->startRangeBin + rangeTile->numRangeBins >
+                obj->cfg.staticCfg.numRangeBins))
+            {
+                retVal = DPU_DOPPLERPROCDSP_EINVAL;
+                goto exit;
+            }
+            else
+            {
+                /* The detection matrix EDMA is programmed for the rows of the tile */
+                obj->rangeTile = *rangeTile;
+                retVal = DPU_DopplerProcDSP_configEdma(obj, &obj->cfg);
+            }
+        }
+        break;
+
         default:
             retVal = DPU_DOPPLERPROCDSP_ECMD;
             break;
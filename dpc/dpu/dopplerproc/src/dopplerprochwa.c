@@ -107,6 +107,85 @@ static void DPU_DopplerProcHWA_edmaDoneIsrCallback(uintptr_t arg,
     }
 }
 
+/**
+ *  @b Description
+ *  @n
+ *      Removes static clutter from one radar cube column sitting in HWA memory.
+ *      The column holds numTxAntennas blocks of numDopplerChirps chirps of
+ *      numRxAntennas samples. For every virtual antenna, the static clutter kernel
+ *      subtracts the mean over the chirps from its samples, strided by numRxAntennas.
+ *
+ *  @param[in]  obj       DPU obj
+ *  @param[in]  column    Radar cube column in HWA memory
+ *
+ *  \ingroup    DPU_DOPPLERPROC_INTERNAL_FUNCTION
+ *
+ *  @retval N/A
+ */
+static void DPU_DopplerProcHWA_clutterRemoval
+(
+    DPU_DopplerProcHWA_Obj  *obj,
+    cmplx16ImRe_t           *column
+)
+{
+    uint32_t        txIdx, rxIdx;
+
+    for (txIdx = 0; txIdx < obj->numTxAntennas; txIdx++)
+    {
+        for (rxIdx = 0; rxIdx < obj->numRxAntennas; rxIdx++)
+        {
+            DPU_StaticClutterProc_kernelRemoveMeanStrided(&obj->clutterKernelCfg,
+                                                          &column[txIdx * obj->numDopplerChirps * obj->numRxAntennas + rxIdx],
+                                                          obj->numRxAntennas);
+        }
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Waits for an input (radar cube -> HWA memory) EDMA transfer to complete.
+ *      Only used when static clutter removal is enabled, otherwise input
+ *      transfers trigger HWA without CPU intervention.
+ *
+ *  @param[in]  obj         DPU obj
+ *  @param[in]  pingPongId  Ping/pong ID
+ *
+ *  \ingroup    DPU_DOPPLERPROC_INTERNAL_FUNCTION
+ *
+ *  @retval EDMA error code, see EDMA API.
+ */
+static int32_t DPU_DopplerProcHWA_waitInData
+(
+    DPU_DopplerProcHWA_Obj  *obj,
+    uint32_t                pingPongId
+)
+{
+    volatile bool   isTransferDone;
+    uint8_t         chId;
+    int32_t         retVal;
+
+    if (pingPongId == 0)
+    {
+        chId = obj->edmaIn.ping.channel;
+    }
+    else
+    {
+        chId = obj->edmaIn.pong.channel;
+    }
+
+    do
+    {
+        retVal = EDMA_isTransferComplete(obj->edmaHandle, chId, (bool *)&isTransferDone);
+        if (retVal != EDMA_NO_ERROR)
+        {
+            break;
+        }
+    } while (isTransferDone == false);
+
+    return retVal;
+}
+
 /**
  *  @b Description
  *  @n
@@ -447,6 +526,7 @@ static inline int32_t DPU_DopplerProcHWA_configEdma
     DPEDMA_ChainingCfg  chainingCfg;
     DPEDMA_syncACfg     syncACfg;
     DPEDMA_syncABCfg    syncABCfg;
+    bool                isClutterRemovalEnabled = cfg->dynCfg.staticClutterCfg.isEnabled;
 
     if(obj == NULL)
     {
@@ -489,9 +569,12 @@ static inline int32_t DPU_DopplerProcHWA_configEdma
     /******************************************************************************************
     *  PROGRAM DMA channel  to transfer data from Radar cube to accelerator input buffer (ping)
     ******************************************************************************************/    
+    /* With static clutter removal, CPU triggers HWA (directly or through the write back)
+       after the column has landed, so input is not chained to the hot signature and
+       signals completion of every transfer instead. */
     chainingCfg.chainingChan                  = cfg->hwRes.edmaCfg.edmaHotSig.ping.channel;
-    chainingCfg.isIntermediateChainingEnabled = true;
-    chainingCfg.isFinalChainingEnabled        = true;
+    chainingCfg.isIntermediateChainingEnabled = !isClutterRemovalEnabled;
+    chainingCfg.isFinalChainingEnabled        = !isClutterRemovalEnabled;
 
     syncABCfg.srcAddress  = (uint32_t)(&radarCubeBase[0]);
     syncABCfg.destAddress = (uint32_t)(obj->hwaMemBankAddr[0]);
@@ -509,7 +592,7 @@ static inline int32_t DPU_DopplerProcHWA_configEdma
                                  &syncABCfg,
                                  false,//isEventTriggered
                                  true, //isIntermediateTransferCompletionEnabled
-                                 false,//isTransferCompletionEnabled
+                                 isClutterRemovalEnabled,//isTransferCompletionEnabled
                                  NULL, //transferCompletionCallbackFxn
                                  NULL);//transferCompletionCallbackFxnArg
 
@@ -564,8 +647,8 @@ static inline int32_t DPU_DopplerProcHWA_configEdma
      *  PROGRAM DMA channel  to transfer data from L3 to accelerator input buffer (pong)
      ******************************************************************************************/ 
     chainingCfg.chainingChan                  = cfg->hwRes.edmaCfg.edmaHotSig.pong.channel;
-    chainingCfg.isIntermediateChainingEnabled = true;
-    chainingCfg.isFinalChainingEnabled        = true;
+    chainingCfg.isIntermediateChainingEnabled = !isClutterRemovalEnabled;
+    chainingCfg.isFinalChainingEnabled        = !isClutterRemovalEnabled;
 
     /* Transfer parameters are the same as ping, except for src/dst addresses */
     syncABCfg.srcAddress  = (uint32_t)(&radarCubeBase[1]);
@@ -577,7 +660,7 @@ static inline int32_t DPU_DopplerProcHWA_configEdma
                                  &syncABCfg,
                                  false,//isEventTriggered
                                  true, //isIntermediateTransferCompletionEnabled
-                                 false,//isTransferCompletionEnabled
+                                 isClutterRemovalEnabled,//isTransferCompletionEnabled
                                  NULL, //transferCompletionCallbackFxn
                                  NULL);//transferCompletionCallbackFxnArg
     
@@ -600,6 +683,67 @@ static inline int32_t DPU_DopplerProcHWA_configEdma
         goto exit;
     }
 
+    if (isClutterRemovalEnabled && cfg->staticCfg.isCubeWriteBackEnabled)
+    {
+        /******************************************************************************************
+        *  PROGRAM DMA channel to write clutter removed data back to Radar cube (ping), then
+        *  trigger HWA
+        ******************************************************************************************/
+        chainingCfg.chainingChan                  = cfg->hwRes.edmaCfg.edmaHotSig.ping.channel;
+        chainingCfg.isIntermediateChainingEnabled = true;
+        chainingCfg.isFinalChainingEnabled        = true;
+
+        syncABCfg.srcAddress  = (uint32_t)(obj->hwaMemBankAddr[0]);
+        syncABCfg.destAddress = (uint32_t)(&radarCubeBase[0]);
+        syncABCfg.aCount      = sampleLenInBytes;
+        syncABCfg.bCount      = cfg->staticCfg.numRxAntennas * cfg->staticCfg.numDopplerChirps *  cfg->staticCfg.numTxAntennas;
+        syncABCfg.cCount      = cfg->staticCfg.numRangeBins / 2;//factor of 2 due to ping/pong
+        syncABCfg.srcBIdx     = sampleLenInBytes;
+        syncABCfg.dstBIdx     = cfg->staticCfg.numRangeBins * sampleLenInBytes;
+        syncABCfg.srcCIdx     = 0;
+        syncABCfg.dstCIdx     = 2 * sampleLenInBytes;//factor of 2 due to ping/pong
+
+        retVal = DPEDMA_configSyncAB(cfg->hwRes.edmaCfg.edmaHandle,
+                                     &cfg->hwRes.edmaCfg.edmaCubeOut.ping,
+                                     &chainingCfg,
+                                     &syncABCfg,
+                                     false,//isEventTriggered
+                                     true, //isIntermediateTransferCompletionEnabled
+                                     false,//isTransferCompletionEnabled
+                                     NULL, //transferCompletionCallbackFxn
+                                     NULL);//transferCompletionCallbackFxnArg
+
+        if (retVal != EDMA_NO_ERROR)
+        {
+            goto exit;
+        }
+
+        /******************************************************************************************
+        *  PROGRAM DMA channel to write clutter removed data back to Radar cube (pong), then
+        *  trigger HWA
+        ******************************************************************************************/
+        chainingCfg.chainingChan = cfg->hwRes.edmaCfg.edmaHotSig.pong.channel;
+
+        /* Transfer parameters are the same as ping, except for src/dst addresses */
+        syncABCfg.srcAddress  = (uint32_t)(obj->hwaMemBankAddr[1]);
+        syncABCfg.destAddress = (uint32_t)(&radarCubeBase[1]);
+
+        retVal = DPEDMA_configSyncAB(cfg->hwRes.edmaCfg.edmaHandle,
+                                     &cfg->hwRes.edmaCfg.edmaCubeOut.pong,
+                                     &chainingCfg,
+                                     &syncABCfg,
+                                     false,//isEventTriggered
+                                     true, //isIntermediateTransferCompletionEnabled
+                                     false,//isTransferCompletionEnabled
+                                     NULL, //transferCompletionCallbackFxn
+                                     NULL);//transferCompletionCallbackFxnArg
+
+        if (retVal != EDMA_NO_ERROR)
+        {
+            goto exit;
+        }
+    }
+
 exit:
     return(retVal);
 } 
@@ -822,6 +966,23 @@ int32_t DPU_DopplerProcHWA_config
     /* EDMA parameters needed to trigger first EDMA transfer*/
     obj->edmaHandle  = cfg->hwRes.edmaCfg.edmaHandle;
     memcpy((void*)(&obj->edmaIn), (void *)(&cfg->hwRes.edmaCfg.edmaIn), sizeof(DPU_DopplerProc_Edma));
+
+    /* Parameters needed for static clutter removal on the radar cube columns */
+    memcpy((void*)(&obj->edmaHotSig), (void *)(&cfg->hwRes.edmaCfg.edmaHotSig), sizeof(DPU_DopplerProc_Edma));
+    memcpy((void*)(&obj->edmaCubeOut), (void *)(&cfg->hwRes.edmaCfg.edmaCubeOut), sizeof(DPU_DopplerProc_Edma));
+    obj->isClutterRemovalEnabled = cfg->dynCfg.staticClutterCfg.isEnabled;
+    obj->isCubeWriteBackEnabled  = obj->isClutterRemovalEnabled && cfg->staticCfg.isCubeWriteBackEnabled;
+    obj->numRangeBins     = cfg->staticCfg.numRangeBins;
+    obj->numDopplerChirps = cfg->staticCfg.numDopplerChirps;
+    obj->numTxAntennas    = cfg->staticCfg.numTxAntennas;
+    obj->numRxAntennas    = cfg->staticCfg.numRxAntennas;
+    DPU_StaticClutterProc_kernelInit(&obj->clutterKernelCfg, cfg->staticCfg.numDopplerChirps);
+
+    /* Radar cube in and detection matrix out, plus radar cube out for write back */
+    obj->numEdmaBytes = cfg->staticCfg.numRangeBins * cfg->staticCfg.numDopplerBins * sizeof(uint16_t) +
+                        cfg->staticCfg.numRangeBins * cfg->staticCfg.numDopplerChirps *
+                        cfg->staticCfg.numTxAntennas * cfg->staticCfg.numRxAntennas *
+                        sizeof(cmplx16ImRe_t) * (obj->isCubeWriteBackEnabled ? 2U : 1U);
     
     /*HWA parameters needed for the HWA common configuration*/
     obj->hwaNumLoops      = cfg->staticCfg.numRangeBins / 2U;
@@ -899,6 +1060,9 @@ int32_t DPU_DopplerProcHWA_process
     int32_t             retVal = 0;
     bool                status;
     HWA_CommonConfig    hwaCommonConfig;
+    uint32_t            rangeIdx, pingPongIdx;
+    uint8_t             trigChan;
+    bool                isTransferDone;
 
     obj = (DPU_DopplerProcHWA_Obj *)handle;
     if (obj == NULL)
@@ -954,8 +1118,58 @@ int32_t DPU_DopplerProcHWA_process
         goto exit;
     }
 
+    if (obj->isClutterRemovalEnabled)
+    {
+        /* Clear any completion left over from previous frames */
+        for (pingPongIdx = 0; pingPongIdx < 2; pingPongIdx++)
+        {
+            retVal = EDMA_isTransferComplete(obj->edmaHandle,
+                                             (pingPongIdx == 0) ? obj->edmaIn.ping.channel : obj->edmaIn.pong.channel,
+                                             &isTransferDone);
+            if (retVal != EDMA_NO_ERROR)
+            {
+                goto exit;
+            }
+        }
+    }
+
     EDMA_startTransfer(obj->edmaHandle, obj->edmaIn.ping.channel, EDMA3_CHANNEL_TYPE_DMA);
     EDMA_startTransfer(obj->edmaHandle, obj->edmaIn.pong.channel, EDMA3_CHANNEL_TYPE_DMA);
+
+    if (obj->isClutterRemovalEnabled)
+    {
+        /* Remove clutter from each column in HWA memory, then trigger HWA either directly
+           or through the write back to the radar cube, which is chained to the HWA trigger.
+           Columns are waited for in order, so the CPU is in the EDMA -> HWA chain of each
+           bank: clutter removal of a column only overlaps with the transfers and HWA
+           processing of the other bank. */
+        for (rangeIdx = 0; rangeIdx < obj->numRangeBins; rangeIdx++)
+        {
+            pingPongIdx = rangeIdx & 0x1U;
+
+            retVal = DPU_DopplerProcHWA_waitInData(obj, pingPongIdx);
+            if (retVal != EDMA_NO_ERROR)
+            {
+                goto exit;
+            }
+
+            DPU_DopplerProcHWA_clutterRemoval(obj, (cmplx16ImRe_t *)obj->hwaMemBankAddr[pingPongIdx]);
+
+            if (obj->isCubeWriteBackEnabled)
+            {
+                trigChan = (pingPongIdx == 0) ? obj->edmaCubeOut.ping.channel : obj->edmaCubeOut.pong.channel;
+            }
+            else
+            {
+                trigChan = (pingPongIdx == 0) ? obj->edmaHotSig.ping.channel : obj->edmaHotSig.pong.channel;
+            }
+            retVal = EDMA_startTransfer(obj->edmaHandle, trigChan, EDMA3_CHANNEL_TYPE_DMA);
+            if (retVal != EDMA_NO_ERROR)
+            {
+                goto exit;
+            }
+        }
+    }
     
     /**********************************************/
     /* WAIT FOR HWA NUMLOOPS INTERRUPT            */
@@ -989,6 +1203,7 @@ int32_t DPU_DopplerProcHWA_process
     
     outParams->stats.numProcess++;
     outParams->stats.processingTime = Cycleprofiler_getTimeStamp() - startTime;
+    outParams->stats.numEdmaBytes = obj->numEdmaBytes;
     
 exit:
     if (obj != NULL)
@@ -1035,7 +1035,7 @@ void Test_printResults(dopplerProcDpuTestConfig_t * testConfig)
 
 #define TEST_DOPP_BIN_ARRAY_SIZE 6
 #define TEST_RANGE_BIN_ARRAY_SIZE 7
-#define TEST_DOPP_CHIRP_ARRAY_SIZE 3
+#define TEST_DOPP_CHIRP_ARRAY_SIZE 4
 /*
     test main task
 */
@@ -1044,7 +1044,7 @@ void Test_task(UArg arg0, UArg arg1)
     uint32_t ii,jj,dopChirps;
     uint32_t numRangeBin[TEST_RANGE_BIN_ARRAY_SIZE] = {16, 32, 64, 128, 256, 512, 1024};
     uint32_t numDopplerBin[TEST_DOPP_BIN_ARRAY_SIZE] = {16, 32, 64, 128, 256, 512};
-    uint32_t numDopplerChirpsToSubtractFromDopBin[TEST_DOPP_CHIRP_ARRAY_SIZE] = {0, 4, 12};//sets numdopplerChirps = numdopplerBins - {value}
+    uint32_t numDopplerChirpsToSubtractFromDopBin[TEST_DOPP_CHIRP_ARRAY_SIZE] = {0, 4, 6, 12};//sets numdopplerChirps = numdopplerBins - {value}
     uint32_t numRxAnt[3] = {1, 2, 4};
     uint32_t numTxAnt[3] = {1, 2, 3};
     uint32_t txAntIdx, rxAntIdx;
@@ -1056,6 +1056,8 @@ void Test_task(UArg arg0, UArg arg1)
     uint32_t testCount,bpmIdx,bpmTest;
     //uint32_t preNumChirps;
     uint32_t cubeSize, detSize;
+    DPU_DopplerProcDSP_RangeTileCfg rangeTile;
+    uint32_t tileIdx, numTiles;
     
     System_printf("...... Initialization ...... \n");
 
@@ -1072,10 +1074,11 @@ void Test_task(UArg arg0, UArg arg1)
     
     /* Test runs all combinations of [NumRxAnt,NumTxAnt,NumRangeBins,NumDopplerBins] such that it
        fits the detection matrix and radar cube sizes.
-       It will test 3 cases for NumDopplerChirps:
+       It will test 4 cases for NumDopplerChirps:
        1. NumDopplerChirps = NumDopplerBins        
        2. NumDopplerChirps = NumDopplerBins - 4
-       3. NumDopplerChirps = NumDopplerBins - 12
+       3. NumDopplerChirps = NumDopplerBins - 6 (not a multiple of 4)
+       4. NumDopplerChirps = NumDopplerBins - 12
     */    
     for (txAntIdx = 0; txAntIdx < 3; txAntIdx++)        
     {
@@ -1171,13 +1174,40 @@ void Test_task(UArg arg0, UArg arg1)
                                     
                                     //System_printf("Doppler DPU configured. Cycles = %d\n", bench1);
                                     
+                                    /* Odd tests process the range bins as two tiles, as a
+                                       multi-core split would, and must give the same result */
+                                    numTiles = (testCount & 1U) ? 2U : 1U;
+                                    if (numTiles > 1U)
+                                    {
+                                        memset((void *)calculatedDetMatrix, 0, sizeof(calculatedDetMatrix));
+                                    }
+
                                     startTime = Cycleprofiler_getTimeStamp();
-                                    retVal = DPU_DopplerProcDSP_process(dopplerProcDpuHandle, &out);
-                                    if (retVal < 0)
+                                    for (tileIdx = 0; tileIdx < numTiles; tileIdx++)
                                     {
-                                        System_printf("doppler DPU failed to run. Error %d.\n", retVal);
-                                        DebugP_assert(0);
-                                        return;
+                                        if (numTiles > 1U)
+                                        {
+                                            rangeTile.startRangeBin = tileIdx * testConfig.numRangeBins / numTiles;
+                                            rangeTile.numRangeBins  = testConfig.numRangeBins / numTiles;
+                                            retVal = DPU_DopplerProcDSP_control(dopplerProcDpuHandle,
+                                                                                DPU_DopplerProcDSP_Cmd_rangeTileCfg,
+                                                                                (void *)&rangeTile,
+                                                                                sizeof(DPU_DopplerProcDSP_RangeTileCfg));
+                                            if (retVal < 0)
+                                            {
+                                                System_printf("doppler DPU failed to configure tile. Error %d.\n", retVal);
+                                                DebugP_assert(0);
+                                                return;
+                                            }
+                                        }
+
+                                        retVal = DPU_DopplerProcDSP_process(dopplerProcDpuHandle, &out);
+                                        if (retVal < 0)
+                                        {
+                                            System_printf("doppler DPU failed to run. Error %d.\n", retVal);
+                                            DebugP_assert(0);
+                                            return;
+                                        }
                                     }
                                     bench2 = Cycleprofiler_getTimeStamp() - startTime;
                                     System_printf("Doppler DPU Process. Cycles = %d. \n", bench2);
@@ -69,6 +69,7 @@
 #include <ti/utils/testlogger/logger.h>
 #include <ti/utils/cycleprofiler/cycle_profiler.h> 
 #include <ti/datapath/dpc/dpu/dopplerproc/dopplerprochwa.h>
+#include <ti/datapath/dpc/dpu/staticclutterproc/staticclutterproc_kernel.h>
 #include <ti/utils/mathutils/mathutils.h>
 #include <ti/utils/randomdatagenerator/gen_rand_data.h>
 
@@ -88,6 +89,9 @@
 #define TEST_EDMA_DOPPLERPROC_HOTSIG_PING     EDMA_TPCC0_REQ_FREE_8
 #define TEST_EDMA_DOPPLERPROC_HOTSIG_PONG     EDMA_TPCC0_REQ_FREE_9
 
+#define TEST_EDMA_DOPPLERPROC_CUBEOUT_PING    EDMA_TPCC0_REQ_FREE_10
+#define TEST_EDMA_DOPPLERPROC_CUBEOUT_PONG    EDMA_TPCC0_REQ_FREE_11
+
 /*EDMA shadow channels*/        
 #define TEST_EDMA_DOPPLERPROC_IN_PING_SHADOW     (EDMA_SHADOW_LNK_PARAM_BASE_ID + 4U)
 #define TEST_EDMA_DOPPLERPROC_IN_PONG_SHADOW     (EDMA_SHADOW_LNK_PARAM_BASE_ID + 5U)
@@ -95,6 +99,8 @@
 #define TEST_EDMA_DOPPLERPROC_OUT_PONG_SHADOW    (EDMA_SHADOW_LNK_PARAM_BASE_ID + 7U)
 #define TEST_EDMA_DOPPLERPROC_HOTSIG_PING_SHADOW (EDMA_SHADOW_LNK_PARAM_BASE_ID + 8U)
 #define TEST_EDMA_DOPPLERPROC_HOTSIG_PONG_SHADOW (EDMA_SHADOW_LNK_PARAM_BASE_ID + 9U)
+#define TEST_EDMA_DOPPLERPROC_CUBEOUT_PING_SHADOW (EDMA_SHADOW_LNK_PARAM_BASE_ID + 10U)
+#define TEST_EDMA_DOPPLERPROC_CUBEOUT_PONG_SHADOW (EDMA_SHADOW_LNK_PARAM_BASE_ID + 11U)
 
 
 
@@ -166,6 +172,25 @@ int32_t fftDataOutBuf[TEST_MAX_NUM_DOPPLER_BINS * 2];
 #endif
 int32_t detMatRefTemp[TEST_MAX_NUM_DOPPLER_BINS];  /* save the reference   */
 
+/* clutter removal equivalence test: 3 tx, 4 rx, 13 chirps (not a power of 2), 32 range bins */
+#define TEST_CLUTTER_EQUIV_NUM_TX_ANT        3
+#define TEST_CLUTTER_EQUIV_NUM_RX_ANT        4
+#define TEST_CLUTTER_EQUIV_NUM_CHIRPS        13
+#define TEST_CLUTTER_EQUIV_NUM_DOPPLER_BINS  16
+#define TEST_CLUTTER_EQUIV_NUM_RANGE_BINS    32
+#define TEST_CLUTTER_EQUIV_CUBE_SIZE         (TEST_CLUTTER_EQUIV_NUM_TX_ANT * TEST_CLUTTER_EQUIV_NUM_RX_ANT * \
+                                              TEST_CLUTTER_EQUIV_NUM_CHIRPS * TEST_CLUTTER_EQUIV_NUM_RANGE_BINS)
+#define TEST_CLUTTER_EQUIV_DETMATRIX_SIZE    (TEST_CLUTTER_EQUIV_NUM_DOPPLER_BINS * TEST_CLUTTER_EQUIV_NUM_RANGE_BINS)
+
+/* radar cube after the separate static clutter removal */
+cmplx16ImRe_t clutterRefCube[TEST_CLUTTER_EQUIV_CUBE_SIZE];
+
+/* samples of one virtual antenna, as the static clutter DPU gets them in its scratch buffer */
+cmplx16ImRe_t clutterRefAntBuf[TEST_CLUTTER_EQUIV_NUM_CHIRPS];
+
+/* detection matrix of the fused clutter removal */
+uint16_t clutterFusedDetMatrix[TEST_CLUTTER_EQUIV_DETMATRIX_SIZE];
+
 #ifdef SUBSYS_MSS
 #pragma DATA_SECTION(detMatRef, ".tcmb");
 #endif
@@ -323,6 +348,17 @@ void dopplerProc_test_dpuConfig()
     dopplerProcDpuCfg.hwRes.edmaCfg.edmaHotSig.pong.channelShadow = TEST_EDMA_DOPPLERPROC_HOTSIG_PONG_SHADOW;
     dopplerProcDpuCfg.hwRes.edmaCfg.edmaHotSig.pong.eventQueue = 0;
 
+    dopplerProcDpuCfg.hwRes.edmaCfg.edmaCubeOut.ping.channel = TEST_EDMA_DOPPLERPROC_CUBEOUT_PING;
+    dopplerProcDpuCfg.hwRes.edmaCfg.edmaCubeOut.ping.channelShadow = TEST_EDMA_DOPPLERPROC_CUBEOUT_PING_SHADOW;
+    dopplerProcDpuCfg.hwRes.edmaCfg.edmaCubeOut.ping.eventQueue = 0;
+    dopplerProcDpuCfg.hwRes.edmaCfg.edmaCubeOut.pong.channel = TEST_EDMA_DOPPLERPROC_CUBEOUT_PONG;
+    dopplerProcDpuCfg.hwRes.edmaCfg.edmaCubeOut.pong.channelShadow = TEST_EDMA_DOPPLERPROC_CUBEOUT_PONG_SHADOW;
+    dopplerProcDpuCfg.hwRes.edmaCfg.edmaCubeOut.pong.eventQueue = 0;
+
+    /* static clutter removal is fused into the input stage, the clutter removed
+       radar cube is written back so the reference can be computed from it */
+    dopplerProcDpuCfg.staticCfg.isCubeWriteBackEnabled = true;
+
     /* window factor */
     dopplerProcDpuCfg.hwRes.hwaCfg.window = testDopplerWindow;
     //dopplerProcDpuCfg.hwRes.hwaCfg.winRamOffset = 256;   
@@ -806,6 +842,170 @@ void Test_printResults(dopplerProcDpuTestConfig_t * testConfig)
     }
     System_printf("\n");
 }
+/*
+    checks that the written back radar cube has no static clutter left, i.e. the
+    mean over the chirps is zero for every range bin and virtual antenna
+*/
+void Test_checkClutterRemoved(dopplerProcDpuTestConfig_t * testConfig)
+{
+    uint32_t ii, jj, kk, mm;
+    uint32_t radarCubeIdx;
+    int32_t sumReal, sumImag;
+    uint8_t testFlag;
+
+    testFlag = 1;
+    for (ii = 0; ii < testConfig->numRangeBins; ii++)
+    {
+        for (jj = 0; jj < testConfig->numTxAntennas; jj++)
+        {
+            for (kk = 0; kk < testConfig->numRxAntennas; kk++)
+            {
+                sumReal = 0;
+                sumImag = 0;
+                for (mm = 0; mm < testConfig->numChirps; mm++)
+                {
+                    radarCubeIdx = jj * testConfig->numChirps * testConfig->numRxAntennas *  testConfig->numRangeBins;
+                    radarCubeIdx += (mm * testConfig->numRxAntennas * testConfig->numRangeBins);
+                    radarCubeIdx += (kk * testConfig->numRangeBins);
+                    radarCubeIdx += ii;
+
+                    sumReal += testRadarCube[radarCubeIdx].real;
+                    sumImag += testRadarCube[radarCubeIdx].imag;
+                }
+
+                /* mean is truncated, so the residual sum is within one sample per chirp */
+                if ((abs(sumReal) >= (int32_t)testConfig->numChirps) || (abs(sumImag) >= (int32_t)testConfig->numChirps))
+                {
+                    System_printf("Rangebin = %d, Tx = %d, Rx = %d, clutter not removed, sum = (%d, %d) fail\n", ii, jj, kk, sumReal, sumImag);
+                    finalResults = 0;
+                    testFlag = 0;
+                }
+            }
+        }
+    }
+
+    if (testFlag == 0)
+    {
+        System_printf("Clutter Removal Test Fail\n");
+    }
+}
+
+/*
+    checks that static clutter removal fused into the doppler DPU input stage gives the
+    same result as the separate static clutter DPU followed by the doppler DPU:
+    the written back radar cube must be equal to the radar cube processed with the
+    static clutter DPU kernel, and the detection matrix must be equal to the one
+    computed from that radar cube with clutter removal disabled
+*/
+void Test_clutterRemovalEquivalence(void)
+{
+    dopplerProcDpuTestConfig_t testConfig;
+    DPU_DopplerProcHWA_OutParams out;
+    DPU_StaticClutterProc_KernelCfg kernelCfg;
+    uint32_t ii, jj, kk, mm;
+    uint32_t radarCubeIdx;
+    uint32_t numCubeErrors = 0;
+    uint32_t numDetMatrixErrors = 0;
+    int32_t retVal;
+
+    System_printf("\nClutter removal equivalence test start\n");
+
+    testConfig.numTxAntennas = TEST_CLUTTER_EQUIV_NUM_TX_ANT;
+    testConfig.numRxAntennas = TEST_CLUTTER_EQUIV_NUM_RX_ANT;
+    testConfig.numChirps = TEST_CLUTTER_EQUIV_NUM_CHIRPS;
+    testConfig.numDopplerBins = TEST_CLUTTER_EQUIV_NUM_DOPPLER_BINS;
+    testConfig.numRangeBins = TEST_CLUTTER_EQUIV_NUM_RANGE_BINS;
+    testConfig.winSymFlag = 0;
+    testConfig.winType = 0;
+
+    Test_window2DCoef_gen(testConfig.numChirps, testConfig.winType);
+    Test_setProfile(&testConfig);
+    Test_cubedata_gen(&testConfig);
+
+    /* separate path: static clutter DPU kernel on each virtual antenna of a copy of the cube */
+    memcpy((void *)clutterRefCube, (void *)testRadarCube, sizeof(clutterRefCube));
+    DPU_StaticClutterProc_kernelInit(&kernelCfg, testConfig.numChirps);
+    for (ii = 0; ii < testConfig.numRangeBins; ii++)
+    {
+        for (jj = 0; jj < testConfig.numTxAntennas; jj++)
+        {
+            for (kk = 0; kk < testConfig.numRxAntennas; kk++)
+            {
+                radarCubeIdx = jj * testConfig.numChirps * testConfig.numRxAntennas * testConfig.numRangeBins +
+                               kk * testConfig.numRangeBins + ii;
+                for (mm = 0; mm < testConfig.numChirps; mm++)
+                {
+                    clutterRefAntBuf[mm] = clutterRefCube[radarCubeIdx + mm * testConfig.numRxAntennas * testConfig.numRangeBins];
+                }
+                DPU_StaticClutterProc_kernelRemoveMean(&kernelCfg, clutterRefAntBuf);
+                for (mm = 0; mm < testConfig.numChirps; mm++)
+                {
+                    clutterRefCube[radarCubeIdx + mm * testConfig.numRxAntennas * testConfig.numRangeBins] = clutterRefAntBuf[mm];
+                }
+            }
+        }
+    }
+
+    /* fused path, with write back of the clutter removed cube */
+    dopplerProcDpuCfg.dynCfg.staticClutterCfg.isEnabled = true;
+    retVal = DPU_DopplerProcHWA_config(dopplerProcDpuHandle, &dopplerProcDpuCfg);
+    if (retVal == 0)
+    {
+        retVal = DPU_DopplerProcHWA_process(dopplerProcDpuHandle, &out);
+    }
+    if (retVal < 0)
+    {
+        System_printf("doppler DPU failed with fused clutter removal. Error %d.\n", retVal);
+        DebugP_assert(0);
+        return;
+    }
+    memcpy((void *)clutterFusedDetMatrix, (void *)calculatedDetMatrix, sizeof(clutterFusedDetMatrix));
+
+    for (ii = 0; ii < TEST_CLUTTER_EQUIV_CUBE_SIZE; ii++)
+    {
+        if ((testRadarCube[ii].real != clutterRefCube[ii].real) ||
+            (testRadarCube[ii].imag != clutterRefCube[ii].imag))
+        {
+            numCubeErrors++;
+        }
+    }
+
+    /* separate path: doppler DPU without clutter removal on the clutter removed cube */
+    memcpy((void *)testRadarCube, (void *)clutterRefCube, sizeof(clutterRefCube));
+    dopplerProcDpuCfg.dynCfg.staticClutterCfg.isEnabled = false;
+    retVal = DPU_DopplerProcHWA_config(dopplerProcDpuHandle, &dopplerProcDpuCfg);
+    if (retVal == 0)
+    {
+        retVal = DPU_DopplerProcHWA_process(dopplerProcDpuHandle, &out);
+    }
+    if (retVal < 0)
+    {
+        System_printf("doppler DPU failed without clutter removal. Error %d.\n", retVal);
+        DebugP_assert(0);
+        return;
+    }
+
+    for (ii = 0; ii < TEST_CLUTTER_EQUIV_DETMATRIX_SIZE; ii++)
+    {
+        if ((uint16_t)calculatedDetMatrix[ii] != clutterFusedDetMatrix[ii])
+        {
+            numDetMatrixErrors++;
+        }
+    }
+
+    System_printf("Radar cube samples different from static clutter DPU: %d\n", numCubeErrors);
+    System_printf("Detection matrix bins different from separate clutter removal: %d\n", numDetMatrixErrors);
+    if ((numCubeErrors != 0) || (numDetMatrixErrors != 0))
+    {
+        System_printf("Clutter removal equivalence test FAIL\n");
+        finalResults = 0;
+    }
+    else
+    {
+        System_printf("Clutter removal equivalence test PASS\n");
+    }
+}
+
 /*
     test main task
 */
@@ -962,19 +1162,23 @@ void Test_task(UArg arg0, UArg arg1)
                         testConfig.numRangeBins = numRangeBin[jj];
                         testConfig.winSymFlag = (ii + jj + txAntIdx + rxAntIdx) & 0x1;
 
+                        /* every 4th test runs with static clutter removal in the input stage */
+                        dopplerProcDpuCfg.dynCfg.staticClutterCfg.isEnabled = ((testCount & 0x3) == 0x3);
+
                         System_printf("\nTest #%d  start\r\n", testCount);
 
                           /* set up test profile based on each test*/
                         Test_setProfile(&testConfig);
 
-                        sprintf(featureName, "%s%d%s%d%s%d%s%d%s%d%s%d%s%d",
+                        sprintf(featureName, "%s%d%s%d%s%d%s%d%s%d%s%d%s%d%s%d",
                             ":Tx", testConfig.numTxAntennas,
                             " Rx", testConfig.numRxAntennas,
                             " Chirp", testConfig.numChirps,
                             " R", testConfig.numRangeBins,
                             " D", testConfig.numDopplerBins,
                             " WinSym", testConfig.winSymFlag,
-                            " 1stFftScale", dopplerProcDpuCfg.hwRes.hwaCfg.firstStageScaling);
+                            " 1stFftScale", dopplerProcDpuCfg.hwRes.hwaCfg.firstStageScaling,
+                            " Clutter", dopplerProcDpuCfg.dynCfg.staticClutterCfg.isEnabled);
 
                         System_printf("Test feature : %s\n", featureName);
                       
@@ -1003,7 +1207,17 @@ void Test_task(UArg arg0, UArg arg1)
                             return;
                         }
                         bench2 = Cycleprofiler_getTimeStamp() - startTime;
-                        System_printf("Doppler DPU Process. Cycles = %d. \n", bench2);
+                        System_printf("Doppler DPU Process. Cycles = %d. EDMA bytes = %d. \n", bench2, out.stats.numEdmaBytes);
+
+                        if (dopplerProcDpuCfg.dynCfg.staticClutterCfg.isEnabled)
+                        {
+                            /* a separate static clutter DPU reads and writes the radar cube, the fused
+                               input stage with write back saves one radar cube read */
+                            System_printf("Separate clutter removal EDMA bytes = %d. \n", out.stats.numEdmaBytes +
+                                testConfig.numRangeBins * testConfig.numChirps * testConfig.numTxAntennas *
+                                testConfig.numRxAntennas * sizeof(cmplx16ImRe_t));
+                            Test_checkClutterRemoved(&testConfig);
+                        }
 
                         if (checkResults)
                         {
@@ -1023,6 +1237,8 @@ void Test_task(UArg arg0, UArg arg1)
         }
     }
 
+    Test_clutterRemovalEquivalence();
+
     EDMA_close(edmaHandle);
     HWA_close(hwaHandle);
 
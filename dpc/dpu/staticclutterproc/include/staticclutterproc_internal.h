@@ -115,6 +115,7 @@
 
 /* Data Path include files */
 #include <ti/datapath/dpc/dpu/staticclutterproc/staticclutterproc.h>
+#include <ti/datapath/dpc/dpu/staticclutterproc/staticclutterproc_kernel.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -147,11 +148,15 @@ typedef struct DPU_StaticClutterProc_Obj_t
     /*! @brief  Configuration parameters. */
     DPU_StaticClutterProc_Config cfg;
 
-    /*! @brief  Size (in samples) of Ping (or Pong) scratch buffer.\n 
-        Size is equal to:\n
-        For R4F: numDopplerChirps\n
-        For DSP (C674X): The smallest multiple of 4 greater or equal to numDopplerChirps\n*/
+    /*! @brief  Size (in samples) of Ping (or Pong) scratch buffer, equal to numDopplerChirps */
     uint16_t sizePingBufSamples;
+
+    /*! @brief  Clutter removal kernel configuration for numDopplerChirps samples */
+    DPU_StaticClutterProc_KernelCfg kernelCfg;
+
+    /*! @brief  Flag indicating that the clutter map holds the clutter of previous frames,
+        cleared by configuration so that the next frame initializes the map */
+    bool     isClutterMapValid;
     
 }DPU_StaticClutterProc_Obj;
 
@@ -53,6 +53,7 @@
 #include <ti/drivers/osal/MemoryP.h>
 #include <ti/drivers/edma/edma.h>
 #include <ti/drivers/soc/soc.h>
+#include <ti/utils/cycleprofiler/cycle_profiler.h>
 
 /* Data path Include files */
 #include <ti/datapath/dpc/dpu/staticclutterproc/include/staticclutterproc_internal.h>
@@ -286,62 +287,54 @@ int32_t DPU_StaticClutterProc_waitOutData(DPU_StaticClutterProc_Obj *obj, uint32
     return 0;
 }
 
-#ifdef SUBSYS_DSS
-#include <ti/alg/mmwavelib/mmwavelib.h>
 /**
  *  @b Description
  *  @n
- *      This function executes the clutter removal computation.
+ *      This function updates one clutter map entry with the mean of the current
+ *      frame and returns the clutter to be removed from the samples.
+ *      The entry holds the clutter scaled by 2^alphaShift, so that the update
+ *      clutter += (mean - clutter) / 2^alphaShift is done in integer arithmetic
+ *      without losing the fractional part of the clutter.
  *
  *  @param[in]  obj         staticClutterDpu object.
- *  @param[in]  inputBuf    input buffer. Clutter removal algorithm will work on this data.
+ *  @param[in]  mapEntry    clutter map entry of this range bin and virtual antenna.
+ *  @param[in]  meanVal     mean of the samples of the current frame.
  *
  *  \ingroup    DPU_STATICCLUTTERPROC_INTERNAL_FUNCTION
  *
- *  @retval N/A
+ *  @retval Clutter estimate
  */
-static inline void DPU_StaticClutterProc_clutterRemoval(DPU_StaticClutterProc_Obj *obj, cmplx16ImRe_t *inputBuf)
+static inline cmplx16ImRe_t DPU_StaticClutterProc_updateClutterMap
+(
+    DPU_StaticClutterProc_Obj *obj,
+    cmplx32ImRe_t             *mapEntry,
+    cmplx16ImRe_t             meanVal
+)
 {
-    uint32_t sumVal[2]={0};
-    cmplx32ImRe_t *pSumVal  = (cmplx32ImRe_t *) sumVal;
-    uint32_t meanVal;
-    cmplx16ImRe_t *pMeanVal = (cmplx16ImRe_t *) &meanVal;
-
-    /* Assume that scratch buffer is not initialized. Even if it is initialized to zeros,
-       after every call of mmwavelib_vecsubc() below the full buffer will be updated (all samples).
-       Therefore, we need to pad the scratch buffer with zeros in the last X samples. X can
-       be 0,1,2,3. In fact, X = obj->sizePingBufSamples - obj->cfg.staticCfg.numDopplerChirps)
-       This should be done every time this API is called, for both ping and pong.
-       When this API is called inputBuf[] already has the contents of the radarCube transferred in,
-       therefore only the trully padded samples should be set to zero.
-       Also note that if numDopplerChirps is already a multiple of 4, then no padding should be done.       
-       R4F does not use the padded samples so this is not necessary.*/
-    if(obj->sizePingBufSamples > obj->cfg.staticCfg.numDopplerChirps)
+    cmplx32ImRe_t   acc;
+    cmplx16ImRe_t   clutterVal;
+    uint8_t         alphaShift = obj->cfg.staticCfg.clutterMapCfg.alphaShift;
+
+    if(obj->isClutterMapValid == false)
     {
-        memset((void*)&inputBuf[obj->cfg.staticCfg.numDopplerChirps], 
-               0,
-               (obj->sizePingBufSamples - obj->cfg.staticCfg.numDopplerChirps) * sizeof(cmplx16ImRe_t));
+        /* First frame after configuration: start from the mean of this frame */
+        acc.real = (int32_t)meanVal.real << alphaShift;
+        acc.imag = (int32_t)meanVal.imag << alphaShift;
     }
-    
-    /*Lib requires size to be multiple of 4*/
-    mmwavelib_vecsum((int16_t *) inputBuf,
-                     (int32_t *) sumVal,
-                     (int32_t)   obj->sizePingBufSamples);
-
-    /*Divide by numDopplerChirps as the scratch buffer was padded to zero to make it a 
-      multiple of 4 so it does not affect the average*/    
-    pMeanVal->real = pSumVal->real / obj->cfg.staticCfg.numDopplerChirps ;
-    pMeanVal->imag = pSumVal->imag / obj->cfg.staticCfg.numDopplerChirps ;
-    
-    /*Lib requires size to be multiple of 4*/
-    mmwavelib_vecsubc((int16_t *) inputBuf,
-                      (int16_t *) inputBuf,
-                      (uint32_t)  meanVal,
-                      (int32_t)   obj->sizePingBufSamples);
+    else
+    {
+        acc = *mapEntry;
+        acc.real += (int32_t)meanVal.real - (acc.real >> alphaShift);
+        acc.imag += (int32_t)meanVal.imag - (acc.imag >> alphaShift);
+    }
+    *mapEntry = acc;
+
+    clutterVal.real = (int16_t)(acc.real >> alphaShift);
+    clutterVal.imag = (int16_t)(acc.imag >> alphaShift);
+
+    return clutterVal;
 }
-#endif
 
-#ifdef SUBSYS_MSS
 /**
  *  @b Description
  *  @n
@@ -349,46 +342,26 @@ static inline void DPU_StaticClutterProc_clutterRemoval(DPU_StaticClutterProc_Ob
  *
  *  @param[in]  obj         staticClutterDpu object.
  *  @param[in]  inputBuf    input buffer. Clutter removal algorithm will work on this data.
+ *  @param[in]  mapEntry    clutter map entry of this range bin and virtual antenna,
+ *                          NULL if the clutter map is disabled.
  *
  *  \ingroup    DPU_STATICCLUTTERPROC_INTERNAL_FUNCTION
  *
  *  @retval N/A
  */
-static inline void DPU_StaticClutterProc_clutterRemoval(DPU_StaticClutterProc_Obj *obj, cmplx16ImRe_t *inputBuf)
+static inline void DPU_StaticClutterProc_clutterRemoval(DPU_StaticClutterProc_Obj *obj, cmplx16ImRe_t *inputBuf, cmplx32ImRe_t *mapEntry)
 {
-    uint32_t                  dopIdx;
-    cmplx32ImRe_t             sumVal;
-    cmplx16ImRe_t             meanVal;
-    int32_t                   *a;
-    int32_t                   *b;
-
-    sumVal.real = 0;
-    sumVal.imag = 0;
-    
-    for (dopIdx = 0; dopIdx < obj->cfg.staticCfg.numDopplerChirps; dopIdx++)
-    {
-        sumVal.real += inputBuf[dopIdx].real;
-        sumVal.imag += inputBuf[dopIdx].imag;
-    }
-    
-    meanVal.real = sumVal.real / obj->cfg.staticCfg.numDopplerChirps;
-    meanVal.imag = sumVal.imag / obj->cfg.staticCfg.numDopplerChirps;
-    
-    b = (int32_t*)&meanVal;
-    a = (int32_t*)&inputBuf[0];
-    for (dopIdx = 0; dopIdx < obj->cfg.staticCfg.numDopplerChirps; dopIdx++)
+    cmplx16ImRe_t meanVal;
+
+    meanVal = DPU_StaticClutterProc_kernelMean(&obj->kernelCfg, inputBuf);
+
+    if(mapEntry != NULL)
     {
-        /*Implementing the following subtraction
-          inputBuf[dopIdx].real -= meanVal.real;
-          inputBuf[dopIdx].imag -= meanVal.imag;
-          using intrinsics below. 
-          Note that the intrinsics below also 
-          saturates instead of overflowing.
-        */
-        *a = _qsub16(*(a++),*b);
+        meanVal = DPU_StaticClutterProc_updateClutterMap(obj, mapEntry, meanVal);
     }
+
+    DPU_StaticClutterProc_kernelSubtract(&obj->kernelCfg, inputBuf, meanVal);
 }
-#endif
 
 /**************************************************************************
  *************************** External Functions ****************************
@@ -429,7 +402,11 @@ int32_t DPU_StaticClutterProc_process
     uint32_t                  idx, txAntIdx, firstSampleIdx;
     cmplx16ImRe_t             *radarCubeBase;
     cmplx16ImRe_t             *scratchBase;
+    cmplx32ImRe_t             *mapEntry = NULL;
+    uint32_t                  startTime;
     
+    startTime = Cycleprofiler_getTimeStamp();
+
     if(handle == NULL)
     {
         retVal = DPU_STATICCLUTTERPROC_EINVAL;
@@ -441,6 +418,13 @@ int32_t DPU_StaticClutterProc_process
     radarCubeBase = (cmplx16ImRe_t *)obj->cfg.hwRes.radarCube.data;
     scratchBase   = (cmplx16ImRe_t *)obj->cfg.hwRes.scratchBuf.buf;
 
+    if(obj->cfg.staticCfg.clutterMapCfg.enabled)
+    {
+        /* Map is in the same order as the radar cube without the chirp dimension,
+           so it is walked sequentially across the loops below */
+        mapEntry = obj->cfg.hwRes.clutterMap;
+    }
+
     for(txAntIdx = 0; txAntIdx < obj->cfg.staticCfg.numTxAntennas; txAntIdx++)
     {
         /*Need to set correct EDMA source address for the first transfer
@@ -538,7 +522,12 @@ int32_t DPU_StaticClutterProc_process
            
             /* Execute the clutter removal algorithm*/ 
             DPU_StaticClutterProc_clutterRemoval(obj, 
-                                                 (cmplx16ImRe_t *)&scratchBase[pingPongIdx * obj->sizePingBufSamples]);
+                                                 (cmplx16ImRe_t *)&scratchBase[pingPongIdx * obj->sizePingBufSamples],
+                                                 mapEntry);
+            if(mapEntry != NULL)
+            {
+                mapEntry++;
+            }
    
             /* Move data back to L3*/
             if (pingPongIdx == DPU_STATICCLUTTERPROC_PONG_IDX)
@@ -567,6 +556,14 @@ int32_t DPU_StaticClutterProc_process
         goto exit;
     }
 
+    /* Map now holds the clutter of this frame */
+    obj->isClutterMapValid = true;
+
+    if(outParams != NULL)
+    {
+        outParams->stats.processingTime = Cycleprofiler_getTimeStamp() - startTime;
+    }
+
 exit:    
     return retVal;
 }
@@ -609,10 +606,6 @@ int32_t DPU_StaticClutterProc_config
         retVal = DPU_STATICCLUTTERPROC_ESCRATCHBUF;
         goto exit;
     }
-    
-    /* The size of each scratch buffer (ping and pong - in samples) must be at minimum the
-       smallest multiple of 4 greater or equal to numDopplerChirps.*/
-    obj->sizePingBufSamples = ((cfg->staticCfg.numDopplerChirps + 3) & ~0x0003);    
     #else
     /* Check if scratch buffer has correct alignment*/
     if MEM_IS_NOT_ALIGN(cfg->hwRes.scratchBuf.buf, DPU_STATICCLUTTERPROC_SCRATCHBUFFER_BYTE_ALIGNMENT_R4F)
@@ -620,10 +613,11 @@ int32_t DPU_StaticClutterProc_config
         retVal = DPU_STATICCLUTTERPROC_ESCRATCHBUF;
         goto exit;
     }
-    
+    #endif   
+
     /* The size of each scratch buffer (ping and pong - in samples) must be at least as big as numDopplerChirps*/
     obj->sizePingBufSamples = cfg->staticCfg.numDopplerChirps;    
-    #endif   
+    DPU_StaticClutterProc_kernelInit(&obj->kernelCfg, cfg->staticCfg.numDopplerChirps);
     
     /* Check if scratch buffer is big enough*/
     if(cfg->hwRes.scratchBuf.bufSize < obj->sizePingBufSamples * 2 * sizeof(cmplx16ImRe_t))
@@ -632,9 +626,26 @@ int32_t DPU_StaticClutterProc_config
         goto exit;
     }
     
+    /* Check clutter map */
+    if(cfg->staticCfg.clutterMapCfg.enabled)
+    {
+        if((cfg->hwRes.clutterMap == NULL) ||
+           MEM_IS_NOT_ALIGN(cfg->hwRes.clutterMap, DPU_STATICCLUTTERPROC_CLUTTERMAP_BYTE_ALIGNMENT) ||
+           (cfg->hwRes.clutterMapSize < (uint32_t)cfg->staticCfg.numTxAntennas * cfg->staticCfg.numRxAntennas *
+                                        cfg->staticCfg.numRangeBins * sizeof(cmplx32ImRe_t)) ||
+           (cfg->staticCfg.clutterMapCfg.alphaShift > DPU_STATICCLUTTERPROC_MAX_ALPHA_SHIFT))
+        {
+            retVal = DPU_STATICCLUTTERPROC_ECLUTTERMAP;
+            goto exit;
+        }
+    }
+
     /* Save config parameters */
     memcpy((void *)&obj->cfg, (void *)cfg, sizeof(DPU_StaticClutterProc_Config));
 
+    /* Map contents are stale after a (re)configuration, next frame initializes it */
+    obj->isClutterMapValid = false;
+
     /* Configure EDMAs */
     retVal = DPU_StaticClutterProc_configEdma(obj);
     if(retVal < 0)
@@ -98,6 +98,13 @@ extern "C" {
  */
 #define DPU_STATICCLUTTERPROC_ESCRATCHBUF   (DP_ERRNO_STATIC_CLUTTER_PROC_BASE-3)
 
+/**
+ * @brief   Error Code: Clutter map buffer is missing, has incorrect size or incorrect alignment,
+ *          or invalid @ref DPU_StaticClutterProc_ClutterMapCfg_t::alphaShift
+ *  \ingroup DPU_STATICCLUTTERPROC_ERROR_CODE
+ */
+#define DPU_STATICCLUTTERPROC_ECLUTTERMAP   (DP_ERRNO_STATIC_CLUTTER_PROC_BASE-4)
+
 /**
  * @brief   Required alignment for scratch buffer provided by application
  *          (if DPU is running on DSP (C674X))
@@ -110,6 +117,16 @@ extern "C" {
  */
 #define DPU_STATICCLUTTERPROC_SCRATCHBUFFER_BYTE_ALIGNMENT_R4F  4
 
+/**
+ * @brief   Required alignment for the clutter map provided by application
+ */
+#define DPU_STATICCLUTTERPROC_CLUTTERMAP_BYTE_ALIGNMENT  8
+
+/**
+ * @brief   Maximum value of @ref DPU_StaticClutterProc_ClutterMapCfg_t::alphaShift
+ */
+#define DPU_STATICCLUTTERPROC_MAX_ALPHA_SHIFT  15
+
 /*!
  *  @brief   Handle for static clutter DPU.
  */
@@ -151,10 +168,7 @@ typedef struct DPU_StaticClutterProc_ScratchBuf_t
 {
     /*! @brief  Scratch buffer size in bytes.\n
         Size must be at least:\n
-        Y*2*sizeof(cmplx16ImRe_t)\n
-        Where:\n
-        For R4F: Y is equal to numDopplerChirps\n
-        For DSP (C674X): Y is the smallest multiple of 4 greater or equal to numDopplerChirps\n
+        numDopplerChirps*2*sizeof(cmplx16ImRe_t)\n
     */
     uint32_t                bufSize;
 
@@ -193,9 +207,46 @@ typedef struct DPU_StaticClutterProc_HW_Resources_t
     
     /*! @brief  Scratch buffer */
     DPU_StaticClutterProc_ScratchBuf scratchBuf;
+
+    /*! @brief  Clutter map, one element per range bin and virtual antenna, in the order
+        [numTxAntennas][numRxAntennas][numRangeBins]. Only needed if
+        @ref DPU_StaticClutterProc_ClutterMapCfg_t::enabled is set. The map persists across
+        frames and is expected in L3 next to the radar cube.\n
+        Byte alignment Requirement = @ref DPU_STATICCLUTTERPROC_CLUTTERMAP_BYTE_ALIGNMENT */
+    cmplx32ImRe_t *clutterMap;
+
+    /*! @brief  Clutter map size in bytes, at least
+        numTxAntennas * numRxAntennas * numRangeBins * sizeof(cmplx32ImRe_t) */
+    uint32_t    clutterMapSize;
 }DPU_StaticClutterProc_HW_Resources;
 
 
+/**
+ * @brief
+ *  Clutter map configuration
+ *
+ * @details
+ *  When enabled, the clutter of each range bin and virtual antenna is tracked across
+ *  frames with a first order IIR filter on the per-frame mean,
+ *  clutter += (mean - clutter) / 2^alphaShift,
+ *  and the clutter, rather than the mean of the current frame, is subtracted from the
+ *  samples. Targets that move too little within one frame to leave the zero Doppler
+ *  bin, such as people sitting still, are then only removed if they stay in place for
+ *  about 2^alphaShift frames. The map is initialized with the mean of the first frame
+ *  after @ref DPU_StaticClutterProc_config.
+ *
+ *  \ingroup DPU_STATICCLUTTERPROC_EXTERNAL_DATA_STRUCTURE
+ */
+typedef struct DPU_StaticClutterProc_ClutterMapCfg_t
+{
+    /*! @brief  1-enabled 0-disabled (the mean of the current frame is subtracted) */
+    uint8_t     enabled;
+
+    /*! @brief  IIR coefficient alpha = 1/2^alphaShift, 0 to
+                @ref DPU_STATICCLUTTERPROC_MAX_ALPHA_SHIFT */
+    uint8_t     alphaShift;
+}DPU_StaticClutterProc_ClutterMapCfg;
+
 /**
  * @brief
  *  Doppler DPU static configuration parameters
@@ -222,6 +273,9 @@ typedef struct DPU_StaticClutterProc_StaticConfig_t
     
     /*! @brief  Number of Doppler chirps. */
     uint16_t    numDopplerChirps;
+
+    /*! @brief  Clutter map configuration */
+    DPU_StaticClutterProc_ClutterMapCfg clutterMapCfg;
     
 }DPU_StaticClutterProc_StaticConfig;
 
@@ -256,7 +310,7 @@ typedef struct DPU_StaticClutterProc_Config_t
  */
 typedef struct DPU_StaticClutterProc_Stats_t
 {
-    /*! @brief total processing time for one execution of the DPU*/
+    /*! @brief total processing time for one execution of the DPU, in CPU cycles*/
     uint32_t   processingTime;
 }DPU_StaticClutterProc_Stats;
 
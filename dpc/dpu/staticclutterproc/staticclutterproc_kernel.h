@@ -0,0 +1,445 @@
+/**
+ *   @file  staticclutterproc_kernel.h
+ *
+ *   @brief
+ *      Static clutter removal kernel shared by the DPUs that remove static clutter
+ *      (static clutter DPU, DSP and HWA Doppler DPUs and DSP AoA DPU).
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**************************************************************************
+ *************************** Include Files ********************************
+ **************************************************************************/
+#ifndef DPU_STATICCLUTTERPROC_KERNEL_H
+#define DPU_STATICCLUTTERPROC_KERNEL_H
+
+#include <stdint.h>
+#include <ti/common/sys_common.h>
+#include <ti/utils/mathutils/mathutils.h>
+
+/**
+@defgroup DPU_STATICCLUTTERPROC_KERNEL                      staticclutterproc Kernel
+@ingroup STATICCLUTTER_PROC_DPU_EXTERNAL
+@brief
+*   Mean computation and subtraction over the chirps of one virtual antenna. The
+*   kernel takes any number of samples (no padding to a multiple of 4 needed),
+*   has no buffer alignment requirement and replaces the integer divide by the
+*   number of chirps with a reciprocal multiply, bit-exact with the divide.
+*   On DSP (C674X) samples are processed four at a time using non-aligned double
+*   word accesses, the 0 to 3 remaining samples are processed one at a time.
+*   Strided variants work on samples interleaved with other antennas, in place.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  @brief   Maximum number of samples for which the reciprocal multiply is bit-exact
+ *           with the integer divide.
+ *
+ *  \ingroup DPU_STATICCLUTTERPROC_KERNEL
+ */
+#define DPU_STATICCLUTTERPROC_KERNEL_MAX_NUM_SAMPLES  65536U
+
+/**
+ * @brief
+ *  Kernel configuration, computed once by @ref DPU_StaticClutterProc_kernelInit
+ *  for a given number of samples.
+ *
+ *  \ingroup DPU_STATICCLUTTERPROC_KERNEL
+ */
+typedef struct DPU_StaticClutterProc_KernelCfg_t
+{
+    /*! @brief  Number of samples (chirps) per virtual antenna */
+    uint32_t    numSamples;
+
+    /*! @brief  Reciprocal of numSamples, ceil(2^shift / numSamples) */
+    uint32_t    invNumSamples;
+
+    /*! @brief  Right shift applied after multiplying by invNumSamples */
+    uint8_t     shift;
+} DPU_StaticClutterProc_KernelCfg;
+
+/**
+ *  @b Description
+ *  @n
+ *      Computes the reciprocal of the number of samples. With shift = 31 + ceil(log2(numSamples))
+ *      the reciprocal fits in 32 bits and, since the magnitude of a sum of numSamples 16-bit
+ *      samples is below 2^shift / numSamples, the quotient is exact.
+ *
+ *  @param[out] cfg         Kernel configuration
+ *  @param[in]  numSamples  Number of samples, 1 to @ref DPU_STATICCLUTTERPROC_KERNEL_MAX_NUM_SAMPLES
+ *
+ *  \ingroup    DPU_STATICCLUTTERPROC_KERNEL
+ *
+ *  @retval N/A
+ */
+static inline void DPU_StaticClutterProc_kernelInit
+(
+    DPU_StaticClutterProc_KernelCfg *cfg,
+    uint32_t                        numSamples
+)
+{
+    uint32_t log2NumSamples = 0;
+
+    while ((1U << log2NumSamples) < numSamples)
+    {
+        log2NumSamples++;
+    }
+
+    cfg->numSamples    = numSamples;
+    cfg->shift         = (uint8_t)(31U + log2NumSamples);
+    cfg->invNumSamples = (uint32_t)((((uint64_t)1U << cfg->shift) + numSamples - 1U) / numSamples);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Divides by the number of samples using the reciprocal, truncating toward zero
+ *      as the integer divide does.
+ *
+ *  @param[in]  cfg     Kernel configuration
+ *  @param[in]  val     Dividend, sum of numSamples 16-bit samples
+ *
+ *  \ingroup    DPU_STATICCLUTTERPROC_KERNEL
+ *
+ *  @retval val / numSamples
+ */
+static inline int32_t DPU_StaticClutterProc_kernelDivide
+(
+    const DPU_StaticClutterProc_KernelCfg   *cfg,
+    int32_t                                 val
+)
+{
+    uint32_t absVal = (val < 0) ? (uint32_t)(-val) : (uint32_t)val;
+    int32_t  quotient;
+
+    quotient = (int32_t)(((uint64_t)absVal * cfg->invNumSamples) >> cfg->shift);
+
+    return (val < 0) ? -quotient : quotient;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Sums the samples of one virtual antenna.
+ *
+ *  @param[in]  cfg         Kernel configuration
+ *  @param[in]  inputBuf    Input samples
+ *
+ *  \ingroup    DPU_STATICCLUTTERPROC_KERNEL
+ *
+ *  @retval Sum of the samples
+ */
+static inline cmplx32ImRe_t DPU_StaticClutterProc_kernelSum
+(
+    const DPU_StaticClutterProc_KernelCfg   *cfg,
+    const cmplx16ImRe_t                     *inputBuf
+)
+{
+    cmplx32ImRe_t   sumVal;
+    uint32_t        idx;
+#ifdef SUBSYS_DSS
+    const uint32_t  *inPtr = (const uint32_t *)inputBuf;
+    int64_t         samples01, samples23;
+    int32_t         sumReal = 0, sumImag = 0;
+
+    /* real is the upper and imag the lower 16 bits of each sample */
+    for (idx = 0; idx < (cfg->numSamples & ~3U); idx += 4)
+    {
+        samples01 = _mem8_const(&inPtr[idx]);
+        samples23 = _mem8_const(&inPtr[idx + 2]);
+        sumReal  += _dotp2(_loll(samples01), 0x00010000) + _dotp2(_hill(samples01), 0x00010000) +
+                    _dotp2(_loll(samples23), 0x00010000) + _dotp2(_hill(samples23), 0x00010000);
+        sumImag  += _dotp2(_loll(samples01), 0x00000001) + _dotp2(_hill(samples01), 0x00000001) +
+                    _dotp2(_loll(samples23), 0x00000001) + _dotp2(_hill(samples23), 0x00000001);
+    }
+    for (; idx < cfg->numSamples; idx++)
+    {
+        sumReal += _dotp2(inPtr[idx], 0x00010000);
+        sumImag += _dotp2(inPtr[idx], 0x00000001);
+    }
+    sumVal.real = sumReal;
+    sumVal.imag = sumImag;
+#else
+    sumVal.real = 0;
+    sumVal.imag = 0;
+    for (idx = 0; idx < cfg->numSamples; idx++)
+    {
+        sumVal.real += inputBuf[idx].real;
+        sumVal.imag += inputBuf[idx].imag;
+    }
+#endif
+    return sumVal;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Computes the mean of the samples of one virtual antenna.
+ *
+ *  @param[in]  cfg         Kernel configuration
+ *  @param[in]  inputBuf    Input samples
+ *
+ *  \ingroup    DPU_STATICCLUTTERPROC_KERNEL
+ *
+ *  @retval Mean of the samples, truncated toward zero
+ */
+static inline cmplx16ImRe_t DPU_StaticClutterProc_kernelMean
+(
+    const DPU_StaticClutterProc_KernelCfg   *cfg,
+    const cmplx16ImRe_t                     *inputBuf
+)
+{
+    cmplx32ImRe_t   sumVal;
+    cmplx16ImRe_t   meanVal;
+
+    sumVal = DPU_StaticClutterProc_kernelSum(cfg, inputBuf);
+    meanVal.real = (int16_t)DPU_StaticClutterProc_kernelDivide(cfg, sumVal.real);
+    meanVal.imag = (int16_t)DPU_StaticClutterProc_kernelDivide(cfg, sumVal.imag);
+
+    return meanVal;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Subtracts a value from the samples of one virtual antenna, in place, with saturation.
+ *
+ *  @param[in]      cfg         Kernel configuration
+ *  @param[in,out]  inputBuf    Samples
+ *  @param[in]      val         Value to subtract
+ *
+ *  \ingroup    DPU_STATICCLUTTERPROC_KERNEL
+ *
+ *  @retval N/A
+ */
+static inline void DPU_StaticClutterProc_kernelSubtract
+(
+    const DPU_StaticClutterProc_KernelCfg   *cfg,
+    cmplx16ImRe_t                           *inputBuf,
+    cmplx16ImRe_t                           val
+)
+{
+    uint32_t        idx;
+#ifdef SUBSYS_DSS
+    uint32_t        *inPtr = (uint32_t *)inputBuf;
+    uint32_t        subVal = _amem4(&val);
+    int64_t         samples01, samples23;
+
+    for (idx = 0; idx < (cfg->numSamples & ~3U); idx += 4)
+    {
+        samples01 = _mem8(&inPtr[idx]);
+        samples23 = _mem8(&inPtr[idx + 2]);
+        _mem8(&inPtr[idx])     = _itoll(_ssub2(_hill(samples01), subVal), _ssub2(_loll(samples01), subVal));
+        _mem8(&inPtr[idx + 2]) = _itoll(_ssub2(_hill(samples23), subVal), _ssub2(_loll(samples23), subVal));
+    }
+    for (; idx < cfg->numSamples; idx++)
+    {
+        inPtr[idx] = _ssub2(inPtr[idx], subVal);
+    }
+#elif defined(SUBSYS_MSS)
+    int32_t         *inPtr = (int32_t *)inputBuf;
+    int32_t         subVal = *(int32_t *)&val;
+
+    for (idx = 0; idx < cfg->numSamples; idx++)
+    {
+        inPtr[idx] = _qsub16(inPtr[idx], subVal);
+    }
+#else
+    int32_t         temp;
+
+    for (idx = 0; idx < cfg->numSamples; idx++)
+    {
+        temp = (int32_t)inputBuf[idx].real - val.real;
+        MATHUTILS_SATURATE16(temp);
+        inputBuf[idx].real = (int16_t)temp;
+
+        temp = (int32_t)inputBuf[idx].imag - val.imag;
+        MATHUTILS_SATURATE16(temp);
+        inputBuf[idx].imag = (int16_t)temp;
+    }
+#endif
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Removes static clutter from the samples of one virtual antenna: subtracts, in place,
+ *      the mean of the samples.
+ *
+ *  @param[in]      cfg         Kernel configuration
+ *  @param[in,out]  inputBuf    Samples
+ *
+ *  \ingroup    DPU_STATICCLUTTERPROC_KERNEL
+ *
+ *  @retval N/A
+ */
+static inline void DPU_StaticClutterProc_kernelRemoveMean
+(
+    const DPU_StaticClutterProc_KernelCfg   *cfg,
+    cmplx16ImRe_t                           *inputBuf
+)
+{
+    DPU_StaticClutterProc_kernelSubtract(cfg, inputBuf, DPU_StaticClutterProc_kernelMean(cfg, inputBuf));
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Sums the samples of one virtual antenna spread with a constant stride, such as
+ *      one receive antenna of a radar cube column where the antennas are interleaved.
+ *
+ *  @param[in]  cfg         Kernel configuration
+ *  @param[in]  inputBuf    First sample
+ *  @param[in]  stride      Distance between two samples, in samples
+ *
+ *  \ingroup    DPU_STATICCLUTTERPROC_KERNEL
+ *
+ *  @retval Sum of the samples
+ */
+static inline cmplx32ImRe_t DPU_StaticClutterProc_kernelSumStrided
+(
+    const DPU_StaticClutterProc_KernelCfg   *cfg,
+    const cmplx16ImRe_t                     *inputBuf,
+    uint32_t                                stride
+)
+{
+    cmplx32ImRe_t   sumVal;
+    uint32_t        idx;
+
+    sumVal.real = 0;
+    sumVal.imag = 0;
+    for (idx = 0; idx < cfg->numSamples; idx++)
+    {
+        sumVal.real += inputBuf[idx * stride].real;
+        sumVal.imag += inputBuf[idx * stride].imag;
+    }
+    return sumVal;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Subtracts a value from the samples of one virtual antenna spread with a constant
+ *      stride, in place, with saturation.
+ *
+ *  @param[in]      cfg         Kernel configuration
+ *  @param[in,out]  inputBuf    First sample
+ *  @param[in]      val         Value to subtract
+ *  @param[in]      stride      Distance between two samples, in samples
+ *
+ *  \ingroup    DPU_STATICCLUTTERPROC_KERNEL
+ *
+ *  @retval N/A
+ */
+static inline void DPU_StaticClutterProc_kernelSubtractStrided
+(
+    const DPU_StaticClutterProc_KernelCfg   *cfg,
+    cmplx16ImRe_t                           *inputBuf,
+    cmplx16ImRe_t                           val,
+    uint32_t                                stride
+)
+{
+    uint32_t        idx;
+#ifdef SUBSYS_DSS
+    uint32_t        *inPtr = (uint32_t *)inputBuf;
+    uint32_t        subVal = _amem4(&val);
+
+    for (idx = 0; idx < cfg->numSamples; idx++)
+    {
+        inPtr[idx * stride] = _ssub2(inPtr[idx * stride], subVal);
+    }
+#elif defined(SUBSYS_MSS)
+    int32_t         *inPtr = (int32_t *)inputBuf;
+    int32_t         subVal = *(int32_t *)&val;
+
+    for (idx = 0; idx < cfg->numSamples; idx++)
+    {
+        inPtr[idx * stride] = _qsub16(inPtr[idx * stride], subVal);
+    }
+#else
+    int32_t         temp;
+
+    for (idx = 0; idx < cfg->numSamples; idx++)
+    {
+        temp = (int32_t)inputBuf[idx * stride].real - val.real;
+        MATHUTILS_SATURATE16(temp);
+        inputBuf[idx * stride].real = (int16_t)temp;
+
+        temp = (int32_t)inputBuf[idx * stride].imag - val.imag;
+        MATHUTILS_SATURATE16(temp);
+        inputBuf[idx * stride].imag = (int16_t)temp;
+    }
+#endif
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Removes static clutter from the samples of one virtual antenna spread with a
+ *      constant stride: subtracts, in place, the mean of the samples. Gives the same
+ *      result as @ref DPU_StaticClutterProc_kernelRemoveMean on the gathered samples.
+ *
+ *  @param[in]      cfg         Kernel configuration
+ *  @param[in,out]  inputBuf    First sample
+ *  @param[in]      stride      Distance between two samples, in samples
+ *
+ *  \ingroup    DPU_STATICCLUTTERPROC_KERNEL
+ *
+ *  @retval N/A
+ */
+static inline void DPU_StaticClutterProc_kernelRemoveMeanStrided
+(
+    const DPU_StaticClutterProc_KernelCfg   *cfg,
+    cmplx16ImRe_t                           *inputBuf,
+    uint32_t                                stride
+)
+{
+    cmplx32ImRe_t   sumVal;
+    cmplx16ImRe_t   meanVal;
+
+    sumVal = DPU_StaticClutterProc_kernelSumStrided(cfg, inputBuf, stride);
+    meanVal.real = (int16_t)DPU_StaticClutterProc_kernelDivide(cfg, sumVal.real);
+    meanVal.imag = (int16_t)DPU_StaticClutterProc_kernelDivide(cfg, sumVal.imag);
+
+    DPU_StaticClutterProc_kernelSubtractStrided(cfg, inputBuf, meanVal, stride);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
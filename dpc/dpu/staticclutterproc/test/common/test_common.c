@@ -71,6 +71,7 @@
 
 
 #include <ti/datapath/dpc/dpu/staticclutterproc/staticclutterproc.h>
+#include <ti/datapath/dpc/dpu/staticclutterproc/staticclutterproc_kernel.h>
 
 #include "test_common.h"
 
@@ -86,6 +87,16 @@
  *  clutter removal and M/2 bytes is used for the DPU static clutter removal implementation.
  *  For each scenario the algorithm output is compared and must be bit-exact, otherwise failure 
  *  is declared.
+ *
+ *  The clutter map is tested with a sequence of frames holding static clutter and a slowly
+ *  moving target. The DPU output is compared bit-exact against a reference IIR clutter map
+ *  in every frame, and the target energy that survives clutter removal is compared between
+ *  the clutter map and the mean of the current frame.
+ *
+ *  The clutter removal kernel shared with the Doppler and AoA DPUs is tested directly
+ *  for every number of samples up to @ref TEST_KERNEL_MAX_NUM_SAMPLES, with aligned and
+ *  non-aligned buffers, against the reference integer divide and saturated subtraction.
+ *  Its cycles are benchmarked against the reference for a few chirp counts.
  */
 
 
@@ -95,6 +106,18 @@
  */
 MCPI_LOGBUF_INIT(9216);
 
+/* Clutter map test parameters */
+#define TEST_CLUTTER_MAP_NUM_FRAMES         40
+#define TEST_CLUTTER_MAP_ALPHA_SHIFT        3
+#define TEST_CLUTTER_MAP_SETTLE_FRAMES      8
+#define TEST_CLUTTER_MAP_TARGET_FIRST_BIN   20
+#define TEST_CLUTTER_MAP_FRAMES_PER_BIN     8
+#define TEST_CLUTTER_MAP_TARGET_AMPLITUDE   2000.f
+#define TEST_CLUTTER_MAP_MIN_ENERGY_GAIN    4.f
+
+#define TEST_KERNEL_MAX_NUM_SAMPLES         300
+#define TEST_KERNEL_NUM_BENCHMARKS          4
+
 void Test_fillRadarCube(uint8_t* radarCubeRefPtr, uint8_t* radarCubeTestPtr, uint32_t radarCubeSizeInBytes)
 {
     uint32_t i;
@@ -169,6 +192,336 @@ void Test_referenceClutterAlgorithm(uint8_t* radarCubeRefPtr, testConfiguration*
     }
 }
 
+/* Computes reference static clutter removal algorithm with a clutter map across frames.
+   Same integer arithmetic as the DPU so that the results are bit-exact.*/
+void Test_referenceClutterMapAlgorithm(uint8_t* radarCubeRefPtr, testConfiguration* testCfg,
+                                       cmplx32ImRe_t *clutterMap, uint8_t alphaShift, uint8_t isMapValid)
+{
+    int32_t txIdx, adx, dopIdx;
+    cmplx16ImRe_t *inPtr = (cmplx16ImRe_t *) radarCubeRefPtr;
+    cmplx32ImRe_t meanVal;
+    cmplx32ImRe_t *acc;
+    int16_t clutterReal, clutterImag;
+    uint32_t midx;
+    
+    for (txIdx = 0; txIdx < testCfg->numTxAnt; txIdx++)
+    {
+        for (adx = 0; adx < testCfg->numRxAnt*testCfg->numRanBin; adx++)
+        {
+                meanVal.real = 0;
+                meanVal.imag = 0;
+                for (dopIdx = 0; dopIdx < testCfg->numDopChirps; dopIdx++)
+                {
+                    midx = txIdx*testCfg->numDopChirps*testCfg->numRanBin*testCfg->numRxAnt + 
+                           adx + dopIdx*testCfg->numRanBin*testCfg->numRxAnt;                        
+                    meanVal.real += inPtr[midx].real;
+                    meanVal.imag += inPtr[midx].imag;
+                }
+                
+                meanVal.real = (int16_t)(meanVal.real/testCfg->numDopChirps);
+                meanVal.imag = (int16_t)(meanVal.imag/testCfg->numDopChirps);
+
+                /* IIR update of the map */
+                acc = &clutterMap[txIdx*testCfg->numRxAnt*testCfg->numRanBin + adx];
+                if(isMapValid == 0)
+                {
+                    acc->real = meanVal.real * (1 << alphaShift);
+                    acc->imag = meanVal.imag * (1 << alphaShift);
+                }
+                else
+                {
+                    acc->real += meanVal.real - (acc->real >> alphaShift);
+                    acc->imag += meanVal.imag - (acc->imag >> alphaShift);
+                }
+                clutterReal = (int16_t)(acc->real >> alphaShift);
+                clutterImag = (int16_t)(acc->imag >> alphaShift);
+                
+                /* subtraction */                
+                for (dopIdx = 0; dopIdx < testCfg->numDopChirps; dopIdx++)
+                {
+                    midx = txIdx*testCfg->numDopChirps*testCfg->numRanBin*testCfg->numRxAnt + 
+                           adx + dopIdx*testCfg->numRanBin*testCfg->numRxAnt;                        
+                    inPtr[midx].real = Test_saturateSubtract(inPtr[midx].real, clutterReal);
+                    inPtr[midx].imag = Test_saturateSubtract(inPtr[midx].imag, clutterImag);
+                }
+        }
+    }
+}
+
+/* Fills one frame of the clutter map test: static clutter in every range bin plus a target
+   that barely moves within the frame (close to zero Doppler) and slowly drifts in range
+   across frames.*/
+void Test_fillClutterMapFrame(uint8_t* radarCubePtr, testConfiguration* testCfg, uint32_t frameIdx,
+                              uint16_t targetRangeBin)
+{
+    int32_t rxIdx, rangeIdx, dopIdx;
+    cmplx16ImRe_t *cube = (cmplx16ImRe_t *) radarCubePtr;
+    uint32_t midx;
+    float phase;
+    
+    for (dopIdx = 0; dopIdx < testCfg->numDopChirps; dopIdx++)
+    {
+        for (rxIdx = 0; rxIdx < testCfg->numRxAnt; rxIdx++)
+        {
+            for (rangeIdx = 0; rangeIdx < testCfg->numRanBin; rangeIdx++)
+            {
+                midx = dopIdx*testCfg->numRanBin*testCfg->numRxAnt + rxIdx*testCfg->numRanBin + rangeIdx;
+                
+                /* Static clutter, different in every bin, identical in every frame */
+                cube[midx].real = (int16_t)(((rangeIdx * 37 + rxIdx * 101) % 401) * 8 - 1600);
+                cube[midx].imag = (int16_t)(((rangeIdx * 53 + rxIdx * 29) % 397) * 8 - 1588);
+                
+                if(rangeIdx == targetRangeBin)
+                {
+                    /* Sub-wavelength motion: phase changes by 0.7 rad per frame but
+                       only by 0.01 rad per chirp */
+                    phase = 0.7f * frameIdx + 0.01f * dopIdx + 0.5f * rxIdx;
+                    cube[midx].real += (int16_t)(TEST_CLUTTER_MAP_TARGET_AMPLITUDE * cosf(phase));
+                    cube[midx].imag += (int16_t)(TEST_CLUTTER_MAP_TARGET_AMPLITUDE * sinf(phase));
+                }
+            }
+        }
+    }
+}
+
+/* Energy left in one range bin of the cube after clutter removal*/
+float Test_rangeBinEnergy(uint8_t* radarCubePtr, testConfiguration* testCfg, uint16_t rangeBin)
+{
+    int32_t rxIdx, dopIdx;
+    cmplx16ImRe_t *cube = (cmplx16ImRe_t *) radarCubePtr;
+    uint32_t midx;
+    float energy = 0.f;
+    
+    for (dopIdx = 0; dopIdx < testCfg->numDopChirps; dopIdx++)
+    {
+        for (rxIdx = 0; rxIdx < testCfg->numRxAnt; rxIdx++)
+        {
+            midx = dopIdx*testCfg->numRanBin*testCfg->numRxAnt + rxIdx*testCfg->numRanBin + rangeBin;
+            energy += (float)cube[midx].real * cube[midx].real + (float)cube[midx].imag * cube[midx].imag;
+        }
+    }
+    return energy;
+}
+
+/* Clutter map test over a sequence of frames. Returns 0 if passed.*/
+int32_t Test_clutterMap
+(
+    DPU_StaticClutterProc_Handle   staticClutterHandle,
+    DPU_StaticClutterProc_Config   *cfgParams,
+    uint8_t                        *radarCubeRefPtr,
+    uint8_t                        *radarCubeTestPtr,
+    uint32_t                       radarCubeSizeInBytes
+)
+{
+    testConfiguration               testCfg;
+    DPU_StaticClutterProc_OutParams outParams;
+    cmplx32ImRe_t                   *refMap, *dpuMap;
+    uint32_t                        cubeSize, mapSize;
+    uint32_t                        frameIdx;
+    uint32_t                        cyclesNoMap, cyclesMap = 0;
+    uint16_t                        targetRangeBin;
+    float                           energyMean = 0.f, energyMap = 0.f;
+    int32_t                         errCode;
+    int32_t                         retVal = 0;
+
+    testCfg.numTxAnt     = 1;
+    testCfg.numRxAnt     = 4;
+    testCfg.numDopChirps = 32;
+    testCfg.numRanBin    = 64;
+
+    cubeSize = sizeof(cmplx16ImRe_t)*testCfg.numTxAnt*testCfg.numRxAnt*testCfg.numDopChirps*testCfg.numRanBin;
+    mapSize  = sizeof(cmplx32ImRe_t)*testCfg.numTxAnt*testCfg.numRxAnt*testCfg.numRanBin;
+
+    printf("\nClutter map test: %d frames, alphaShift %d\n", TEST_CLUTTER_MAP_NUM_FRAMES, TEST_CLUTTER_MAP_ALPHA_SHIFT);
+
+    /* Both maps are placed after the cube in the reference half of L3 */
+    if(cubeSize + 2 * mapSize > radarCubeSizeInBytes)
+    {
+        printf("Clutter map test failed because radarCubeSizeInBytes is not big enough.\n");
+        return MINUS_ONE;
+    }
+    refMap = (cmplx32ImRe_t *)&radarCubeRefPtr[cubeSize];
+    dpuMap = (cmplx32ImRe_t *)&radarCubeRefPtr[cubeSize + mapSize];
+
+    cfgParams->staticCfg.numTxAntennas    = testCfg.numTxAnt;
+    cfgParams->staticCfg.numRxAntennas    = testCfg.numRxAnt;
+    cfgParams->staticCfg.numRangeBins     = testCfg.numRanBin;
+    cfgParams->staticCfg.numDopplerChirps = testCfg.numDopChirps;
+    cfgParams->hwRes.clutterMap           = dpuMap;
+    cfgParams->hwRes.clutterMapSize       = mapSize;
+
+    /* Baseline: one frame without the clutter map */
+    cfgParams->staticCfg.clutterMapCfg.enabled = 0;
+    errCode = DPU_StaticClutterProc_config(staticClutterHandle, cfgParams);
+    if(errCode != 0)
+    {
+        printf("staticClutter DPU failed to configure. Error %d.\n",errCode);
+        return errCode;
+    }
+    Test_fillClutterMapFrame(radarCubeTestPtr, &testCfg, 0, TEST_CLUTTER_MAP_TARGET_FIRST_BIN);
+    errCode = DPU_StaticClutterProc_process(staticClutterHandle, &outParams);
+    if(errCode != 0)
+    {
+        printf("staticClutter DPU failed to run. Error %d.\n",errCode);
+        return errCode;
+    }
+    cyclesNoMap = outParams.stats.processingTime;
+
+    /* Frame sequence with the clutter map */
+    cfgParams->staticCfg.clutterMapCfg.enabled    = 1;
+    cfgParams->staticCfg.clutterMapCfg.alphaShift = TEST_CLUTTER_MAP_ALPHA_SHIFT;
+    errCode = DPU_StaticClutterProc_config(staticClutterHandle, cfgParams);
+    if(errCode != 0)
+    {
+        printf("staticClutter DPU failed to configure. Error %d.\n",errCode);
+        return errCode;
+    }
+
+    for(frameIdx = 0; frameIdx < TEST_CLUTTER_MAP_NUM_FRAMES; frameIdx++)
+    {
+        targetRangeBin = TEST_CLUTTER_MAP_TARGET_FIRST_BIN + frameIdx / TEST_CLUTTER_MAP_FRAMES_PER_BIN;
+
+        /* Target energy left by removing the mean of the current frame */
+        Test_fillClutterMapFrame(radarCubeRefPtr, &testCfg, frameIdx, targetRangeBin);
+        Test_referenceClutterAlgorithm(radarCubeRefPtr, &testCfg);
+        if(frameIdx >= TEST_CLUTTER_MAP_SETTLE_FRAMES)
+        {
+            energyMean += Test_rangeBinEnergy(radarCubeRefPtr, &testCfg, targetRangeBin);
+        }
+
+        /* Reference and DPU with the clutter map */
+        Test_fillClutterMapFrame(radarCubeRefPtr, &testCfg, frameIdx, targetRangeBin);
+        Test_fillClutterMapFrame(radarCubeTestPtr, &testCfg, frameIdx, targetRangeBin);
+        Test_referenceClutterMapAlgorithm(radarCubeRefPtr, &testCfg, refMap,
+                                          TEST_CLUTTER_MAP_ALPHA_SHIFT, (frameIdx > 0));
+
+        errCode = DPU_StaticClutterProc_process(staticClutterHandle, &outParams);
+        if(errCode != 0)
+        {
+            printf("staticClutter DPU failed to run. Error %d.\n",errCode);
+            return errCode;
+        }
+        cyclesMap += outParams.stats.processingTime;
+
+        if((Test_verifyResult(radarCubeRefPtr, radarCubeTestPtr, cubeSize) != 0) ||
+           (memcmp((void *)refMap, (void *)dpuMap, mapSize) != 0))
+        {
+            printf("Clutter map mismatch in frame %d\n", frameIdx);
+            retVal = MINUS_ONE;
+        }
+
+        if(frameIdx >= TEST_CLUTTER_MAP_SETTLE_FRAMES)
+        {
+            energyMap += Test_rangeBinEnergy(radarCubeRefPtr, &testCfg, targetRangeBin);
+        }
+    }
+
+    printf("DPU cycles per frame: without clutter map %d, with clutter map %d\n",
+           cyclesNoMap, cyclesMap / TEST_CLUTTER_MAP_NUM_FRAMES);
+    printf("Target energy retained: frame mean %.3e, clutter map %.3e\n", energyMean, energyMap);
+
+    /* The near static target must survive the clutter map */
+    if(energyMap < TEST_CLUTTER_MAP_MIN_ENERGY_GAIN * energyMean)
+    {
+        printf("Clutter map did not retain the slowly moving target\n");
+        retVal = MINUS_ONE;
+    }
+
+    /* Leave the map disabled for any following test */
+    cfgParams->staticCfg.clutterMapCfg.enabled = 0;
+
+    return retVal;
+}
+
+/* Reference clutter removal of one virtual antenna, integer divide and saturated subtraction*/
+void Test_referenceClutterKernel(cmplx16ImRe_t *buf, uint32_t numSamples)
+{
+    uint32_t idx;
+    cmplx32ImRe_t meanVal;
+
+    meanVal.real = 0;
+    meanVal.imag = 0;
+    for (idx = 0; idx < numSamples; idx++)
+    {
+        meanVal.real += buf[idx].real;
+        meanVal.imag += buf[idx].imag;
+    }
+    meanVal.real = meanVal.real/(int32_t)numSamples;
+    meanVal.imag = meanVal.imag/(int32_t)numSamples;
+
+    for (idx = 0; idx < numSamples; idx++)
+    {
+        buf[idx].real = Test_saturateSubtract(buf[idx].real, meanVal.real);
+        buf[idx].imag = Test_saturateSubtract(buf[idx].imag, meanVal.imag);
+    }
+}
+
+/* Clutter removal kernel test and benchmark. Returns 0 if passed.*/
+int32_t Test_clutterKernel(uint8_t *radarCubeRefPtr, uint8_t *radarCubeTestPtr, uint32_t radarCubeSizeInBytes)
+{
+    DPU_StaticClutterProc_KernelCfg kernelCfg;
+    cmplx16ImRe_t   *refBuf = (cmplx16ImRe_t *)radarCubeRefPtr;
+    cmplx16ImRe_t   *testBuf;
+    uint32_t        numSamples, offset, idx;
+    uint32_t        benchSamples[TEST_KERNEL_NUM_BENCHMARKS] = {37, 64, 130, 256};
+    uint32_t        startTime, benchRef, benchKernel;
+    int32_t         retVal = 0;
+
+    printf("\nClutter kernel test: 1 to %d samples\n", TEST_KERNEL_MAX_NUM_SAMPLES);
+
+    if((TEST_KERNEL_MAX_NUM_SAMPLES + 1) * sizeof(cmplx16ImRe_t) > radarCubeSizeInBytes)
+    {
+        printf("Clutter kernel test failed because radarCubeSizeInBytes is not big enough.\n");
+        return MINUS_ONE;
+    }
+
+    for (numSamples = 1; numSamples <= TEST_KERNEL_MAX_NUM_SAMPLES; numSamples++)
+    {
+        DPU_StaticClutterProc_kernelInit(&kernelCfg, numSamples);
+
+        /* offset 1 sample so that the double word accesses are not aligned*/
+        for (offset = 0; offset < 2; offset++)
+        {
+            testBuf = &((cmplx16ImRe_t *)radarCubeTestPtr)[offset];
+            Test_fillRadarCube((uint8_t *)refBuf, (uint8_t *)testBuf, numSamples * sizeof(cmplx16ImRe_t));
+
+            /* Saturate a few samples so that the subtraction saturates too*/
+            for (idx = 0; idx < numSamples; idx += 7)
+            {
+                refBuf[idx].real = testBuf[idx].real = (idx & 0x8) ? 32767 : -32768;
+            }
+
+            Test_referenceClutterKernel(refBuf, numSamples);
+            DPU_StaticClutterProc_kernelRemoveMean(&kernelCfg, testBuf);
+
+            if(memcmp((void *)refBuf, (void *)testBuf, numSamples * sizeof(cmplx16ImRe_t)) != 0)
+            {
+                printf("Clutter kernel mismatch, %d samples, offset %d\n", numSamples, offset);
+                retVal = MINUS_ONE;
+            }
+        }
+    }
+
+    for (idx = 0; idx < TEST_KERNEL_NUM_BENCHMARKS; idx++)
+    {
+        numSamples = benchSamples[idx];
+        DPU_StaticClutterProc_kernelInit(&kernelCfg, numSamples);
+        Test_fillRadarCube((uint8_t *)refBuf, radarCubeTestPtr, numSamples * sizeof(cmplx16ImRe_t));
+
+        startTime = Cycleprofiler_getTimeStamp();
+        Test_referenceClutterKernel(refBuf, numSamples);
+        benchRef = Cycleprofiler_getTimeStamp() - startTime;
+
+        startTime = Cycleprofiler_getTimeStamp();
+        DPU_StaticClutterProc_kernelRemoveMean(&kernelCfg, (cmplx16ImRe_t *)radarCubeTestPtr);
+        benchKernel = Cycleprofiler_getTimeStamp() - startTime;
+
+        printf("%d samples: reference %d cycles, kernel %d cycles. Gain %.1f\n",
+               numSamples, benchRef, benchKernel, (float)benchRef/benchKernel);
+    }
+
+    return retVal;
+}
 
 EDMA_Handle Test_edmaOpen(uint8_t instanceId)
 {
@@ -353,6 +706,28 @@ void Test_main
             failFlag = 1;
         }
     }
+
+    /* Clutter map across frames */
+    if(Test_clutterMap(staticClutterHandle, &cfgParams, radarCubeRefPtr, radarCubeTestPtr, radarCubeSizeInBytes) == 0)
+    {
+        printf("Clutter map test PASSED!\n");
+    }
+    else
+    {
+        printf("Clutter map test FAILED!\n");
+        failFlag = 1;
+    }
+
+    /* Clutter removal kernel */
+    if(Test_clutterKernel(radarCubeRefPtr, radarCubeTestPtr, radarCubeSizeInBytes) == 0)
+    {
+        printf("Clutter kernel test PASSED!\n");
+    }
+    else
+    {
+        printf("Clutter kernel test FAILED!\n");
+        failFlag = 1;
+    }
     
     errCode = DPU_StaticClutterProc_deinit(staticClutterHandle);
     if(errCode != 0)
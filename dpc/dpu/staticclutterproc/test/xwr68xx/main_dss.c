@@ -111,7 +111,7 @@ uint8_t gMmwL3[L3usable];
 /* Definition of test scenarios. Depending on the available size for the 
    radar cube for the specific platform, more scenarios can be added 
    with larger sizes for # Doppler and Range bins.*/
-#define TEST_NUM_OF_SCENARIOS 13
+#define TEST_NUM_OF_SCENARIOS 14
 testConfiguration testConfigArray[TEST_NUM_OF_SCENARIOS] = 
 {
     /*TX ant  RX ant  Dop chirp  Ran bin*/
@@ -128,7 +128,9 @@ testConfiguration testConfigArray[TEST_NUM_OF_SCENARIOS] =
     /* Non power of 2 number of doppler chirps*/
     3,         4,       130,     16,
     2,         2,       34,      128,
-    1,         1,       250,     64
+    1,         1,       250,     64,
+    /* Odd number of doppler chirps*/
+    2,         1,       37,      64
 };
 
 void Test_task(UArg arg0, UArg arg1)
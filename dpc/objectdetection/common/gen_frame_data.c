@@ -52,6 +52,9 @@
 uint16_t RandSimple(void);
 void GaussianNoise(float *NoiseVariance, float *pxn, float *pyn);
 
+/* State of the random number generator */
+static int64_t gRandSimpleNext = 1;
+
 /*
  *  Generates Gausian distributed random number, with unit variance
  */
@@ -90,11 +93,10 @@ void GaussianNoise(
  */
 uint16_t RandSimple(void)
 {
-    static int64_t next = 1;
     uint16_t ret2;
 
-    next = (next * 16807) % 2147483647;
-    ret2 = (uint16_t)(next & 0x7fff);
+    gRandSimpleNext = (gRandSimpleNext * 16807) % 2147483647;
+    ret2 = (uint16_t)(gRandSimpleNext & 0x7fff);
 
     return (ret2);
 }
@@ -127,6 +129,7 @@ void genChirpData (ObjectDetection_Test_SubFrameParams *subFrameParams,
     float xRe, xIm;
     float var = 1;
     uint32_t antIdx;
+    uint32_t virtAntIdx;
     uint32_t targIdx;
     uint32_t rangeIdx;
     uint32_t chirpIdx;
@@ -185,7 +188,14 @@ void genChirpData (ObjectDetection_Test_SubFrameParams *subFrameParams,
                     pT = &frm->targetObj[targIdx];
                     GaussianNoise(&var, &noiseRe, &noiseIm);
 
-                    if(processingElevationAntenna)
+                    if(subFrameParams->isAntGeometryEnabled && !subFrameParams->isBpmEnabled)
+                    {
+                        /*Antenna at (row, col) of the geometry table sees pi*(col*Wx - row*Wz)*/
+                        virtAntIdx = frm->chirpModNumTxAntCntr * subFrameParams->numRxAntennas + antIdx;
+                        pT->azimPhy = subFrameParams->antGeometryCol[virtAntIdx] * pT->azimPhyIncr -
+                                      subFrameParams->antGeometryRow[virtAntIdx] * pT->elevationPhy;
+                    }
+                    else if(processingElevationAntenna)
                     {
                         /*If this is the elevation antenna, need to set the azimuth to the correct value*/
                         pT->azimPhy = pT->azimPhyElevAntenna[antIdx] - pT->elevationPhy;
@@ -301,6 +311,24 @@ void genChirpData (ObjectDetection_Test_SubFrameParams *subFrameParams,
     }
 }
 
+/*!
+ * \brief
+ * Function Name       :    seedFrameData
+ *
+ * \par
+ * <b>Description</b>  : Restarts the noise of the generated data from a seed, so that the
+ *                       same frames can be generated again.
+ *
+ * @param[in]      seed   Seed, 1 to 2147483646. The generator starts with seed 1.
+ *
+ * @return         void
+ *
+ */
+void seedFrameData (uint32_t seed)
+{
+    gRandSimpleNext = seed;
+}
+
 /*!
  * \brief
  * Function Name       :    initFrameData
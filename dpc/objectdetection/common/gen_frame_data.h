@@ -139,6 +139,8 @@ typedef struct genFrameStruc_t_
     targetObjStruc_t targetObj[MAX_NUM_GEN_TARGETS];
 } genFrameStruc_t;
 
+void seedFrameData (uint32_t seed);
+
 void initFrameData (ObjectDetection_Test_SubFrameParams *subFrameParams,
                     genFrameStruc_t *genFrmDataObj,
                     sceneConfig_t *sceneConfig);
@@ -138,6 +138,16 @@ typedef struct ObjectDetection_Test_SubFrameParams_t
 
     /*! @brief number of angle bins */
     uint32_t numAngleBins;
+
+    /*! @brief Virtual antennas are placed per antGeometryRow/antGeometryCol instead of the
+               default azimuth/elevation layout: 0-Disabled 1-Enabled. Ignored with BPM. */
+    uint8_t isAntGeometryEnabled;
+
+    /*! @brief Row of each virtual antenna (tx * numRxAntennas + rx) */
+    uint8_t antGeometryRow[SYS_COMMON_NUM_TX_ANTENNAS * SYS_COMMON_NUM_RX_CHANNEL];
+
+    /*! @brief Column of each virtual antenna (tx * numRxAntennas + rx) */
+    uint8_t antGeometryCol[SYS_COMMON_NUM_TX_ANTENNAS * SYS_COMMON_NUM_RX_CHANNEL];
 } ObjectDetection_Test_SubFrameParams;
 
 #ifdef __cplusplus
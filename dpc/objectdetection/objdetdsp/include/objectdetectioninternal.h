@@ -66,6 +66,7 @@
 #include <ti/common/mmwave_error.h>
 #include <ti/drivers/edma/edma.h>
 #include <ti/drivers/osal/DebugP.h>
+#include <ti/drivers/osal/SemaphoreP.h>
 #include <ti/control/dpm/dpm.h>
 
 #include <ti/control/mmwavelink/mmwavelink.h>
@@ -134,8 +135,90 @@ typedef struct SubFrameObj_t
      * sub-frames due to shared resources among DPUs of same sub-frame and
      * sharing across sub-frames */
     DpuConfigs  dpuCfg;
+
+    /*! @brief  The windows and twiddles are the generated tables of the instance group,
+     *          they are not generated again when switching sub-frames */
+    bool        isTablesInitialized;
 } SubFrameObj;
 
+/*! @brief Number of radar cubes used in pipelined mode */
+#define DPC_OBJDET_PIPELINE_NUM_RADAR_CUBES     2U
+
+/**
+ * @brief  State of the pipelined mode, see
+ *         @ref DPC_ObjectDetection_PreStartCommonCfg_t::isPipelineEnabled.
+ */
+typedef struct PipelineObj_t
+{
+    /*! @brief   Radar cubes alternately filled by range processing */
+    DPIF_RadarCube  radarCube[DPC_OBJDET_PIPELINE_NUM_RADAR_CUBES];
+
+    /*! @brief   Index of the radar cube range processing is filling */
+    uint8_t         fillIdx;
+
+    /*! @brief   A filled radar cube was handed to the inter-frame processing and its
+     *           result has not been returned by the execute API yet */
+    bool            isFrameInFlight;
+
+    /*! @brief   The filled radar cube is released to the inter-frame processing when
+     *           the previous result is exported, as both share the output buffers */
+    bool            isCubePending;
+
+    /*! @brief   Frame start time stamp of the frame in flight */
+    uint32_t        frameStartTimeStamp;
+
+    /*! @brief   Frame start interrupt counter of the frame in flight, the counter
+                 has moved on to the next frame when it is processed */
+    uint32_t        frameNumber;
+
+    /*! @brief   Return value of the inter-frame processing of the frame in flight */
+    int32_t         procRetVal;
+
+    /*! @brief   Posted when a filled radar cube is released to the inter-frame processing */
+    SemaphoreP_Handle cubeReadySemHandle;
+
+    /*! @brief   Posted when the inter-frame processing of a radar cube is done */
+    SemaphoreP_Handle procDoneSemHandle;
+} PipelineObj;
+
+/**
+ * @brief  Cycles of the most recent frames of one DPU in one sub-frame, see
+ *         @ref DPC_ObjectDetection_DpuStats_t::cycles.
+ */
+typedef struct DpuCycleHistory_t
+{
+    /*! @brief   Circular buffer of processing plus EDMA wait cycles */
+    uint32_t        cycles[DPC_OBJDET_DPU_STATS_HISTORY_SIZE];
+
+    /*! @brief   Index of the next entry to write */
+    uint16_t        writeIdx;
+
+    /*! @brief   Number of valid entries */
+    uint16_t        numFrames;
+} DpuCycleHistory;
+
+/**
+ * @brief  Layout of the DPUs' scratch areas in one memory pool. Each DPU allocates its
+ *         scratch buffers from the pool in one contiguous area. The area starts at the end
+ *         of the highest area already placed whose DPU can be alive at the same time, so
+ *         the areas of DPUs that never run concurrently overlap.
+ */
+typedef struct ScratchPlan_t
+{
+    /*! @brief   Pool address where the scratch areas start, after the persistent buffers */
+    uintptr_t       scratchStartAddr;
+
+    /*! @brief   Stages (bit mask of @ref DPC_ObjectDetection_DpuId_e) during which the
+     *           scratch area of each DPU is alive, zero if the area is not placed */
+    uint32_t        lifetime[DPC_OBJDET_DPU_NUM];
+
+    /*! @brief   Start address of the scratch area of each DPU */
+    uintptr_t       startAddr[DPC_OBJDET_DPU_NUM];
+
+    /*! @brief   End address of the scratch area of each DPU */
+    uintptr_t       endAddr[DPC_OBJDET_DPU_NUM];
+} ScratchPlan;
+
 /*
  * @brief Memory pool object to manage memory based on @ref DPC_ObjectDetection_MemCfg_t.
  */
@@ -222,6 +305,36 @@ typedef struct ObjDetObj_t
     /*! @brief   Stats structure to convey to Application timing and related information. */
     DPC_ObjectDetection_Stats stats;
 
+    /*! @brief   End of the inter-frame processing of the last reported frame, zero
+     *           before the first result after start */
+    uint32_t      prevInterFrameEndTimeStamp;
+
+    /*! @brief   Pipelined mode state */
+    PipelineObj   pipeline;
+
+    /*! @brief   Instance group sharing the read-only tables, NULL if none */
+    DPC_ObjectDetection_InstanceGroup *instanceGroup;
+
+    /*! @brief   The instance is counted in the users of the group tables */
+    bool          isGroupTablesUser;
+
+    /*! @brief   Range processing cycles accumulated over the chirps of the current frame */
+    uint32_t      rangeProcCycles;
+
+    /*! @brief   Range processing EDMA wait cycles accumulated over the chirps of the current frame */
+    uint32_t      rangeWaitCycles;
+
+    /*! @brief   Cycle history per sub-frame and DPU, numSubFrames * DPC_OBJDET_DPU_NUM
+     *           entries indexed by subFrameIndx * DPC_OBJDET_DPU_NUM + DPU id. Allocated
+     *           from heap at pre-start common config. */
+    DpuCycleHistory *dpuCycleHist;
+
+    /*! @brief   Overload governor configuration */
+    DPC_ObjectDetection_OverloadGovernorCfg governorCfg;
+
+    /*! @brief   Output ring control block, NULL if the output ring is not configured */
+    DPC_ObjectDetection_OutputRingCtrl *outputRing;
+
     /*! @brief   Process call back function configuration */
     DPC_ObjectDetection_ProcessCallBackCfg processCallBackCfg;
 } ObjDetObj;
@@ -310,6 +310,7 @@
 #include <ti/datapath/dpc/dpu/cfarcaproc/cfarcaprocdsp.h>
 #include <ti/datapath/dpc/dpu/aoaproc/aoaprocdsp.h>
 #include <ti/datapath/dpc/dpu/dopplerproc/dopplerprocdsp.h>
+#include <ti/datapath/dpc/objectdetection/objdetdsp/objectdetection_outputring.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -394,6 +395,24 @@ typedef struct DPC_ObjectDetection_CfarCfg_t
     DPU_CFARCAProc_CfarCfg cfg;
 }DPC_ObjectDetection_CfarCfg;
 
+/**
+ * @brief
+ *  CFAR range dependent threshold profile Configuration
+ *
+ * @details
+ *  The structure contains the range dependent CFAR threshold profile used in data path
+ */
+typedef struct DPC_ObjectDetection_CfarRangeThresholdProfileCfg_t
+{
+    /*! @brief   Subframe number for which this message is applicable. When
+     *           advanced frame is not used, this should be set to
+     *           0 (the 1st and only sub-frame) */
+    uint8_t subFrameNum;
+
+    /*! @brief   CFAR range dependent threshold profile Configuration */
+    DPU_CFARCAProc_RangeThresholdProfileCfg cfg;
+}DPC_ObjectDetection_CfarRangeThresholdProfileCfg;
+
 /*! @brief      Field of view configuration in range domain */
 typedef struct DPC_ObjectDetection_fovRangeCfg_t
 {
@@ -463,6 +482,37 @@ typedef struct DPC_ObjectDetection_extMaxVelCfg_t
    DPU_AoAProc_ExtendedMaxVelocityCfg cfg;
 } DPC_ObjectDetection_extMaxVelCfg;
 
+/*
+ * @brief Azimuth peak interpolation configuration
+ *
+ */
+typedef struct DPC_ObjectDetection_angleInterpCfg_t
+{
+    /*! @brief   Subframe number for which this message is applicable. When
+     *           advanced frame is not used, this should be set to
+     *           0 (the 1st and only sub-frame) */
+   uint8_t subFrameNum;
+
+   /*! @brief    Azimuth peak interpolation configuration */
+   DPU_AoAProc_AngleInterpCfg cfg;
+} DPC_ObjectDetection_angleInterpCfg;
+
+/*
+ * @brief Range-azimuth heat map update configuration
+ *
+ */
+typedef struct DPC_ObjectDetection_heatMapUpdateCfg_t
+{
+    /*! @brief   Subframe number for which this message is applicable. When
+     *           advanced frame is not used, this should be set to
+     *           0 (the 1st and only sub-frame) */
+   uint8_t subFrameNum;
+
+   /*! @brief    Range-azimuth heat map update configuration. Modes other than
+    *            @ref DPU_AOAPROC_HEATMAP_UPDATE_FULL require a single sub-frame. */
+   DPU_AoAProc_HeatMapUpdateCfg cfg;
+} DPC_ObjectDetection_heatMapUpdateCfg;
+
 /*
  * @brief Range Bias and rx channel gain/phase compensation configuration.
  *
@@ -526,6 +576,85 @@ typedef struct DPC_ObjectDetection_MeasureRxChannelBiasCfg_t
     float searchWinSize;
 } DPC_ObjectDetection_MeasureRxChannelBiasCfg;
 
+/**
+ * @brief
+ *  Overload governor configuration
+ *
+ * @details
+ *  When enabled, the DPC predicts the cycles of the AoA processing from the number of
+ *  CFAR detections before running it. If the inter-frame processing would take longer
+ *  than @ref targetInterFrameCycles, the AoA processing of that frame is degraded in the
+ *  following order until the prediction fits:
+ *  1. Multi-peak search is disabled.
+ *  2. The range-azimuth heat map is not refreshed, it keeps the values of the previous
+ *     frame and stays valid for the incremental heat map updates.
+ *  3. The number of detections processed by AoA is capped, the detections of lowest SNR
+ *     are dropped. The kept detections stay in their CFAR order, so the point cloud of a
+ *     capped frame is in the same order as without the cap, less the dropped detections.
+ *
+ *  The configuration is restored after the frame, and the degradations applied are reported
+ *  in @ref DPC_ObjectDetection_ExecuteResult_t::overload. The cycle costs can be derived
+ *  from @ref DPC_ObjectDetection_Stats_t::dpuStats of frames with and without these features.
+ *  The configuration is common to all sub-frames.
+ */
+typedef struct DPC_ObjectDetection_OverloadGovernorCfg_t
+{
+    /*! @brief  1-enabled 0-disabled */
+    uint8_t     enabled;
+
+    /*! @brief  Number of detections AoA always processes, the cap does not go below this */
+    uint16_t    minNumAoaDetections;
+
+    /*! @brief  Target CPU cycles of the inter-frame processing, from its start
+     *          (@ref DPC_ObjectDetection_Stats_t::interFrameStartTimeStamp) to the end of AoA */
+    uint32_t    targetInterFrameCycles;
+
+    /*! @brief  AoA cycles independent of the number of detections, without heat map */
+    uint32_t    aoaFixedCycles;
+
+    /*! @brief  AoA cycles per detection without multi-peak search, must be non-zero */
+    uint32_t    aoaCyclesPerDetection;
+
+    /*! @brief  Additional AoA cycles per detection when multi-peak search is enabled */
+    uint32_t    multiPeakCyclesPerDetection;
+
+    /*! @brief  AoA cycles of the range-azimuth heat map refresh */
+    uint32_t    heatMapCycles;
+} DPC_ObjectDetection_OverloadGovernorCfg;
+
+/**
+ * @brief
+ *  Output ring configuration, see @ref DPC_OBJDET_OUTPUT_RING.
+ *
+ * @details
+ *  When the ring is configured, the AoA DPU writes the point cloud and its side info
+ *  in place in the next free slot of the ring, and
+ *  @ref DPC_ObjectDetection_ExecuteResult_t::objOut and
+ *  @ref DPC_ObjectDetection_ExecuteResult_t::objOutSideInfo point into that slot.
+ *  The range-azimuth heat map, refreshed incrementally by AoA in its own buffer, is
+ *  copied in the slot if it is enabled and the slot is large enough. When the ring is
+ *  full, the DPC falls back to its own buffers for the frame.
+ *
+ *  The ring memory is written by the DSP CPU without cache maintenance, it must be
+ *  non-cacheable for the DSP and the consumer (same as the DPC result buffers shared
+ *  with the MSS). A slot must hold the frame header, the point cloud and side info TLVs
+ *  of the maximum number of objects of the DPC (500) and, to carry it, the heat map TLV.
+ *  The configuration is common to all sub-frames. It must be issued while the DPC
+ *  is stopped.
+ */
+typedef struct DPC_ObjectDetection_OutputRingCfg_t
+{
+    /*! @brief  Ring memory, aligned to @ref DPC_OBJDET_OUTPUT_RING_BYTE_ALIGNMENT.
+     *          NULL disables the ring */
+    void        *addr;
+
+    /*! @brief  Size in bytes of the ring memory, control block included */
+    uint32_t    size;
+
+    /*! @brief  Number of slots the memory is divided into */
+    uint32_t    numSlots;
+} DPC_ObjectDetection_OutputRingCfg;
+
 /*!
 *  @brief      Call back function type for calling back during process
 *  @param[out] subFrameIndx Sub-frame indx [0..(numSubFrames-1)]
@@ -558,6 +687,113 @@ typedef struct DPC_ObjectDetection_MemCfg_t
     uint32_t size;
 } DPC_ObjectDetection_MemCfg;
 
+/*
+ * @brief Read-only tables of the DPUs (windows, twiddles, DFT sin/cos table) shared by the
+ *        instances of a @ref DPC_ObjectDetection_InstanceGroup_t. Set by the DPC.
+ */
+typedef struct DPC_ObjectDetection_SharedTables_t
+{
+    /*! @brief   Tables are allocated */
+    bool            isAllocated;
+
+    /*! @brief   Tables are generated, by the first configuration after their allocation.
+     *           Later configurations of the instances do not write them. */
+    bool            isGenerated;
+
+    /*! @brief   Number of instances using the tables, they are released when it drops to zero.
+     *           Updated together with @ref isAllocated in a critical section. */
+    uint32_t        numUsers;
+
+    /*! @brief   Number of ADC samples the tables were generated for */
+    uint16_t        numAdcSamples;
+
+    /*! @brief   Number of range bins the tables were generated for */
+    uint16_t        numRangeBins;
+
+    /*! @brief   Number of Doppler chirps the tables were generated for */
+    uint16_t        numDopplerChirps;
+
+    /*! @brief   Number of Doppler bins the tables were generated for */
+    uint16_t        numDopplerBins;
+
+    /*! @brief   Number of angle bins the tables were generated for */
+    uint16_t        numAngleBins;
+
+    /*! @brief   Range FFT window */
+    int16_t         *rangeWindow;
+
+    /*! @brief   Size in bytes of @ref rangeWindow */
+    uint32_t        rangeWindowSize;
+
+    /*! @brief   Doppler FFT window, used by Doppler and AoA */
+    int32_t         *dopplerWindow;
+
+    /*! @brief   Size in bytes of @ref dopplerWindow */
+    uint32_t        dopplerWindowSize;
+
+    /*! @brief   Doppler FFT twiddle, used by Doppler and AoA */
+    cmplx32ReIm_t   *dopplerTwiddle;
+
+    /*! @brief   Size in bytes of @ref dopplerTwiddle */
+    uint32_t        dopplerTwiddleSize;
+
+    /*! @brief   Doppler single point DFT sin/cos table */
+    cmplx16ImRe_t   *dftSinCosTable;
+
+    /*! @brief   Size in bytes of @ref dftSinCosTable */
+    uint32_t        dftSinCosTableSize;
+
+    /*! @brief   Angle FFT twiddle */
+    cmplx32ReIm_t   *angleTwiddle32x32;
+
+    /*! @brief   Size in bytes of @ref angleTwiddle32x32 */
+    uint32_t        angleTwiddle32x32Size;
+
+    /*! @brief   Number of bytes of the group Core L2 memory used by the tables */
+    uint32_t        CoreL2RamUsage;
+
+    /*! @brief   Number of bytes of the group Core L1 memory used by the tables */
+    uint32_t        CoreL1RamUsage;
+} DPC_ObjectDetection_SharedTables;
+
+/*
+ * @brief Group of DPC instances processing sensors of identical chirp configuration on
+ *        the same DSP, e.g. captures of several sensors processed one after the other.
+ *        The read-only tables of the DPUs are allocated from the group memory and
+ *        generated by the first instance of the group that is pre-started, the other
+ *        instances use them instead of allocating and generating their own, so the
+ *        tables are never written while an instance may be processing. The range FFT
+ *        twiddle is generated by the range DPU at every configuration and is not shared.
+ *        All the sub-frames of all
+ *        the instances must have the same number of ADC samples, range bins, Doppler chirps,
+ *        Doppler bins and angle bins.
+ *
+ *        The application zero-initializes the structure, sets the memory configuration
+ *        and passes the same group to all the instances through
+ *        @ref DPC_ObjectDetection_InitParams_t::instanceGroup. The group must outlive the
+ *        instances, and the pre-start configuration of the instances of a group must not
+ *        be issued concurrently. The use count of the tables is updated in critical
+ *        sections, so an instance may be reconfigured or de-initialized while another
+ *        one is pre-started.
+ *
+ *        An instance stops using the tables when it receives a new pre-start common
+ *        configuration or is de-initialized. The tables are released when no instance
+ *        uses them any more, so the group can be reconfigured with other sizes by issuing
+ *        the pre-start common configuration of all its instances, the first pre-start
+ *        configuration that follows allocates the tables again.
+ */
+typedef struct DPC_ObjectDetection_InstanceGroup_t
+{
+    /*! @brief Core L2 RAM configuration for the shared tables */
+    DPC_ObjectDetection_MemCfg CoreL2RamCfg;
+
+    /*! @brief Core L1 RAM configuration for the shared tables */
+    DPC_ObjectDetection_MemCfg CoreL1RamCfg;
+
+    /*! @brief Shared tables, set by the DPC */
+    DPC_ObjectDetection_SharedTables tables;
+} DPC_ObjectDetection_InstanceGroup;
+
 /*
  * @brief Configuration for DPM's init API.
  *        DPM_init's arg = pointer to this structure.
@@ -588,6 +824,10 @@ typedef struct DPC_ObjectDetection_InitParams_t
 
    /*! @brief   Process call back function configuration */
    DPC_ObjectDetection_ProcessCallBackCfg processCallBackCfg;
+
+   /*! @brief   Instance group sharing the read-only tables of the DPUs, NULL if the
+    *           instance allocates its own tables from @ref CoreL2RamCfg and @ref CoreL1RamCfg */
+   DPC_ObjectDetection_InstanceGroup *instanceGroup;
 } DPC_ObjectDetection_InitParams;
 
 /*
@@ -635,6 +875,11 @@ typedef struct DPC_ObjectDetection_StaticCfg_t
                than the minimum. */
     uint16_t    numDopplerBins;
 
+    /*! @brief  Number of angle bins of the AoA Azimuth/Elevation FFT, see
+               @ref DPU_AoAProcDSP_StaticConfig_t::numAngleBins. Zero selects
+               @ref DPU_AOAPROCDSP_NUM_ANGLE_BINS. */
+    uint16_t    numAngleBins;
+
     /*! @brief  Range conversion factor for FFT range index to meters */
     float       rangeStep;
 
@@ -647,6 +892,24 @@ typedef struct DPC_ObjectDetection_StaticCfg_t
     /*! @brief  Flag that indicates if BPM is enabled. 
                 BPM can only be enabled/disabled during configuration time.*/
     bool        isBpmEnabled;
+
+    /*! @brief  CFAR noise floor map configuration. The map is allocated from
+                heap and persists across frames and sub-frames. */
+    DPU_CFARCAProc_NoiseMapCfg cfarNoiseMapCfg;
+
+    /*! @brief  Capon range-azimuth heat map configuration, see
+                @ref DPU_AoAProcDSP_CaponCfg_t. The heat map is produced together with
+                the range-azimuth static heat map. */
+    DPU_AoAProcDSP_CaponCfg caponCfg;
+
+    /*! @brief  Virtual antenna geometry table for the 2D angle FFT, see
+                @ref DPU_AoAProcDSP_AntennaGeometryCfg_t. When disabled the default
+                azimuth/elevation processing is used. */
+    DPU_AoAProcDSP_AntennaGeometryCfg antGeometryCfg;
+
+    /*! @brief  Flag that enables the compact point cloud output, see
+                @ref DPC_ObjectDetection_ExecuteResult_t::objOutCompactHeader */
+    bool        isCompactPointCloudEnabled;
 } DPC_ObjectDetection_StaticCfg;
 
 /*
@@ -658,12 +921,19 @@ typedef struct DPC_ObjectDetection_DynCfg_t
     /*! @brief   Calibration DC Range configuration */
     DPU_RangeProc_CalibDcRangeSigCfg calibDcRangeSigCfg;
 #endif
-    /*! @brief      CFAR configuration in range direction */
+    /*! @brief      CFAR configuration in range direction. The peak grouping scheme is
+                    @ref DPU_CFAR_PEAK_GROUPING_DET_MATRIX_BASED unless both directions select
+                    @ref DPU_CFAR_PEAK_GROUPING_LOCAL_MAX_FUSED, the scheme cannot be changed by
+                    @ref DPC_OBJDET_IOCTL__DYNAMIC_CFAR_RANGE_CFG. */
     DPU_CFARCAProc_CfarCfg cfarCfgRange;
 
-    /*! @brief      CFAR configuration in Doppler direction */
+    /*! @brief      CFAR configuration in Doppler direction, see @ref cfarCfgRange for the
+                    peak grouping scheme */
     DPU_CFARCAProc_CfarCfg cfarCfgDoppler;
 
+    /*! @brief      CFAR range dependent threshold profile */
+    DPU_CFARCAProc_RangeThresholdProfileCfg cfarRangeThresholdProfileCfg;
+
     /*! @brief      Field of view configuration in range domain */
     DPU_CFARCAProc_FovCfg fovRange;
 
@@ -682,6 +952,15 @@ typedef struct DPC_ObjectDetection_DynCfg_t
     /*! @brief      Extended maximum velocity configuration */
     DPU_AoAProc_ExtendedMaxVelocityCfg extMaxVelCfg;
 
+    /*! @brief      Azimuth peak interpolation configuration */
+    DPU_AoAProc_AngleInterpCfg angleInterpCfg;
+
+    /*! @brief      Range-azimuth heat map update configuration. Modes other than
+     *              @ref DPU_AOAPROC_HEATMAP_UPDATE_FULL require a single sub-frame,
+     *              the pre-start configuration fails with
+     *              @ref DPC_OBJECTDETECTION_EINVAL__COMMAND otherwise. */
+    DPU_AoAProc_HeatMapUpdateCfg heatMapUpdateCfg;
+
     /*! @brief   Static Clutter Removal Cfg */
     DPC_ObjectDetection_StaticClutterRemovalCfg_Base staticClutterRemovalCfg;
 } DPC_ObjectDetection_DynCfg;
@@ -718,8 +997,57 @@ typedef struct DPC_ObjectDetection_PreStartCommonCfg_t
 
     /*! @brief   Range Bias and rx channel gain/phase compensation configuration */
     DPU_AoAProc_compRxChannelBiasCfg compRxChanCfg;
+
+    /*! @brief   Pipelined frame processing. When set, a second radar cube is allocated
+     *           in L3 and range processing of the next frame fills one cube while the
+     *           inter-frame processing of the previous frame runs on the other from
+     *           @ref DPC_OBJDET_IOCTL__PIPELINE_INTER_FRAME_PROCESS. The result of a frame
+     *           is then returned by the execute API at the end of the chirps of the
+     *           following frame. Only supported with a single sub-frame. */
+    bool isPipelineEnabled;
 } DPC_ObjectDetection_PreStartCommonCfg;
 
+/*
+ * @brief Index of a DPU in the per DPU arrays of @ref DPC_ObjectDetection_Stats_t and
+ *        @ref DPC_ObjectDetection_DPC_IOCTL_preStartCfg_memUsage_t
+ */
+typedef enum DPC_ObjectDetection_DpuId_e
+{
+    /*! @brief  Range processing */
+    DPC_OBJDET_DPU_RANGEPROC = 0,
+
+    /*! @brief  Doppler processing */
+    DPC_OBJDET_DPU_DOPPLERPROC,
+
+    /*! @brief  CFAR detection */
+    DPC_OBJDET_DPU_CFARCAPROC,
+
+    /*! @brief  Angle of arrival estimation */
+    DPC_OBJDET_DPU_AOAPROC,
+
+    /*! @brief  Number of DPUs */
+    DPC_OBJDET_DPU_NUM
+} DPC_ObjectDetection_DpuId;
+
+/*
+ * @brief Placement of the scratch buffers of a DPU in the Core Local memories.
+ *        Offsets are from the start of the memory given in @ref DPC_ObjectDetection_InitParams.
+ */
+typedef struct DPC_ObjectDetection_ScratchPlacement_t
+{
+    /*! @brief   Offset of the DPU's scratch area in Core Local L2 memory */
+    uint32_t CoreL2RamOffset;
+
+    /*! @brief   Size in bytes of the DPU's scratch area in Core Local L2 memory */
+    uint32_t CoreL2RamSize;
+
+    /*! @brief   Offset of the DPU's scratch area in Core Local L1 memory */
+    uint32_t CoreL1RamOffset;
+
+    /*! @brief   Size in bytes of the DPU's scratch area in Core Local L1 memory */
+    uint32_t CoreL1RamSize;
+} DPC_ObjectDetection_ScratchPlacement;
+
 /*
  * @brief  Structure related to @ref DPC_OBJDET_IOCTL__STATIC_PRE_START_CFG
  *        IOCTL command. When the pre-start IOCTL is processed, it will report
@@ -756,6 +1084,37 @@ typedef struct DPC_ObjectDetection_DPC_IOCTL_preStartCfg_memUsage_t
 
     /*! @brief   Indicates number of bytes of system heap used by DCP at the end of PreStartCfg */
     uint32_t SystemHeapDPCUsed;
+
+    /*! @brief   Placement of the scratch buffers of each DPU, indexed by
+     *           @ref DPC_ObjectDetection_DpuId_e. The scratch areas of DPUs that never
+     *           run at the same time overlap. The range DPU entry is zero if the range
+     *           DPU is not part of the DPC. */
+    DPC_ObjectDetection_ScratchPlacement scratchPlan[DPC_OBJDET_DPU_NUM];
+
+    /*! @brief   Number of bytes of Core Local L2 memory saved by overlapping the scratch
+     *           areas, compared to giving each DPU its own area */
+    uint32_t CoreL2RamScratchSaved;
+
+    /*! @brief   Number of bytes of Core Local L1 memory saved by overlapping the scratch
+     *           areas, compared to giving each DPU its own area */
+    uint32_t CoreL1RamScratchSaved;
+
+    /*! @brief   Number of bytes of Core Local L2 memory of the tables shared through
+     *           @ref DPC_ObjectDetection_InitParams_t::instanceGroup. They are not counted in
+     *           @ref CoreL2RamUsage, an independent instance would use them in addition.
+     *           Zero if the instance is not part of a group */
+    uint32_t CoreL2RamShared;
+
+    /*! @brief   Number of bytes of Core Local L1 memory of the tables shared through
+     *           @ref DPC_ObjectDetection_InitParams_t::instanceGroup. They are not counted in
+     *           @ref CoreL1RamUsage, an independent instance would use them in addition.
+     *           Zero if the instance is not part of a group */
+    uint32_t CoreL1RamShared;
+
+    /*! @brief   Set if the AoA DPU groups the CFAR detections by range bin. Cleared when
+     *           the range bin grouping buffers do not fit in the remaining Core Local L2
+     *           memory, each detection then fetches its range bin from the radar cube */
+    bool isAoaRangeBinGroupingEnabled;
 } DPC_ObjectDetection_DPC_IOCTL_preStartCfg_memUsage;
 
 /*
@@ -785,6 +1144,60 @@ typedef struct DPC_ObjectDetection_PreStartCfg_t
     DPC_ObjectDetection_DPC_IOCTL_preStartCfg_memUsage memUsage;
 } DPC_ObjectDetection_PreStartCfg;
 
+/*! @brief Number of most recent frames of a sub-frame over which the per-DPU cycle summary is computed */
+#define DPC_OBJDET_DPU_STATS_HISTORY_SIZE      100U
+
+/*
+ * @brief Summary of the cycles (processing plus EDMA wait) a DPU took over the
+ *        last @ref DPC_OBJDET_DPU_STATS_HISTORY_SIZE frames.
+ */
+typedef struct DPC_ObjectDetection_CycleSummary_t
+{
+    /*! @brief   Number of frames in the summary, up to @ref DPC_OBJDET_DPU_STATS_HISTORY_SIZE */
+    uint32_t      numFrames;
+
+    /*! @brief   Minimum cycles */
+    uint32_t      minCycles;
+
+    /*! @brief   Average cycles */
+    uint32_t      avgCycles;
+
+    /*! @brief   Maximum cycles */
+    uint32_t      maxCycles;
+
+    /*! @brief   99th percentile of the cycles, i.e. at most 1% of the frames took longer */
+    uint32_t      p99Cycles;
+} DPC_ObjectDetection_CycleSummary;
+
+/*
+ * @brief Per DPU statistics of the reported frame.
+ */
+typedef struct DPC_ObjectDetection_DpuStats_t
+{
+    /*! @brief   CPU cycles of the DPU processing excluding EDMA waiting time */
+    uint32_t      processingCycles;
+
+    /*! @brief   CPU cycles spent waiting for EDMA transfers */
+    uint32_t      waitCycles;
+
+    /*! @brief   Number of bytes moved by EDMA to and from the DPU */
+    uint32_t      bytesMoved;
+
+    /*! @brief   Number of detections input to the DPU */
+    uint32_t      numDetIn;
+
+    /*! @brief   Number of detections output by the DPU */
+    uint32_t      numDetOut;
+
+    /*! @brief   Summary of @ref processingCycles + @ref waitCycles over the recent frames.
+     *           Comparing @ref DPC_ObjectDetection_CycleSummary_t::p99Cycles of the inter-frame
+     *           DPUs against the frame period shows how close the processing is to an overrun.
+     *           The history is kept per sub-frame: the summary reported with the result of a
+     *           sub-frame only covers the recent frames of that sub-frame, so sub-frames of
+     *           different configurations are not mixed. */
+    DPC_ObjectDetection_CycleSummary cycles;
+} DPC_ObjectDetection_DpuStats;
+
 /*
  * @brief Stats structure to convey to Application timing and related information.
  */
@@ -812,8 +1225,50 @@ typedef struct DPC_ObjectDetection_Stats_t
      *         in the processing of DPC_OBJDET_IOCTL__DYNAMIC_EXECUTE_RESULT_EXPORTED,
      *         which is after the DPC process. */
     uint32_t      subFramePreparationCycles;
+
+    /*! @brief   CPU cycles from the frame start of the reported frame to the end of its
+     *           inter-frame processing. In pipelined mode this includes the range processing
+     *           of the frame and the time its radar cube waited for the inter-frame stages. */
+    uint32_t      frameLatency;
+
+    /*! @brief   CPU cycles between the end of the inter-frame processing of the reported
+     *           frame and of the one before it, the inverse of the result throughput.
+     *           Zero for the first result after start. */
+    uint32_t      resultPeriod;
+
+    /*! @brief   Per DPU statistics indexed by @ref DPC_ObjectDetection_DpuId_e. Range processing
+     *           is accumulated over the chirps of the frame. In pipelined mode
+     *           the range processing entry is of the frame being filled, which is one frame ahead
+     *           of the other entries. */
+    DPC_ObjectDetection_DpuStats dpuStats[DPC_OBJDET_DPU_NUM];
 } DPC_ObjectDetection_Stats;
 
+/*! @brief Overload degradation: multi-peak search was disabled for the frame */
+#define DPC_OBJDET_OVERLOAD_MULTI_PEAK_DISABLED     (1U << 0)
+
+/*! @brief Overload degradation: the range-azimuth heat map was not refreshed in the frame */
+#define DPC_OBJDET_OVERLOAD_HEAT_MAP_SKIPPED        (1U << 1)
+
+/*! @brief Overload degradation: the number of detections processed by AoA was capped */
+#define DPC_OBJDET_OVERLOAD_DETECTIONS_CAPPED       (1U << 2)
+
+/*
+ * @brief Degradations applied to a frame by the overload governor, see
+ *        @ref DPC_ObjectDetection_OverloadGovernorCfg_t. All zero if the governor is disabled.
+ */
+typedef struct DPC_ObjectDetection_OverloadReport_t
+{
+    /*! @brief   Bit mask of the DPC_OBJDET_OVERLOAD_xxx degradations applied */
+    uint32_t      degradations;
+
+    /*! @brief   Predicted cycles of the inter-frame processing with the degradations applied */
+    uint32_t      predictedInterFrameCycles;
+
+    /*! @brief   Number of CFAR detections not processed by AoA, the ones of lowest SNR. The
+     *           processed detections keep their CFAR order. */
+    uint32_t      numDetectionsDropped;
+} DPC_ObjectDetection_OverloadReport;
+
 /*
  * @brief This is the result structure reported from DPC's registered processing function
  *        to the application through the DPM_Buffer structure. The DPM_Buffer's
@@ -844,6 +1299,16 @@ typedef struct DPC_ObjectDetection_ExecuteResult_t
      *              of @ref numObjOut elements */
     DPIF_PointCloudSideInfo *objOutSideInfo;
 
+    /*! @brief      Compact point cloud header (Q-formats and number of points), followed in
+     *              memory by @ref objOutCompact so that both can be exported as one block of
+     *              sizeof(DPU_AoAProc_PointCloudCompactHeader) + numObjOut *
+     *              sizeof(DPU_AoAProc_PointCloudCompact) bytes. NULL if
+     *              @ref DPC_ObjectDetection_StaticCfg_t::isCompactPointCloudEnabled is not set */
+    DPU_AoAProc_PointCloudCompactHeader *objOutCompactHeader;
+
+    /*! @brief      Compact point cloud of @ref numObjOut elements, NULL if disabled */
+    DPU_AoAProc_PointCloudCompact *objOutCompact;
+
     /*! @brief      Pointer to range-azimuth static heat map, this is a 2D FFT
      *              array in range direction (cmplx16ImRe_t x[numRangeBins][numVirtualAntAzim]),
      *              at doppler index 0 */
@@ -854,9 +1319,19 @@ typedef struct DPC_ObjectDetection_ExecuteResult_t
      *              @ref DPC_ObjectDetection_StaticCfg_t::numRangeBins */
     uint32_t        azimuthStaticHeatMapSize;
 
+    /*! @brief      Pointer to Capon range-azimuth heat map (float x[numRangeBins][numAngleBins]),
+     *              NULL if @ref DPC_ObjectDetection_StaticCfg_t::caponCfg is not enabled */
+    float           *caponHeatMap;
+
+    /*! @brief      Number of elements of @ref caponHeatMap */
+    uint32_t        caponHeatMapSize;
+
     /*! @brief      Pointer to DPC stats structure */
     DPC_ObjectDetection_Stats *stats;
 
+    /*! @brief      Degradations applied by the overload governor */
+    DPC_ObjectDetection_OverloadReport overload;
+
     /*! @brief   Pointer to Range Bias and rx channel gain/phase compensation measurement
      *           result. Note the contents of this pointer are independent of sub-frame
      *           i.e all sub-frames will report the same result although it is
@@ -1011,11 +1486,49 @@ typedef struct DPC_ObjectDetection_ExecuteResultExportedInfo_t
  */
 #define DPC_OBJDET_IOCTL__TRIGGER_CHIRP                                     (DPM_CMD_DPC_START_INDEX + 16U)
 
+/**
+ * @brief Command associated with @ref DPC_ObjectDetection_CfarRangeThresholdProfileCfg_t.
+ *        The profile overrides @ref DPC_OBJDET_IOCTL__DYNAMIC_CFAR_RANGE_CFG and
+ *        @ref DPC_OBJDET_IOCTL__DYNAMIC_CFAR_DOPPLER_CFG thresholds within its range segments.
+ */
+#define DPC_OBJDET_IOCTL__DYNAMIC_CFAR_RANGE_THRESHOLD_PROFILE_CFG          (DPM_CMD_DPC_START_INDEX + 17U)
+
+/**
+ * @brief Command associated with @ref DPC_ObjectDetection_angleInterpCfg_t
+ */
+#define DPC_OBJDET_IOCTL__DYNAMIC_ANGLE_INTERP_CFG                          (DPM_CMD_DPC_START_INDEX + 18U)
+
+/**
+ * @brief Command associated with @ref DPC_ObjectDetection_heatMapUpdateCfg_t
+ */
+#define DPC_OBJDET_IOCTL__DYNAMIC_HEAT_MAP_UPDATE_CFG                       (DPM_CMD_DPC_START_INDEX + 19U)
+
+/**
+ * @brief Command to run the inter-frame processing (Doppler, CFAR and AoA) when
+ *        @ref DPC_ObjectDetection_PreStartCommonCfg_t::isPipelineEnabled is set. It blocks
+ *        until the range processing of a frame has completed and the result of the previous
+ *        frame has been exported, processes that frame's radar cube and returns. The
+ *        application issues it in a loop from a task of lower priority than the DPM execute
+ *        context, so that range processing of the next frame preempts it. No argument is
+ *        associated with this command.
+ */
+#define DPC_OBJDET_IOCTL__PIPELINE_INTER_FRAME_PROCESS                      (DPM_CMD_DPC_START_INDEX + 20U)
+
+/**
+ * @brief Command associated with @ref DPC_ObjectDetection_OverloadGovernorCfg_t
+ */
+#define DPC_OBJDET_IOCTL__DYNAMIC_OVERLOAD_GOVERNOR_CFG                     (DPM_CMD_DPC_START_INDEX + 21U)
+
+/**
+ * @brief Command associated with @ref DPC_ObjectDetection_OutputRingCfg_t
+ */
+#define DPC_OBJDET_IOCTL__OUTPUT_RING_CFG                                   (DPM_CMD_DPC_START_INDEX + 22U)
+
 /**
  * @brief This is not a command, just to capture the last command supported in DPC.
         This definition is used to track if the commond is targed for this DPC, otherwise return an error.
  */
-#define DPC_OBJDET_IOCTL__MAX                                               (DPC_OBJDET_IOCTL__TRIGGER_CHIRP)
+#define DPC_OBJDET_IOCTL__MAX                                               (DPC_OBJDET_IOCTL__OUTPUT_RING_CFG)
 
 /**
 @}
@@ -1048,6 +1561,30 @@ typedef struct DPC_ObjectDetection_ExecuteResultExportedInfo_t
  */
 #define DPC_OBJECTDETECTION_EINVAL__COMMAND                                 (DP_ERRNO_OBJDETDSP_BASE - 4)
 
+/**
+ * @brief   Error Code: Pipelined mode requested with more than one sub-frame, or with a
+ *                      DPC built without range processing, or the IOCTL
+ *                      @ref DPC_OBJDET_IOCTL__PIPELINE_INTER_FRAME_PROCESS issued while
+ *                      pipelined mode is not enabled.
+ */
+#define DPC_OBJECTDETECTION_EINVAL__PIPELINE_CFG                            (DP_ERRNO_OBJDETDSP_BASE - 5)
+
+/**
+ * @brief   Error Code: Invalid argument in configuration @ref DPC_ObjectDetection_OverloadGovernorCfg_t
+ */
+#define DPC_OBJECTDETECTION_EINVAL__OVERLOAD_GOVERNOR_CFG                   (DP_ERRNO_OBJDETDSP_BASE - 6)
+
+/**
+ * @brief   Error Code: Invalid argument in configuration @ref DPC_ObjectDetection_OutputRingCfg_t
+ */
+#define DPC_OBJECTDETECTION_EINVAL__OUTPUT_RING_CFG                         (DP_ERRNO_OBJDETDSP_BASE - 7)
+
+/**
+ * @brief   Error Code: Pre-start configuration does not match the tables of the
+ *                      @ref DPC_ObjectDetection_InstanceGroup_t of the instance
+ */
+#define DPC_OBJECTDETECTION_EINVAL__INSTANCE_GROUP_CFG                      (DP_ERRNO_OBJDETDSP_BASE - 8)
+
 /**
  * @brief   Error Code: Out of general heap memory
  */
@@ -1068,6 +1605,11 @@ typedef struct DPC_ObjectDetection_ExecuteResultExportedInfo_t
  */
 #define DPC_OBJECTDETECTION_PRE_START_CONFIG_BEFORE_PRE_START_COMMON_CONFIG  (DP_ERRNO_OBJDETDSP_BASE - 13)
 
+/**
+ * @brief   Error Code: Out of Core Local memory for the read-only tables of the DPUs
+ */
+#define DPC_OBJECTDETECTION_ENOMEM__CORE_RAM_TABLES                         (DP_ERRNO_OBJDETDSP_BASE - 14)
+
 /**
  * @brief   Error Code: Internal error
  */
@@ -0,0 +1,287 @@
+/**
+ *   @file  objectdetection_outputring.h
+ *
+ *   @brief
+ *      Object Detection DPC (DSP chain) output ring layout and consumer functions.
+ *      This header only depends on the C standard headers and the compiler intrinsics so
+ *      that it can be included by the consumer of the ring (MSS application or host)
+ *      without the DPC dependencies.
+ *
+ *  \par
+ *  NOTE:
+ *      (C) Copyright 2019 Texas Instruments, Inc.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *    Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ *    Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the
+ *    distribution.
+ *
+ *    Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *  A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *  OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *  LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *  DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *  THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *  OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef DPC_OBJECTDETECTION_OUTPUTRING_H
+#define DPC_OBJECTDETECTION_OUTPUTRING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+@defgroup DPC_OBJDET_OUTPUT_RING                          Object Detection DPC Output Ring
+@ingroup DPC_OBJDET_EXTERNAL
+@brief
+*   Single producer (DPC) single consumer ring of TLV frames, configured with
+*   @ref DPC_OBJDET_IOCTL__OUTPUT_RING_CFG. The ring memory starts with
+*   @ref DPC_ObjectDetection_OutputRingCtrl_t followed by
+*   @ref DPC_ObjectDetection_OutputRingCtrl_t::numSlots slots of
+*   @ref DPC_ObjectDetection_OutputRingCtrl_t::slotSize bytes. The DPC writes a frame
+*   in the slot of index (writeIdx % numSlots) and publishes it by incrementing writeIdx,
+*   the consumer releases it by incrementing readIdx. Each index is written by one side
+*   only, so no lock is needed. @ref DPC_OBJDET_OUTPUT_RING_BARRIER orders the slot
+*   accesses with the index updates on both sides. When the ring is full the frame is not written and
+*   @ref DPC_ObjectDetection_OutputRingCtrl_t::numFramesDropped is incremented.
+*
+*   A frame is a @ref DPC_ObjectDetection_TlvFrameHeader_t followed by
+*   @ref DPC_ObjectDetection_TlvFrameHeader_t::numTlvs TLVs, each a
+*   @ref DPC_ObjectDetection_TlvHeader_t followed by its payload. The point cloud and
+*   side info payloads are written in place by the AoA DPU. TLVs of type
+*   @ref DPC_OBJDET_TLV_TYPE_PADDING must be skipped by the consumer.
+*/
+
+/**
+ *  @brief   Alignment in bytes of the ring memory
+ *
+ *  \ingroup DPC_OBJDET_OUTPUT_RING
+ */
+#define DPC_OBJDET_OUTPUT_RING_BYTE_ALIGNMENT       8U
+
+/**
+ *  @brief   Memory barrier between the slot accesses and the index updates: the DPC
+ *           completes the slot writes before incrementing writeIdx, the consumer reads
+ *           the slot only after reading writeIdx and completes it before incrementing
+ *           readIdx. A consumer built with another compiler defines it before including
+ *           this header.
+ *
+ *  \ingroup DPC_OBJDET_OUTPUT_RING
+ */
+#ifndef DPC_OBJDET_OUTPUT_RING_BARRIER
+#if defined(_TMS320C6X)
+#include <c6x.h>
+#define DPC_OBJDET_OUTPUT_RING_BARRIER()            _mfence()
+#elif defined(__TI_ARM__)
+#define DPC_OBJDET_OUTPUT_RING_BARRIER()            __asm(" DMB")
+#elif defined(__GNUC__)
+#define DPC_OBJDET_OUTPUT_RING_BARRIER()            __sync_synchronize()
+#else
+#error "DPC_OBJDET_OUTPUT_RING_BARRIER is not defined for this compiler"
+#endif
+#endif
+
+/** @addtogroup DPC_OBJDET_OUTPUT_RING
+ @{ */
+
+/*! @brief TLV type: padding, to be skipped */
+#define DPC_OBJDET_TLV_TYPE_PADDING                 0U
+
+/*! @brief TLV type: point cloud, array of DPIF_PointCloudCartesian */
+#define DPC_OBJDET_TLV_TYPE_POINT_CLOUD             1U
+
+/*! @brief TLV type: point cloud side info, array of DPIF_PointCloudSideInfo */
+#define DPC_OBJDET_TLV_TYPE_SIDE_INFO               2U
+
+/*! @brief TLV type: range-azimuth static heat map, array of cmplx16ImRe_t
+ *         [numRangeBins][numVirtualAntAzim] */
+#define DPC_OBJDET_TLV_TYPE_AZIMUTH_HEAT_MAP        3U
+
+/**
+@}
+*/
+
+/**
+ * @brief
+ *  Control block at the start of the ring memory.
+ *
+ *  \ingroup DPC_OBJDET_OUTPUT_RING
+ */
+typedef struct DPC_ObjectDetection_OutputRingCtrl_t
+{
+    /*! @brief  Number of frames published, written by the DPC only */
+    volatile uint32_t   writeIdx;
+
+    /*! @brief  Number of frames released, written by the consumer only */
+    volatile uint32_t   readIdx;
+
+    /*! @brief  Number of slots */
+    uint32_t            numSlots;
+
+    /*! @brief  Size in bytes of a slot, multiple of @ref DPC_OBJDET_OUTPUT_RING_BYTE_ALIGNMENT */
+    uint32_t            slotSize;
+
+    /*! @brief  Number of frames not written because the ring was full */
+    volatile uint32_t   numFramesDropped;
+
+    /*! @brief  Reserved, keeps the slots aligned */
+    uint32_t            reserved[3];
+} DPC_ObjectDetection_OutputRingCtrl;
+
+/**
+ * @brief
+ *  Header of a frame in the ring.
+ *
+ *  \ingroup DPC_OBJDET_OUTPUT_RING
+ */
+typedef struct DPC_ObjectDetection_TlvFrameHeader_t
+{
+    /*! @brief  Length in bytes of the frame, header included */
+    uint32_t    totalLen;
+
+    /*! @brief  Frame number, DPC_ObjectDetection_Stats_t::frameStartIntCounter at the
+     *          start of the frame, also in pipelined mode */
+    uint32_t    frameNumber;
+
+    /*! @brief  Sub-frame index */
+    uint32_t    subFrameIdx;
+
+    /*! @brief  Number of TLVs following the header, padding included */
+    uint32_t    numTlvs;
+
+    /*! @brief  Number of detected objects */
+    uint32_t    numObj;
+
+    /*! @brief  Bit mask of the DPC_OBJDET_OVERLOAD_xxx degradations applied to the frame */
+    uint32_t    degradations;
+} DPC_ObjectDetection_TlvFrameHeader;
+
+/**
+ * @brief
+ *  Header of a TLV.
+ *
+ *  \ingroup DPC_OBJDET_OUTPUT_RING
+ */
+typedef struct DPC_ObjectDetection_TlvHeader_t
+{
+    /*! @brief  Type, one of DPC_OBJDET_TLV_TYPE_xxx */
+    uint32_t    type;
+
+    /*! @brief  Length in bytes of the payload */
+    uint32_t    length;
+} DPC_ObjectDetection_TlvHeader;
+
+/**
+ *  @b Description
+ *  @n
+ *      Returns the oldest published frame of the ring without releasing it.
+ *
+ *  @param[in]  ctrl    Pointer to the ring control block
+ *
+ *  \ingroup    DPC_OBJDET_OUTPUT_RING
+ *
+ *  @retval
+ *      Pointer to the frame header, NULL if the ring is empty
+ */
+static inline DPC_ObjectDetection_TlvFrameHeader *DPC_ObjectDetection_outputRingPeek
+(
+    DPC_ObjectDetection_OutputRingCtrl *ctrl
+)
+{
+    DPC_ObjectDetection_TlvFrameHeader *frame = NULL;
+    uint32_t readIdx = ctrl->readIdx;
+
+    if (ctrl->writeIdx != readIdx)
+    {
+        /* Slot content is read after writeIdx */
+        DPC_OBJDET_OUTPUT_RING_BARRIER();
+        frame = (DPC_ObjectDetection_TlvFrameHeader *)((uint8_t *)(ctrl + 1) +
+                    (readIdx % ctrl->numSlots) * ctrl->slotSize);
+    }
+    return frame;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Releases the frame returned by @ref DPC_ObjectDetection_outputRingPeek, its
+ *      slot can then be written by the DPC.
+ *
+ *  @param[in]  ctrl    Pointer to the ring control block
+ *
+ *  \ingroup    DPC_OBJDET_OUTPUT_RING
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+static inline void DPC_ObjectDetection_outputRingRelease
+(
+    DPC_ObjectDetection_OutputRingCtrl *ctrl
+)
+{
+    /* Slot content is read before the DPC can reuse the slot */
+    DPC_OBJDET_OUTPUT_RING_BARRIER();
+    ctrl->readIdx = ctrl->readIdx + 1U;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Iterates over the TLVs of a frame, padding included.
+ *
+ *  @param[in]  frame   Pointer to the frame header
+ *  @param[in]  tlv     Pointer to the current TLV, NULL to get the first TLV
+ *
+ *  \ingroup    DPC_OBJDET_OUTPUT_RING
+ *
+ *  @retval
+ *      Pointer to the next TLV header, its payload follows it. NULL after the last TLV.
+ */
+static inline DPC_ObjectDetection_TlvHeader *DPC_ObjectDetection_outputRingNextTlv
+(
+    DPC_ObjectDetection_TlvFrameHeader *frame,
+    DPC_ObjectDetection_TlvHeader *tlv
+)
+{
+    uint8_t *next;
+
+    if (tlv == NULL)
+    {
+        next = (uint8_t *)(frame + 1);
+    }
+    else
+    {
+        next = (uint8_t *)(tlv + 1) + tlv->length;
+    }
+
+    if (next >= ((uint8_t *)frame + frame->totalLen))
+    {
+        next = NULL;
+    }
+    return (DPC_ObjectDetection_TlvHeader *)next;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DPC_OBJECTDETECTION_OUTPUTRING_H */
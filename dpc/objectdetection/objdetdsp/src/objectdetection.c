@@ -49,6 +49,7 @@
 #include <ti/common/sys_common.h>
 #include <ti/drivers/osal/DebugP.h>
 #include <ti/drivers/osal/MemoryP.h>
+#include <ti/drivers/osal/HwiP.h>
 #include <ti/drivers/edma/edma.h>
 #include <ti/utils/mathutils/mathutils.h>
 #include <ti/utils/cycleprofiler/cycle_profiler.h>
@@ -159,6 +160,22 @@ ObjDetObj     *gObjDetObj;
 /*! Maximum Number of objects that can be detected in a frame */
 #define DPC_OBJDET_MAX_NUM_OBJECTS                       500U
 
+/*! Offset in an output ring slot of the point cloud payload, after the frame header and
+ *  the point cloud TLV header */
+#define DPC_OBJDET_OUTPUT_RING_POINT_CLOUD_OFFSET        (sizeof(DPC_ObjectDetection_TlvFrameHeader) + \
+                                                          sizeof(DPC_ObjectDetection_TlvHeader))
+
+/*! Offset in an output ring slot of the side info TLV header, the point cloud TLV is sized
+ *  for the maximum number of objects so that AoA can write it in place */
+#define DPC_OBJDET_OUTPUT_RING_SIDE_INFO_TLV_OFFSET      (DPC_OBJDET_OUTPUT_RING_POINT_CLOUD_OFFSET + \
+                                                          DPC_OBJDET_MAX_NUM_OBJECTS * sizeof(DPIF_PointCloudCartesian))
+
+/*! Minimum size of an output ring slot, the heat map TLV follows the side info TLV if the
+ *  slot is large enough */
+#define DPC_OBJDET_OUTPUT_RING_MIN_SLOT_SIZE             (DPC_OBJDET_OUTPUT_RING_SIDE_INFO_TLV_OFFSET + \
+                                                          sizeof(DPC_ObjectDetection_TlvHeader) + \
+                                                          DPC_OBJDET_MAX_NUM_OBJECTS * sizeof(DPIF_PointCloudSideInfo))
+
 /* Window definition for range and doppler */
 #define DPC_DPU_RANGEPROC_FFT_WINDOW_TYPE            MMWAVELIB_WIN_BLACKMAN
 #define DPC_DPU_DOPPLERPROC_FFT_WINDOW_TYPE          MMWAVELIB_WIN_HANNING
@@ -311,6 +328,114 @@ static void *DPC_ObjDetDSP_MemPoolAlloc(MemPoolObj *pool,
     return(retAddr);
 }
 
+/**
+ *  @b Description
+ *  @n
+ *      Starts the scratch layout of a memory pool at the pool's current address,
+ *      after the buffers that persist across all stages.
+ *
+ *  @param[out] plan Scratch layout of the pool.
+ *  @param[in]  pool Handle to pool object.
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      None
+ */
+static void DPC_ObjDetDSP_scratchPlanInit(ScratchPlan *plan, MemPoolObj *pool)
+{
+    memset((void *)plan, 0, sizeof(ScratchPlan));
+    plan->scratchStartAddr = (uintptr_t)DPC_ObjDetDSP_MemPoolGet(pool);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Places the scratch area of a DPU and sets the pool to its start, the DPU's
+ *      scratch buffers are then allocated from the pool. The area starts at the end of
+ *      the highest area already placed whose lifetime intersects the DPU's lifetime,
+ *      so it overlaps all areas of DPUs that are never alive at the same time.
+ *
+ *  @param[in]  plan     Scratch layout of the pool.
+ *  @param[in]  pool     Handle to pool object.
+ *  @param[in]  dpuId    DPU whose scratch area is placed.
+ *  @param[in]  lifetime Stages during which the area is alive, as a bit mask of
+ *                       @ref DPC_ObjectDetection_DpuId_e.
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      None
+ */
+static void DPC_ObjDetDSP_scratchPlanBegin(ScratchPlan *plan, MemPoolObj *pool,
+                                           DPC_ObjectDetection_DpuId dpuId, uint32_t lifetime)
+{
+    uintptr_t startAddr = plan->scratchStartAddr;
+    uint32_t idx;
+
+    for (idx = 0; idx < DPC_OBJDET_DPU_NUM; idx++)
+    {
+        if ((plan->lifetime[idx] & lifetime) != 0U)
+        {
+            startAddr = MAX(startAddr, plan->endAddr[idx]);
+        }
+    }
+
+    plan->lifetime[dpuId] = lifetime;
+    plan->startAddr[dpuId] = startAddr;
+    plan->endAddr[dpuId] = startAddr;
+    DPC_ObjDetDSP_MemPoolSet(pool, (void *)startAddr);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Closes the scratch area of a DPU at the pool's current address, i.e. after the
+ *      last scratch buffer the DPU allocated.
+ *
+ *  @param[in]  plan     Scratch layout of the pool.
+ *  @param[in]  pool     Handle to pool object.
+ *  @param[in]  dpuId    DPU whose scratch area is closed.
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      None
+ */
+static void DPC_ObjDetDSP_scratchPlanEnd(ScratchPlan *plan, MemPoolObj *pool,
+                                         DPC_ObjectDetection_DpuId dpuId)
+{
+    plan->endAddr[dpuId] = (uintptr_t)DPC_ObjDetDSP_MemPoolGet(pool);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Computes the memory saved by the scratch layout, i.e. the sum of the sizes of the
+ *      scratch areas minus the size of the memory they span.
+ *
+ *  @param[in]  plan     Scratch layout of the pool.
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Number of bytes saved.
+ */
+static uint32_t DPC_ObjDetDSP_scratchPlanGetSaved(ScratchPlan *plan)
+{
+    uintptr_t endAddr = plan->scratchStartAddr;
+    uint32_t sumSize = 0;
+    uint32_t idx;
+
+    for (idx = 0; idx < DPC_OBJDET_DPU_NUM; idx++)
+    {
+        sumSize += (uint32_t)(plan->endAddr[idx] - plan->startAddr[idx]);
+        endAddr = MAX(endAddr, plan->endAddr[idx]);
+    }
+
+    return(sumSize - (uint32_t)(endAddr - plan->scratchStartAddr));
+}
+
 /**
  *  @b Description
  *  @n
@@ -486,6 +611,8 @@ static void DPC_ObjDetDSP_GenRangeWindow
  *  @param[in]  twiddle         Pointer to range FFT twiddle buffer
  *  @param[in]  twiddleSize     Range FFT twiddle buffer size in bytes. See Range DPU
  *                              configuration for more information.
+ *  @param[in]  isTablesInitialized The window is already generated, e.g. shared with
+ *                              other instances, it is not generated again.
  *  @param[out] cfgSave         Configuration that is built in local
  *                              (stack) variable is saved here. This is for facilitating
  *                              quick reconfiguration later without having to go through
@@ -511,6 +638,7 @@ static int32_t DPC_ObjDetDSP_rangeConfig
     uint32_t                      windowSize,
     cmplx16ImRe_t                 *twiddle,
     uint32_t                      twiddleSize,
+    bool                          isTablesInitialized,
     DPU_RangeProcDSP_Config       *cfgSave
 )
 {
@@ -542,7 +670,10 @@ static int32_t DPC_ObjDetDSP_rangeConfig
     hwRes->radarCube = *radarCube;
     hwRes->windowSize = windowSize;
     hwRes->window  = window;
-    DPC_ObjDetDSP_GenRangeWindow(&rangeCfg);
+    if (isTablesInitialized == false)
+    {
+        DPC_ObjDetDSP_GenRangeWindow(&rangeCfg);
+    }
 
     hwRes->twiddleSize = twiddleSize;
     hwRes->twiddle16x16 = twiddle;
@@ -937,7 +1068,10 @@ static int32_t DPC_ObjDetDSP_reconfigSubFrame(ObjDetObj *objDetObj, uint8_t subF
 
 #ifndef OBJDET_NO_RANGE
     /* Generate windowing buffer */
-    DPC_ObjDetDSP_GenRangeWindow(&subFrmObj->dpuCfg.rangeCfg);
+    if (subFrmObj->isTablesInitialized == false)
+    {
+        DPC_ObjDetDSP_GenRangeWindow(&subFrmObj->dpuCfg.rangeCfg);
+    }
     retVal = DPU_RangeProcDSP_config(subFrmObj->dpuRangeObj, &subFrmObj->dpuCfg.rangeCfg);
     if (retVal != 0)
     {
@@ -952,7 +1086,10 @@ static int32_t DPC_ObjDetDSP_reconfigSubFrame(ObjDetObj *objDetObj, uint8_t subF
     }
 
     /* Generate 2D window coefficients.*/
-    DPC_ObjDetDSP_GenDopplerWindow(&subFrmObj->dpuCfg.dopplerCfg);
+    if (subFrmObj->isTablesInitialized == false)
+    {
+        DPC_ObjDetDSP_GenDopplerWindow(&subFrmObj->dpuCfg.dopplerCfg);
+    }
     retVal = DPU_DopplerProcDSP_config(subFrmObj->dpuDopplerObj, &subFrmObj->dpuCfg.dopplerCfg);
     if (retVal != 0)
     {
@@ -1132,167 +1269,86 @@ exit:
 /**
  *  @b Description
  *  @n
- *     Configure Doppler DPU.
+ *      Configures the DPC's overload governor.
  *
- *  @param[in]  dpuHandle           Handle to Doppler DPU
- *  @param[in]  staticCfg           Pointer to static configuration of the sub-frame
- *  @param[in]  log2NumDopplerBins  log2 of numDopplerBins of the static config.
- *  @param[in]  dynCfg              Pointer to dynamic configuration of the sub-frame
- *  @param[in]  edmaHandle          Handle to edma driver to be used for the DPU
- *  @param[in]  radarCube           Pointer to DPIF radar cube, which will be the input
- *                                  to doppler processing
- *  @param[in]  detMatrix           Pointer to DPIF detection matrix, which will be the output
- *                                  of doppler processing
- *  @param[in]  CoreL2RamObj        Pointer to core local L2 RAM object to allocate local memory
- *                                  for the DPU, only for scratch purposes
- *  @param[in]  CoreL1RamObj        Pointer to core local L1 RAM object to allocate local memory
- *                                  for the DPU, only for scratch purposes
- *  @param[in]  window              Pointer to doppler FFT window coefficients buffer
- *  @param[in]  windowSize          Doppler FFT window size in bytes. See Doppler DPU
- *                                  configuration for more information.
- *  @param[in]  twiddleBuf          Pointer to doppler FFT twiddle buffer
- *  @param[in]  twiddleSize         Doppler FFT twiddle buffer size in bytes. See Doppler DPU
- *                                  configuration for more information.
- *  @param[in]  dftSinCosTable      Pointer to DFT Sin/Cos table buffer
- *  @param[in]  dftSinCosTableSize  DFT Sin/Cos Table size in bytes. See Doppler DPU
- *                                  configuration for more information.
- *  @param[out] cfgSave             Configuration that is built in local
- *                                  (stack) variable is saved here. This is for facilitating
- *                                  quick reconfiguration later without having to go through
- *                                  the construction of the configuration.
+ *  @param[in] obj       Pointer to DPC object
+ *  @param[in] cfg       Pointer to overload governor configuration
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
  *
  *  @retval
  *      Success -   0
  *  @retval
  *      Error   -   <0
- *
- *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
  */
-static int32_t DPC_ObjDetDSP_dopplerConfig
-(
-    DPU_DopplerProcDSP_Handle dpuHandle,
-    DPC_ObjectDetection_StaticCfg *staticCfg,
-    uint8_t                       log2NumDopplerBins,
-    DPC_ObjectDetection_DynCfg    *dynCfg,
-    EDMA_Handle                   edmaHandle,
-    DPIF_RadarCube                *radarCube,
-    DPIF_DetMatrix                *detMatrix,
-    MemPoolObj                    *CoreL2RamObj,
-    MemPoolObj                    *CoreL1RamObj,
-    int32_t                       *window,
-    uint32_t                      windowSize,
-    cmplx32ReIm_t                 *twiddleBuf,
-    uint32_t                      twiddleSize,
-    cmplx16ImRe_t                 *dftSinCosTable,
-    uint32_t                      dftSinCosTableSize,
-    DPU_DopplerProcDSP_Config     *cfgSave
-)
+static int32_t DPC_ObjDetDSP_Config_OverloadGovernorCfg(ObjDetObj *obj,
+                   DPC_ObjectDetection_OverloadGovernorCfg *cfg)
 {
     int32_t retVal = 0;
-    DPU_DopplerProcDSP_Config dopCfg;
-    DPU_DopplerProcDSP_HW_Resources  *hwRes;
-    DPU_DopplerProcDSP_StaticConfig  *dopStaticCfg;
-    DPU_DopplerProcDSP_EdmaCfg *edmaCfg;
-    DPU_DopplerProcDSP_DynamicConfig  *dopDynCfg;
-
-    hwRes = &dopCfg.hwRes;
-    dopStaticCfg = &dopCfg.staticCfg;
-    dopDynCfg = &dopCfg.dynCfg;
-    edmaCfg = &hwRes->edmaCfg;
-
-    memset(&dopCfg, 0, sizeof(dopCfg));
-
-    /* Static Configurations */
-    dopStaticCfg->numDopplerChirps   = staticCfg->numDopplerChirps;
-    dopStaticCfg->numDopplerBins     = staticCfg->numDopplerBins;
-    dopStaticCfg->numRangeBins       = staticCfg->numRangeBins;
-    dopStaticCfg->numRxAntennas      = staticCfg->ADCBufData.dataProperty.numRxAntennas;
-    dopStaticCfg->numVirtualAntennas = staticCfg->numVirtualAntennas;
-    dopStaticCfg->log2NumDopplerBins = log2NumDopplerBins;
-    dopStaticCfg->numTxAntennas      = staticCfg->numTxAntennas;
-    dopStaticCfg->isBpmEnabled       = staticCfg->isBpmEnabled;
-
-    /* Dynamic Configuration */
-    dopDynCfg->staticClutterCfg.isEnabled = dynCfg->staticClutterRemovalCfg.enabled;
-
-    /* hwRes */
-    hwRes->radarCube = *radarCube;
-    hwRes->detMatrix = *detMatrix;
-
-    /* hwRes - edmaCfg */
-    edmaCfg->edmaHandle = edmaHandle;
-
-    /* edmaIn - ping */
-    edmaCfg->edmaIn.ping.channel =            DPC_OBJDET_DPU_DOPPLERPROC_EDMAIN_PING_CH;
-    edmaCfg->edmaIn.ping.channelShadow =      DPC_OBJDET_DPU_DOPPLERPROC_EDMAIN_PING_SHADOW;
-    edmaCfg->edmaIn.ping.eventQueue =         DPC_OBJDET_DPU_DOPPLERPROC_EDMAIN_PING_EVENT_QUE;
-
-    /* edmaIn - pong */
-    edmaCfg->edmaIn.pong.channel =            DPC_OBJDET_DPU_DOPPLERPROC_EDMAIN_PONG_CH;
-    edmaCfg->edmaIn.pong.channelShadow =      DPC_OBJDET_DPU_DOPPLERPROC_EDMAIN_PONG_SHADOW;
-    edmaCfg->edmaIn.pong.eventQueue =         DPC_OBJDET_DPU_DOPPLERPROC_EDMAIN_PONG_EVENT_QUE;
-
-    /* edmaOut */
-    edmaCfg->edmaOut.channel =           DPC_OBJDET_DPU_DOPPLERPROC_EDMAOUT_PING_CH;
-    edmaCfg->edmaOut.channelShadow =     DPC_OBJDET_DPU_DOPPLERPROC_EDMAOUT_PING_SHADOW;
-    edmaCfg->edmaOut.eventQueue =        DPC_OBJDET_DPU_DOPPLERPROC_EDMAOUT_PING_EVENT_QUE;
-
-    /* hwres window */
-    hwRes->windowSize = windowSize;
-    hwRes->windowCoeff = window;
-    DPC_ObjDetDSP_GenDopplerWindow(&dopCfg);
-
-    /* hwres twiddle */
-    hwRes->twiddle32x32 = twiddleBuf;
-    hwRes->twiddleSize = twiddleSize;
 
-    /* hwres dftSinCosTable */
-    hwRes->dftSinCosSize  = dftSinCosTableSize;
-    hwRes->dftSinCosTable = dftSinCosTable;
+    if (cfg->enabled == 1)
+    {
+        if ((cfg->targetInterFrameCycles == 0U) || (cfg->aoaCyclesPerDetection == 0U))
+        {
+            retVal = DPC_OBJECTDETECTION_EINVAL__OVERLOAD_GOVERNOR_CFG;
+            goto exit;
+        }
+    }
+    obj->governorCfg = *cfg;
 
-    /* hwres - pingPong buffer*/
-    hwRes->pingPongSize = 2U * staticCfg->numDopplerChirps * sizeof(cmplx16ImRe_t);
-    hwRes->pingPongBuf  = (cmplx16ImRe_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj,
-                                                  hwRes->pingPongSize,
-                                                  DPU_DOPPLERPROCDSP_BUFFER_BYTE_ALIGNMENT);
-    DebugP_assert((int)hwRes->pingPongBuf);
+exit:
+    return retVal;
+}
 
-    /* hwres - windowing output and log2Abs output overlaid buffer*/
-    hwRes->windowingLog2AbsSize = staticCfg->numDopplerBins * sizeof(cmplx32ReIm_t);
-    hwRes->windowingLog2AbsBuf  = (cmplx32ReIm_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL2RamObj,
-                                            hwRes->windowingLog2AbsSize,
-                                            DPU_DOPPLERPROCDSP_BUFFER_BYTE_ALIGNMENT);
-    DebugP_assert((int)hwRes->windowingLog2AbsBuf);
+/**
+ *  @b Description
+ *  @n
+ *      Configures the DPC's output ring and initializes its control block.
+ *
+ *  @param[in] obj       Pointer to DPC object
+ *  @param[in] cfg       Pointer to output ring configuration
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Success -   0
+ *  @retval
+ *      Error   -   <0
+ */
+static int32_t DPC_ObjDetDSP_Config_OutputRingCfg(ObjDetObj *obj,
+                   DPC_ObjectDetection_OutputRingCfg *cfg)
+{
+    DPC_ObjectDetection_OutputRingCtrl *ctrl;
+    uint32_t slotSize;
+    int32_t retVal = 0;
 
-    /* hwres - fftOutBuf */
-    hwRes->fftOutSize = staticCfg->numDopplerBins * sizeof(cmplx32ReIm_t);
-    if (dopStaticCfg->isBpmEnabled)
+    if (cfg->addr == NULL)
     {
-        /* BPM only supports azimuth antenna */
-        hwRes->fftOutSize *= 2U;
+        obj->outputRing = NULL;
+        goto exit;
     }
 
-    hwRes->fftOutBuf = (cmplx32ReIm_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL2RamObj,
-                                                  hwRes->fftOutSize,
-                                                  DPU_DOPPLERPROCDSP_BUFFER_BYTE_ALIGNMENT);
-    DebugP_assert((int)hwRes->fftOutBuf);
-
-    /* hwres - sumAbsBuf */
-    hwRes->sumAbsSize = staticCfg->numDopplerBins * sizeof(uint16_t);
-    hwRes->sumAbsBuf  = (uint16_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj,
-                                                  hwRes->sumAbsSize,
-                                                  DPU_DOPPLERPROCDSP_BUFFER_BYTE_ALIGNMENT);
-    DebugP_assert((int)hwRes->sumAbsBuf);
+    if (MEM_IS_NOT_ALIGN(cfg->addr, DPC_OBJDET_OUTPUT_RING_BYTE_ALIGNMENT) ||
+        (cfg->numSlots == 0U) ||
+        (cfg->size < sizeof(DPC_ObjectDetection_OutputRingCtrl)))
+    {
+        retVal = DPC_OBJECTDETECTION_EINVAL__OUTPUT_RING_CFG;
+        goto exit;
+    }
 
-    retVal = DPU_DopplerProcDSP_config(dpuHandle, &dopCfg);
-    if (retVal != 0)
+    slotSize = (cfg->size - sizeof(DPC_ObjectDetection_OutputRingCtrl)) / cfg->numSlots;
+    slotSize -= slotSize % DPC_OBJDET_OUTPUT_RING_BYTE_ALIGNMENT;
+    if (slotSize < DPC_OBJDET_OUTPUT_RING_MIN_SLOT_SIZE)
     {
+        retVal = DPC_OBJECTDETECTION_EINVAL__OUTPUT_RING_CFG;
         goto exit;
     }
 
-    /* store configuration for use in intra-sub-frame processing and
-     * inter-sub-frame switching, although window will need to be regenerated */
-    *cfgSave = dopCfg;
+    ctrl = (DPC_ObjectDetection_OutputRingCtrl *)cfg->addr;
+    memset((void *)ctrl, 0, sizeof(DPC_ObjectDetection_OutputRingCtrl));
+    ctrl->numSlots = cfg->numSlots;
+    ctrl->slotSize = slotSize;
+    obj->outputRing = ctrl;
 
 exit:
     return retVal;
@@ -1301,22 +1357,620 @@ exit:
 /**
  *  @b Description
  *  @n
- *     Configure CFARCA DPU.
+ *      Selects where AoA writes the point cloud of the frame: in place in the next free
+ *      slot of the output ring, or in the DPC's own buffers if the ring is not configured
+ *      or is full.
  *
- *  @param[in]  dpuHandle               Handle to CFARCA DPU
- *  @param[in]  subFrameObj             Pointer to subFrame data object
- *  @param[in]  edmaHandle              Handle to edma driver to be used for the DPU
- *  @param[in]  detMatrix               Pointer to DPIF detection matrix, which will be the input
- *                                      to the CFARCA
- *  @param[in]  cfarRngDopSnrList       Pointer to range-doppler SNR list, which will be
- *                                      the output of CFARCA
- *  @param[in]  cfarRngDopSnrListSize   Range-doppler SNR List Size to which the list will be
- *                                      capped.
- *  @param[in]  CoreL2RamObj            Pointer to core local L2 RAM object to allocate local memory
- *                                      for the DPU, only for scratch purposes
- *  @param[in]  CoreL1RamObj            Pointer to core local L1 RAM object to allocate local memory
- *                                      for the DPU, only for scratch purposes
- *  @param[in]  rangeBias               Range Bias which will be used to adjust fov min value.
+ *  @param[in]  ring        Pointer to the output ring control block, NULL if not configured
+ *  @param[in]  subFrmObj   Pointer to sub-frame object
+ *  @param[out] pointCloudOut Point cloud buffers selected
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Pointer to the slot, NULL if the frame is not written in the ring.
+ */
+static uint8_t *DPC_ObjDetDSP_outputRingReserve
+(
+    DPC_ObjectDetection_OutputRingCtrl *ring,
+    SubFrameObj *subFrmObj,
+    DPU_AoAProcDSP_PointCloudOutCfg *pointCloudOut
+)
+{
+    uint8_t *slot = NULL;
+
+    pointCloudOut->detObjOut         = subFrmObj->dpuCfg.aoaCfg.res.detObjOut;
+    pointCloudOut->detObjOutSideInfo = subFrmObj->dpuCfg.aoaCfg.res.detObjOutSideInfo;
+
+    if (ring != NULL)
+    {
+        if ((ring->writeIdx - ring->readIdx) >= ring->numSlots)
+        {
+            ring->numFramesDropped++;
+        }
+        else
+        {
+            /* The slot is written after readIdx shows the consumer is done with it */
+            DPC_OBJDET_OUTPUT_RING_BARRIER();
+            slot = (uint8_t *)(ring + 1) + (ring->writeIdx % ring->numSlots) * ring->slotSize;
+            pointCloudOut->detObjOut = (DPIF_PointCloudCartesian *)(slot +
+                DPC_OBJDET_OUTPUT_RING_POINT_CLOUD_OFFSET);
+            pointCloudOut->detObjOutSideInfo = (DPIF_PointCloudSideInfo *)(slot +
+                DPC_OBJDET_OUTPUT_RING_SIDE_INFO_TLV_OFFSET + sizeof(DPC_ObjectDetection_TlvHeader));
+        }
+    }
+    return slot;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Writes a TLV header in an output ring slot.
+ *
+ *  @param[in]  slot        Pointer to the slot
+ *  @param[in]  offset      Offset of the TLV header in the slot
+ *  @param[in]  type        TLV type
+ *  @param[in]  length      Length in bytes of the payload
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Offset of the end of the TLV in the slot.
+ */
+static uint32_t DPC_ObjDetDSP_outputRingWriteTlv
+(
+    uint8_t     *slot,
+    uint32_t    offset,
+    uint32_t    type,
+    uint32_t    length
+)
+{
+    DPC_ObjectDetection_TlvHeader *tlv = (DPC_ObjectDetection_TlvHeader *)(slot + offset);
+
+    tlv->type   = type;
+    tlv->length = length;
+    return offset + sizeof(DPC_ObjectDetection_TlvHeader) + length;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Completes the frame written in place by AoA in an output ring slot (frame header,
+ *      TLV headers, heat map) and publishes it to the consumer.
+ *
+ *  @param[in]  ring        Pointer to the output ring control block
+ *  @param[in]  slot        Pointer to the slot returned by @ref DPC_ObjDetDSP_outputRingReserve
+ *  @param[in]  result      Pointer to the result of the frame
+ *  @param[in]  frameNumber Frame number
+ *  @param[in]  isHeatMapUpdated Range-azimuth heat map was refreshed in the frame
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+static void DPC_ObjDetDSP_outputRingCommit
+(
+    DPC_ObjectDetection_OutputRingCtrl *ring,
+    uint8_t     *slot,
+    DPC_ObjectDetection_ExecuteResult *result,
+    uint32_t    frameNumber,
+    bool        isHeatMapUpdated
+)
+{
+    DPC_ObjectDetection_TlvFrameHeader *frame = (DPC_ObjectDetection_TlvFrameHeader *)slot;
+    uint32_t pointCloudLen, sideInfoLen, heatMapLen, offset;
+
+    pointCloudLen = result->numObjOut * sizeof(DPIF_PointCloudCartesian);
+    sideInfoLen   = result->numObjOut * sizeof(DPIF_PointCloudSideInfo);
+
+    frame->numTlvs = 2U;
+    offset = DPC_ObjDetDSP_outputRingWriteTlv(slot, sizeof(DPC_ObjectDetection_TlvFrameHeader),
+                 DPC_OBJDET_TLV_TYPE_POINT_CLOUD, pointCloudLen);
+
+    /* Skip the unused part of the point cloud TLV */
+    if (offset < DPC_OBJDET_OUTPUT_RING_SIDE_INFO_TLV_OFFSET)
+    {
+        DPC_ObjDetDSP_outputRingWriteTlv(slot, offset, DPC_OBJDET_TLV_TYPE_PADDING,
+            DPC_OBJDET_OUTPUT_RING_SIDE_INFO_TLV_OFFSET - offset - sizeof(DPC_ObjectDetection_TlvHeader));
+        frame->numTlvs++;
+    }
+
+    offset = DPC_ObjDetDSP_outputRingWriteTlv(slot, DPC_OBJDET_OUTPUT_RING_SIDE_INFO_TLV_OFFSET,
+                 DPC_OBJDET_TLV_TYPE_SIDE_INFO, sideInfoLen);
+
+    /* The heat map is refreshed incrementally in the AoA buffer, it is copied */
+    heatMapLen = result->azimuthStaticHeatMapSize * sizeof(cmplx16ImRe_t);
+    if ((isHeatMapUpdated == true) &&
+        ((offset + sizeof(DPC_ObjectDetection_TlvHeader) + heatMapLen) <= ring->slotSize))
+    {
+        offset = DPC_ObjDetDSP_outputRingWriteTlv(slot, offset,
+                     DPC_OBJDET_TLV_TYPE_AZIMUTH_HEAT_MAP, heatMapLen);
+        memcpy((void *)(slot + offset - heatMapLen), (void *)result->azimuthStaticHeatMap, heatMapLen);
+        frame->numTlvs++;
+    }
+
+    frame->totalLen     = offset;
+    frame->frameNumber  = frameNumber;
+    frame->subFrameIdx  = result->subFrameIdx;
+    frame->numObj       = result->numObjOut;
+    frame->degradations = result->overload.degradations;
+
+    /* Publish the frame once the slot content is written */
+    DPC_OBJDET_OUTPUT_RING_BARRIER();
+    ring->writeIdx = ring->writeIdx + 1U;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Overload governor decision. Predicts the AoA cycles from the number of CFAR
+ *      detections and selects the degradations, in the order of
+ *      @ref DPC_ObjectDetection_OverloadGovernorCfg_t, that make the inter-frame
+ *      processing fit its target.
+ *
+ *  @param[in]  cfg                 Pointer to overload governor configuration
+ *  @param[in]  elapsedCycles       Cycles of the inter-frame processing before AoA
+ *  @param[in]  numDetections       Number of CFAR detections
+ *  @param[in]  isMultiPeakEnabled  Multi-peak search is configured
+ *  @param[in]  isHeatMapEnabled    Range-azimuth heat map is configured
+ *  @param[out] report              Degradations selected
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Number of detections for AoA to process.
+ */
+static uint32_t DPC_ObjDetDSP_overloadGovernorPlan
+(
+    DPC_ObjectDetection_OverloadGovernorCfg *cfg,
+    uint32_t    elapsedCycles,
+    uint32_t    numDetections,
+    bool        isMultiPeakEnabled,
+    bool        isHeatMapEnabled,
+    DPC_ObjectDetection_OverloadReport *report
+)
+{
+    uint32_t budget;
+    uint32_t fixedCycles, cyclesPerDetection;
+    uint32_t maxNumDetections;
+    uint64_t predictedCycles;
+
+    report->degradations = 0;
+    report->numDetectionsDropped = 0;
+
+    if (cfg->targetInterFrameCycles > elapsedCycles)
+    {
+        budget = cfg->targetInterFrameCycles - elapsedCycles;
+    }
+    else
+    {
+        budget = 0;
+    }
+
+    fixedCycles = cfg->aoaFixedCycles;
+    if (isHeatMapEnabled == true)
+    {
+        fixedCycles += cfg->heatMapCycles;
+    }
+    cyclesPerDetection = cfg->aoaCyclesPerDetection;
+    if (isMultiPeakEnabled == true)
+    {
+        cyclesPerDetection += cfg->multiPeakCyclesPerDetection;
+    }
+    predictedCycles = fixedCycles + (uint64_t)numDetections * cyclesPerDetection;
+
+    if ((predictedCycles > budget) && (isMultiPeakEnabled == true))
+    {
+        report->degradations |= DPC_OBJDET_OVERLOAD_MULTI_PEAK_DISABLED;
+        cyclesPerDetection = cfg->aoaCyclesPerDetection;
+        predictedCycles = fixedCycles + (uint64_t)numDetections * cyclesPerDetection;
+    }
+
+    if ((predictedCycles > budget) && (isHeatMapEnabled == true))
+    {
+        report->degradations |= DPC_OBJDET_OVERLOAD_HEAT_MAP_SKIPPED;
+        fixedCycles = cfg->aoaFixedCycles;
+        predictedCycles = fixedCycles + (uint64_t)numDetections * cyclesPerDetection;
+    }
+
+    if (predictedCycles > budget)
+    {
+        if (budget > fixedCycles)
+        {
+            maxNumDetections = (budget - fixedCycles) / cyclesPerDetection;
+        }
+        else
+        {
+            maxNumDetections = 0;
+        }
+        maxNumDetections = MAX(maxNumDetections, cfg->minNumAoaDetections);
+
+        if (maxNumDetections < numDetections)
+        {
+            report->degradations |= DPC_OBJDET_OVERLOAD_DETECTIONS_CAPPED;
+            report->numDetectionsDropped = numDetections - maxNumDetections;
+            numDetections = maxNumDetections;
+            predictedCycles = fixedCycles + (uint64_t)numDetections * cyclesPerDetection;
+        }
+    }
+
+    predictedCycles += elapsedCycles;
+    report->predictedInterFrameCycles = (uint32_t)MIN(predictedCycles, 0xFFFFFFFFU);
+
+    return(numDetections);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Returns the number of detections of the CFAR detection list with an SNR of
+ *      at least the given threshold.
+ *
+ *  @param[in]  list            CFAR detection list
+ *  @param[in]  numDetections   Number of detections in the list
+ *  @param[in]  snrThreshold    SNR threshold
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Number of detections
+ */
+static uint32_t DPC_ObjDetDSP_countDetectionsAbove
+(
+    DPIF_CFARDetList    *list,
+    uint32_t            numDetections,
+    int32_t             snrThreshold
+)
+{
+    uint32_t count = 0;
+    uint32_t i;
+
+    for (i = 0; i < numDetections; i++)
+    {
+        if ((int32_t)list[i].snr >= snrThreshold)
+        {
+            count++;
+        }
+    }
+    return(count);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Moves the numKeep detections of highest SNR to the head of the CFAR detection
+ *      list, so that the detections dropped by the overload governor are the weakest
+ *      ones rather than the ones at the end of the list, i.e. the farthest range bins.
+ *      The kept detections stay in their CFAR order; of the detections with the SNR
+ *      of the weakest kept one, the first ones in the list are kept. The dropped
+ *      detections are overwritten.
+ *
+ *      The SNR of the numKeep-th strongest detection is found by a binary search over
+ *      the SNR range, which needs no scratch memory, then the list is compacted in place.
+ *
+ *  @param[in,out]  list            CFAR detection list
+ *  @param[in]      numDetections   Number of detections in the list
+ *  @param[in]      numKeep         Number of detections to keep
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+static void DPC_ObjDetDSP_selectStrongestDetections
+(
+    DPIF_CFARDetList    *list,
+    uint32_t            numDetections,
+    uint32_t            numKeep
+)
+{
+    int32_t  lo, hi, mid;
+    uint32_t numAtThreshold;
+    uint32_t i, j;
+
+    if ((numKeep == 0U) || (numKeep >= numDetections))
+    {
+        return;
+    }
+
+    /* Highest SNR threshold with at least numKeep detections at or above it */
+    lo = -32768;
+    hi = 65535;
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo + 1) / 2;
+        if (DPC_ObjDetDSP_countDetectionsAbove(list, numDetections, mid) >= numKeep)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid - 1;
+        }
+    }
+
+    /* Detections at the threshold that fit after the stronger ones */
+    numAtThreshold = numKeep - DPC_ObjDetDSP_countDetectionsAbove(list, numDetections, lo + 1);
+
+    /* Stable compaction, the write index never passes the read index */
+    j = 0;
+    for (i = 0; i < numDetections; i++)
+    {
+        if ((int32_t)list[i].snr > lo)
+        {
+            list[j++] = list[i];
+        }
+        else if (((int32_t)list[i].snr == lo) && (numAtThreshold > 0U))
+        {
+            list[j++] = list[i];
+            numAtThreshold--;
+        }
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Applies the overload degradations to the AoA DPU of a sub-frame, or restores
+ *      the sub-frame's configuration after the frame. The heat map refresh is skipped
+ *      for the next AoA processing only, so it needs no restore and the heat map
+ *      stays valid.
+ *
+ *  @param[in]  subFrmObj       Pointer to sub-frame object
+ *  @param[in]  degradations    Bit mask of DPC_OBJDET_OVERLOAD_xxx degradations
+ *  @param[in]  isDegraded      true to apply the degradations, false to restore
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Success -   0
+ *  @retval
+ *      Error   -   <0
+ */
+static int32_t DPC_ObjDetDSP_overloadGovernorApply
+(
+    SubFrameObj *subFrmObj,
+    uint32_t    degradations,
+    bool        isDegraded
+)
+{
+    DPU_AoAProc_MultiObjBeamFormingCfg multiObjBeamFormingCfg;
+    bool skipHeatMapRefresh = true;
+    int32_t retVal = 0;
+
+    if ((degradations & DPC_OBJDET_OVERLOAD_MULTI_PEAK_DISABLED) != 0U)
+    {
+        multiObjBeamFormingCfg = subFrmObj->dynCfg.multiObjBeamFormingCfg;
+        if (isDegraded == true)
+        {
+            multiObjBeamFormingCfg.enabled = 0;
+        }
+        retVal = DPU_AoAProcDSP_control(subFrmObj->dpuAoAObj,
+                     DPU_AoAProcDSP_Cmd_MultiObjBeamFormingCfg,
+                     &multiObjBeamFormingCfg,
+                     sizeof(DPU_AoAProc_MultiObjBeamFormingCfg));
+        if (retVal != 0)
+        {
+            goto exit;
+        }
+    }
+
+    if (((degradations & DPC_OBJDET_OVERLOAD_HEAT_MAP_SKIPPED) != 0U) && (isDegraded == true))
+    {
+        retVal = DPU_AoAProcDSP_control(subFrmObj->dpuAoAObj,
+                     DPU_AoAProcDSP_Cmd_SkipHeatMapRefresh,
+                     &skipHeatMapRefresh,
+                     sizeof(bool));
+        if (retVal != 0)
+        {
+            goto exit;
+        }
+    }
+
+exit:
+    return retVal;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *     Configure Doppler DPU.
+ *
+ *  @param[in]  dpuHandle           Handle to Doppler DPU
+ *  @param[in]  staticCfg           Pointer to static configuration of the sub-frame
+ *  @param[in]  log2NumDopplerBins  log2 of numDopplerBins of the static config.
+ *  @param[in]  dynCfg              Pointer to dynamic configuration of the sub-frame
+ *  @param[in]  edmaHandle          Handle to edma driver to be used for the DPU
+ *  @param[in]  radarCube           Pointer to DPIF radar cube, which will be the input
+ *                                  to doppler processing
+ *  @param[in]  detMatrix           Pointer to DPIF detection matrix, which will be the output
+ *                                  of doppler processing
+ *  @param[in]  CoreL2RamObj        Pointer to core local L2 RAM object to allocate local memory
+ *                                  for the DPU, only for scratch purposes
+ *  @param[in]  CoreL1RamObj        Pointer to core local L1 RAM object to allocate local memory
+ *                                  for the DPU, only for scratch purposes
+ *  @param[in]  window              Pointer to doppler FFT window coefficients buffer
+ *  @param[in]  windowSize          Doppler FFT window size in bytes. See Doppler DPU
+ *                                  configuration for more information.
+ *  @param[in]  twiddleBuf          Pointer to doppler FFT twiddle buffer
+ *  @param[in]  twiddleSize         Doppler FFT twiddle buffer size in bytes. See Doppler DPU
+ *                                  configuration for more information.
+ *  @param[in]  dftSinCosTable      Pointer to DFT Sin/Cos table buffer
+ *  @param[in]  dftSinCosTableSize  DFT Sin/Cos Table size in bytes. See Doppler DPU
+ *                                  configuration for more information.
+ *  @param[in]  isTablesInitialized The window, twiddle and sin/cos table are already
+ *                                  generated, e.g. shared with other instances, they
+ *                                  are not generated again.
+ *  @param[out] cfgSave             Configuration that is built in local
+ *                                  (stack) variable is saved here. This is for facilitating
+ *                                  quick reconfiguration later without having to go through
+ *                                  the construction of the configuration.
+ *
+ *  @retval
+ *      Success -   0
+ *  @retval
+ *      Error   -   <0
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ */
+static int32_t DPC_ObjDetDSP_dopplerConfig
+(
+    DPU_DopplerProcDSP_Handle dpuHandle,
+    DPC_ObjectDetection_StaticCfg *staticCfg,
+    uint8_t                       log2NumDopplerBins,
+    DPC_ObjectDetection_DynCfg    *dynCfg,
+    EDMA_Handle                   edmaHandle,
+    DPIF_RadarCube                *radarCube,
+    DPIF_DetMatrix                *detMatrix,
+    MemPoolObj                    *CoreL2RamObj,
+    MemPoolObj                    *CoreL1RamObj,
+    int32_t                       *window,
+    uint32_t                      windowSize,
+    cmplx32ReIm_t                 *twiddleBuf,
+    uint32_t                      twiddleSize,
+    cmplx16ImRe_t                 *dftSinCosTable,
+    uint32_t                      dftSinCosTableSize,
+    bool                          isTablesInitialized,
+    DPU_DopplerProcDSP_Config     *cfgSave
+)
+{
+    int32_t retVal = 0;
+    DPU_DopplerProcDSP_Config dopCfg;
+    DPU_DopplerProcDSP_HW_Resources  *hwRes;
+    DPU_DopplerProcDSP_StaticConfig  *dopStaticCfg;
+    DPU_DopplerProcDSP_EdmaCfg *edmaCfg;
+    DPU_DopplerProcDSP_DynamicConfig  *dopDynCfg;
+
+    hwRes = &dopCfg.hwRes;
+    dopStaticCfg = &dopCfg.staticCfg;
+    dopDynCfg = &dopCfg.dynCfg;
+    edmaCfg = &hwRes->edmaCfg;
+
+    memset(&dopCfg, 0, sizeof(dopCfg));
+
+    /* Static Configurations */
+    dopStaticCfg->numDopplerChirps   = staticCfg->numDopplerChirps;
+    dopStaticCfg->numDopplerBins     = staticCfg->numDopplerBins;
+    dopStaticCfg->numRangeBins       = staticCfg->numRangeBins;
+    dopStaticCfg->numRxAntennas      = staticCfg->ADCBufData.dataProperty.numRxAntennas;
+    dopStaticCfg->numVirtualAntennas = staticCfg->numVirtualAntennas;
+    dopStaticCfg->log2NumDopplerBins = log2NumDopplerBins;
+    dopStaticCfg->numTxAntennas      = staticCfg->numTxAntennas;
+    dopStaticCfg->isBpmEnabled       = staticCfg->isBpmEnabled;
+
+    /* Dynamic Configuration */
+    dopDynCfg->staticClutterCfg.isEnabled = dynCfg->staticClutterRemovalCfg.enabled;
+
+    /* hwRes */
+    hwRes->radarCube = *radarCube;
+    hwRes->detMatrix = *detMatrix;
+
+    /* hwRes - edmaCfg */
+    edmaCfg->edmaHandle = edmaHandle;
+
+    /* edmaIn - ping */
+    edmaCfg->edmaIn.ping.channel =            DPC_OBJDET_DPU_DOPPLERPROC_EDMAIN_PING_CH;
+    edmaCfg->edmaIn.ping.channelShadow =      DPC_OBJDET_DPU_DOPPLERPROC_EDMAIN_PING_SHADOW;
+    edmaCfg->edmaIn.ping.eventQueue =         DPC_OBJDET_DPU_DOPPLERPROC_EDMAIN_PING_EVENT_QUE;
+
+    /* edmaIn - pong */
+    edmaCfg->edmaIn.pong.channel =            DPC_OBJDET_DPU_DOPPLERPROC_EDMAIN_PONG_CH;
+    edmaCfg->edmaIn.pong.channelShadow =      DPC_OBJDET_DPU_DOPPLERPROC_EDMAIN_PONG_SHADOW;
+    edmaCfg->edmaIn.pong.eventQueue =         DPC_OBJDET_DPU_DOPPLERPROC_EDMAIN_PONG_EVENT_QUE;
+
+    /* edmaOut */
+    edmaCfg->edmaOut.channel =           DPC_OBJDET_DPU_DOPPLERPROC_EDMAOUT_PING_CH;
+    edmaCfg->edmaOut.channelShadow =     DPC_OBJDET_DPU_DOPPLERPROC_EDMAOUT_PING_SHADOW;
+    edmaCfg->edmaOut.eventQueue =        DPC_OBJDET_DPU_DOPPLERPROC_EDMAOUT_PING_EVENT_QUE;
+
+    /* hwres window */
+    hwRes->windowSize = windowSize;
+    hwRes->windowCoeff = window;
+    if (isTablesInitialized == false)
+    {
+        DPC_ObjDetDSP_GenDopplerWindow(&dopCfg);
+    }
+
+    /* hwres twiddle */
+    hwRes->twiddle32x32 = twiddleBuf;
+    hwRes->twiddleSize = twiddleSize;
+
+    /* hwres dftSinCosTable */
+    hwRes->dftSinCosSize  = dftSinCosTableSize;
+    hwRes->dftSinCosTable = dftSinCosTable;
+    hwRes->isTablesInitialized = isTablesInitialized;
+
+    /* hwres - pingPong buffer*/
+    hwRes->pingPongSize = 2U * staticCfg->numDopplerChirps * sizeof(cmplx16ImRe_t);
+    hwRes->pingPongBuf  = (cmplx16ImRe_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj,
+                                                  hwRes->pingPongSize,
+                                                  DPU_DOPPLERPROCDSP_BUFFER_BYTE_ALIGNMENT);
+    DebugP_assert((int)hwRes->pingPongBuf);
+
+    /* hwres - windowing output and log2Abs output overlaid buffer*/
+    hwRes->windowingLog2AbsSize = staticCfg->numDopplerBins * sizeof(cmplx32ReIm_t);
+    hwRes->windowingLog2AbsBuf  = (cmplx32ReIm_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL2RamObj,
+                                            hwRes->windowingLog2AbsSize,
+                                            DPU_DOPPLERPROCDSP_BUFFER_BYTE_ALIGNMENT);
+    DebugP_assert((int)hwRes->windowingLog2AbsBuf);
+
+    /* hwres - fftOutBuf */
+    hwRes->fftOutSize = staticCfg->numDopplerBins * sizeof(cmplx32ReIm_t);
+    if (dopStaticCfg->isBpmEnabled)
+    {
+        /* BPM only supports azimuth antenna */
+        hwRes->fftOutSize *= 2U;
+    }
+
+    hwRes->fftOutBuf = (cmplx32ReIm_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL2RamObj,
+                                                  hwRes->fftOutSize,
+                                                  DPU_DOPPLERPROCDSP_BUFFER_BYTE_ALIGNMENT);
+    DebugP_assert((int)hwRes->fftOutBuf);
+
+    /* hwres - sumAbsBuf */
+    hwRes->sumAbsSize = staticCfg->numDopplerBins * sizeof(uint16_t);
+    hwRes->sumAbsBuf  = (uint16_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj,
+                                                  hwRes->sumAbsSize,
+                                                  DPU_DOPPLERPROCDSP_BUFFER_BYTE_ALIGNMENT);
+    DebugP_assert((int)hwRes->sumAbsBuf);
+
+    retVal = DPU_DopplerProcDSP_config(dpuHandle, &dopCfg);
+    if (retVal != 0)
+    {
+        goto exit;
+    }
+
+    /* store configuration for use in intra-sub-frame processing and
+     * inter-sub-frame switching, although window will need to be regenerated */
+    *cfgSave = dopCfg;
+
+exit:
+    return retVal;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *     Configure CFARCA DPU.
+ *
+ *  @param[in]  dpuHandle               Handle to CFARCA DPU
+ *  @param[in]  subFrameObj             Pointer to subFrame data object
+ *  @param[in]  edmaHandle              Handle to edma driver to be used for the DPU
+ *  @param[in]  detMatrix               Pointer to DPIF detection matrix, which will be the input
+ *                                      to the CFARCA
+ *  @param[in]  cfarRngDopSnrList       Pointer to range-doppler SNR list, which will be
+ *                                      the output of CFARCA
+ *  @param[in]  cfarRngDopSnrListSize   Range-doppler SNR List Size to which the list will be
+ *                                      capped.
+ *  @param[in]  cfarThresholdLut        Pointer to per range bin threshold table, not shared
+ *                                      with other DPUs
+ *  @param[in]  cfarThresholdLutSize    Size of per range bin threshold table in bytes
+ *  @param[in]  CoreL2RamObj            Pointer to core local L2 RAM object to allocate local memory
+ *                                      for the DPU, only for scratch purposes
+ *  @param[in]  CoreL1RamObj            Pointer to core local L1 RAM object to allocate local memory
+ *                                      for the DPU, only for scratch purposes
+ *  @param[in]  rangeBias               Range Bias which will be used to adjust fov min value.
  *  @param[out] cfgSave                 Configuration that is built in local
  *                                      (stack) variable is saved here. This is for facilitating
  *                                      quick reconfiguration later without having to go through
@@ -1336,6 +1990,8 @@ static int32_t DPC_ObjDetDSP_CFARCAconfig
     DPIF_DetMatrix           *detMatrix,
     DPIF_CFARDetList         *cfarRngDopSnrList,
     uint32_t                 cfarRngDopSnrListSize,
+    uint16_t                 *cfarThresholdLut,
+    uint32_t                 cfarThresholdLutSize,
     MemPoolObj               *CoreL2RamObj,
     MemPoolObj               *CoreL1RamObj,
     float                    rangeBias,
@@ -1348,6 +2004,7 @@ static int32_t DPC_ObjDetDSP_CFARCAconfig
     uint32_t bitMaskCoreLocalRamSize;
     DPC_ObjectDetection_StaticCfg *staticCfg;
     DPC_ObjectDetection_DynCfg  *dynCfg;
+    bool isLocalMaxFused = false;
 
     hwRes = &cfarCfg.res;
     staticCfg = &subFrameObj->staticCfg;
@@ -1361,16 +2018,28 @@ static int32_t DPC_ObjDetDSP_CFARCAconfig
     cfarCfg.staticCfg.numRangeBins       = staticCfg->numRangeBins;
     cfarCfg.staticCfg.rangeStep          = staticCfg->rangeStep;
     cfarCfg.staticCfg.dopplerStep        = staticCfg->dopplerStep;
+    cfarCfg.staticCfg.noiseMapCfg        = staticCfg->cfarNoiseMapCfg;
+    cfarCfg.staticCfg.resetNoiseMap      = 1;
 
     /* Dynamic config */
     cfarCfg.dynCfg.fovDoppler     = &dynCfg->fovDoppler;
     cfarCfg.dynCfg.fovRange       = &dynCfg->fovRange;
     cfarCfg.dynCfg.cfarCfgDoppler = &dynCfg->cfarCfgDoppler;
     cfarCfg.dynCfg.cfarCfgRange   = &dynCfg->cfarCfgRange;
+    cfarCfg.dynCfg.rangeThresholdProfile = &dynCfg->cfarRangeThresholdProfileCfg;
 
-    /* Although CFARCA sopports both schemes, in DPC we fixed into one scheme */
-    cfarCfg.dynCfg.cfarCfgDoppler->peakGroupingScheme = DPU_CFAR_PEAK_GROUPING_DET_MATRIX_BASED;
-    cfarCfg.dynCfg.cfarCfgRange->peakGroupingScheme = DPU_CFAR_PEAK_GROUPING_DET_MATRIX_BASED;
+    /* Although CFARCA sopports several schemes, in DPC we use the detection matrix based
+     * scheme unless the fused local maximum scheme is requested for both domains */
+    if ((cfarCfg.dynCfg.cfarCfgDoppler->peakGroupingScheme == DPU_CFAR_PEAK_GROUPING_LOCAL_MAX_FUSED) &&
+        (cfarCfg.dynCfg.cfarCfgRange->peakGroupingScheme == DPU_CFAR_PEAK_GROUPING_LOCAL_MAX_FUSED))
+    {
+        isLocalMaxFused = true;
+    }
+    else
+    {
+        cfarCfg.dynCfg.cfarCfgDoppler->peakGroupingScheme = DPU_CFAR_PEAK_GROUPING_DET_MATRIX_BASED;
+        cfarCfg.dynCfg.cfarCfgRange->peakGroupingScheme = DPU_CFAR_PEAK_GROUPING_DET_MATRIX_BASED;
+    }
 
     /* Need to adjust min by range bias */
     cfarCfg.dynCfg.fovRange->min  += rangeBias;
@@ -1396,6 +2065,9 @@ static int32_t DPC_ObjDetDSP_CFARCAconfig
     hwRes->cfarRngDopSnrList = cfarRngDopSnrList;
     hwRes->cfarRngDopSnrListSize = cfarRngDopSnrListSize;
 
+    hwRes->cfarThresholdLut = cfarThresholdLut;
+    hwRes->cfarThresholdLutSize = cfarThresholdLutSize;
+
     hwRes->localDetMatrixBufferSize = MAX(staticCfg->numRangeBins,staticCfg->numDopplerBins ) * sizeof(uint16_t) * 2;
     hwRes->localDetMatrixBuffer = (uint16_t *) DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj,
                                                        hwRes->localDetMatrixBufferSize,
@@ -1415,6 +2087,32 @@ static int32_t DPC_ObjDetDSP_CFARCAconfig
                                                                DPU_CFARCAPROCDSP_SCRACHBUF_BYTE_ALIGNMENT);
     DebugP_assert(hwRes->cfarScrachBuffer != NULL);
 
+    /* Scratch buffers for local maximum peak grouping, only when it is requested */
+    if (isLocalMaxFused)
+    {
+        hwRes->cfarLocalMaxLineBufferSize = (4U * staticCfg->numRangeBins + 4U) * sizeof(uint16_t);
+        hwRes->cfarLocalMaxLineBuffer = (uint16_t *) DPC_ObjDetDSP_MemPoolAlloc(CoreL2RamObj,
+                                                                   hwRes->cfarLocalMaxLineBufferSize,
+                                                                   DPU_CFARCAPROCDSP_LOCAL_MAX_BYTE_ALIGNMENT);
+        DebugP_assert(hwRes->cfarLocalMaxLineBuffer != NULL);
+
+        hwRes->cfarLocalMaxMaskSize = (staticCfg->numRangeBins + 31U) >> 5U;
+        hwRes->cfarLocalMaxMask = (uint32_t *) DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj,
+                                                                   hwRes->cfarLocalMaxMaskSize * sizeof(uint32_t),
+                                                                   DPU_CFARCAPROCDSP_LOCAL_MAX_BYTE_ALIGNMENT);
+        DebugP_assert(hwRes->cfarLocalMaxMask != NULL);
+    }
+
+    /* hwres - noise floor map, allocate from heap, this needs to persist across
+     * frames and sub-frames */
+    if (staticCfg->cfarNoiseMapCfg.enabled)
+    {
+        hwRes->cfarNoiseMapSize = ((uint32_t)staticCfg->numRangeBins << staticCfg->cfarNoiseMapCfg.log2NumDopplerRegions) *
+                                  sizeof(uint16_t);
+        hwRes->cfarNoiseMap = (uint16_t *) MemoryP_ctrlAlloc (hwRes->cfarNoiseMapSize, 0);
+        DebugP_assert(hwRes->cfarNoiseMap != NULL);
+    }
+
     retVal = DPU_CFARCAProcDSP_config(dpuHandle, &cfarCfg);
     if (retVal != 0)
     {
@@ -1422,7 +2120,9 @@ static int32_t DPC_ObjDetDSP_CFARCAconfig
     }
 
     /* store configuration for use in intra-sub-frame processing and
-     * inter-sub-frame switching, although window will need to be regenerated */
+     * inter-sub-frame switching, although window will need to be regenerated and
+     * noise floor map should not be reset. */
+    cfarCfg.staticCfg.resetNoiseMap = 0;
     *cfgSave = cfarCfg;
 
 exit:
@@ -1453,6 +2153,8 @@ exit:
  *  @param[in]  edmaHandle              Handle to edma driver to be used for the DPU
  *  @param[in]  radarCube               Pointer to DPIF radar cube, which will be the
  *                                      input for AoA processing
+ *  @param[in]  detMatrix               Pointer to DPIF detection matrix, used by the
+ *                                      on change range-azimuth heat map update mode
  *  @param[in]  cfarRngDopSnrList       Pointer to range-doppler SNR list, which will be
  *                                      input for AoA processing
  *  @param[in]  cfarRngDopSnrListSize   Range-doppler SNR List Size to which the list
@@ -1472,6 +2174,8 @@ exit:
  *  @param[in]  angleTwiddle32x32       Pointer to angle 3D FFT twiddle buffer
  *  @param[in]  angleTwiddle32x32Size   3D (Azimuth/Elevation) FFT twiddle buffer size in bytes. See AoA DPU
  *                                      configuration for more information.
+ *  @param[in]  isTablesInitialized     The Doppler and angle FFT twiddles are already generated,
+ *                                      e.g. shared with other instances, they are not generated again.
  *  @param[out] cfgSave                 Configuration that is built in local
  *                                      (stack) variable is saved here. This is for facilitating
  *                                      quick reconfiguration later without having to go through
@@ -1492,6 +2196,7 @@ static int32_t DPC_ObjDetDSP_AoAconfig
     DPC_ObjectDetection_DynCfg       *dynCfg,
     EDMA_Handle                      edmaHandle,
     DPIF_RadarCube                   *radarCube,
+    DPIF_DetMatrix                   *detMatrix,
     DPIF_CFARDetList                 *cfarRngDopSnrList,
     uint32_t                         cfarRngDopSnrListSize,
     MemPoolObj                       *CoreL1RamObj,
@@ -1503,6 +2208,7 @@ static int32_t DPC_ObjDetDSP_AoAconfig
     uint32_t                         twiddleSize,
     cmplx32ReIm_t                    *angleTwiddle32x32,
     uint32_t                         angleTwiddle32x32Size,
+    bool                             isTablesInitialized,
     DPU_AoAProcDSP_Config            *cfgSave
 )
 {
@@ -1525,6 +2231,9 @@ static int32_t DPC_ObjDetDSP_AoAconfig
     aoaCfg.staticCfg.numVirtualAntAzim  = staticCfg->numVirtualAntAzim;
     aoaCfg.staticCfg.numVirtualAntElev  = staticCfg->numVirtualAntElev;
     aoaCfg.staticCfg.isBpmEnabled       = staticCfg->isBpmEnabled;
+    aoaCfg.staticCfg.numAngleBins       = staticCfg->numAngleBins;
+    aoaCfg.staticCfg.caponCfg           = staticCfg->caponCfg;
+    aoaCfg.staticCfg.antGeometryCfg     = staticCfg->antGeometryCfg;
 
     /* Dynamic config */
     DPC_ObjDetDSP_GetRxChPhaseComp(staticCfg, inpCommonCompRxCfg, &outCompRxCfg);
@@ -1534,6 +2243,8 @@ static int32_t DPC_ObjDetDSP_AoAconfig
     aoaCfg.dynCfg.prepareRangeAzimuthHeatMap = dynCfg->prepareRangeAzimuthHeatMap;
     aoaCfg.dynCfg.extMaxVelCfg               = &dynCfg->extMaxVelCfg;
     aoaCfg.dynCfg.staticClutterCfg.isEnabled = dynCfg->staticClutterRemovalCfg.enabled;
+    aoaCfg.dynCfg.angleInterpCfg             = dynCfg->angleInterpCfg;
+    aoaCfg.dynCfg.heatMapUpdateCfg           = dynCfg->heatMapUpdateCfg;
 
     /* Hardware Resources */
     res->radarCube = *radarCube;
@@ -1552,6 +2263,17 @@ static int32_t DPC_ObjDetDSP_AoAconfig
                                  DPC_OBJDET_POINT_CLOUD_SIDE_INFO_BYTE_ALIGNMENT);
     DebugP_assert(res->detObjOutSideInfo != NULL);
 
+    if(staticCfg->isCompactPointCloudEnabled)
+    {
+        /* Header and points are contiguous so that they can be exported as one block */
+        res->detObjOutCompactHeader = DPC_ObjDetDSP_MemPoolAlloc(CoreL2RamObj,
+                                 sizeof(DPU_AoAProc_PointCloudCompactHeader) +
+                                 res->detObjOutMaxSize * sizeof(DPU_AoAProc_PointCloudCompact),
+                                 DPU_AOAPROCDSP_POINT_CLOUD_COMPACT_BYTE_ALIGNMENT);
+        DebugP_assert(res->detObjOutCompactHeader != NULL);
+        res->detObjOutCompact = (DPU_AoAProc_PointCloudCompact *)(res->detObjOutCompactHeader + 1);
+    }
+
     res->detObj2dAzimIdx = DPC_ObjDetDSP_MemPoolAlloc(CoreL2RamObj,
                                res->detObjOutMaxSize *sizeof(uint8_t),
                                1U);
@@ -1569,10 +2291,41 @@ static int32_t DPC_ObjDetDSP_AoAconfig
                                          res->azimuthStaticHeatMapSize *sizeof(cmplx16ImRe_t),
                                          DPC_OBJDET_AZIMUTH_STATIC_HEAT_MAP_BYTE_ALIGNMENT);
         DebugP_assert(res->azimuthStaticHeatMap != NULL);
+
+        /* Zero Doppler energy of the last refresh of each range bin, kept across frames */
+        res->heatMapRefEnergySize = staticCfg->numRangeBins;
+        res->heatMapRefEnergy = (uint16_t *)DPC_ObjDetDSP_MemPoolAlloc(L3RamObj,
+                                         res->heatMapRefEnergySize * sizeof(uint16_t),
+                                         sizeof(uint16_t));
+        DebugP_assert(res->heatMapRefEnergy != NULL);
+    }
+    res->detMatrix = *detMatrix;
+
+    if(aoaCfg.staticCfg.caponCfg.enabled)
+    {
+        res->caponHeatMapSize = staticCfg->numRangeBins * staticCfg->caponCfg.numAngleBins;
+        res->caponHeatMap = (float *)DPC_ObjDetDSP_MemPoolAlloc(L3RamObj,
+                                         res->caponHeatMapSize * sizeof(float),
+                                         DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
+        DebugP_assert(res->caponHeatMap != NULL);
+
+        res->caponSteeringVecSize = 2U * sizeof(float) * staticCfg->numVirtualAntAzim *
+                                    staticCfg->caponCfg.numAngleBins;
+        res->caponSteeringVec = (float *)DPC_ObjDetDSP_MemPoolAlloc(CoreL2RamObj,
+                                         res->caponSteeringVecSize,
+                                         DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
+        DebugP_assert(res->caponSteeringVec != NULL);
+
+        res->caponSnapshotBufSize = sizeof(cmplx16ImRe_t) * staticCfg->numVirtualAntAzim *
+                                    staticCfg->numDopplerChirps;
+        res->caponSnapshotBuf = (cmplx16ImRe_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL2RamObj,
+                                         res->caponSnapshotBufSize,
+                                         DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
+        DebugP_assert(res->caponSnapshotBuf != NULL);
     }
 
     /* 3D processing buffers */
-    res->angleFftInSize = sizeof(cmplx32ReIm_t) * DPU_AOAPROCDSP_NUM_ANGLE_BINS;
+    res->angleFftInSize = sizeof(cmplx32ReIm_t) * staticCfg->numAngleBins;
     res->angleFftIn = (cmplx32ReIm_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj,
                                                   res->angleFftInSize,
                                                   DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
@@ -1580,7 +2333,7 @@ static int32_t DPC_ObjDetDSP_AoAconfig
 
     /* AOA scratch buffers */
     res->scratch1Size = MAX(sizeof(cmplx32ReIm_t) * staticCfg->numDopplerBins,
-                          (sizeof(cmplx32ReIm_t) * DPU_AOAPROCDSP_NUM_ANGLE_BINS));
+                          (sizeof(cmplx32ReIm_t) * staticCfg->numAngleBins));
 
     res->scratch1Buff = (void *)DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj,
                                                   res->scratch1Size,
@@ -1589,19 +2342,41 @@ static int32_t DPC_ObjDetDSP_AoAconfig
 
 
     res->scratch2Size = MAX(sizeof(cmplx32ReIm_t) * staticCfg->numDopplerBins,
-                          sizeof(float) * DPU_AOAPROCDSP_NUM_ANGLE_BINS);
+                          sizeof(float) * staticCfg->numAngleBins);
+    if(aoaCfg.staticCfg.antGeometryCfg.enabled)
+    {
+        res->scratch2Size = MAX(res->scratch2Size,
+                                sizeof(float) * staticCfg->antGeometryCfg.numElevBins);
+    }
 
     res->scratch2Buff = (void *)DPC_ObjDetDSP_MemPoolAlloc(CoreL2RamObj,
                                                   res->scratch2Size,
                                                   DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
     DebugP_assert(res->scratch2Buff != NULL);
 
-    res->elevationFftOutSize = sizeof(cmplx32ReIm_t) * DPU_AOAPROCDSP_NUM_ANGLE_BINS;
+    res->elevationFftOutSize = sizeof(cmplx32ReIm_t) * staticCfg->numAngleBins;
     res->elevationFftOut = (cmplx32ReIm_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj,
                                                   res->elevationFftOutSize,
                                                   DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
     DebugP_assert(res->elevationFftOut != NULL);
 
+    if(aoaCfg.staticCfg.antGeometryCfg.enabled)
+    {
+        res->angle2DFftBufSize = sizeof(cmplx32ReIm_t) *
+                                 (2U * staticCfg->antGeometryCfg.numRows * staticCfg->numAngleBins +
+                                  2U * staticCfg->antGeometryCfg.numElevBins);
+        res->angle2DFftBuf = (cmplx32ReIm_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL2RamObj,
+                                                  res->angle2DFftBufSize,
+                                                  DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
+        DebugP_assert(res->angle2DFftBuf != NULL);
+
+        res->elevTwiddleSize = sizeof(cmplx32ReIm_t) * staticCfg->antGeometryCfg.numElevBins;
+        res->elevTwiddle32x32 = (cmplx32ReIm_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL2RamObj,
+                                                  res->elevTwiddleSize,
+                                                  DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
+        DebugP_assert(res->elevTwiddle32x32 != NULL);
+    }
+
     /* Doppler calculation related buffers */
     res->pingPongSize      = 2U * sizeof(cmplx16ImRe_t) * staticCfg->numDopplerChirps;
     res->pingPongBuf       = (cmplx16ImRe_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL2RamObj,
@@ -1609,6 +2384,26 @@ static int32_t DPC_ObjDetDSP_AoAconfig
                                                   DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
     DebugP_assert(res->pingPongBuf != NULL);
 
+    /* Range bin grouping buffers are optional, they are allocated from the remaining
+     * scratch memory and grouping is disabled if they do not fit */
+    res->rangeBinDopplerFftBufSize = sizeof(cmplx32ReIm_t) * staticCfg->numTxAntennas *
+                                     staticCfg->ADCBufData.dataProperty.numRxAntennas *
+                                     staticCfg->numDopplerBins;
+    res->rangeBinDopplerFftBuf = (cmplx32ReIm_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL2RamObj,
+                                                  res->rangeBinDopplerFftBufSize,
+                                                  DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
+    res->detObjRangeBinOrderSize = staticCfg->numRangeBins + 1U + cfarRngDopSnrListSize;
+    res->detObjRangeBinOrder = (uint16_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL2RamObj,
+                                                  res->detObjRangeBinOrderSize * sizeof(uint16_t),
+                                                  sizeof(uint16_t));
+    if ((res->rangeBinDopplerFftBuf == NULL) || (res->detObjRangeBinOrder == NULL))
+    {
+        res->rangeBinDopplerFftBuf = NULL;
+        res->rangeBinDopplerFftBufSize = 0U;
+        res->detObjRangeBinOrder = NULL;
+        res->detObjRangeBinOrderSize = 0U;
+    }
+
     /* Coeff buffers */
     res->windowCoeff       = window;
     res->windowSize        = windowSize;
@@ -1618,6 +2413,7 @@ static int32_t DPC_ObjDetDSP_AoAconfig
     
     res->angleTwiddleSize  = angleTwiddle32x32Size;
     res->angleTwiddle32x32  = angleTwiddle32x32;
+    res->isTablesInitialized = isTablesInitialized;
 
     res->edmaHandle = edmaHandle;
     res->edmaPing.channel       = DPC_OBJDET_DPU_AOA_PROC_EDMA_PING_CH   ;
@@ -1642,6 +2438,207 @@ exit:
     return retVal;
 }
 
+/**
+ *  @b Description
+ *  @n
+ *     Allocates the read-only tables of the DPUs (windows, twiddles, DFT sin/cos table).
+ *     The tables are generated when the DPUs are configured. The range FFT twiddle,
+ *     which the range DPU generates at every configuration, is not one of them.
+ *
+ *  @param[in]  staticCfg       Pointer to static configuration of the sub-frame
+ *  @param[in]  CoreL2RamObj    Pointer to Core Local L2 memory pool object
+ *  @param[in]  CoreL1RamObj    Pointer to Core Local L1 memory pool object
+ *  @param[out] tables          Tables allocated
+ *
+ *  @retval
+ *      Success -   0
+ *  @retval
+ *      Error   -   <0
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ */
+static int32_t DPC_ObjDetDSP_allocTables
+(
+    DPC_ObjectDetection_StaticCfg    *staticCfg,
+    MemPoolObj                       *CoreL2RamObj,
+    MemPoolObj                       *CoreL1RamObj,
+    DPC_ObjectDetection_SharedTables *tables
+)
+{
+    int32_t retVal = 0;
+
+    memset((void *)tables, 0, sizeof(DPC_ObjectDetection_SharedTables));
+    tables->numAdcSamples    = staticCfg->ADCBufData.dataProperty.numAdcSamples;
+    tables->numRangeBins     = staticCfg->numRangeBins;
+    tables->numDopplerChirps = staticCfg->numDopplerChirps;
+    tables->numDopplerBins   = staticCfg->numDopplerBins;
+    tables->numAngleBins     = staticCfg->numAngleBins;
+
+#ifndef OBJDET_NO_RANGE
+    /* hwres - range DPU window allocate */
+    tables->rangeWindowSize = DPC_ObjDetDSP_GetRangeWinGenLen(tables->numAdcSamples) * sizeof(uint16_t);
+    tables->rangeWindow = (int16_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj, tables->rangeWindowSize,
+                                                      DPU_RANGEPROCDSP_WINDOW_BYTE_ALIGNMENT_DSP);
+    if (tables->rangeWindow == NULL)
+    {
+        retVal = DPC_OBJECTDETECTION_ENOMEM__CORE_RAM_TABLES;
+        goto exit;
+    }
+#endif
+
+    /* Doppler/AoA DPU window buffer allocation */
+    tables->dopplerWindowSize = DPC_ObjDetDSP_GetDopplerWinGenLen(tables->numDopplerChirps) * sizeof(cmplx16ImRe_t);
+    tables->dopplerWindow = DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj, tables->dopplerWindowSize,
+                                                       DPU_DOPPLERPROCDSP_BUFFER_BYTE_ALIGNMENT);
+
+    /* Doppler/AoA DPU Twiddle buffer */
+    tables->dopplerTwiddleSize = tables->numDopplerBins * sizeof(cmplx32ReIm_t);
+    tables->dopplerTwiddle = (cmplx32ReIm_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL2RamObj,
+                                              tables->dopplerTwiddleSize,
+                                              DPU_DOPPLERPROCDSP_BUFFER_BYTE_ALIGNMENT);
+
+    /* Doppler/AoA DPU DFT Sin/Cos table */
+    tables->dftSinCosTableSize = tables->numDopplerBins * sizeof(cmplx16ImRe_t);
+    tables->dftSinCosTable = (cmplx16ImRe_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj,
+                                              tables->dftSinCosTableSize,
+                                              DPU_DOPPLERPROCDSP_BUFFER_BYTE_ALIGNMENT);
+
+    /* AoA DPU Twiddle buffer */
+    tables->angleTwiddle32x32Size = sizeof(cmplx32ReIm_t) * tables->numAngleBins;
+    tables->angleTwiddle32x32 = (cmplx32ReIm_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj,
+                                          tables->angleTwiddle32x32Size,
+                                          DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
+
+    if ((tables->dopplerWindow == NULL) || (tables->dopplerTwiddle == NULL) ||
+        (tables->dftSinCosTable == NULL) || (tables->angleTwiddle32x32 == NULL))
+    {
+        retVal = DPC_OBJECTDETECTION_ENOMEM__CORE_RAM_TABLES;
+        goto exit;
+    }
+    tables->isAllocated = true;
+
+exit:
+    return retVal;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *     Stops an instance using the read-only tables of its group. The tables are
+ *     released when no instance uses them, the next pre-start configuration of an
+ *     instance of the group allocates them again, possibly with other sizes.
+ *
+ *  @param[in]  obj     Pointer to DPC object
+ *
+ *  @retval
+ *      Not Applicable.
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ */
+static void DPC_ObjDetDSP_releaseGroupTables
+(
+    ObjDetObj *obj
+)
+{
+    DPC_ObjectDetection_SharedTables *tables;
+    uintptr_t key;
+
+    if (obj->instanceGroup == NULL)
+    {
+        return;
+    }
+    tables = &obj->instanceGroup->tables;
+
+    /* Other instances of the group may get or release the tables concurrently */
+    key = HwiP_disable();
+    if (obj->isGroupTablesUser == true)
+    {
+        tables->numUsers--;
+        obj->isGroupTablesUser = false;
+    }
+    if (tables->numUsers == 0U)
+    {
+        tables->isAllocated = false;
+        tables->isGenerated = false;
+    }
+    HwiP_restore(key);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *     Gets the read-only tables of the DPUs from the instance group, allocating them
+ *     from the group memory for the first instance of the group, and counts the
+ *     instance in the users of the tables.
+ *
+ *  @param[in]  staticCfg       Pointer to static configuration of the sub-frame
+ *  @param[in]  instanceGroup   Pointer to the instance group
+ *  @param[in,out] isUser       The instance is counted in the users of the tables,
+ *                              set when it is counted by this call
+ *  @param[out] isGenerated     The tables are already generated, the configuration
+ *                              of the DPUs must not write them
+ *
+ *  @retval
+ *      Success -   0
+ *  @retval
+ *      Error   -   <0
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ */
+static int32_t DPC_ObjDetDSP_getGroupTables
+(
+    DPC_ObjectDetection_StaticCfg     *staticCfg,
+    DPC_ObjectDetection_InstanceGroup *instanceGroup,
+    bool                              *isUser,
+    bool                              *isGenerated
+)
+{
+    DPC_ObjectDetection_SharedTables *tables = &instanceGroup->tables;
+    MemPoolObj groupL2RamObj;
+    MemPoolObj groupL1RamObj;
+    int32_t retVal = 0;
+    uintptr_t key;
+
+    /* Other instances of the group may release the tables concurrently, the
+     * allocation only places the tables in the group memory */
+    key = HwiP_disable();
+    if (tables->isAllocated == false)
+    {
+        groupL2RamObj.cfg = instanceGroup->CoreL2RamCfg;
+        groupL1RamObj.cfg = instanceGroup->CoreL1RamCfg;
+        DPC_ObjDetDSP_MemPoolReset(&groupL2RamObj);
+        DPC_ObjDetDSP_MemPoolReset(&groupL1RamObj);
+
+        retVal = DPC_ObjDetDSP_allocTables(staticCfg, &groupL2RamObj, &groupL1RamObj, tables);
+        if (retVal != 0)
+        {
+            goto exit;
+        }
+        tables->CoreL2RamUsage = DPC_ObjDetDSP_MemPoolGetMaxUsage(&groupL2RamObj);
+        tables->CoreL1RamUsage = DPC_ObjDetDSP_MemPoolGetMaxUsage(&groupL1RamObj);
+    }
+    else if ((tables->numAdcSamples    != staticCfg->ADCBufData.dataProperty.numAdcSamples) ||
+             (tables->numRangeBins     != staticCfg->numRangeBins) ||
+             (tables->numDopplerChirps != staticCfg->numDopplerChirps) ||
+             (tables->numDopplerBins   != staticCfg->numDopplerBins) ||
+             (tables->numAngleBins     != staticCfg->numAngleBins))
+    {
+        retVal = DPC_OBJECTDETECTION_EINVAL__INSTANCE_GROUP_CFG;
+        goto exit;
+    }
+
+    if (*isUser == false)
+    {
+        tables->numUsers++;
+        *isUser = true;
+    }
+    *isGenerated = tables->isGenerated;
+
+exit:
+    HwiP_restore(key);
+    return retVal;
+}
+
 /**
  *  @b Description
  *  @n
@@ -1660,6 +2657,12 @@ exit:
  *     No L3 buffers are presently required that need to be preserved across sub-frames
  *     (type described in #1 above), neither are L3 scratch buffers required for
  *     intermediate processing within DPU process call.
+ *  4. The private scratch areas of #2 are placed by the lifetime of their DPU (see
+ *     @ref ScratchPlan_t), the areas of DPUs that never run at the same time overlap.
+ *  5. The read-only tables of the DPUs (windows, twiddles, DFT sin/cos table) are
+ *     allocated from the memory of the instance group if the instance is part of one,
+ *     once for all the instances of the group, otherwise as #2. Group tables are
+ *     generated by the first configuration only.
  *
  *  @param[in]  subFrameObj     Pointer to sub-frame object
  *  @param[in]  commonCfg       Pointer to pre-start common configuration
@@ -1670,10 +2673,14 @@ exit:
  *  @param[in]  L3ramObj        Pointer to L3 RAM memory pool object
  *  @param[in]  CoreL2RamObj    Pointer to Core Local L2 memory pool object
  *  @param[in]  CoreL1RamObj    Pointer to Core Local L1 memory pool object
- *  @param[out] L3RamUsage      Net L3 RAM memory usage in bytes as a result of allocation
- *                              by the DPUs.
- *  @param[out] CoreL2RamUsage  Net Local L2 RAM memory usage in bytes
- *  @param[out] CoreL1RamUsage  Net Core L1 RAM memory usage in bytes
+ *  @param[out] memUsage        Net L3, Core Local L2 and L1 RAM memory usage in bytes as
+ *                              a result of allocation by the DPUs, and the placement
+ *                              of the DPUs' scratch areas.
+ *  @param[out] pipeline        Pipelined mode state, receives the radar cubes when
+ *                              pipelined mode is enabled in the common configuration
+ *  @param[in]  instanceGroup   Instance group sharing the read-only tables, NULL if none
+ *  @param[in,out] isGroupTablesUser The instance is counted in the users of the group
+ *                              tables, set when the configuration counts it
  *
  *  @retval
  *      Success -   0
@@ -1691,9 +2698,10 @@ static int32_t DPC_ObjDetDSP_preStartConfig
     MemPoolObj                     *L3ramObj,
     MemPoolObj                     *CoreL2RamObj,
     MemPoolObj                     *CoreL1RamObj,
-    uint32_t                       *L3RamUsage,
-    uint32_t                       *CoreL2RamUsage,
-    uint32_t                       *CoreL1RamUsage
+    DPC_ObjectDetection_DPC_IOCTL_preStartCfg_memUsage *memUsage,
+    PipelineObj                    *pipeline,
+    DPC_ObjectDetection_InstanceGroup *instanceGroup,
+    bool                           *isGroupTablesUser
 )
 {
     int32_t retVal = 0;
@@ -1702,28 +2710,35 @@ static int32_t DPC_ObjDetDSP_preStartConfig
     DPIF_RadarCube radarCube;
     DPIF_DetMatrix detMatrix;
 #ifndef OBJDET_NO_RANGE
-    int16_t *rangeWindow;
-    uint32_t rangeWindowSize;
-    cmplx16ImRe_t *rangeTwiddle16x16;
-    uint32_t rangeTwiddleSize;
+    uint32_t rangeLifetime;
 #endif
     DPIF_CFARDetList *cfarRngDopSnrList;
     uint32_t cfarRngDopSnrListSize;
-    void *CoreL2ScratchStartPoolAddr;
-    void *CoreL1ScratchStartPoolAddr;
-
-    int32_t         *dopplerWindow;
-    uint32_t        dopplerWindowSize;
-    cmplx32ReIm_t   *dopplerTwiddle;
-    uint32_t        dopplerTwiddleSize;
-    cmplx16ImRe_t   *dftSinCosTable;
-    uint32_t        dftSinCosTableSize;
-    uint32_t        angleTwiddle32x32Size;
-    cmplx32ReIm_t   *angleTwiddle32x32;
+    uint16_t *cfarThresholdLut;
+    uint32_t cfarThresholdLutSize;
+    ScratchPlan CoreL2ScratchPlan;
+    ScratchPlan CoreL1ScratchPlan;
+    uint32_t    dpuId;
+    DPC_ObjectDetection_SharedTables localTables;
+    DPC_ObjectDetection_SharedTables *tables;
+    bool        isTablesInitialized = false;
+#ifndef OBJDET_NO_RANGE
+    cmplx16ImRe_t *rangeTwiddle;
+    uint32_t    rangeTwiddleSize;
+#endif
 
     staticCfg = &preStartCfg->staticCfg;
     dynCfg = &preStartCfg->dynCfg;
 
+    /* Sub-frames share the L3 memory of the heat map, so range bins
+       can only be carried over between frames without sub-frames */
+    if ((dynCfg->heatMapUpdateCfg.mode != DPU_AOAPROC_HEATMAP_UPDATE_FULL) &&
+        (commonCfg->numSubFrames > 1U))
+    {
+        retVal = DPC_OBJECTDETECTION_EINVAL__COMMAND;
+        goto exit;
+    }
+
     /* Save configs to object. We need to pass this stored config (instead of
        the input arguments to this function which will be in stack) to
        the DPU config functions inside of this function because the DPUs
@@ -1733,6 +2748,12 @@ static int32_t DPC_ObjDetDSP_preStartConfig
     subFrameObj->staticCfg = *staticCfg;
     subFrameObj->dynCfg = *dynCfg;
 
+    /* Angle FFT size of zero selects the AoA DPU default */
+    if (subFrameObj->staticCfg.numAngleBins == 0)
+    {
+        subFrameObj->staticCfg.numAngleBins = DPU_AOAPROCDSP_NUM_ANGLE_BINS;
+    }
+
     /* Run-time L3RAM memory configuration
      * By default, L3RAM memory configuration is initialized during DPC init time.
      * L3 RAM and radar cube memory configuration can also be overwritten at run time
@@ -1794,6 +2815,22 @@ static int32_t DPC_ObjDetDSP_preStartConfig
     /* Only supported radar Cube format in this DPC */
     radarCube.datafmt = DPIF_RADARCUBE_FORMAT_1;
 
+    /* L3 - second radar cube for pipelined mode, range processing starts on the first */
+    if (commonCfg->isPipelineEnabled == true)
+    {
+        pipeline->radarCube[0] = radarCube;
+        pipeline->radarCube[1].dataSize = radarCube.dataSize;
+        pipeline->radarCube[1].datafmt = radarCube.datafmt;
+        pipeline->radarCube[1].data = DPC_ObjDetDSP_MemPoolAlloc(L3ramObj, radarCube.dataSize,
+                                                 DPC_OBJDET_RADAR_CUBE_DATABUF_BYTE_ALIGNMENT);
+        if (pipeline->radarCube[1].data == NULL)
+        {
+            retVal = DPC_OBJECTDETECTION_ENOMEM__L3_RAM_RADAR_CUBE;
+            goto exit;
+        }
+        pipeline->fillIdx = 0;
+    }
+
     /* L3 - detection matrix */
     detMatrix.dataSize = staticCfg->numRangeBins * staticCfg->numDopplerBins * sizeof(uint16_t);
     detMatrix.data = DPC_ObjDetDSP_MemPoolAlloc(L3ramObj, detMatrix.dataSize,
@@ -1817,68 +2854,85 @@ static int32_t DPC_ObjDetDSP_preStartConfig
                             DPC_OBJDET_CFAR_DET_LIST_BYTE_ALIGNMENT);
     DebugP_assert(cfarRngDopSnrList != NULL);
 
-#ifndef OBJDET_NO_RANGE
-    /* hwres - range DPU window allocate and generate */
-    rangeWindowSize = DPC_ObjDetDSP_GetRangeWinGenLen(staticCfg->ADCBufData.dataProperty.numAdcSamples) * sizeof(uint16_t);
-    rangeWindow = (int16_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj, rangeWindowSize,
-                                                      DPU_RANGEPROCDSP_WINDOW_BYTE_ALIGNMENT_DSP);
-    DebugP_assert(rangeWindow != NULL);
+    /* Core Local - CFAR per range bin threshold table (range and Doppler domain) */
+    cfarThresholdLutSize = staticCfg->numRangeBins * sizeof(uint16_t) * 2U;
+    cfarThresholdLut = (uint16_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL2RamObj,
+                            cfarThresholdLutSize,
+                            DPU_CFARCAPROCDSP_THRESHOLD_LUT_BYTE_ALIGNMENT);
+    DebugP_assert(cfarThresholdLut != NULL);
+
+    /* Windows, twiddles and sin/cos table, shared by the instances of a group. Only
+     * the configuration that follows their allocation generates them, the other
+     * instances may already be processing with them. */
+    if (instanceGroup != NULL)
+    {
+        retVal = DPC_ObjDetDSP_getGroupTables(&subFrameObj->staticCfg, instanceGroup,
+                                              isGroupTablesUser, &isTablesInitialized);
+        tables = &instanceGroup->tables;
+    }
+    else
+    {
+        retVal = DPC_ObjDetDSP_allocTables(&subFrameObj->staticCfg, CoreL2RamObj, CoreL1RamObj,
+                                           &localTables);
+        tables = &localTables;
+    }
+    if (retVal != 0)
+    {
+        goto exit;
+    }
 
-    /* hwres - range DPU twiddle allocate */
+#ifndef OBJDET_NO_RANGE
+    /* Core Local - range FFT twiddle, generated by the range DPU at every configuration
+     * so never shared */
     rangeTwiddleSize = staticCfg->numRangeBins * sizeof(cmplx16ImRe_t);
-    rangeTwiddle16x16 = (cmplx16ImRe_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj,
+    rangeTwiddle = (cmplx16ImRe_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj,
                                               rangeTwiddleSize,
                                               DPU_RANGEPROCDSP_TWIDDLEBUF_BYTE_ALIGNMENT_DSP);
-    DebugP_assert(rangeTwiddle16x16 != NULL);
+    if (rangeTwiddle == NULL)
+    {
+        retVal = DPC_OBJECTDETECTION_ENOMEM__CORE_RAM_TABLES;
+        goto exit;
+    }
 #endif
 
-    /* Doppler/AoA DPU window buffer allocation and generation */
-    dopplerWindowSize = DPC_ObjDetDSP_GetDopplerWinGenLen(staticCfg->numDopplerChirps) * sizeof(cmplx16ImRe_t);
-    dopplerWindow = DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj, dopplerWindowSize, DPU_DOPPLERPROCDSP_BUFFER_BYTE_ALIGNMENT);
-    DebugP_assert(dopplerWindow != NULL);
-
-    /* Doppler/AoA DPU Twiddle buffer */
-    dopplerTwiddleSize = staticCfg->numDopplerBins * sizeof(cmplx32ReIm_t);
-    dopplerTwiddle = (cmplx32ReIm_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL2RamObj,
-                                              dopplerTwiddleSize,
-                                              DPU_DOPPLERPROCDSP_BUFFER_BYTE_ALIGNMENT);
-    DebugP_assert(dopplerTwiddle != NULL);
-
-    /* Doppler/AoA DPU DFT Sin/Cos table */
-    dftSinCosTableSize  = staticCfg->numDopplerBins * sizeof(cmplx16ImRe_t);
-    dftSinCosTable = (cmplx16ImRe_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj,
-                                              dftSinCosTableSize,
-                                              DPU_DOPPLERPROCDSP_BUFFER_BYTE_ALIGNMENT);
-    DebugP_assert(dftSinCosTable != NULL);
-
-    /* AoA DPU Twiddle buffer */
-    angleTwiddle32x32Size = sizeof(cmplx32ReIm_t) * DPU_AOAPROCDSP_NUM_ANGLE_BINS;
-    angleTwiddle32x32 = (cmplx32ReIm_t *)DPC_ObjDetDSP_MemPoolAlloc(CoreL1RamObj,
-                                          angleTwiddle32x32Size,
-                                          DPU_AOAPROCDSP_BUFFERS_BYTE_ALIGNMENT);
-    DebugP_assert(angleTwiddle32x32 != NULL);
-
     /* Remember pool (L1 & L2) position. These addresses will be the start address for scratch buffers */
-    CoreL2ScratchStartPoolAddr = DPC_ObjDetDSP_MemPoolGet(CoreL2RamObj);
-    CoreL1ScratchStartPoolAddr = DPC_ObjDetDSP_MemPoolGet(CoreL1RamObj);
+    DPC_ObjDetDSP_scratchPlanInit(&CoreL2ScratchPlan, CoreL2RamObj);
+    DPC_ObjDetDSP_scratchPlanInit(&CoreL1ScratchPlan, CoreL1RamObj);
 
+    /* The DPUs' scratch areas are placed by lifetime. The inter-frame DPUs run one after
+     * the other. In pipelined mode range processing of the next frame runs concurrently
+     * with all of them, otherwise it runs alone. */
 #ifndef OBJDET_NO_RANGE
+    rangeLifetime = (1U << DPC_OBJDET_DPU_RANGEPROC);
+    if (commonCfg->isPipelineEnabled == true)
+    {
+        rangeLifetime |= (1U << DPC_OBJDET_DPU_DOPPLERPROC) | (1U << DPC_OBJDET_DPU_CFARCAPROC) |
+                         (1U << DPC_OBJDET_DPU_AOAPROC);
+    }
+    DPC_ObjDetDSP_scratchPlanBegin(&CoreL2ScratchPlan, CoreL2RamObj, DPC_OBJDET_DPU_RANGEPROC,
+                                   rangeLifetime);
+    DPC_ObjDetDSP_scratchPlanBegin(&CoreL1ScratchPlan, CoreL1RamObj, DPC_OBJDET_DPU_RANGEPROC,
+                                   rangeLifetime);
+
     DebugP_assert(edmaHandle[DPC_OBJDET_DPU_RANGEPROC_EDMA_INST_ID] != NULL);
     retVal = DPC_ObjDetDSP_rangeConfig(subFrameObj->dpuRangeObj, &subFrameObj->staticCfg, &subFrameObj->dynCfg,
                  edmaHandle[DPC_OBJDET_DPU_RANGEPROC_EDMA_INST_ID],
                  &radarCube, CoreL2RamObj, CoreL1RamObj,
-                 rangeWindow, rangeWindowSize,
-                 rangeTwiddle16x16,rangeTwiddleSize,
+                 tables->rangeWindow, tables->rangeWindowSize,
+                 rangeTwiddle, rangeTwiddleSize, isTablesInitialized,
                  &subFrameObj->dpuCfg.rangeCfg);
     if (retVal != 0)
     {
         goto exit;
     }
+    DPC_ObjDetDSP_scratchPlanEnd(&CoreL2ScratchPlan, CoreL2RamObj, DPC_OBJDET_DPU_RANGEPROC);
+    DPC_ObjDetDSP_scratchPlanEnd(&CoreL1ScratchPlan, CoreL1RamObj, DPC_OBJDET_DPU_RANGEPROC);
 #endif
 
-    /* Rewind to the scratch beginning */
-    DPC_ObjDetDSP_MemPoolSet(CoreL2RamObj, CoreL2ScratchStartPoolAddr);
-    DPC_ObjDetDSP_MemPoolSet(CoreL1RamObj, CoreL1ScratchStartPoolAddr);
+    DPC_ObjDetDSP_scratchPlanBegin(&CoreL2ScratchPlan, CoreL2RamObj, DPC_OBJDET_DPU_CFARCAPROC,
+                                   (1U << DPC_OBJDET_DPU_CFARCAPROC));
+    DPC_ObjDetDSP_scratchPlanBegin(&CoreL1ScratchPlan, CoreL1RamObj, DPC_OBJDET_DPU_CFARCAPROC,
+                                   (1U << DPC_OBJDET_DPU_CFARCAPROC));
 
     DebugP_assert(edmaHandle[DPC_OBJDET_DPU_CFARCA_PROC_EDMA_INST_ID] != NULL);
     retVal = DPC_ObjDetDSP_CFARCAconfig(subFrameObj->dpuCFARCAObj,
@@ -1887,6 +2941,8 @@ static int32_t DPC_ObjDetDSP_preStartConfig
                  &detMatrix,
                  cfarRngDopSnrList,
                  cfarRngDopSnrListSize,
+                 cfarThresholdLut,
+                 cfarThresholdLutSize,
                  CoreL2RamObj,
                  CoreL1RamObj,
                  commonCfg->compRxChanCfg.rangeBias,
@@ -1895,10 +2951,13 @@ static int32_t DPC_ObjDetDSP_preStartConfig
     {
         goto exit;
     }
+    DPC_ObjDetDSP_scratchPlanEnd(&CoreL2ScratchPlan, CoreL2RamObj, DPC_OBJDET_DPU_CFARCAPROC);
+    DPC_ObjDetDSP_scratchPlanEnd(&CoreL1ScratchPlan, CoreL1RamObj, DPC_OBJDET_DPU_CFARCAPROC);
 
-    /* Rewind to the scratch beginning */
-    DPC_ObjDetDSP_MemPoolSet(CoreL2RamObj, CoreL2ScratchStartPoolAddr);
-    DPC_ObjDetDSP_MemPoolSet(CoreL1RamObj, CoreL1ScratchStartPoolAddr);
+    DPC_ObjDetDSP_scratchPlanBegin(&CoreL2ScratchPlan, CoreL2RamObj, DPC_OBJDET_DPU_DOPPLERPROC,
+                                   (1U << DPC_OBJDET_DPU_DOPPLERPROC));
+    DPC_ObjDetDSP_scratchPlanBegin(&CoreL1ScratchPlan, CoreL1RamObj, DPC_OBJDET_DPU_DOPPLERPROC,
+                                   (1U << DPC_OBJDET_DPU_DOPPLERPROC));
 
     retVal = DPC_ObjDetDSP_dopplerConfig(subFrameObj->dpuDopplerObj, &subFrameObj->staticCfg,
                  subFrameObj->log2NumDopplerBins, &subFrameObj->dynCfg,
@@ -1906,41 +2965,92 @@ static int32_t DPC_ObjDetDSP_preStartConfig
                  &radarCube, &detMatrix, 
                  CoreL2RamObj,
                  CoreL1RamObj,
-                 dopplerWindow, dopplerWindowSize,
-                 dopplerTwiddle, dopplerTwiddleSize,
-                 dftSinCosTable,dftSinCosTableSize,
+                 tables->dopplerWindow, tables->dopplerWindowSize,
+                 tables->dopplerTwiddle, tables->dopplerTwiddleSize,
+                 tables->dftSinCosTable, tables->dftSinCosTableSize,
+                 isTablesInitialized,
                  &subFrameObj->dpuCfg.dopplerCfg);
     if (retVal != 0)
     {
         goto exit;
     }
+    DPC_ObjDetDSP_scratchPlanEnd(&CoreL2ScratchPlan, CoreL2RamObj, DPC_OBJDET_DPU_DOPPLERPROC);
+    DPC_ObjDetDSP_scratchPlanEnd(&CoreL1ScratchPlan, CoreL1RamObj, DPC_OBJDET_DPU_DOPPLERPROC);
 
-    /* Rewind to the scratch beginning */
-    DPC_ObjDetDSP_MemPoolSet(CoreL2RamObj, CoreL2ScratchStartPoolAddr);
-    DPC_ObjDetDSP_MemPoolSet(CoreL1RamObj, CoreL1ScratchStartPoolAddr);
+    DPC_ObjDetDSP_scratchPlanBegin(&CoreL2ScratchPlan, CoreL2RamObj, DPC_OBJDET_DPU_AOAPROC,
+                                   (1U << DPC_OBJDET_DPU_AOAPROC));
+    DPC_ObjDetDSP_scratchPlanBegin(&CoreL1ScratchPlan, CoreL1RamObj, DPC_OBJDET_DPU_AOAPROC,
+                                   (1U << DPC_OBJDET_DPU_AOAPROC));
 
     DebugP_assert(edmaHandle[DPC_OBJDET_DPU_AOA_PROC_EDMA_INST_ID] != NULL);
     retVal = DPC_ObjDetDSP_AoAconfig(subFrameObj->dpuAoAObj, &commonCfg->compRxChanCfg,
                  &subFrameObj->staticCfg, &subFrameObj->dynCfg,
                  edmaHandle[DPC_OBJDET_DPU_AOA_PROC_EDMA_INST_ID],
-                 &radarCube,
+                 &radarCube, &detMatrix,
                  cfarRngDopSnrList, cfarRngDopSnrListSize,
                  CoreL1RamObj,
                  CoreL2RamObj,
                  L3ramObj,
-                 dopplerWindow, dopplerWindowSize,
-                 dopplerTwiddle, dopplerTwiddleSize,
-                 angleTwiddle32x32, angleTwiddle32x32Size,
+                 tables->dopplerWindow, tables->dopplerWindowSize,
+                 tables->dopplerTwiddle, tables->dopplerTwiddleSize,
+                 tables->angleTwiddle32x32, tables->angleTwiddle32x32Size,
+                 isTablesInitialized,
                  &subFrameObj->dpuCfg.aoaCfg);
     if (retVal != 0)
     {
         goto exit;
     }
+    DPC_ObjDetDSP_scratchPlanEnd(&CoreL2ScratchPlan, CoreL2RamObj, DPC_OBJDET_DPU_AOAPROC);
+    DPC_ObjDetDSP_scratchPlanEnd(&CoreL1ScratchPlan, CoreL1RamObj, DPC_OBJDET_DPU_AOAPROC);
+
+    /* The group tables are generated, no later configuration or sub-frame switch of
+     * this or another instance writes them again */
+    subFrameObj->isTablesInitialized = (instanceGroup != NULL);
+    if (instanceGroup != NULL)
+    {
+        instanceGroup->tables.isGenerated = true;
+        subFrameObj->dpuCfg.dopplerCfg.hwRes.isTablesInitialized = true;
+        subFrameObj->dpuCfg.aoaCfg.res.isTablesInitialized = true;
+    }
 
     /* Report RAM usage */
-    *CoreL2RamUsage = DPC_ObjDetDSP_MemPoolGetMaxUsage(CoreL2RamObj);
-    *CoreL1RamUsage = DPC_ObjDetDSP_MemPoolGetMaxUsage(CoreL1RamObj);
-    *L3RamUsage = DPC_ObjDetDSP_MemPoolGetMaxUsage(L3ramObj);
+    memUsage->CoreL2RamUsage = DPC_ObjDetDSP_MemPoolGetMaxUsage(CoreL2RamObj);
+    memUsage->CoreL1RamUsage = DPC_ObjDetDSP_MemPoolGetMaxUsage(CoreL1RamObj);
+    memUsage->L3RamUsage = DPC_ObjDetDSP_MemPoolGetMaxUsage(L3ramObj);
+    memUsage->isAoaRangeBinGroupingEnabled =
+        (subFrameObj->dpuCfg.aoaCfg.res.rangeBinDopplerFftBuf != NULL);
+
+    /* Report scratch layout */
+    memset((void *)memUsage->scratchPlan, 0, sizeof(memUsage->scratchPlan));
+    for (dpuId = 0; dpuId < DPC_OBJDET_DPU_NUM; dpuId++)
+    {
+        if (CoreL2ScratchPlan.lifetime[dpuId] == 0U)
+        {
+            continue;
+        }
+        memUsage->scratchPlan[dpuId].CoreL2RamOffset =
+            (uint32_t)(CoreL2ScratchPlan.startAddr[dpuId] - (uintptr_t)CoreL2RamObj->cfg.addr);
+        memUsage->scratchPlan[dpuId].CoreL2RamSize =
+            (uint32_t)(CoreL2ScratchPlan.endAddr[dpuId] - CoreL2ScratchPlan.startAddr[dpuId]);
+        memUsage->scratchPlan[dpuId].CoreL1RamOffset =
+            (uint32_t)(CoreL1ScratchPlan.startAddr[dpuId] - (uintptr_t)CoreL1RamObj->cfg.addr);
+        memUsage->scratchPlan[dpuId].CoreL1RamSize =
+            (uint32_t)(CoreL1ScratchPlan.endAddr[dpuId] - CoreL1ScratchPlan.startAddr[dpuId]);
+    }
+    memUsage->CoreL2RamScratchSaved = DPC_ObjDetDSP_scratchPlanGetSaved(&CoreL2ScratchPlan);
+    memUsage->CoreL1RamScratchSaved = DPC_ObjDetDSP_scratchPlanGetSaved(&CoreL1ScratchPlan);
+
+    /* Report the tables held by the group */
+    if (instanceGroup != NULL)
+    {
+        memUsage->CoreL2RamShared = instanceGroup->tables.CoreL2RamUsage;
+        memUsage->CoreL1RamShared = instanceGroup->tables.CoreL1RamUsage;
+    }
+    else
+    {
+        memUsage->CoreL2RamShared = 0;
+        memUsage->CoreL1RamShared = 0;
+    }
 
 exit:
     return retVal;
@@ -1974,22 +3084,434 @@ static void DPC_ObjectDetection_frameStart (DPM_DPCHandle handle)
     DPC_Objdet_Assert(objDetObj->dpmHandle, (objDetObj->interSubFrameProcToken == 0));
     objDetObj->interSubFrameProcToken++;
 
-    /* Increment interrupt counter for debugging purpose */
-    if (objDetObj->subFrameIndx == 0)
+    /* Increment interrupt counter for debugging purpose */
+    if (objDetObj->subFrameIndx == 0)
+    {
+        objDetObj->stats.frameStartIntCounter++;
+    }
+
+    return;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      DPC's (DPM registered) start function which is invoked by the
+ *      application using DPM_start API.
+ *
+ *  @param[in]  handle  DPM's DPC handle
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Success -   0
+ *  @retval
+ *      Error   -   <0
+ */
+static int32_t DPC_ObjectDetection_start (DPM_DPCHandle handle)
+{
+    ObjDetObj   *objDetObj;
+    int32_t retVal = 0;
+
+    objDetObj = (ObjDetObj *) handle;
+    DebugP_assert (objDetObj != NULL);
+
+    objDetObj->stats.frameStartIntCounter = 0;
+    objDetObj->prevInterFrameEndTimeStamp = 0;
+    memset((void *)objDetObj->stats.dpuStats, 0, sizeof(objDetObj->stats.dpuStats));
+    memset((void *)objDetObj->dpuCycleHist, 0,
+           objDetObj->commonCfg.numSubFrames * DPC_OBJDET_DPU_NUM * sizeof(DpuCycleHistory));
+
+    /* Start marks consumption of all pre-start configs, reset the flag to check
+     * if pre-starts were issued only after common config was issued for the next
+     * time full configuration happens between stop and start */
+    objDetObj->isCommonCfgReceived = false;
+
+    /* App must issue export of last frame after stop which will switch to sub-frame 0,
+     * so start should always see sub-frame indx of 0, check */
+    DebugP_assert(objDetObj->subFrameIndx == 0);
+
+    if(objDetObj->commonCfg.numSubFrames > 1U)
+    {
+        /* Pre-start cfgs for sub-frames may have come in any order, so need
+         * to ensure we reconfig for the current (0) sub-frame before starting */
+        DPC_ObjDetDSP_reconfigSubFrame(objDetObj, objDetObj->subFrameIndx);
+    }
+    DebugP_log0("ObjDet DPC: Start done\n");
+    return(retVal);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      DPC's (DPM registered) stop function which is invoked by the
+ *      application using DPM_stop API.
+ *
+ *  @param[in]  handle  DPM's DPC handle
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Success -   0
+ *  @retval
+ *      Error   -   <0
+ */
+static int32_t DPC_ObjectDetection_stop (DPM_DPCHandle handle)
+{
+    ObjDetObj   *objDetObj;
+
+    objDetObj = (ObjDetObj *) handle;
+    DebugP_assert (objDetObj != NULL);
+
+    /* We can be here only after complete frame processing is done, which means
+     * processing token must be 0 and subFrameIndx also 0  */
+    DebugP_assert((objDetObj->interSubFrameProcToken == 0) && (objDetObj->subFrameIndx == 0));
+
+    /* Pipelined mode: the result of the last frame is not reported. Wait for its
+     * inter-frame processing if it was released, so the DPUs are idle on return */
+    if (objDetObj->pipeline.isFrameInFlight == true)
+    {
+        if (objDetObj->pipeline.isCubePending == true)
+        {
+            objDetObj->pipeline.isCubePending = false;
+        }
+        else
+        {
+            SemaphoreP_pend(objDetObj->pipeline.procDoneSemHandle, SemaphoreP_WAIT_FOREVER);
+        }
+        objDetObj->pipeline.isFrameInFlight = false;
+    }
+
+    DebugP_log0("ObjDet DPC: Stop done\n");
+    return(0);
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Records the statistics of a DPU for the reported frame and updates the
+ *      summary of its cycles over the recent frames of the current sub-frame.
+ *
+ *  @param[in]  objDetObj           Pointer to DPC object
+ *  @param[in]  dpuId               DPU the statistics are of
+ *  @param[in]  processingCycles    Processing cycles excluding EDMA waiting time
+ *  @param[in]  waitCycles          EDMA waiting cycles
+ *  @param[in]  bytesMoved          Bytes moved by EDMA
+ *  @param[in]  numDetIn            Number of detections input to the DPU
+ *  @param[in]  numDetOut           Number of detections output by the DPU
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ *
+ *  @retval None
+ */
+static void DPC_ObjDetDSP_updateDpuStats
+(
+    ObjDetObj   *objDetObj,
+    DPC_ObjectDetection_DpuId dpuId,
+    uint32_t    processingCycles,
+    uint32_t    waitCycles,
+    uint32_t    bytesMoved,
+    uint32_t    numDetIn,
+    uint32_t    numDetOut
+)
+{
+    DPC_ObjectDetection_DpuStats *dpuStats = &objDetObj->stats.dpuStats[dpuId];
+    DpuCycleHistory *hist = &objDetObj->dpuCycleHist[objDetObj->subFrameIndx * DPC_OBJDET_DPU_NUM + dpuId];
+    uint64_t sumCycles = 0;
+    uint32_t maxCycles = 0, secondMaxCycles = 0, minCycles = 0xFFFFFFFFU;
+    uint32_t cycles;
+    uint16_t idx;
+
+    dpuStats->processingCycles = processingCycles;
+    dpuStats->waitCycles = waitCycles;
+    dpuStats->bytesMoved = bytesMoved;
+    dpuStats->numDetIn = numDetIn;
+    dpuStats->numDetOut = numDetOut;
+
+    hist->cycles[hist->writeIdx] = processingCycles + waitCycles;
+    hist->writeIdx++;
+    if (hist->writeIdx == DPC_OBJDET_DPU_STATS_HISTORY_SIZE)
+    {
+        hist->writeIdx = 0;
+    }
+    if (hist->numFrames < DPC_OBJDET_DPU_STATS_HISTORY_SIZE)
+    {
+        hist->numFrames++;
+    }
+
+    for (idx = 0; idx < hist->numFrames; idx++)
+    {
+        cycles = hist->cycles[idx];
+        sumCycles += cycles;
+        if (cycles < minCycles)
+        {
+            minCycles = cycles;
+        }
+        if (cycles > maxCycles)
+        {
+            secondMaxCycles = maxCycles;
+            maxCycles = cycles;
+        }
+        else if (cycles > secondMaxCycles)
+        {
+            secondMaxCycles = cycles;
+        }
+    }
+
+    dpuStats->cycles.numFrames = hist->numFrames;
+    dpuStats->cycles.minCycles = minCycles;
+    dpuStats->cycles.avgCycles = (uint32_t)(sumCycles / hist->numFrames);
+    dpuStats->cycles.maxCycles = maxCycles;
+
+    /* At most numFrames/100 frames may exceed the 99th percentile, which is at most one
+     * frame for a history of less than 200 frames */
+    if (hist->numFrames >= 100U)
+    {
+        dpuStats->cycles.p99Cycles = secondMaxCycles;
+    }
+    else
+    {
+        dpuStats->cycles.p99Cycles = maxCycles;
+    }
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Runs the inter-frame processing (Doppler, CFAR and AoA) on the radar cube
+ *      the Doppler and AoA DPUs are configured with and fills the DPC's execute result.
+ *
+ *  @param[in]  objDetObj           Pointer to DPC object
+ *  @param[in]  subFrmObj           Pointer to sub-frame object
+ *  @param[in]  frameStartTimeStamp Frame start time stamp of the processed frame
+ *  @param[in]  frameNumber         Frame start interrupt counter of the processed frame
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Success -   0
+ *  @retval
+ *      Error   -   <0
+ */
+static int32_t DPC_ObjDetDSP_interFrameProcess
+(
+    ObjDetObj   *objDetObj,
+    SubFrameObj *subFrmObj,
+    uint32_t    frameStartTimeStamp,
+    uint32_t    frameNumber
+)
+{
+    DPU_DopplerProcDSP_OutParams outDopplerProc;
+    DPU_CFARCAProcDSP_OutParams outCfarcaProc;
+    DPU_AoAProcDSP_OutParams outAoaProc;
+    DPC_ObjectDetection_ProcessCallBackCfg *processCallBack;
+    DPC_ObjectDetection_ExecuteResult *result;
+    DPU_AoAProcDSP_PointCloudOutCfg pointCloudOut;
+    uint8_t *outputRingSlot;
+    uint8_t numChirpsPerChirpEvent;
+    uint32_t numAoaDetIn;
+    int32_t retVal, restoreRetVal;
+
+    processCallBack = &objDetObj->processCallBackCfg;
+    result = &objDetObj->executeResult;
+    numChirpsPerChirpEvent = subFrmObj->staticCfg.ADCBufData.dataProperty.numChirpsPerChirpEvent;
+
+    if (processCallBack->processInterFrameBeginCallBackFxn != NULL)
+    {
+        (*processCallBack->processInterFrameBeginCallBackFxn)(objDetObj->subFrameIndx);
+    }
+    objDetObj->stats.interFrameStartTimeStamp = Cycleprofiler_getTimeStamp();
+
+    DebugP_log0("ObjDet DPC: Range Proc Done\n");
+
+    retVal = DPU_DopplerProcDSP_process(subFrmObj->dpuDopplerObj, &outDopplerProc);
+    if (retVal != 0)
+    {
+        goto exit;
+    }
+    DPC_ObjDetDSP_updateDpuStats(objDetObj, DPC_OBJDET_DPU_DOPPLERPROC,
+        outDopplerProc.stats.processingTime, outDopplerProc.stats.waitTime,
+        subFrmObj->dpuCfg.dopplerCfg.hwRes.radarCube.dataSize +
+        subFrmObj->dpuCfg.dopplerCfg.hwRes.detMatrix.dataSize, 0, 0);
+
+    /* Procedure for range bias measurement and Rx channels gain/phase offset measurement */
+    if(objDetObj->commonCfg.measureRxChannelBiasCfg.enabled)
+    {
+        DPC_ObjDetDSP_rangeBiasRxChPhaseMeasure(&subFrmObj->staticCfg,
+            objDetObj->commonCfg.measureRxChannelBiasCfg.targetDistance,
+            objDetObj->commonCfg.measureRxChannelBiasCfg.searchWinSize,
+            subFrmObj->dpuCfg.dopplerCfg.hwRes.detMatrix.data,
+            (uint32_t *) subFrmObj->dpuCfg.dopplerCfg.hwRes.radarCube.data,
+            &objDetObj->compRxChanCfgMeasureOut);
+    }
+
+    retVal = DPU_CFARCAProcDSP_process(subFrmObj->dpuCFARCAObj, &outCfarcaProc);
+    if (retVal != 0)
+    {
+        goto exit;
+    }
+
+    DebugP_log1("ObjDet DPC: number of detected objects after CFAR = %d\n",
+                outCfarcaProc.numCfarDetectedPoints);
+    DPC_ObjDetDSP_updateDpuStats(objDetObj, DPC_OBJDET_DPU_CFARCAPROC,
+        outCfarcaProc.stats.processingTime, outCfarcaProc.stats.waitTime,
+        subFrmObj->dpuCfg.dopplerCfg.hwRes.detMatrix.dataSize,
+        0, outCfarcaProc.numCfarDetectedPoints);
+
+    /* Degrade the AoA processing of this frame if it would overrun the target */
+    numAoaDetIn = outCfarcaProc.numCfarDetectedPoints;
+    memset((void *)&result->overload, 0, sizeof(DPC_ObjectDetection_OverloadReport));
+    if (objDetObj->governorCfg.enabled == 1)
+    {
+        numAoaDetIn = DPC_ObjDetDSP_overloadGovernorPlan(&objDetObj->governorCfg,
+                          Cycleprofiler_getTimeStamp() - objDetObj->stats.interFrameStartTimeStamp,
+                          numAoaDetIn,
+                          (subFrmObj->dynCfg.multiObjBeamFormingCfg.enabled == 1),
+                          subFrmObj->dynCfg.prepareRangeAzimuthHeatMap,
+                          &result->overload);
+        if ((result->overload.degradations & DPC_OBJDET_OVERLOAD_DETECTIONS_CAPPED) != 0U)
+        {
+            DPC_ObjDetDSP_selectStrongestDetections(subFrmObj->dpuCfg.aoaCfg.res.cfarRngDopSnrList,
+                outCfarcaProc.numCfarDetectedPoints, numAoaDetIn);
+        }
+        retVal = DPC_ObjDetDSP_overloadGovernorApply(subFrmObj, result->overload.degradations, true);
+        if (retVal != 0)
+        {
+            goto exit;
+        }
+    }
+
+    /* Point cloud written in place in the output ring when configured */
+    outputRingSlot = DPC_ObjDetDSP_outputRingReserve(objDetObj->outputRing, subFrmObj,
+                         &pointCloudOut);
+    retVal = DPU_AoAProcDSP_control(subFrmObj->dpuAoAObj,
+                 DPU_AoAProcDSP_Cmd_PointCloudOutCfg,
+                 &pointCloudOut,
+                 sizeof(DPU_AoAProcDSP_PointCloudOutCfg));
+    if (retVal != 0)
+    {
+        goto exit;
+    }
+
+    retVal = DPU_AoAProcDSP_process(subFrmObj->dpuAoAObj,
+                 numAoaDetIn, &outAoaProc);
+
+    /* Restore the configuration degraded for this frame */
+    if (result->overload.degradations != 0U)
+    {
+        restoreRetVal = DPC_ObjDetDSP_overloadGovernorApply(subFrmObj,
+                            result->overload.degradations, false);
+        if (retVal == 0)
+        {
+            retVal = restoreRetVal;
+        }
+    }
+    if (retVal != 0)
+    {
+        goto exit;
+    }
+    /* Each range bin fetch reads the Doppler chirps of all virtual antennas */
+    DPC_ObjDetDSP_updateDpuStats(objDetObj, DPC_OBJDET_DPU_AOAPROC,
+        outAoaProc.stats.processingTime, outAoaProc.stats.waitTime,
+        outAoaProc.numRangeBinFetches * subFrmObj->staticCfg.numVirtualAntennas *
+        subFrmObj->staticCfg.numDopplerChirps * sizeof(cmplx16ImRe_t),
+        numAoaDetIn, outAoaProc.numAoADetectedPoints);
+
+    /* Set DPM result with measure (bias, phase) and detection info */
+    result->numObjOut = outAoaProc.numAoADetectedPoints;
+    result->subFrameIdx = objDetObj->subFrameIndx;
+    result->objOut               = pointCloudOut.detObjOut;
+    result->objOutSideInfo       = pointCloudOut.detObjOutSideInfo;
+    result->objOutCompactHeader  = subFrmObj->dpuCfg.aoaCfg.res.detObjOutCompactHeader;
+    result->objOutCompact        = subFrmObj->dpuCfg.aoaCfg.res.detObjOutCompact;
+    result->azimuthStaticHeatMap = subFrmObj->dpuCfg.aoaCfg.res.azimuthStaticHeatMap;
+    result->azimuthStaticHeatMapSize = subFrmObj->dpuCfg.aoaCfg.res.azimuthStaticHeatMapSize;
+    result->caponHeatMap         = subFrmObj->dpuCfg.aoaCfg.res.caponHeatMap;
+    result->caponHeatMapSize     = subFrmObj->dpuCfg.aoaCfg.res.caponHeatMapSize;
+    result->radarCube            = subFrmObj->dpuCfg.aoaCfg.res.radarCube;
+    result->detMatrix            = subFrmObj->dpuCfg.dopplerCfg.hwRes.detMatrix;
+    if (objDetObj->commonCfg.measureRxChannelBiasCfg.enabled == 1)
+    {
+        result->compRxChanBiasMeasurement = &objDetObj->compRxChanCfgMeasureOut;
+    }
+    else
+    {
+        result->compRxChanBiasMeasurement = NULL;
+    }
+
+    if (outputRingSlot != NULL)
+    {
+        DPC_ObjDetDSP_outputRingCommit(objDetObj->outputRing, outputRingSlot, result,
+            frameNumber,
+            (subFrmObj->dynCfg.prepareRangeAzimuthHeatMap == true) &&
+            ((result->overload.degradations & DPC_OBJDET_OVERLOAD_HEAT_MAP_SKIPPED) == 0U));
+    }
+
+    /* interChirpProcessingMargin is the smallest margin in the frame */
+    objDetObj->stats.interChirpProcessingMargin = objDetObj->chirpMargin / numChirpsPerChirpEvent;
+
+    objDetObj->stats.interFrameEndTimeStamp = Cycleprofiler_getTimeStamp();
+
+    /* Latency and throughput of the results */
+    objDetObj->stats.frameLatency = objDetObj->stats.interFrameEndTimeStamp - frameStartTimeStamp;
+    if (objDetObj->prevInterFrameEndTimeStamp != 0U)
+    {
+        objDetObj->stats.resultPeriod = objDetObj->stats.interFrameEndTimeStamp -
+                                        objDetObj->prevInterFrameEndTimeStamp;
+    }
+    else
+    {
+        objDetObj->stats.resultPeriod = 0U;
+    }
+    objDetObj->prevInterFrameEndTimeStamp = objDetObj->stats.interFrameEndTimeStamp;
+
+    result->stats = &objDetObj->stats;
+
+exit:
+    return retVal;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      Populates the DPM result buffer with the DPC's execute result.
+ *
+ *  @param[in]  objDetObj   Pointer to DPC object
+ *  @param[out] ptrResult   Pointer to the DPM result buffer
+ *
+ *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ *
+ *  @retval
+ *      Not applicable
+ */
+static void DPC_ObjDetDSP_populateResult
+(
+    ObjDetObj   *objDetObj,
+    DPM_Buffer  *ptrResult
+)
+{
+    int32_t i;
+
+    /* populate DPM_resultBuf - first pointer and size are for results of the processing */
+    ptrResult->ptrBuffer[0] = (uint8_t *)&objDetObj->executeResult;
+    ptrResult->size[0] = sizeof(DPC_ObjectDetection_ExecuteResult);
+
+    /* clear rest of the result */
+    for (i = 1; i < DPM_MAX_BUFFER; i++)
     {
-        objDetObj->stats.frameStartIntCounter++;
+        ptrResult->ptrBuffer[i] = NULL;
+        ptrResult->size[i] = 0;
     }
-
-    return;
 }
 
 /**
  *  @b Description
  *  @n
- *      DPC's (DPM registered) start function which is invoked by the
- *      application using DPM_start API.
+ *      Pipelined mode: switches range processing to the other radar cube and the
+ *      inter-frame DPUs (Doppler and AoA) to the cube range processing just filled.
  *
- *  @param[in]  handle  DPM's DPC handle
+ *  @param[in]  objDetObj   Pointer to DPC object
+ *  @param[in]  subFrmObj   Pointer to sub-frame object
  *
  *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
  *
@@ -1998,42 +3520,72 @@ static void DPC_ObjectDetection_frameStart (DPM_DPCHandle handle)
  *  @retval
  *      Error   -   <0
  */
-static int32_t DPC_ObjectDetection_start (DPM_DPCHandle handle)
+static int32_t DPC_ObjDetDSP_pipelineSwitchRadarCube
+(
+    ObjDetObj   *objDetObj,
+    SubFrameObj *subFrmObj
+)
 {
-    ObjDetObj   *objDetObj;
-    int32_t retVal = 0;
+    PipelineObj    *pipeline = &objDetObj->pipeline;
+#ifndef OBJDET_NO_RANGE
+    DPIF_RadarCube *fillCube;
+#endif
+    DPIF_RadarCube *procCube;
+    int32_t        retVal;
 
-    objDetObj = (ObjDetObj *) handle;
-    DebugP_assert (objDetObj != NULL);
+    procCube = &pipeline->radarCube[pipeline->fillIdx];
+    pipeline->fillIdx ^= 1U;
 
-    objDetObj->stats.frameStartIntCounter = 0;
+#ifndef OBJDET_NO_RANGE
+    fillCube = &pipeline->radarCube[pipeline->fillIdx];
 
-    /* Start marks consumption of all pre-start configs, reset the flag to check
-     * if pre-starts were issued only after common config was issued for the next
-     * time full configuration happens between stop and start */
-    objDetObj->isCommonCfgReceived = false;
+    retVal = DPU_RangeProcDSP_control(subFrmObj->dpuRangeObj,
+                 DPU_RangeProcDSP_Cmd_radarCubeCfg,
+                 fillCube,
+                 sizeof(DPIF_RadarCube));
+    if (retVal != 0)
+    {
+        goto exit;
+    }
+    subFrmObj->dpuCfg.rangeCfg.hwRes.radarCube = *fillCube;
+#endif
 
-    /* App must issue export of last frame after stop which will switch to sub-frame 0,
-     * so start should always see sub-frame indx of 0, check */
-    DebugP_assert(objDetObj->subFrameIndx == 0);
+    retVal = DPU_DopplerProcDSP_control(subFrmObj->dpuDopplerObj,
+                 DPU_DopplerProcDSP_Cmd_radarCubeCfg,
+                 procCube,
+                 sizeof(DPIF_RadarCube));
+    if (retVal != 0)
+    {
+        goto exit;
+    }
+    subFrmObj->dpuCfg.dopplerCfg.hwRes.radarCube = *procCube;
 
-    if(objDetObj->commonCfg.numSubFrames > 1U)
+    retVal = DPU_AoAProcDSP_control(subFrmObj->dpuAoAObj,
+                 DPU_AoAProcDSP_Cmd_RadarCubeCfg,
+                 procCube,
+                 sizeof(DPIF_RadarCube));
+    if (retVal != 0)
     {
-        /* Pre-start cfgs for sub-frames may have come in any order, so need
-         * to ensure we reconfig for the current (0) sub-frame before starting */
-        DPC_ObjDetDSP_reconfigSubFrame(objDetObj, objDetObj->subFrameIndx);
+        goto exit;
     }
-    DebugP_log0("ObjDet DPC: Start done\n");
-    return(retVal);
+    subFrmObj->dpuCfg.aoaCfg.res.radarCube = *procCube;
+
+exit:
+    return retVal;
 }
 
 /**
  *  @b Description
  *  @n
- *      DPC's (DPM registered) stop function which is invoked by the
- *      application using DPM_stop API.
+ *      Pipelined mode: called from the execute API when range processing of a frame
+ *      is done. Waits for the inter-frame processing of the previous frame, returns its
+ *      result and hands the radar cube just filled to the inter-frame processing
+ *      (@ref DPC_OBJDET_IOCTL__PIPELINE_INTER_FRAME_PROCESS). The cube is released once
+ *      the returned result is exported, because both frames share the output buffers.
  *
- *  @param[in]  handle  DPM's DPC handle
+ *  @param[in]  objDetObj   Pointer to DPC object
+ *  @param[in]  subFrmObj   Pointer to sub-frame object
+ *  @param[out] ptrResult   Pointer to the DPM result buffer
  *
  *  \ingroup DPC_OBJDET__INTERNAL_FUNCTION
  *
@@ -2042,19 +3594,56 @@ static int32_t DPC_ObjectDetection_start (DPM_DPCHandle handle)
  *  @retval
  *      Error   -   <0
  */
-static int32_t DPC_ObjectDetection_stop (DPM_DPCHandle handle)
+static int32_t DPC_ObjDetDSP_pipelineFrameDone
+(
+    ObjDetObj   *objDetObj,
+    SubFrameObj *subFrmObj,
+    DPM_Buffer  *ptrResult
+)
 {
-    ObjDetObj   *objDetObj;
+    PipelineObj *pipeline = &objDetObj->pipeline;
+    bool        isResultReady = false;
+    int32_t     retVal = 0;
 
-    objDetObj = (ObjDetObj *) handle;
-    DebugP_assert (objDetObj != NULL);
+    if (pipeline->isFrameInFlight == true)
+    {
+        /* The previous frame's cube is refilled next, its processing must be done */
+        SemaphoreP_pend(pipeline->procDoneSemHandle, SemaphoreP_WAIT_FOREVER);
+        pipeline->isFrameInFlight = false;
 
-    /* We can be here only after complete frame processing is done, which means
-     * processing token must be 0 and subFrameIndx also 0  */
-    DebugP_assert((objDetObj->interSubFrameProcToken == 0) && (objDetObj->subFrameIndx == 0));
+        retVal = pipeline->procRetVal;
+        if (retVal != 0)
+        {
+            goto exit;
+        }
+        isResultReady = true;
+    }
 
-    DebugP_log0("ObjDet DPC: Stop done\n");
-    return(0);
+    retVal = DPC_ObjDetDSP_pipelineSwitchRadarCube(objDetObj, subFrmObj);
+    if (retVal != 0)
+    {
+        goto exit;
+    }
+
+    pipeline->frameStartTimeStamp = objDetObj->stats.frameStartTimeStamp;
+    pipeline->frameNumber = objDetObj->stats.frameStartIntCounter;
+    pipeline->isFrameInFlight = true;
+
+    if (isResultReady == true)
+    {
+        pipeline->isCubePending = true;
+        DPC_ObjDetDSP_populateResult(objDetObj, ptrResult);
+    }
+    else
+    {
+        /* First frame after start has nothing to report, so no export will
+         * follow: release the cube now and mark the end of this frame */
+        SemaphoreP_post(pipeline->cubeReadySemHandle);
+        objDetObj->interSubFrameProcToken--;
+    }
+
+exit:
+    return retVal;
 }
 
 /**
@@ -2085,15 +3674,10 @@ int32_t DPC_ObjectDetection_execute
     SubFrameObj *subFrmObj;
 #ifndef OBJDET_NO_RANGE
     DPU_RangeProcDSP_OutParams outRangeProc;
-#endif
-    DPU_DopplerProcDSP_OutParams outDopplerProc;
-    DPU_CFARCAProcDSP_OutParams outCfarcaProc;
-    DPU_AoAProcDSP_OutParams outAoaProc;
     DPC_ObjectDetection_ProcessCallBackCfg *processCallBack;
-    DPC_ObjectDetection_ExecuteResult *result;
-    int32_t retVal;
     uint8_t numChirpsPerChirpEvent;
-    int32_t i;
+#endif
+    int32_t retVal;
 
     objDetObj = (ObjDetObj *) handle;
     DebugP_assert (objDetObj != NULL);
@@ -2101,26 +3685,32 @@ int32_t DPC_ObjectDetection_execute
 
     DebugP_log1("ObjDet DPC: Processing sub-frame %d\n", objDetObj->subFrameIndx);
 
-    processCallBack = &objDetObj->processCallBackCfg;
-    result = &objDetObj->executeResult;
-
     subFrmObj = &objDetObj->subFrameObj[objDetObj->subFrameIndx];
+#ifndef OBJDET_NO_RANGE
+    processCallBack = &objDetObj->processCallBackCfg;
     numChirpsPerChirpEvent = subFrmObj->staticCfg.ADCBufData.dataProperty.numChirpsPerChirpEvent;
+#endif
 
     /*==============================================
                    Chirp Processing
      ===============================================*/
 #ifndef OBJDET_NO_RANGE
-    if (((objDetObj->chirpIndex % subFrmObj->staticCfg.numChirpsPerFrame)== 0) &&
-       (processCallBack->processFrameBeginCallBackFxn != NULL))
+    if ((objDetObj->chirpIndex % subFrmObj->staticCfg.numChirpsPerFrame)== 0)
     {
-        (*processCallBack->processFrameBeginCallBackFxn)(objDetObj->subFrameIndx);
+        if (processCallBack->processFrameBeginCallBackFxn != NULL)
+        {
+            (*processCallBack->processFrameBeginCallBackFxn)(objDetObj->subFrameIndx);
+        }
+        objDetObj->rangeProcCycles = 0;
+        objDetObj->rangeWaitCycles = 0;
     }
     retVal = DPU_RangeProcDSP_process(subFrmObj->dpuRangeObj, &outRangeProc);
     if (retVal != 0)
     {
         goto exit;
     }
+    objDetObj->rangeProcCycles += outRangeProc.stats.processingTime;
+    objDetObj->rangeWaitCycles += outRangeProc.stats.waitTime;
 
     objDetObj->chirpEndTime = Cycleprofiler_getTimeStamp();
 
@@ -2131,80 +3721,35 @@ int32_t DPC_ObjectDetection_execute
 #endif
 
     {
-        if (processCallBack->processInterFrameBeginCallBackFxn != NULL)
-        {
-            (*processCallBack->processInterFrameBeginCallBackFxn)(objDetObj->subFrameIndx);
-        }
-        objDetObj->stats.interFrameStartTimeStamp = Cycleprofiler_getTimeStamp();
-
-        DebugP_log0("ObjDet DPC: Range Proc Done\n");
-
-        retVal = DPU_DopplerProcDSP_process(subFrmObj->dpuDopplerObj, &outDopplerProc);
-        if (retVal != 0)
-        {
-            goto exit;
-        }
-
-        /* Procedure for range bias measurement and Rx channels gain/phase offset measurement */
-        if(objDetObj->commonCfg.measureRxChannelBiasCfg.enabled)
-        {
-            DPC_ObjDetDSP_rangeBiasRxChPhaseMeasure(&subFrmObj->staticCfg,
-                objDetObj->commonCfg.measureRxChannelBiasCfg.targetDistance,
-                objDetObj->commonCfg.measureRxChannelBiasCfg.searchWinSize,
-                subFrmObj->dpuCfg.dopplerCfg.hwRes.detMatrix.data,
-                (uint32_t *) subFrmObj->dpuCfg.dopplerCfg.hwRes.radarCube.data,
-                &objDetObj->compRxChanCfgMeasureOut);
-        }
-
-        retVal = DPU_CFARCAProcDSP_process(subFrmObj->dpuCFARCAObj, &outCfarcaProc);
-        if (retVal != 0)
-        {
-            goto exit;
-        }
-
-        DebugP_log1("ObjDet DPC: number of detected objects after CFAR = %d\n",
-                    outCfarcaProc.numCfarDetectedPoints);
-
-        retVal = DPU_AoAProcDSP_process(subFrmObj->dpuAoAObj,
-                     outCfarcaProc.numCfarDetectedPoints, &outAoaProc);
-        if (retVal != 0)
-        {
-            goto exit;
-        }
+#ifndef OBJDET_NO_RANGE
+        /* ADC samples in and range FFT output to the radar cube for every chirp and Rx antenna */
+        DPC_ObjDetDSP_updateDpuStats(objDetObj, DPC_OBJDET_DPU_RANGEPROC,
+            objDetObj->rangeProcCycles, objDetObj->rangeWaitCycles,
+            (uint32_t)subFrmObj->staticCfg.numChirpsPerFrame *
+            subFrmObj->staticCfg.ADCBufData.dataProperty.numRxAntennas *
+            (subFrmObj->staticCfg.ADCBufData.dataProperty.numAdcSamples +
+             subFrmObj->staticCfg.numRangeBins) * sizeof(cmplx16ImRe_t), 0, 0);
+#endif
 
-        /* Set DPM result with measure (bias, phase) and detection info */
-        result->numObjOut = outAoaProc.numAoADetectedPoints;
-        result->subFrameIdx = objDetObj->subFrameIndx;
-        result->objOut               = subFrmObj->dpuCfg.aoaCfg.res.detObjOut;
-        result->objOutSideInfo       = subFrmObj->dpuCfg.aoaCfg.res.detObjOutSideInfo;
-        result->azimuthStaticHeatMap = subFrmObj->dpuCfg.aoaCfg.res.azimuthStaticHeatMap;
-        result->azimuthStaticHeatMapSize = subFrmObj->dpuCfg.aoaCfg.res.azimuthStaticHeatMapSize;
-        result->radarCube            = subFrmObj->dpuCfg.aoaCfg.res.radarCube;
-        result->detMatrix            = subFrmObj->dpuCfg.dopplerCfg.hwRes.detMatrix;
-        if (objDetObj->commonCfg.measureRxChannelBiasCfg.enabled == 1)
+        if (objDetObj->commonCfg.isPipelineEnabled == true)
         {
-            result->compRxChanBiasMeasurement = &objDetObj->compRxChanCfgMeasureOut;
+            retVal = DPC_ObjDetDSP_pipelineFrameDone(objDetObj, subFrmObj, ptrResult);
+            if (retVal != 0)
+            {
+                goto exit;
+            }
         }
         else
         {
-            result->compRxChanBiasMeasurement = NULL;
-        }
-
-        /* interChirpProcessingMargin is the smallest margin in the frame */
-        objDetObj->stats.interChirpProcessingMargin = objDetObj->chirpMargin / numChirpsPerChirpEvent;
-
-        objDetObj->stats.interFrameEndTimeStamp = Cycleprofiler_getTimeStamp();
-        result->stats = &objDetObj->stats;
-
-        /* populate DPM_resultBuf - first pointer and size are for results of the processing */
-        ptrResult->ptrBuffer[0] = (uint8_t *)result;
-        ptrResult->size[0] = sizeof(DPC_ObjectDetection_ExecuteResult);
+            retVal = DPC_ObjDetDSP_interFrameProcess(objDetObj, subFrmObj,
+                                                     objDetObj->stats.frameStartTimeStamp,
+                                                     objDetObj->stats.frameStartIntCounter);
+            if (retVal != 0)
+            {
+                goto exit;
+            }
 
-        /* clear rest of the result */
-        for (i = 1; i < DPM_MAX_BUFFER; i++)
-        {
-            ptrResult->ptrBuffer[i] = NULL;
-            ptrResult->size[i] = 0;
+            DPC_ObjDetDSP_populateResult(objDetObj, ptrResult);
         }
 
         /* Frame is done, reset chirp index */
@@ -2275,9 +3820,21 @@ static int32_t DPC_ObjectDetection_ioctl
 
         cfg = (DPC_ObjectDetection_PreStartCommonCfg*)arg;
 
-#ifndef OBJDET_NO_RANGE
         int32_t indx;
 
+        /* Pipelining overlaps range processing with the inter-frame processing of
+         * the same (single) sub-frame configuration */
+#ifndef OBJDET_NO_RANGE
+        if ((cfg->isPipelineEnabled == true) && (cfg->numSubFrames != 1U))
+#else
+        if (cfg->isPipelineEnabled == true)
+#endif
+        {
+            retVal = DPC_OBJECTDETECTION_EINVAL__PIPELINE_CFG;
+            goto exit;
+        }
+
+#ifndef OBJDET_NO_RANGE
         /* Free all buffers that were allocated from system (MemoryP) heap.
          * Note we cannot free buffers during allocation time
          * for new config during the pre-start config processing because the heap is not capable
@@ -2295,6 +3852,37 @@ static int32_t DPC_ObjectDetection_ioctl
         }
 #endif
 
+        for(indx = 0; indx < objDetObj->commonCfg.numSubFrames; indx++)
+        {
+            subFrmObj = &objDetObj->subFrameObj[indx];
+
+            if (subFrmObj->dpuCfg.cfarCfg.res.cfarNoiseMap)
+            {
+                MemoryP_ctrlFree(subFrmObj->dpuCfg.cfarCfg.res.cfarNoiseMap,
+                                 subFrmObj->dpuCfg.cfarCfg.res.cfarNoiseMapSize);
+                subFrmObj->dpuCfg.cfarCfg.res.cfarNoiseMap = NULL;
+            }
+        }
+
+        /* The sub-frames are configured again, possibly with other sizes */
+        DPC_ObjDetDSP_releaseGroupTables(objDetObj);
+
+        if (objDetObj->dpuCycleHist != NULL)
+        {
+            MemoryP_ctrlFree(objDetObj->dpuCycleHist,
+                             objDetObj->commonCfg.numSubFrames * DPC_OBJDET_DPU_NUM * sizeof(DpuCycleHistory));
+            objDetObj->dpuCycleHist = NULL;
+        }
+
+        /* DPU cycle history of each sub-frame */
+        objDetObj->dpuCycleHist = (DpuCycleHistory *) MemoryP_ctrlAlloc(cfg->numSubFrames *
+                                      DPC_OBJDET_DPU_NUM * sizeof(DpuCycleHistory), 0);
+        if (objDetObj->dpuCycleHist == NULL)
+        {
+            retVal = DPC_OBJECTDETECTION_ENOMEM;
+            goto exit;
+        }
+
         objDetObj->commonCfg = *cfg;
         objDetObj->isCommonCfgReceived = true;
 
@@ -2314,6 +3902,34 @@ static int32_t DPC_ObjectDetection_ioctl
             goto exit;
         }
     }
+    else if (cmd == DPC_OBJDET_IOCTL__DYNAMIC_OVERLOAD_GOVERNOR_CFG)
+    {
+        DPC_ObjectDetection_OverloadGovernorCfg *cfg;
+
+        DebugP_assert(argLen == sizeof(DPC_ObjectDetection_OverloadGovernorCfg));
+
+        cfg = (DPC_ObjectDetection_OverloadGovernorCfg*)arg;
+
+        retVal = DPC_ObjDetDSP_Config_OverloadGovernorCfg(objDetObj, cfg);
+        if (retVal != 0)
+        {
+            goto exit;
+        }
+    }
+    else if (cmd == DPC_OBJDET_IOCTL__OUTPUT_RING_CFG)
+    {
+        DPC_ObjectDetection_OutputRingCfg *cfg;
+
+        DebugP_assert(argLen == sizeof(DPC_ObjectDetection_OutputRingCfg));
+
+        cfg = (DPC_ObjectDetection_OutputRingCfg*)arg;
+
+        retVal = DPC_ObjDetDSP_Config_OutputRingCfg(objDetObj, cfg);
+        if (retVal != 0)
+        {
+            goto exit;
+        }
+    }
     else if (cmd == DPC_OBJDET_IOCTL__DYNAMIC_COMP_RANGE_BIAS_AND_RX_CHAN_PHASE)
     {
         DPU_AoAProc_compRxChannelBiasCfg *inpCfg;
@@ -2377,6 +3993,35 @@ static int32_t DPC_ObjectDetection_ioctl
 
         /* mark end of processing of the frame/sub-frame by the DPC and the app */
         objDetObj->interSubFrameProcToken--;
+
+        /* Output buffers are free again, release the radar cube waiting for the
+         * inter-frame processing in pipelined mode */
+        if (objDetObj->pipeline.isCubePending == true)
+        {
+            objDetObj->pipeline.isCubePending = false;
+            SemaphoreP_post(objDetObj->pipeline.cubeReadySemHandle);
+        }
+    }
+    else if (cmd == DPC_OBJDET_IOCTL__PIPELINE_INTER_FRAME_PROCESS)
+    {
+        if (objDetObj->commonCfg.isPipelineEnabled == false)
+        {
+            retVal = DPC_OBJECTDETECTION_EINVAL__PIPELINE_CFG;
+            goto exit;
+        }
+
+        /* Wait for range processing to hand over a radar cube, then run the
+         * inter-frame processing on it. Range processing of the next frame
+         * preempts this from the (higher priority) DPM execute context. */
+        SemaphoreP_pend(objDetObj->pipeline.cubeReadySemHandle, SemaphoreP_WAIT_FOREVER);
+
+        objDetObj->pipeline.procRetVal = DPC_ObjDetDSP_interFrameProcess(objDetObj,
+                                             &objDetObj->subFrameObj[0],
+                                             objDetObj->pipeline.frameStartTimeStamp,
+                                             objDetObj->pipeline.frameNumber);
+        retVal = objDetObj->pipeline.procRetVal;
+
+        SemaphoreP_post(objDetObj->pipeline.procDoneSemHandle);
     }
     else
     {
@@ -2426,8 +4071,9 @@ static int32_t DPC_ObjectDetection_ioctl
                 cfg = (DPC_ObjectDetection_CfarCfg*)arg;
                 cfarCfg = &cfg->cfg;
 
-                /* Although CFARCA sopports both schemes, in DPC we fixed into one scheme */
-                cfarCfg->peakGroupingScheme = DPU_CFAR_PEAK_GROUPING_DET_MATRIX_BASED;
+                /* Keep the peak grouping scheme selected at configuration time, the local
+                 * maximum scratch buffers are only allocated for the fused scheme */
+                cfarCfg->peakGroupingScheme = subFrmObj->dynCfg.cfarCfgRange.peakGroupingScheme;
 
                 retVal = DPU_CFARCAProcDSP_control(subFrmObj->dpuCFARCAObj,
                              DPU_CFARCAProcDSP_Cmd_CfarRangeCfg,
@@ -2453,8 +4099,9 @@ static int32_t DPC_ObjectDetection_ioctl
                 cfg = (DPC_ObjectDetection_CfarCfg*)arg;
                 cfarCfg = &cfg->cfg;
 
-                /* Although CFARCA sopports both schemes, in DPC we fixed into one scheme */
-                cfarCfg->peakGroupingScheme = DPU_CFAR_PEAK_GROUPING_DET_MATRIX_BASED;
+                /* Keep the peak grouping scheme selected at configuration time, the local
+                 * maximum scratch buffers are only allocated for the fused scheme */
+                cfarCfg->peakGroupingScheme = subFrmObj->dynCfg.cfarCfgDoppler.peakGroupingScheme;
 
                 retVal = DPU_CFARCAProcDSP_control(subFrmObj->dpuCFARCAObj,
                              DPU_CFARCAProcDSP_Cmd_CfarDopplerCfg,
@@ -2470,6 +4117,28 @@ static int32_t DPC_ObjectDetection_ioctl
 
                 break;
             }
+            case DPC_OBJDET_IOCTL__DYNAMIC_CFAR_RANGE_THRESHOLD_PROFILE_CFG:
+            {
+                DPC_ObjectDetection_CfarRangeThresholdProfileCfg *cfg;
+
+                DebugP_assert(argLen == sizeof(DPC_ObjectDetection_CfarRangeThresholdProfileCfg));
+
+                cfg = (DPC_ObjectDetection_CfarRangeThresholdProfileCfg*)arg;
+
+                retVal = DPU_CFARCAProcDSP_control(subFrmObj->dpuCFARCAObj,
+                             DPU_CFARCAProcDSP_Cmd_RangeThresholdProfileCfg,
+                             &cfg->cfg,
+                             sizeof(DPU_CFARCAProc_RangeThresholdProfileCfg));
+                if (retVal != 0)
+                {
+                    goto exit;
+                }
+
+                /* save into object */
+                subFrmObj->dynCfg.cfarRangeThresholdProfileCfg = cfg->cfg;
+
+                break;
+            }
             case DPC_OBJDET_IOCTL__DYNAMIC_FOV_RANGE:
             {
                 DPC_ObjectDetection_fovRangeCfg *cfg;
@@ -2544,8 +4213,6 @@ static int32_t DPC_ObjectDetection_ioctl
             }
             case DPC_OBJDET_IOCTL__DYNAMIC_EXT_MAX_VELOCITY:
             {
-/* Support for Extended Velocity will be added later */
-#if 0
                 DPC_ObjectDetection_extMaxVelCfg *cfg;
 
                 DebugP_assert(argLen == sizeof(DPC_ObjectDetection_extMaxVelCfg));
@@ -2563,7 +4230,59 @@ static int32_t DPC_ObjectDetection_ioctl
 
                 /* save into object */
                 subFrmObj->dynCfg.extMaxVelCfg = cfg->cfg;
-#endif
+                break;
+            }
+            case DPC_OBJDET_IOCTL__DYNAMIC_ANGLE_INTERP_CFG:
+            {
+                DPC_ObjectDetection_angleInterpCfg *cfg;
+
+                DebugP_assert(argLen == sizeof(DPC_ObjectDetection_angleInterpCfg));
+
+                cfg = (DPC_ObjectDetection_angleInterpCfg*)arg;
+
+                retVal = DPU_AoAProcDSP_control(subFrmObj->dpuAoAObj,
+                             DPU_AoAProcDSP_Cmd_AngleInterpCfg,
+                             &cfg->cfg,
+                             sizeof(DPU_AoAProc_AngleInterpCfg));
+                if (retVal != 0)
+                {
+                    goto exit;
+                }
+
+                /* save into object */
+                subFrmObj->dynCfg.angleInterpCfg = cfg->cfg;
+
+                break;
+            }
+            case DPC_OBJDET_IOCTL__DYNAMIC_HEAT_MAP_UPDATE_CFG:
+            {
+                DPC_ObjectDetection_heatMapUpdateCfg *cfg;
+
+                DebugP_assert(argLen == sizeof(DPC_ObjectDetection_heatMapUpdateCfg));
+
+                cfg = (DPC_ObjectDetection_heatMapUpdateCfg*)arg;
+
+                /* Sub-frames share the L3 memory of the heat map, so range bins
+                   can only be carried over between frames without sub-frames */
+                if ((cfg->cfg.mode != DPU_AOAPROC_HEATMAP_UPDATE_FULL) &&
+                    (objDetObj->commonCfg.numSubFrames > 1U))
+                {
+                    retVal = DPC_OBJECTDETECTION_EINVAL__COMMAND;
+                    goto exit;
+                }
+
+                retVal = DPU_AoAProcDSP_control(subFrmObj->dpuAoAObj,
+                             DPU_AoAProcDSP_Cmd_HeatMapUpdateCfg,
+                             &cfg->cfg,
+                             sizeof(DPU_AoAProc_HeatMapUpdateCfg));
+                if (retVal != 0)
+                {
+                    goto exit;
+                }
+
+                /* save into object */
+                subFrmObj->dynCfg.heatMapUpdateCfg = cfg->cfg;
+
                 break;
             }
             case DPC_OBJDET_IOCTL__DYNAMIC_FOV_AOA:
@@ -2658,6 +4377,7 @@ static int32_t DPC_ObjectDetection_ioctl
                 DPC_ObjectDetection_DPC_IOCTL_preStartCfg_memUsage *memUsage;
                 MemoryP_Stats statsStart;
                 MemoryP_Stats statsEnd;
+                bool isGroupTablesUser;
 
                 /* Pre-start common config must be received before pre-start configs
                  * are received. */
@@ -2678,6 +4398,7 @@ static int32_t DPC_ObjectDetection_ioctl
                 memUsage->L3RamTotal = objDetObj->L3RamObj.cfg.size;
                 memUsage->CoreL2RamTotal = objDetObj->CoreL2RamObj.cfg.size;
                 memUsage->CoreL1RamTotal = objDetObj->CoreL1RamObj.cfg.size;
+                isGroupTablesUser = objDetObj->isGroupTablesUser;
                 retVal = DPC_ObjDetDSP_preStartConfig(subFrmObj,
                              &objDetObj->commonCfg, 
                              cfg,
@@ -2685,9 +4406,17 @@ static int32_t DPC_ObjectDetection_ioctl
                              &objDetObj->L3RamObj,
                              &objDetObj->CoreL2RamObj,
                              &objDetObj->CoreL1RamObj,
-                             &memUsage->L3RamUsage,
-                             &memUsage->CoreL2RamUsage,
-                             &memUsage->CoreL1RamUsage);
+                             memUsage,
+                             &objDetObj->pipeline,
+                             objDetObj->instanceGroup,
+                             &objDetObj->isGroupTablesUser);
+
+                /* Drop the use of the group tables taken by a failed pre-start, which
+                   also releases tables allocated for it */
+                if ((retVal != 0) && (isGroupTablesUser == false))
+                {
+                    DPC_ObjDetDSP_releaseGroupTables(objDetObj);
+                }
                 if (retVal != 0)
                 {
                     goto exit;
@@ -2751,6 +4480,7 @@ static DPM_DPCHandle DPC_ObjectDetection_init
 {
     ObjDetObj     *objDetObj = NULL;
     DPC_ObjectDetection_InitParams *dpcInitParams;
+    SemaphoreP_Params semParams;
     int32_t i;
 
     *errCode = 0;
@@ -2800,6 +4530,19 @@ static DPM_DPCHandle DPC_ObjectDetection_init
         objDetObj->edmaHandle[i] = dpcInitParams->edmaHandle[i];
     }
     objDetObj->processCallBackCfg = dpcInitParams->processCallBackCfg;
+    objDetObj->instanceGroup = dpcInitParams->instanceGroup;
+
+    /* Pipelined mode hand-over between the execute and the inter-frame processing */
+    SemaphoreP_Params_init(&semParams);
+    semParams.mode = SemaphoreP_Mode_BINARY;
+    objDetObj->pipeline.cubeReadySemHandle = SemaphoreP_create(0, &semParams);
+    objDetObj->pipeline.procDoneSemHandle = SemaphoreP_create(0, &semParams);
+    if ((objDetObj->pipeline.cubeReadySemHandle == NULL) ||
+        (objDetObj->pipeline.procDoneSemHandle == NULL))
+    {
+        *errCode = DPC_OBJECTDETECTION_ENOMEM;
+        goto exit;
+    }
 
     *errCode = DPC_ObjDetDSP_initDPU(objDetObj, RL_MAX_SUBFRAMES);
 exit:
@@ -2807,6 +4550,14 @@ exit:
     {
         if(objDetObj != NULL)
         {
+            if (objDetObj->pipeline.cubeReadySemHandle != NULL)
+            {
+                SemaphoreP_delete(objDetObj->pipeline.cubeReadySemHandle);
+            }
+            if (objDetObj->pipeline.procDoneSemHandle != NULL)
+            {
+                SemaphoreP_delete(objDetObj->pipeline.procDoneSemHandle);
+            }
             MemoryP_ctrlFree(objDetObj, sizeof(ObjDetObj));
             objDetObj = NULL;
         }
@@ -2843,6 +4594,17 @@ static int32_t DPC_ObjectDetection_deinit (DPM_DPCHandle handle)
 
     retVal = DPC_ObjDetDSP_deinitDPU(objDetObj, RL_MAX_SUBFRAMES);
 
+    DPC_ObjDetDSP_releaseGroupTables(objDetObj);
+
+    if (objDetObj->dpuCycleHist != NULL)
+    {
+        MemoryP_ctrlFree(objDetObj->dpuCycleHist,
+                         objDetObj->commonCfg.numSubFrames * DPC_OBJDET_DPU_NUM * sizeof(DpuCycleHistory));
+    }
+
+    SemaphoreP_delete(objDetObj->pipeline.cubeReadySemHandle);
+    SemaphoreP_delete(objDetObj->pipeline.procDoneSemHandle);
+
     MemoryP_ctrlFree(handle, sizeof(ObjDetObj));
 
 exit:
@@ -171,14 +171,29 @@
  */
 MCPI_LOGBUF_INIT(9216);
 
-#define OBJECT_DETECTION_L3RAM_CODE_SIZE 64 * 1024
+/* Code and test buffers placed in L3 RAM next to the L3 heap */
+#define OBJECT_DETECTION_L3RAM_CODE_SIZE 96 * 1024
 
 #define OBJECT_DETECTION_TEST_CHIRP_DATA_SIZE 16*1024
 uint8_t gObjectDetection_Test_chirpData[OBJECT_DETECTION_TEST_CHIRP_DATA_SIZE]; //simulating 16KB of ADCBuf memory
 #pragma DATA_SECTION(gObjectDetection_Test_chirpData, ".hsram");
 
+/*! Output ring test: slot holding the frame header, the point cloud and side info
+    TLVs of the maximum number of objects of the DPC (500), without heat map */
+#define OUTPUT_RING_TEST_NUM_SLOTS 2
+#define OUTPUT_RING_TEST_SLOT_SIZE MEM_ALIGN(sizeof(DPC_ObjectDetection_TlvFrameHeader) + \
+                                   2 * sizeof(DPC_ObjectDetection_TlvHeader) + \
+                                   500 * (sizeof(DPIF_PointCloudCartesian) + sizeof(DPIF_PointCloudSideInfo)), \
+                                   DPC_OBJDET_OUTPUT_RING_BYTE_ALIGNMENT)
+#define OUTPUT_RING_TEST_SIZE (sizeof(DPC_ObjectDetection_OutputRingCtrl) + \
+                               OUTPUT_RING_TEST_NUM_SLOTS * OUTPUT_RING_TEST_SLOT_SIZE)
+uint8_t gObjectDetection_Test_outputRing[OUTPUT_RING_TEST_SIZE];
+#pragma DATA_SECTION(gObjectDetection_Test_outputRing, ".l3ram");
+#pragma DATA_ALIGN(gObjectDetection_Test_outputRing, DPC_OBJDET_OUTPUT_RING_BYTE_ALIGNMENT);
+
 /*! L3 RAM buffer */
-#define OBJECT_DETECTION_L3RAM_HEAP_SIZE SOC_L3RAM_SIZE - OBJECT_DETECTION_L3RAM_CODE_SIZE
+#define OBJECT_DETECTION_L3RAM_HEAP_SIZE SOC_L3RAM_SIZE - OBJECT_DETECTION_L3RAM_CODE_SIZE - \
+                                         MEM_ALIGN(OUTPUT_RING_TEST_SIZE, 8)
 uint8_t gObjectDetection_Test_L3Heap[OBJECT_DETECTION_L3RAM_HEAP_SIZE];
 #pragma DATA_SECTION(gObjectDetection_Test_L3Heap, ".l3ram");
 
@@ -190,6 +205,13 @@ uint8_t gObjectDetection_Test_L2RamHeap[40*1024];
 uint8_t gObjectDetection_Test_L1RamHeap[16*1024];
 #pragma DATA_SECTION(gObjectDetection_Test_L1RamHeap, ".l1Heap");
 
+/*! Instance group test: memory of the shared tables. The group instances are only
+    configured, so the tables need not be in L1/L2. */
+uint8_t gObjectDetection_Test_groupL2RamHeap[1*1024];
+#pragma DATA_SECTION(gObjectDetection_Test_groupL2RamHeap, ".hsram");
+uint8_t gObjectDetection_Test_groupL1RamHeap[3*1024];
+#pragma DATA_SECTION(gObjectDetection_Test_groupL1RamHeap, ".hsram");
+
 
 /******************************************************************
  *                      Internal definitions
@@ -206,6 +228,11 @@ extern const uint32_t ref_input_frame[];
 #define AZIMUTH_ALLOWED_ERROR 4
 #define ELEVATION_ALLOWED_ERROR 0.5 /*in degrees*/
 
+/* Elevation FFT size and allowed elevation error (in degrees) of the antenna geometry
+   test: no sub-bin interpolation, so the error is up to half an elevation bin */
+#define ANT_GEOMETRY_NUM_ELEV_BINS 64
+#define ANT_GEOMETRY_ELEVATION_ALLOWED_ERROR 2.0
+
 
 /*! cumulative average of left+right */
 #define MMW_NOISE_AVG_MODE_CFAR_CA       ((uint8_t)0U)
@@ -312,6 +339,85 @@ uint8_t gNumSubFrames = RL_MAX_SUBFRAMES;
   */
 bool gReadTestConfigFromBinFile = true;
 
+ /**
+  * @brief
+  *  "true": after the tests, the sub-frames of the last test are run once more with
+  *  the antenna geometry (2D angle FFT) enabled on the sub-frames with elevation
+  *  antennas, see @ref ObjectDetection_Test_setAntGeometry.
+  *
+  */
+bool gAntGeometryTestEnabled = true;
+
+ /**
+  * @brief
+  *  "true": after the tests, frames of @ref gPipelineTestFrameConfig are run without
+  *  and with pipelined frame processing and the point clouds of the two runs are
+  *  compared, see @ref ObjectDetection_Test_pipeline.
+  *
+  */
+bool gPipelineTestEnabled = true;
+
+ /**
+  * @brief
+  *  "true": after the tests, frames of @ref gPipelineTestFrameConfig are run with the
+  *  overload governor disabled, with a target it cannot meet and disabled again, see
+  *  @ref ObjectDetection_Test_overloadGovernor.
+  *
+  */
+bool gGovernorTestEnabled = true;
+
+ /**
+  * @brief
+  *  "true": after the tests, frames of @ref gPipelineTestFrameConfig are run with a
+  *  two slot output ring that is not released, see @ref ObjectDetection_Test_outputRing.
+  *
+  */
+bool gOutputRingTestEnabled = true;
+
+ /**
+  * @brief
+  *  "true": after the tests, more than @ref DPC_OBJDET_DPU_STATS_HISTORY_SIZE frames of
+  *  @ref gPipelineTestFrameConfig are run and the per DPU statistics checked, see
+  *  @ref ObjectDetection_Test_dpuStats.
+  *
+  */
+bool gDpuStatsTestEnabled = true;
+
+ /**
+  * @brief
+  *  "true": after the tests, two more DPC instances sharing a
+  *  @ref DPC_ObjectDetection_InstanceGroup_t are configured, see
+  *  @ref ObjectDetection_Test_instanceGroup.
+  *
+  */
+bool gInstanceGroupTestEnabled = true;
+
+DPC_ObjectDetection_InstanceGroup gObjectDetection_Test_instanceGroup;
+
+/* Number of detections the governor test caps AoA to */
+#define GOVERNOR_TEST_MIN_NUM_AOA_DET 2
+
+/* Number of frames of the DPU statistics test, the first ones (cold caches) are out of
+   the cycle history by the last frame */
+#define DPU_STATS_TEST_NUM_FRAMES (DPC_OBJDET_DPU_STATS_HISTORY_SIZE + 5U)
+
+/* Configuration of the pipelined processing and governor tests, the built-in Test #1 */
+frameConfig_t gPipelineTestFrameConfig;
+
+/* Number of frames of the pipelined run, and number of inter-frame processing
+   IOCTLs completed by ObjectDetection_Test_pipelineTask */
+uint32_t gPipelineNumFrames;
+volatile uint32_t gPipelineNumFramesProcessed;
+
+/* Point clouds of the run without pipelining */
+#define PIPELINE_TEST_MAX_NUM_OBJ 32
+#define PIPELINE_TEST_SEED 1
+uint32_t gPipelineRefNumObjOut[MAX_NUM_TEST_FRAME];
+DPIF_PointCloudCartesian gPipelineRefObjOut[MAX_NUM_TEST_FRAME][PIPELINE_TEST_MAX_NUM_OBJ];
+DPIF_PointCloudSideInfo gPipelineRefObjOutSideInfo[MAX_NUM_TEST_FRAME][PIPELINE_TEST_MAX_NUM_OBJ];
+#pragma DATA_SECTION(gPipelineRefObjOut, ".l3ram");
+#pragma DATA_SECTION(gPipelineRefObjOutSideInfo, ".l3ram");
+
 
 SOC_Handle          socHandle;
 genFrameStruc_t     gGenFrameDataObj;
@@ -327,6 +433,10 @@ uint16_t gMaxL2UsageTestId = 0;
 uint32_t gMaxL1Usage = 0;
 uint16_t gMaxL1UsageTestId = 0;
 
+/* Scratch memory saved by overlapping the DPUs' scratch areas */
+uint32_t gTotalL2ScratchSaved = 0;
+uint32_t gTotalL1ScratchSaved = 0;
+
 /**
  * @brief
  *  Unit test full configuration, including scene and sensor configuration
@@ -595,6 +705,8 @@ void ObjectDetection_Test_setProfile
     /* Hard coded these two values */
     params->isInterleavedSampInAdcBuf = 0;
     params->isBpmEnabled = 0;
+    params->isAntGeometryEnabled = 0;
+    subFrameObj->staticCfg.antGeometryCfg.enabled = 0;
 
     params->numRxAntennas = sensorConfig->numRxAntennas;
     params->numAdcSamples = sensorConfig->numAdcSamples;
@@ -683,6 +795,7 @@ void ObjectDetection_Test_setProfile
     subFrameObj->dynCfg.fovRange.max = (subFrameObj->staticCfg.numRangeBins - 1) * subFrameObj->staticCfg.rangeStep;
     subFrameObj->dynCfg.multiObjBeamFormingCfg.enabled = params->multiObjBeamFormingCfgEnabled;
     subFrameObj->dynCfg.multiObjBeamFormingCfg.multiPeakThrsScal = 0.5;
+    subFrameObj->dynCfg.multiObjBeamFormingCfg.maxNumPeaks = 0;
     subFrameObj->dynCfg.extMaxVelCfg.enabled = false;
 
     if(params->numVirtualAntAzim > 1)
@@ -709,6 +822,98 @@ void ObjectDetection_Test_setProfile
     System_printf("Number of antennas: Ntx=%d, Nrx=%d\n",params->numTxAntennas, params->numRxAntennas);
 }
 
+/**
+  *  @b Description
+  *  @n
+  *     Enables the antenna geometry (2D angle FFT) on a sub-frame with elevation
+  *     antennas, in the test data generator and in the DPC static configuration.
+  *     The azimuth virtual antennas are placed on row 0 and the elevation virtual
+  *     antennas on row 1, centered on the azimuth row (columns 2..5 for 3Tx/4Rx,
+  *     as the default generator layout). Sub-frames without elevation antennas
+  *     are left unchanged.
+  *
+  *  @param[in,out] subFrameObj pointer to subframe test object
+  *
+  *  @retval None
+  *
+  */
+void ObjectDetection_Test_setAntGeometry
+(
+    ObjectDetection_Test_SubFrameObj *subFrameObj
+)
+{
+    ObjectDetection_Test_SubFrameParams *params = &subFrameObj->params;
+    DPU_AoAProcDSP_AntennaGeometryCfg *geometryCfg = &subFrameObj->staticCfg.antGeometryCfg;
+    uint32_t antIdx;
+    uint32_t elevColOffset;
+
+    if (params->numVirtualAntElev > 0)
+    {
+        elevColOffset = (params->numVirtualAntAzim - params->numVirtualAntElev) / 2;
+
+        /* Virtual antenna order is tx * numRxAntennas + rx, elevation Tx chirped last */
+        for (antIdx = 0; antIdx < params->numVirtualAntennas; antIdx++)
+        {
+            if (antIdx < params->numVirtualAntAzim)
+            {
+                params->antGeometryRow[antIdx] = 0;
+                params->antGeometryCol[antIdx] = antIdx;
+            }
+            else
+            {
+                params->antGeometryRow[antIdx] = 1;
+                params->antGeometryCol[antIdx] = antIdx - params->numVirtualAntAzim + elevColOffset;
+            }
+            geometryCfg->antPos[antIdx].row = params->antGeometryRow[antIdx];
+            geometryCfg->antPos[antIdx].col = params->antGeometryCol[antIdx];
+        }
+        geometryCfg->numRows = 2;
+        geometryCfg->numElevBins = ANT_GEOMETRY_NUM_ELEV_BINS;
+        geometryCfg->enabled = 1;
+        params->isAntGeometryEnabled = 1;
+
+        /* Multi object beam forming is not applied with the 2D angle FFT */
+        subFrameObj->dynCfg.multiObjBeamFormingCfg.enabled = 0;
+    }
+}
+
+/**
+  *  @b Description
+  *  @n
+  *     Adjusts the CFAR configuration of a sub-frame to its number of Tx antennas
+  *     and Doppler bins.
+  *
+  *  @param[in,out] subFrameObj pointer to subframe test object
+  *
+  *  @retval None
+  *
+  */
+void ObjectDetection_Test_adjustCfarCfg
+(
+    ObjectDetection_Test_SubFrameObj *subFrameObj
+)
+{
+    /* Adjust thresholdScale when numTxAntennas is 3, this is due to the shift used in Doppler DPU when generating detection Matrix */
+    if(subFrameObj->staticCfg.numTxAntennas == 3)
+    {
+        if(subFrameObj->dynCfg.cfarCfgDoppler.thresholdScale !=0)
+        {
+            subFrameObj->dynCfg.cfarCfgDoppler.thresholdScale = subFrameObj->dynCfg.cfarCfgDoppler.thresholdScale * 3 /4;
+        }
+        if (subFrameObj->dynCfg.cfarCfgRange.thresholdScale !=0)
+        {
+            subFrameObj->dynCfg.cfarCfgRange.thresholdScale = subFrameObj->dynCfg.cfarCfgRange.thresholdScale * 3 /4;
+        }
+    }
+
+    /* For numDopplerBins== 16, adjust noise len and shift */
+    if(subFrameObj->staticCfg.numDopplerBins == 16)
+    {
+        subFrameObj->dynCfg.cfarCfgDoppler.noiseDivShift = 2;
+        subFrameObj->dynCfg.cfarCfgDoppler.winLen = 2;
+    }
+}
+
 #ifdef USE_BUILT_IN_GENERATOR
 /**
   *  @b Description
@@ -804,6 +1009,10 @@ uint32_t ObjectDetection_Test_CompareToRef(ObjectDetection_Test_SubFrameObj *obj
     {
         elevationAllowedError = 2.5;
     }
+    if(obj->params.isAntGeometryEnabled && (elevationAllowedError < ANT_GEOMETRY_ELEVATION_ALLOWED_ERROR))
+    {
+        elevationAllowedError = ANT_GEOMETRY_ELEVATION_ALLOWED_ERROR;
+    }
 
     for (refIdx = 0; refIdx < gGenFrameDataObj.numTargets; refIdx++)
     {
@@ -1149,11 +1358,23 @@ static void ObjectDetection_Test_reportFxn
                     gMaxL1Usage = memUsage->CoreL1RamUsage;
                     gMaxL1UsageTestId = gCurrTestId;
                 }
+                gTotalL2ScratchSaved += memUsage->CoreL2RamScratchSaved;
+                gTotalL1ScratchSaved += memUsage->CoreL1RamScratchSaved;
                 System_printf("DPC ObjDet Memory usage (SubFrameIndx = %d): L3: %d Bytes, L2: %d Bytes, L1: %d Bytes\n",
                               cfg->subFrameNum,
                               memUsage->L3RamUsage,
                               memUsage->CoreL2RamUsage,
                               memUsage->CoreL1RamUsage);
+                System_printf("DPC ObjDet Scratch overlay saved: L2: %d Bytes, L1: %d Bytes\n",
+                              memUsage->CoreL2RamScratchSaved,
+                              memUsage->CoreL1RamScratchSaved);
+                System_printf("DPC ObjDet Instance group shared tables: L2: %d Bytes, L1: %d Bytes\n",
+                              memUsage->CoreL2RamShared,
+                              memUsage->CoreL1RamShared);
+                if (!memUsage->isAoaRangeBinGroupingEnabled)
+                {
+                    System_printf("DPC ObjDet AoA range bin grouping disabled, buffers do not fit in L2\n");
+                }
 
             }
             break;
@@ -1237,6 +1458,9 @@ static void ObjectDetection_Test_dpmTask(UArg arg0, UArg arg1)
 
     while (1)
     {
+        /* In pipelined mode the first frame returns no result */
+        memset((void *)&resultBuffer, 0, sizeof(DPM_Buffer));
+
         /* Execute the DPM module: */
         errCode = DPM_execute (gDataPathObj.dpmHandle, &resultBuffer);
         if (errCode < 0) {
@@ -1691,170 +1915,1341 @@ void ObjectDetection_Test_stopDPC(ObjectDetection_Test_DataPathObj *dataPathObj)
 }
 
 
+#ifdef USE_BUILT_IN_GENERATOR
 /**
  *  @b Description
  *  @n
- *      Test task - Main task that performs ObjectDetecion DPC unit test.
+ *      Pipeline Task: issues the inter-frame processing IOCTL for each of the
+ *      @ref gPipelineNumFrames frames of the pipelined run, then exits. It runs
+ *      below the DPM execution task, so range processing preempts it.
  *
  *  @retval
  *      Not Applicable.
  */
-void ObjectDetection_Test_task(UArg arg0, UArg arg1)
+static void ObjectDetection_Test_pipelineTask(UArg arg0, UArg arg1)
 {
-    ObjectDetection_Test_DataPathObj *dataPathObj = &gDataPathObj;
-    int32_t  errCode; 
-    uint32_t i;
-
-    FILE * fileId;    
-    uint32_t numTests;
-    uint32_t testIndx, gTestIndx;
-    char tempMsg[20]; 
-    char featureName[200];
-    bool allTestsPassed = true;
-    uint32_t testStatus;
-    DPC_ObjectDetection_ExecuteResultExportedInfo exportInfo;
-    uint8_t subFrameIndx;
-    uint8_t frameIdx;
-    uint8_t testResultBuf[RL_MAX_SUBFRAMES];
-    uint8_t numFrames;
-    uint8_t numChirpsPerEvent;
-
-    ObjectDetection_Test_ReferenceFileInit();
-
-    /* Initialize EDMA, DPM/DPC */
-    ObjectDetection_Test_initComponents(dataPathObj);
+    int32_t     errCode;
 
-    if(gReadTestConfigFromBinFile)
+    while (gPipelineNumFramesProcessed < gPipelineNumFrames)
     {
-#if defined(SOC_XWR18XX)
-        fileId = fopen("testdata\\xwr18xx_data_path_test_config.bin", "rb");
-#elif defined(SOC_XWR16XX)
-        fileId = fopen("testdata\\xwr16xx_data_path_test_config.bin", "rb");
-#elif defined(SOC_XWR68XX)
-        fileId = fopen("testdata\\xwr68xx_data_path_test_config.bin", "rb");
-#else
-#error "Error: Unsupported platform"
-#endif
-        if (fileId == NULL)
+        errCode = DPM_ioctl (gDataPathObj.dpmHandle,
+                             DPC_OBJDET_IOCTL__PIPELINE_INTER_FRAME_PROCESS,
+                             NULL,
+                             0);
+        if (errCode < 0)
         {
-            System_printf("Error: Cannot open xwr68xx_data_path_test_config.bin!\n");
-            exit(0);
+            System_printf ("Error: DPC_OBJDET_IOCTL__PIPELINE_INTER_FRAME_PROCESS failed [Error code %d]\n", errCode);
+            ObjectDetection_Test_debugAssert (0);
         }
-        /* read in number of tests to be run */
-        fread(&numTests, sizeof(uint32_t),1,fileId);
-    }
-    else
-    {
-        numTests = 4;
+        gPipelineNumFramesProcessed++;
     }
-    System_printf("%d Tests to be run\n\r", numTests);
-    if (numTests % gNumSubFrames)
+}
+
+/**
+  *  @b Description
+  *  @n
+  *     Runs the frames of the pipelined processing test on sub-frame 0 and checks each
+  *     point cloud against the reference targets. Without pipelining the point cloud of
+  *     each frame is saved. With pipelining the result of a frame comes at the end of
+  *     the next frame, so one more frame is run, the first frame must return no result
+  *     and the result of every other frame must be equal to the saved point cloud of
+  *     the previous frame. Stopping must wait for the inter-frame processing of the
+  *     last frame, whose result is not reported.
+  *
+  *  @param[in] dataPathObj Pointer to main test data structure
+  *
+  *  @param[in] isPipelined Runs with pipelined frame processing
+  *
+  *  @retval    Test result: 1: Passed, 0: Failed
+  *
+  */
+uint32_t ObjectDetection_Test_runPipelineFrames
+(
+    ObjectDetection_Test_DataPathObj *dataPathObj,
+    bool isPipelined
+)
+{
+    ObjectDetection_Test_SubFrameObj *subFrameObj = &dataPathObj->testSubFrmObj[0];
+    DPC_ObjectDetection_ExecuteResultExportedInfo exportInfo;
+    Task_Params taskParams;
+    uint32_t numFrames = MAX_NUM_TEST_FRAME;
+    uint32_t frameIdx, refIdx, i;
+    uint8_t  numChirpsPerEvent;
+    uint32_t isOk = 1;
+    int32_t  errCode;
+
+    numChirpsPerEvent = subFrameObj->staticCfg.ADCBufData.dataProperty.numChirpsPerChirpEvent;
+
+    dataPathObj->commonCfg.isPipelineEnabled = isPipelined;
+    ObjectDetection_Test_configDPC(dataPathObj);
+
+    if (isPipelined)
     {
-        System_printf("numTests = %d must be a multiple of gNumSubFrames = %d\n", numTests, gNumSubFrames);
-        BIOS_exit(0);
+        numFrames++;
+        gPipelineNumFrames = numFrames;
+        gPipelineNumFramesProcessed = 0;
+
+        Task_Params_init(&taskParams);
+        taskParams.priority  = 3;
+        taskParams.stackSize = 4*1024;
+        Task_create(ObjectDetection_Test_pipelineTask, &taskParams, NULL);
     }
 
+    /* Both runs get the same frames */
+    seedFrameData(PIPELINE_TEST_SEED);
 
-    /* config common */
-    ObjectDetection_Test_setCommonProfile(dataPathObj);
-    
-    /* process each test */
-    subFrameIndx = 0;
-    testIndx = 0;
-    while (testIndx < numTests)
+    ObjectDetection_Test_startDPC(dataPathObj);
+    for (frameIdx = 0; frameIdx < numFrames; frameIdx++)
     {
-        sensorConfig_t *sensorConfig;
-        sceneConfig_t *sceneConfig;
-        uint32_t sceneObjIndx;
-
-        gCurrTestId = testIndx + 1;
-        numFrames = MAX_NUM_TEST_FRAME;
+        ObjectDetection_Test_trigFrameStart(dataPathObj);
+        ObjectDetection_Test_initGenerator(&subFrameObj->params, &gPipelineTestFrameConfig.sceneConfig);
 
-        for (subFrameIndx = 0; subFrameIndx < gNumSubFrames; subFrameIndx++)
+        for(i=0; i<subFrameObj->params.numChirpsPerFrame/numChirpsPerEvent; i++)
         {
-            sensorConfig = &gFrameConfig[subFrameIndx].sensorConfig;
-            sceneConfig = &gFrameConfig[subFrameIndx].sceneConfig;
-
-            if (gReadTestConfigFromBinFile)
-            {
-                /* read in test config */
-                fread(&sensorConfig->numRxAntennas, sizeof(uint32_t),1,fileId);
-                fread(&sensorConfig->numAdcSamples, sizeof(uint32_t),1,fileId);
-                fread(&sensorConfig->numTxAntAzim, sizeof(uint32_t),1,fileId);
-                fread(&sensorConfig->numTxAntElev, sizeof(uint32_t),1,fileId);
-                fread(&sensorConfig->numAngleBins, sizeof(uint32_t),1,fileId);
-                fread(&sensorConfig->numChirpsPerFrame, sizeof(uint32_t),1,fileId);
-
-                fread(&sceneConfig->numTargets, sizeof(uint32_t),1,fileId);
-                fread(&sceneConfig->snrdB, sizeof(int32_t),1,fileId);
+            ObjectDetection_Test_getChirpData(dataPathObj, &subFrameObj->params, numChirpsPerEvent);
+            ObjectDetection_Test_trigChirpEvent(dataPathObj);
+            Task_sleep(1);
+        }
 
-                for (sceneObjIndx = 0; sceneObjIndx < sceneConfig->numTargets; sceneObjIndx++)
-                {
-                    fread(&sceneConfig->sceneObj[sceneObjIndx].amplitude, sizeof(uint32_t),1,fileId);
-                    fread(&sceneConfig->sceneObj[sceneObjIndx].azimPhyBin, sizeof(uint32_t),1,fileId);
-                    fread(&sceneConfig->sceneObj[sceneObjIndx].rngPhyBin, sizeof(uint32_t),1,fileId);
-                    fread(&sceneConfig->sceneObj[sceneObjIndx].doppPhyBin, sizeof(int32_t),1,fileId);
-                    fread(&sceneConfig->sceneObj[sceneObjIndx].elevationDeg, sizeof(int32_t),1,fileId);
-                }
-            }
-            /* check validity of arguments */
-            if((sensorConfig->numChirpsPerFrame %
-                (sensorConfig->numTxAntAzim + sensorConfig->numTxAntElev)) != 0)
+        if (isPipelined && (frameIdx == 0))
+        {
+            /* Range processing is done and the DPM task is idle again: the cube
+               went to the pipeline task and no result may have been reported */
+            if (SemaphoreP_pend(dataPathObj->semaphoreHandle, 0) == SemaphoreP_OK)
             {
-                System_printf("\n#### BAD argument. numChirpsPerFrame needs to be (power of 2)*(numTxAntAzim + numTxAntElev)\n\n");
+                System_printf("Pipelined: result reported at the end of the first frame\n");
+                isOk = 0;
             }
+            continue;
+        }
 
-            /* config datapathObj from sensorConfig */
-            ObjectDetection_Test_setProfile(dataPathObj,
-                            &dataPathObj->testSubFrmObj[subFrameIndx],
-                            &gFrameConfig[subFrameIndx].sensorConfig,
-                            sceneConfig);
+        SemaphoreP_pend(dataPathObj->semaphoreHandle, SemaphoreP_WAIT_FOREVER);
 
-            testResultBuf[subFrameIndx] = 1; //1-pass, 0-fail
-            if (sceneConfig->numTargets > 4)
-            {
-                numFrames = 1;
-            }
+        if (ObjectDetection_Test_CompareToRef(subFrameObj) != 1)
+        {
+            System_printf("Pipelined %d: wrong point cloud at frame %d\n", isPipelined, frameIdx);
+            isOk = 0;
+        }
 
-            /* Adjust thresholdScale when numTxAntennas is 3, this is due to the shift used in Doppler DPU when generating detection Matrix */
-            if(dataPathObj->testSubFrmObj[subFrameIndx].staticCfg.numTxAntennas == 3)
+        if (!isPipelined)
+        {
+            refIdx = frameIdx;
+            gPipelineRefNumObjOut[refIdx] = subFrameObj->result->numObjOut;
+            if (gPipelineRefNumObjOut[refIdx] > PIPELINE_TEST_MAX_NUM_OBJ)
             {
-                if(dataPathObj->testSubFrmObj[subFrameIndx].dynCfg.cfarCfgDoppler.thresholdScale !=0)
-                {
-                    dataPathObj->testSubFrmObj[subFrameIndx].dynCfg.cfarCfgDoppler.thresholdScale = dataPathObj->testSubFrmObj[subFrameIndx].dynCfg.cfarCfgDoppler.thresholdScale * 3 /4;
-                }
-                if (dataPathObj->testSubFrmObj[subFrameIndx].dynCfg.cfarCfgRange.thresholdScale !=0)
-                {
-                    dataPathObj->testSubFrmObj[subFrameIndx].dynCfg.cfarCfgRange.thresholdScale = dataPathObj->testSubFrmObj[subFrameIndx].dynCfg.cfarCfgRange.thresholdScale * 3 /4;
-                }
+                System_printf("Pipelined: too many objects (%d) at frame %d\n", gPipelineRefNumObjOut[refIdx], frameIdx);
+                gPipelineRefNumObjOut[refIdx] = PIPELINE_TEST_MAX_NUM_OBJ;
+                isOk = 0;
             }
-
-            /* For numDopplerBins== 16, adjust noise len and shift */
-            if(dataPathObj->testSubFrmObj[subFrameIndx].staticCfg.numDopplerBins == 16)
+            memcpy((void *)gPipelineRefObjOut[refIdx], (void *)subFrameObj->result->objOut,
+                   gPipelineRefNumObjOut[refIdx] * sizeof(DPIF_PointCloudCartesian));
+            memcpy((void *)gPipelineRefObjOutSideInfo[refIdx], (void *)subFrameObj->result->objOutSideInfo,
+                   gPipelineRefNumObjOut[refIdx] * sizeof(DPIF_PointCloudSideInfo));
+        }
+        else
+        {
+            /* Result of the previous frame */
+            refIdx = frameIdx - 1;
+            if ((subFrameObj->result->numObjOut != gPipelineRefNumObjOut[refIdx]) ||
+                (memcmp((void *)gPipelineRefObjOut[refIdx], (void *)subFrameObj->result->objOut,
+                        gPipelineRefNumObjOut[refIdx] * sizeof(DPIF_PointCloudCartesian)) != 0) ||
+                (memcmp((void *)gPipelineRefObjOutSideInfo[refIdx], (void *)subFrameObj->result->objOutSideInfo,
+                        gPipelineRefNumObjOut[refIdx] * sizeof(DPIF_PointCloudSideInfo)) != 0))
             {
-                dataPathObj->testSubFrmObj[subFrameIndx].dynCfg.cfarCfgDoppler.noiseDivShift = 2;
-                dataPathObj->testSubFrmObj[subFrameIndx].dynCfg.cfarCfgDoppler.winLen = 2;
+                System_printf("Pipelined: point cloud of frame %d differs from the non pipelined run\n", refIdx);
+                isOk = 0;
             }
         }
 
-        /* config DPC from dataPathObj */
-        ObjectDetection_Test_configDPC(dataPathObj);
+        /* indicate result consumed, this releases the cube of this frame in pipelined mode */
+        exportInfo.subFrameIdx = subFrameObj->result->subFrameIdx;
+        errCode = DPM_ioctl(dataPathObj->dpmHandle,
+            DPC_OBJDET_IOCTL__DYNAMIC_EXECUTE_RESULT_EXPORTED,
+            &exportInfo,
+            sizeof(DPC_ObjectDetection_ExecuteResultExportedInfo));
+        if (errCode < 0) {
+            System_printf("Error: DPM DPC_OBJDET_IOCTL__DYNAMIC_EXECUTE_RESULT_EXPORTED failed [Error code %d]\n",
+                errCode);
+            ObjectDetection_Test_debugAssert(0);
+        }
+    }
+    ObjectDetection_Test_stopDPC(dataPathObj);
 
-        /* start DPC */
-        ObjectDetection_Test_startDPC(dataPathObj);
-        System_printf("running %d frame for the test\n", numFrames);
-        for (frameIdx = 0; frameIdx < numFrames; frameIdx++)
-        {
-            gTestIndx = testIndx;
-            for (subFrameIndx = 0; subFrameIndx < gNumSubFrames; subFrameIndx++)
-            {
-                /* Simulate the trigger of frame start event for DPC */
-                ObjectDetection_Test_trigFrameStart(dataPathObj);
+    if (isPipelined && (gPipelineNumFramesProcessed != numFrames))
+    {
+        System_printf("Pipelined: %d of %d frames processed at stop\n", gPipelineNumFramesProcessed, numFrames);
+        isOk = 0;
+    }
 
-                sensorConfig = &gFrameConfig[subFrameIndx].sensorConfig;
-                sceneConfig = &gFrameConfig[subFrameIndx].sceneConfig;
+    return isOk;
+}
 
-                numChirpsPerEvent = dataPathObj->testSubFrmObj[subFrameIndx].staticCfg.ADCBufData.dataProperty.numChirpsPerChirpEvent;
+/**
+  *  @b Description
+  *  @n
+  *     Pipelined frame processing test: runs @ref gPipelineTestFrameConfig as a single
+  *     sub-frame without and then with pipelining and compares the point clouds of the
+  *     same generated frames.
+  *
+  *  @param[in] dataPathObj Pointer to main test data structure
+  *
+  *  @retval    Test result: 1: Passed, 0: Failed
+  *
+  */
+uint32_t ObjectDetection_Test_pipeline(ObjectDetection_Test_DataPathObj *dataPathObj)
+{
+    uint32_t isOk;
+    uint8_t  numSubFrames = gNumSubFrames;
+
+    System_printf("Pipelined frame processing test\n");
+
+    /* Pipelined mode needs a single sub-frame */
+    gNumSubFrames = 1;
+    ObjectDetection_Test_setCommonProfile(dataPathObj);
+    ObjectDetection_Test_setProfile(dataPathObj,
+                    &dataPathObj->testSubFrmObj[0],
+                    &gPipelineTestFrameConfig.sensorConfig,
+                    &gPipelineTestFrameConfig.sceneConfig);
+    ObjectDetection_Test_adjustCfarCfg(&dataPathObj->testSubFrmObj[0]);
+
+    isOk = ObjectDetection_Test_runPipelineFrames(dataPathObj, false);
+    if (ObjectDetection_Test_runPipelineFrames(dataPathObj, true) != 1)
+    {
+        isOk = 0;
+    }
+
+    dataPathObj->commonCfg.isPipelineEnabled = false;
+    gNumSubFrames = numSubFrames;
+
+    System_printf("Pipelined frame processing test %s\n", isOk ? "PASSED" : "FAILED");
+    return isOk;
+}
+
+/**
+  *  @b Description
+  *  @n
+  *     Runs one frame of @ref gPipelineTestFrameConfig on sub-frame 0 and waits for
+  *     its result. All frames are generated with the same seed so they have the same
+  *     CFAR detections.
+  *
+  *  @param[in] dataPathObj Pointer to main test data structure
+  *
+  *  @retval    Result of the frame, valid until it is exported
+  *
+  */
+DPC_ObjectDetection_ExecuteResult *ObjectDetection_Test_runSingleFrame
+(
+    ObjectDetection_Test_DataPathObj *dataPathObj
+)
+{
+    ObjectDetection_Test_SubFrameObj *subFrameObj = &dataPathObj->testSubFrmObj[0];
+    uint8_t  numChirpsPerEvent;
+    uint32_t i;
+
+    numChirpsPerEvent = subFrameObj->staticCfg.ADCBufData.dataProperty.numChirpsPerChirpEvent;
+
+    seedFrameData(PIPELINE_TEST_SEED);
+
+    ObjectDetection_Test_trigFrameStart(dataPathObj);
+    ObjectDetection_Test_initGenerator(&subFrameObj->params, &gPipelineTestFrameConfig.sceneConfig);
+    for(i=0; i<subFrameObj->params.numChirpsPerFrame/numChirpsPerEvent; i++)
+    {
+        ObjectDetection_Test_getChirpData(dataPathObj, &subFrameObj->params, numChirpsPerEvent);
+        ObjectDetection_Test_trigChirpEvent(dataPathObj);
+        Task_sleep(1);
+    }
+    SemaphoreP_pend(dataPathObj->semaphoreHandle, SemaphoreP_WAIT_FOREVER);
+
+    return subFrameObj->result;
+}
+
+/**
+  *  @b Description
+  *  @n
+  *     Runs one frame of the overload governor test with the given governor
+  *     configuration.
+  *
+  *  @param[in] dataPathObj Pointer to main test data structure
+  *
+  *  @param[in] cfg Overload governor configuration of the frame
+  *
+  *  @retval    Result of the frame, valid until it is exported
+  *
+  */
+DPC_ObjectDetection_ExecuteResult *ObjectDetection_Test_runGovernorFrame
+(
+    ObjectDetection_Test_DataPathObj *dataPathObj,
+    DPC_ObjectDetection_OverloadGovernorCfg *cfg
+)
+{
+    int32_t  errCode;
+
+    errCode = DPM_ioctl(dataPathObj->dpmHandle,
+                        DPC_OBJDET_IOCTL__DYNAMIC_OVERLOAD_GOVERNOR_CFG,
+                        cfg,
+                        sizeof(DPC_ObjectDetection_OverloadGovernorCfg));
+    if (errCode < 0)
+    {
+        System_printf("Error: DPC_OBJDET_IOCTL__DYNAMIC_OVERLOAD_GOVERNOR_CFG failed [Error code %d]\n", errCode);
+        ObjectDetection_Test_debugAssert(0);
+    }
+
+    return ObjectDetection_Test_runSingleFrame(dataPathObj);
+}
+
+/**
+  *  @b Description
+  *  @n
+  *     Exports the result of a frame of the single sub-frame tests.
+  *
+  *  @param[in] dataPathObj Pointer to main test data structure
+  *
+  *  @param[in] result Result of the frame
+  *
+  *  @retval    None
+  *
+  */
+void ObjectDetection_Test_exportSingleFrame
+(
+    ObjectDetection_Test_DataPathObj *dataPathObj,
+    DPC_ObjectDetection_ExecuteResult *result
+)
+{
+    DPC_ObjectDetection_ExecuteResultExportedInfo exportInfo;
+    int32_t errCode;
+
+    exportInfo.subFrameIdx = result->subFrameIdx;
+    errCode = DPM_ioctl(dataPathObj->dpmHandle,
+        DPC_OBJDET_IOCTL__DYNAMIC_EXECUTE_RESULT_EXPORTED,
+        &exportInfo,
+        sizeof(DPC_ObjectDetection_ExecuteResultExportedInfo));
+    if (errCode < 0) {
+        System_printf("Error: DPM DPC_OBJDET_IOCTL__DYNAMIC_EXECUTE_RESULT_EXPORTED failed [Error code %d]\n",
+            errCode);
+        ObjectDetection_Test_debugAssert(0);
+    }
+}
+
+/**
+  *  @b Description
+  *  @n
+  *     Returns the highest SNR of the point cloud of a frame.
+  *
+  *  @param[in] result Result of the frame
+  *
+  *  @retval    Highest SNR, -32768 if the point cloud is empty
+  *
+  */
+int32_t ObjectDetection_Test_maxPointCloudSnr(DPC_ObjectDetection_ExecuteResult *result)
+{
+    int32_t maxSnr = -32768;
+    uint32_t i;
+
+    for (i = 0; i < result->numObjOut; i++)
+    {
+        if (result->objOutSideInfo[i].snr > maxSnr)
+        {
+            maxSnr = result->objOutSideInfo[i].snr;
+        }
+    }
+    return maxSnr;
+}
+
+/**
+  *  @b Description
+  *  @n
+  *     Overload governor test: runs the same frame of @ref gPipelineTestFrameConfig
+  *     as a single sub-frame three times:
+  *     1. Governor disabled, the reference.
+  *     2. Governor enabled with a target of one cycle. Multi-peak search must be
+  *        disabled, the heat map refresh skipped and the AoA input capped to
+  *        @ref GOVERNOR_TEST_MIN_NUM_AOA_DET detections, the others being reported in
+  *        numDetectionsDropped. The strongest detection must be kept.
+  *     3. Governor disabled again, the point cloud must be the reference one, i.e.
+  *        the AoA configuration was restored.
+  *
+  *  @param[in] dataPathObj Pointer to main test data structure
+  *
+  *  @retval    Test result: 1: Passed, 0: Failed
+  *
+  */
+uint32_t ObjectDetection_Test_overloadGovernor(ObjectDetection_Test_DataPathObj *dataPathObj)
+{
+    ObjectDetection_Test_SubFrameObj *subFrameObj = &dataPathObj->testSubFrmObj[0];
+    DPC_ObjectDetection_OverloadGovernorCfg governorCfg;
+    DPC_ObjectDetection_ExecuteResult *result;
+    uint32_t expectedDegradations;
+    uint32_t numCfarDet, refNumObjOut;
+    int32_t  refMaxSnr;
+    uint8_t  numSubFrames = gNumSubFrames;
+    uint32_t isOk = 1;
+
+    System_printf("Overload governor test\n");
+
+    gNumSubFrames = 1;
+    ObjectDetection_Test_setCommonProfile(dataPathObj);
+    ObjectDetection_Test_setProfile(dataPathObj,
+                    subFrameObj,
+                    &gPipelineTestFrameConfig.sensorConfig,
+                    &gPipelineTestFrameConfig.sceneConfig);
+    ObjectDetection_Test_adjustCfarCfg(subFrameObj);
+    ObjectDetection_Test_configDPC(dataPathObj);
+    ObjectDetection_Test_startDPC(dataPathObj);
+
+    memset((void *)&governorCfg, 0, sizeof(DPC_ObjectDetection_OverloadGovernorCfg));
+
+    /* Reference */
+    result = ObjectDetection_Test_runGovernorFrame(dataPathObj, &governorCfg);
+    numCfarDet = result->stats->dpuStats[DPC_OBJDET_DPU_CFARCAPROC].numDetOut;
+    refNumObjOut = result->numObjOut;
+    refMaxSnr = ObjectDetection_Test_maxPointCloudSnr(result);
+    if (result->overload.degradations != 0U)
+    {
+        System_printf("Governor: degradations 0x%x while disabled\n", result->overload.degradations);
+        isOk = 0;
+    }
+    if (numCfarDet <= GOVERNOR_TEST_MIN_NUM_AOA_DET)
+    {
+        System_printf("Governor: %d CFAR detections, not enough to test the cap\n", numCfarDet);
+        isOk = 0;
+    }
+    ObjectDetection_Test_exportSingleFrame(dataPathObj, result);
+
+    /* Overloaded */
+    governorCfg.enabled = 1;
+    governorCfg.minNumAoaDetections = GOVERNOR_TEST_MIN_NUM_AOA_DET;
+    governorCfg.targetInterFrameCycles = 1;
+    governorCfg.aoaFixedCycles = 1000;
+    governorCfg.aoaCyclesPerDetection = 1000;
+    governorCfg.multiPeakCyclesPerDetection = 1000;
+    governorCfg.heatMapCycles = 1000;
+    result = ObjectDetection_Test_runGovernorFrame(dataPathObj, &governorCfg);
+
+    expectedDegradations = DPC_OBJDET_OVERLOAD_DETECTIONS_CAPPED;
+    if (subFrameObj->dynCfg.multiObjBeamFormingCfg.enabled == 1)
+    {
+        expectedDegradations |= DPC_OBJDET_OVERLOAD_MULTI_PEAK_DISABLED;
+    }
+    if (subFrameObj->dynCfg.prepareRangeAzimuthHeatMap == true)
+    {
+        expectedDegradations |= DPC_OBJDET_OVERLOAD_HEAT_MAP_SKIPPED;
+    }
+    if (result->overload.degradations != expectedDegradations)
+    {
+        System_printf("Governor: degradations 0x%x, expected 0x%x\n",
+                      result->overload.degradations, expectedDegradations);
+        isOk = 0;
+    }
+    if ((result->overload.numDetectionsDropped != numCfarDet - GOVERNOR_TEST_MIN_NUM_AOA_DET) ||
+        (result->stats->dpuStats[DPC_OBJDET_DPU_AOAPROC].numDetIn != GOVERNOR_TEST_MIN_NUM_AOA_DET) ||
+        (result->numObjOut > GOVERNOR_TEST_MIN_NUM_AOA_DET))
+    {
+        System_printf("Governor: %d of %d detections dropped, %d processed, %d objects\n",
+                      result->overload.numDetectionsDropped, numCfarDet,
+                      result->stats->dpuStats[DPC_OBJDET_DPU_AOAPROC].numDetIn, result->numObjOut);
+        isOk = 0;
+    }
+    if (ObjectDetection_Test_maxPointCloudSnr(result) != refMaxSnr)
+    {
+        System_printf("Governor: strongest detection dropped by the cap\n");
+        isOk = 0;
+    }
+    if (result->overload.predictedInterFrameCycles <= governorCfg.targetInterFrameCycles)
+    {
+        System_printf("Governor: predicted %d cycles, below the target\n",
+                      result->overload.predictedInterFrameCycles);
+        isOk = 0;
+    }
+    ObjectDetection_Test_exportSingleFrame(dataPathObj, result);
+
+    /* Restored */
+    governorCfg.enabled = 0;
+    result = ObjectDetection_Test_runGovernorFrame(dataPathObj, &governorCfg);
+    if ((result->overload.degradations != 0U) || (result->numObjOut != refNumObjOut) ||
+        (ObjectDetection_Test_maxPointCloudSnr(result) != refMaxSnr))
+    {
+        System_printf("Governor: %d objects after the overloaded frame, expected %d\n",
+                      result->numObjOut, refNumObjOut);
+        isOk = 0;
+    }
+    ObjectDetection_Test_exportSingleFrame(dataPathObj, result);
+
+    ObjectDetection_Test_stopDPC(dataPathObj);
+    gNumSubFrames = numSubFrames;
+
+    System_printf("Overload governor test %s\n", isOk ? "PASSED" : "FAILED");
+    return isOk;
+}
+
+/**
+  *  @b Description
+  *  @n
+  *     DPU statistics test: runs @ref DPU_STATS_TEST_NUM_FRAMES frames of
+  *     @ref gPipelineTestFrameConfig as a single sub-frame. After the last frame the
+  *     cycle summary of each DPU must cover @ref DPC_OBJDET_DPU_STATS_HISTORY_SIZE frames
+  *     and be ordered min <= avg <= p99 <= max. The bytes moved by range, Doppler and CFAR
+  *     processing must match the sizes derived from the configuration. AoA fetches the
+  *     Doppler chirps of all virtual antennas of a range bin per fetch, so a last frame
+  *     capped by the overload governor to one detection must report exactly one fetch.
+  *
+  *  @param[in] dataPathObj Pointer to main test data structure
+  *
+  *  @retval    Test result: 1: Passed, 0: Failed
+  *
+  */
+uint32_t ObjectDetection_Test_dpuStats(ObjectDetection_Test_DataPathObj *dataPathObj)
+{
+    ObjectDetection_Test_SubFrameObj *subFrameObj = &dataPathObj->testSubFrmObj[0];
+    DPC_ObjectDetection_StaticCfg *staticCfg = &subFrameObj->staticCfg;
+    DPC_ObjectDetection_OverloadGovernorCfg governorCfg;
+    DPC_ObjectDetection_ExecuteResult *result = NULL;
+    DPC_ObjectDetection_DpuStats *dpuStats;
+    DPC_ObjectDetection_CycleSummary *cycles;
+    uint32_t expectedBytes[DPC_OBJDET_DPU_NUM];
+    uint32_t bytesPerFetch;
+    uint8_t  numSubFrames = gNumSubFrames;
+    uint32_t isOk = 1;
+    uint32_t frameIdx;
+    uint32_t dpuId;
+    int32_t  errCode;
+
+    System_printf("DPU statistics test\n");
+
+    gNumSubFrames = 1;
+    ObjectDetection_Test_setCommonProfile(dataPathObj);
+    ObjectDetection_Test_setProfile(dataPathObj,
+                    subFrameObj,
+                    &gPipelineTestFrameConfig.sensorConfig,
+                    &gPipelineTestFrameConfig.sceneConfig);
+    ObjectDetection_Test_adjustCfarCfg(subFrameObj);
+    ObjectDetection_Test_configDPC(dataPathObj);
+    ObjectDetection_Test_startDPC(dataPathObj);
+
+    /* All frames but the last one without governor */
+    memset((void *)&governorCfg, 0, sizeof(DPC_ObjectDetection_OverloadGovernorCfg));
+    for (frameIdx = 0; frameIdx < DPU_STATS_TEST_NUM_FRAMES - 1U; frameIdx++)
+    {
+        result = ObjectDetection_Test_runGovernorFrame(dataPathObj, &governorCfg);
+        ObjectDetection_Test_exportSingleFrame(dataPathObj, result);
+    }
+
+    /* Last frame with AoA capped to one detection */
+    governorCfg.enabled = 1;
+    governorCfg.minNumAoaDetections = 1;
+    governorCfg.targetInterFrameCycles = 1;
+    governorCfg.aoaFixedCycles = 1000;
+    governorCfg.aoaCyclesPerDetection = 1000;
+    governorCfg.multiPeakCyclesPerDetection = 1000;
+    governorCfg.heatMapCycles = 1000;
+    result = ObjectDetection_Test_runGovernorFrame(dataPathObj, &governorCfg);
+
+    expectedBytes[DPC_OBJDET_DPU_RANGEPROC] = (uint32_t)staticCfg->numChirpsPerFrame *
+        staticCfg->ADCBufData.dataProperty.numRxAntennas *
+        (staticCfg->ADCBufData.dataProperty.numAdcSamples + staticCfg->numRangeBins) *
+        sizeof(cmplx16ImRe_t);
+    expectedBytes[DPC_OBJDET_DPU_CFARCAPROC] = (uint32_t)staticCfg->numRangeBins *
+        staticCfg->numDopplerBins * sizeof(uint16_t);
+    expectedBytes[DPC_OBJDET_DPU_DOPPLERPROC] = (uint32_t)staticCfg->numRangeBins *
+        staticCfg->numDopplerChirps * staticCfg->numVirtualAntennas * sizeof(cmplx16ImRe_t) +
+        expectedBytes[DPC_OBJDET_DPU_CFARCAPROC];
+    bytesPerFetch = (uint32_t)staticCfg->numVirtualAntennas * staticCfg->numDopplerChirps *
+        sizeof(cmplx16ImRe_t);
+    /* No fetch when the angle is not estimated */
+    expectedBytes[DPC_OBJDET_DPU_AOAPROC] = (staticCfg->numVirtualAntAzim > 1) ? bytesPerFetch : 0U;
+
+    if ((result->overload.degradations & DPC_OBJDET_OVERLOAD_DETECTIONS_CAPPED) == 0U)
+    {
+        System_printf("DPU stats: AoA input of the last frame not capped\n");
+        isOk = 0;
+    }
+
+    for (dpuId = 0; dpuId < DPC_OBJDET_DPU_NUM; dpuId++)
+    {
+        dpuStats = &result->stats->dpuStats[dpuId];
+        cycles = &dpuStats->cycles;
+        if ((cycles->numFrames != DPC_OBJDET_DPU_STATS_HISTORY_SIZE) ||
+            (cycles->minCycles > cycles->avgCycles) ||
+            (cycles->avgCycles > cycles->p99Cycles) ||
+            (cycles->p99Cycles > cycles->maxCycles))
+        {
+            System_printf("DPU stats: DPU %d cycles over %d frames min %d avg %d p99 %d max %d\n",
+                          dpuId, cycles->numFrames, cycles->minCycles, cycles->avgCycles,
+                          cycles->p99Cycles, cycles->maxCycles);
+            isOk = 0;
+        }
+        if (dpuStats->bytesMoved != expectedBytes[dpuId])
+        {
+            System_printf("DPU stats: DPU %d moved %d bytes, expected %d\n",
+                          dpuId, dpuStats->bytesMoved, expectedBytes[dpuId]);
+            isOk = 0;
+        }
+    }
+    ObjectDetection_Test_exportSingleFrame(dataPathObj, result);
+
+    /* The governor configuration is kept over stop and start */
+    governorCfg.enabled = 0;
+    errCode = DPM_ioctl(dataPathObj->dpmHandle,
+                        DPC_OBJDET_IOCTL__DYNAMIC_OVERLOAD_GOVERNOR_CFG,
+                        &governorCfg,
+                        sizeof(DPC_ObjectDetection_OverloadGovernorCfg));
+    if (errCode < 0)
+    {
+        System_printf("Error: DPC_OBJDET_IOCTL__DYNAMIC_OVERLOAD_GOVERNOR_CFG failed [Error code %d]\n", errCode);
+        ObjectDetection_Test_debugAssert(0);
+    }
+
+    ObjectDetection_Test_stopDPC(dataPathObj);
+    gNumSubFrames = numSubFrames;
+
+    System_printf("DPU statistics test %s\n", isOk ? "PASSED" : "FAILED");
+    return isOk;
+}
+
+/**
+  *  @b Description
+  *  @n
+  *     Sends the output ring configuration to the DPC, which must be stopped.
+  *
+  *  @param[in] dataPathObj Pointer to main test data structure
+  *
+  *  @param[in] addr Ring memory, NULL disables the ring
+  *
+  *  @retval    None
+  *
+  */
+void ObjectDetection_Test_outputRingCfg(ObjectDetection_Test_DataPathObj *dataPathObj, void *addr)
+{
+    DPC_ObjectDetection_OutputRingCfg cfg;
+    int32_t errCode;
+
+    cfg.addr = addr;
+    cfg.size = OUTPUT_RING_TEST_SIZE;
+    cfg.numSlots = OUTPUT_RING_TEST_NUM_SLOTS;
+    errCode = DPM_ioctl(dataPathObj->dpmHandle,
+                        DPC_OBJDET_IOCTL__OUTPUT_RING_CFG,
+                        &cfg,
+                        sizeof(DPC_ObjectDetection_OutputRingCfg));
+    if (errCode < 0)
+    {
+        System_printf("Error: DPC_OBJDET_IOCTL__OUTPUT_RING_CFG failed [Error code %d]\n", errCode);
+        ObjectDetection_Test_debugAssert(0);
+    }
+}
+
+/**
+  *  @b Description
+  *  @n
+  *     Output ring test: runs frames of @ref gPipelineTestFrameConfig as a single
+  *     sub-frame with a ring of @ref OUTPUT_RING_TEST_NUM_SLOTS slots that the test
+  *     does not release. The first frames must be written in place in the ring, the
+  *     others dropped and counted in numFramesDropped. The frames are then read back
+  *     with the consumer functions of objectdetection_outputring.h: frame header,
+  *     TLV walk and release until the ring is empty.
+  *
+  *  @param[in] dataPathObj Pointer to main test data structure
+  *
+  *  @retval    Test result: 1: Passed, 0: Failed
+  *
+  */
+uint32_t ObjectDetection_Test_outputRing(ObjectDetection_Test_DataPathObj *dataPathObj)
+{
+    ObjectDetection_Test_SubFrameObj *subFrameObj = &dataPathObj->testSubFrmObj[0];
+    DPC_ObjectDetection_OutputRingCtrl *ctrl = (DPC_ObjectDetection_OutputRingCtrl *)gObjectDetection_Test_outputRing;
+    DPC_ObjectDetection_ExecuteResult *result;
+    DPC_ObjectDetection_TlvFrameHeader *frame;
+    DPC_ObjectDetection_TlvHeader *tlv;
+    uint8_t  *slot;
+    uint32_t frameNumber[OUTPUT_RING_TEST_NUM_SLOTS];
+    uint32_t numObjOut[OUTPUT_RING_TEST_NUM_SLOTS];
+    void     *objOut[OUTPUT_RING_TEST_NUM_SLOTS];
+    uint32_t numFrames = OUTPUT_RING_TEST_NUM_SLOTS + 2U;
+    uint32_t frameIdx, numTlvs, tlvEnd;
+    uint8_t  numSubFrames = gNumSubFrames;
+    uint32_t isOk = 1;
+
+    System_printf("Output ring test\n");
+
+    gNumSubFrames = 1;
+    ObjectDetection_Test_setCommonProfile(dataPathObj);
+    ObjectDetection_Test_setProfile(dataPathObj,
+                    subFrameObj,
+                    &gPipelineTestFrameConfig.sensorConfig,
+                    &gPipelineTestFrameConfig.sceneConfig);
+    ObjectDetection_Test_adjustCfarCfg(subFrameObj);
+    ObjectDetection_Test_configDPC(dataPathObj);
+    ObjectDetection_Test_outputRingCfg(dataPathObj, (void *)gObjectDetection_Test_outputRing);
+    ObjectDetection_Test_startDPC(dataPathObj);
+
+    for (frameIdx = 0; frameIdx < numFrames; frameIdx++)
+    {
+        result = ObjectDetection_Test_runSingleFrame(dataPathObj);
+
+        if (ObjectDetection_Test_CompareToRef(subFrameObj) != 1)
+        {
+            System_printf("Output ring: wrong point cloud at frame %d\n", frameIdx);
+            isOk = 0;
+        }
+
+        slot = gObjectDetection_Test_outputRing + sizeof(DPC_ObjectDetection_OutputRingCtrl) +
+               (frameIdx % OUTPUT_RING_TEST_NUM_SLOTS) * OUTPUT_RING_TEST_SLOT_SIZE;
+        if (frameIdx < OUTPUT_RING_TEST_NUM_SLOTS)
+        {
+            /* Written in place in the ring */
+            frameNumber[frameIdx] = result->stats->frameStartIntCounter;
+            numObjOut[frameIdx] = result->numObjOut;
+            objOut[frameIdx] = (void *)result->objOut;
+            if (((uint8_t *)result->objOut <= slot) ||
+                ((uint8_t *)result->objOut >= slot + OUTPUT_RING_TEST_SLOT_SIZE))
+            {
+                System_printf("Output ring: frame %d not written in its slot\n", frameIdx);
+                isOk = 0;
+            }
+        }
+        else if (((uint8_t *)result->objOut >= gObjectDetection_Test_outputRing) &&
+                 ((uint8_t *)result->objOut < gObjectDetection_Test_outputRing + OUTPUT_RING_TEST_SIZE))
+        {
+            System_printf("Output ring: frame %d written in the full ring\n", frameIdx);
+            isOk = 0;
+        }
+
+        ObjectDetection_Test_exportSingleFrame(dataPathObj, result);
+    }
+    ObjectDetection_Test_stopDPC(dataPathObj);
+
+    if ((ctrl->writeIdx != OUTPUT_RING_TEST_NUM_SLOTS) ||
+        (ctrl->numFramesDropped != numFrames - OUTPUT_RING_TEST_NUM_SLOTS))
+    {
+        System_printf("Output ring: %d frames written, %d dropped\n", ctrl->writeIdx, ctrl->numFramesDropped);
+        isOk = 0;
+    }
+
+    /* Consumer side */
+    for (frameIdx = 0; frameIdx < OUTPUT_RING_TEST_NUM_SLOTS; frameIdx++)
+    {
+        frame = DPC_ObjectDetection_outputRingPeek(ctrl);
+        if (frame == NULL)
+        {
+            System_printf("Output ring: frame %d missing\n", frameIdx);
+            isOk = 0;
+            break;
+        }
+        if ((frame->frameNumber != frameNumber[frameIdx]) ||
+            (frame->subFrameIdx != 0U) ||
+            (frame->numObj != numObjOut[frameIdx]) ||
+            (frame->degradations != 0U) ||
+            (frame->totalLen > OUTPUT_RING_TEST_SLOT_SIZE))
+        {
+            System_printf("Output ring: wrong header of frame %d\n", frameIdx);
+            isOk = 0;
+        }
+
+        numTlvs = 0;
+        tlvEnd = sizeof(DPC_ObjectDetection_TlvFrameHeader);
+        tlv = DPC_ObjectDetection_outputRingNextTlv(frame, NULL);
+        while (tlv != NULL)
+        {
+            if ((tlv->type == DPC_OBJDET_TLV_TYPE_POINT_CLOUD) &&
+                (((void *)(tlv + 1) != objOut[frameIdx]) ||
+                 (tlv->length != numObjOut[frameIdx] * sizeof(DPIF_PointCloudCartesian))))
+            {
+                System_printf("Output ring: wrong point cloud TLV in frame %d\n", frameIdx);
+                isOk = 0;
+            }
+            if ((tlv->type == DPC_OBJDET_TLV_TYPE_SIDE_INFO) &&
+                (tlv->length != numObjOut[frameIdx] * sizeof(DPIF_PointCloudSideInfo)))
+            {
+                System_printf("Output ring: wrong side info TLV in frame %d\n", frameIdx);
+                isOk = 0;
+            }
+            if (tlv->type == DPC_OBJDET_TLV_TYPE_AZIMUTH_HEAT_MAP)
+            {
+                System_printf("Output ring: heat map TLV in a slot too small for it\n");
+                isOk = 0;
+            }
+            tlvEnd += sizeof(DPC_ObjectDetection_TlvHeader) + tlv->length;
+            numTlvs++;
+            tlv = DPC_ObjectDetection_outputRingNextTlv(frame, tlv);
+        }
+        if ((numTlvs != frame->numTlvs) || (tlvEnd != frame->totalLen))
+        {
+            System_printf("Output ring: %d TLVs of %d bytes in frame %d, header says %d of %d\n",
+                          numTlvs, tlvEnd, frameIdx, frame->numTlvs, frame->totalLen);
+            isOk = 0;
+        }
+
+        DPC_ObjectDetection_outputRingRelease(ctrl);
+    }
+
+    if ((frameNumber[1] != frameNumber[0] + 1U) ||
+        (DPC_ObjectDetection_outputRingPeek(ctrl) != NULL))
+    {
+        System_printf("Output ring: frames not consecutive or ring not empty after release\n");
+        isOk = 0;
+    }
+
+    ObjectDetection_Test_outputRingCfg(dataPathObj, NULL);
+    gNumSubFrames = numSubFrames;
+
+    System_printf("Output ring test %s\n", isOk ? "PASSED" : "FAILED");
+    return isOk;
+}
+
+/**
+ *  @b Description
+ *  @n
+ *      DPM report function of the instance group test instances. The test checks the
+ *      IOCTL return values itself, including the expected failures.
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+static void ObjectDetection_Test_groupReportFxn
+(
+    DPM_Report  reportType,
+    uint32_t    instanceId,
+    int32_t     errCode,
+    uint32_t    arg0,
+    uint32_t    arg1
+)
+{
+    return;
+}
+
+/**
+  *  @b Description
+  *  @n
+  *     Initializes a DPC instance of the instance group test. It uses the memory of the
+  *     main instance, which is stopped.
+  *
+  *  @param[in] dataPathObj Pointer to main test data structure
+  *
+  *  @param[in] instanceId DPM instance identifier
+  *
+  *  @retval    DPM handle
+  *
+  */
+DPM_Handle ObjectDetection_Test_groupInit
+(
+    ObjectDetection_Test_DataPathObj *dataPathObj,
+    uint32_t instanceId
+)
+{
+    DPM_InitCfg                         dpmInitCfg;
+    DPC_ObjectDetection_InitParams      objDetInitParams;
+    DPM_Handle                          dpmHandle;
+    uint32_t                            edmaCCIdx;
+    int32_t                             errCode;
+
+    memset ((void *)&objDetInitParams, 0, sizeof(DPC_ObjectDetection_InitParams));
+    for (edmaCCIdx = 0; edmaCCIdx < EDMA_NUM_CC; edmaCCIdx++)
+    {
+        objDetInitParams.edmaHandle[edmaCCIdx] = dataPathObj->edmaHandle[edmaCCIdx];
+    }
+    objDetInitParams.L3ramCfg.addr     = &gObjectDetection_Test_L3Heap;
+    objDetInitParams.L3ramCfg.size     = sizeof(gObjectDetection_Test_L3Heap);
+    objDetInitParams.CoreL2RamCfg.addr = &gObjectDetection_Test_L2RamHeap;
+    objDetInitParams.CoreL2RamCfg.size = sizeof(gObjectDetection_Test_L2RamHeap);
+    objDetInitParams.CoreL1RamCfg.addr = &gObjectDetection_Test_L1RamHeap;
+    objDetInitParams.CoreL1RamCfg.size = sizeof(gObjectDetection_Test_L1RamHeap);
+    objDetInitParams.instanceGroup     = &gObjectDetection_Test_instanceGroup;
+
+    memset ((void *)&dpmInitCfg, 0, sizeof(DPM_InitCfg));
+    dpmInitCfg.socHandle        = socHandle;
+    dpmInitCfg.ptrProcChainCfg  = &gDPC_ObjectDetectionCfg;
+    dpmInitCfg.instanceId       = instanceId;
+    dpmInitCfg.domain           = DPM_Domain_LOCALIZED;
+    dpmInitCfg.reportFxn        = ObjectDetection_Test_groupReportFxn;
+    dpmInitCfg.arg              = &objDetInitParams;
+    dpmInitCfg.argSize          = sizeof(DPC_ObjectDetection_InitParams);
+
+    dpmHandle = DPM_init (&dpmInitCfg, &errCode);
+    if (dpmHandle == NULL)
+    {
+        System_printf ("Error: Unable to initialize the DPM Module [Error: %d]\n", errCode);
+        ObjectDetection_Test_debugAssert (0);
+    }
+    return dpmHandle;
+}
+
+/**
+  *  @b Description
+  *  @n
+  *     Sends the pre-start common and pre-start configurations of sub-frame 0 of the
+  *     test data structure to a DPC instance of the instance group test.
+  *
+  *  @param[in] dpmHandle DPM handle of the instance
+  *
+  *  @param[in] dataPathObj Pointer to main test data structure
+  *
+  *  @param[out] memUsage Memory usage reported by the pre-start configuration
+  *
+  *  @retval    Error code of the pre-start configuration
+  *
+  */
+int32_t ObjectDetection_Test_groupConfig
+(
+    DPM_Handle dpmHandle,
+    ObjectDetection_Test_DataPathObj *dataPathObj,
+    DPC_ObjectDetection_DPC_IOCTL_preStartCfg_memUsage *memUsage
+)
+{
+    DPC_ObjectDetection_PreStartCommonCfg objDetPreStartCommonCfg;
+    DPC_ObjectDetection_PreStartCfg objDetPreStartCfg;
+    int32_t errCode;
+
+    objDetPreStartCommonCfg = dataPathObj->commonCfg;
+    errCode = DPM_ioctl (dpmHandle,
+                         DPC_OBJDET_IOCTL__STATIC_PRE_START_COMMON_CFG,
+                         &objDetPreStartCommonCfg,
+                         sizeof (DPC_ObjectDetection_PreStartCommonCfg));
+    if (errCode < 0)
+    {
+        System_printf ("Error: Unable to send DPC_OBJDET_IOCTL__STATIC_PRE_START_COMMON_CFG [Error:%d]\n", errCode);
+        ObjectDetection_Test_debugAssert (0);
+    }
+
+    memset(&objDetPreStartCfg, 0, sizeof(DPC_ObjectDetection_PreStartCfg));
+    objDetPreStartCfg.subFrameNum = 0;
+    objDetPreStartCfg.staticCfg = dataPathObj->testSubFrmObj[0].staticCfg;
+    objDetPreStartCfg.dynCfg = dataPathObj->testSubFrmObj[0].dynCfg;
+    errCode = DPM_ioctl (dpmHandle,
+                         DPC_OBJDET_IOCTL__STATIC_PRE_START_CFG,
+                         &objDetPreStartCfg,
+                         sizeof (DPC_ObjectDetection_PreStartCfg));
+    *memUsage = objDetPreStartCfg.memUsage;
+    return errCode;
+}
+
+/**
+  *  @b Description
+  *  @n
+  *     Starts a configured DPC instance of the instance group test, runs one frame of
+  *     @ref gPipelineTestFrameConfig on it and stops it. The point cloud must be the
+  *     reference one of the main instance, which is not in the group, saved in the
+  *     first frame of the pipelined test references. The DPM task only executes the
+  *     main instance, so the inter-frame processing is executed here.
+  *
+  *  @param[in] dataPathObj Pointer to main test data structure
+  *
+  *  @param[in] dpmHandle DPM handle of the instance
+  *
+  *  @param[in] instIdx Index of the instance in the test
+  *
+  *  @retval    Test result: 1: Passed, 0: Failed
+  *
+  */
+uint32_t ObjectDetection_Test_groupFrame
+(
+    ObjectDetection_Test_DataPathObj *dataPathObj,
+    DPM_Handle dpmHandle,
+    uint32_t instIdx
+)
+{
+    ObjectDetection_Test_SubFrameObj *subFrameObj = &dataPathObj->testSubFrmObj[0];
+    DPC_ObjectDetection_ExecuteResult *result;
+    DPC_ObjectDetection_ExecuteResultExportedInfo exportInfo;
+    DPM_Buffer resultBuffer;
+    uint8_t  numChirpsPerEvent;
+    uint32_t isOk = 1;
+    int32_t  errCode;
+    uint32_t i;
+
+    errCode = DPM_start(dpmHandle);
+    if (errCode < 0)
+    {
+        System_printf("Error: Unable to start the DPM Profile [Error: %d]\n", errCode);
+        ObjectDetection_Test_debugAssert(0);
+    }
+
+    numChirpsPerEvent = subFrameObj->staticCfg.ADCBufData.dataProperty.numChirpsPerChirpEvent;
+
+    seedFrameData(PIPELINE_TEST_SEED);
+
+    errCode = DPM_ioctl(dpmHandle, DPC_OBJDET_IOCTL__TRIGGER_FRAME, NULL, 0);
+    if (errCode < 0)
+    {
+        System_printf("Error: Unable to send DPC_OBJDET_IOCTL__TRIGGER_FRAME [Error:%d]\n", errCode);
+        ObjectDetection_Test_debugAssert(0);
+    }
+    ObjectDetection_Test_initGenerator(&subFrameObj->params, &gPipelineTestFrameConfig.sceneConfig);
+    for(i=0; i<subFrameObj->params.numChirpsPerFrame/numChirpsPerEvent; i++)
+    {
+        ObjectDetection_Test_getChirpData(dataPathObj, &subFrameObj->params, numChirpsPerEvent);
+        errCode = DPM_ioctl(dpmHandle, DPC_OBJDET_IOCTL__TRIGGER_CHIRP, NULL, 0);
+        if (errCode < 0)
+        {
+            System_printf("Error: Unable to send DPC_OBJDET_IOCTL__TRIGGER_CHIRP [Error:%d]\n", errCode);
+            ObjectDetection_Test_debugAssert(0);
+        }
+        Task_sleep(1);
+    }
+
+    /* The end of the frame was notified by the last chirp */
+    memset((void *)&resultBuffer, 0, sizeof(DPM_Buffer));
+    errCode = DPM_execute(dpmHandle, &resultBuffer);
+    if ((errCode < 0) || (resultBuffer.size[0] != sizeof(DPC_ObjectDetection_ExecuteResult)))
+    {
+        System_printf("Group: instance %d frame failed [Error code %d]\n", instIdx, errCode);
+        isOk = 0;
+    }
+    else
+    {
+        result = (DPC_ObjectDetection_ExecuteResult *)resultBuffer.ptrBuffer[0];
+        if ((result->numObjOut != gPipelineRefNumObjOut[0]) ||
+            (memcmp((void *)gPipelineRefObjOut[0], (void *)result->objOut,
+                    gPipelineRefNumObjOut[0] * sizeof(DPIF_PointCloudCartesian)) != 0) ||
+            (memcmp((void *)gPipelineRefObjOutSideInfo[0], (void *)result->objOutSideInfo,
+                    gPipelineRefNumObjOut[0] * sizeof(DPIF_PointCloudSideInfo)) != 0))
+        {
+            System_printf("Group: instance %d point cloud of %d objects differs from the %d of the ungrouped instance\n",
+                          instIdx, result->numObjOut, gPipelineRefNumObjOut[0]);
+            isOk = 0;
+        }
+
+        exportInfo.subFrameIdx = result->subFrameIdx;
+        errCode = DPM_ioctl(dpmHandle,
+            DPC_OBJDET_IOCTL__DYNAMIC_EXECUTE_RESULT_EXPORTED,
+            &exportInfo,
+            sizeof(DPC_ObjectDetection_ExecuteResultExportedInfo));
+        if (errCode < 0)
+        {
+            System_printf("Error: DPM DPC_OBJDET_IOCTL__DYNAMIC_EXECUTE_RESULT_EXPORTED failed [Error code %d]\n",
+                errCode);
+            ObjectDetection_Test_debugAssert(0);
+        }
+    }
+
+    errCode = DPM_stop(dpmHandle);
+    if (errCode < 0)
+    {
+        System_printf("Error: Unable to stop the DPM Profile [Error: %d]\n", errCode);
+        ObjectDetection_Test_debugAssert(0);
+    }
+    return isOk;
+}
+
+/**
+  *  @b Description
+  *  @n
+  *     Instance group test: two DPC instances share @ref gObjectDetection_Test_instanceGroup.
+  *     1. Both are configured with the single sub-frame of @ref gPipelineTestFrameConfig, the
+  *        first allocates and generates the tables, both report them as shared. A frame
+  *        run on each must give the point cloud of the main instance, which is not in
+  *        the group, see @ref ObjectDetection_Test_groupFrame.
+  *     2. The second is configured with half the ADC samples while the first still uses
+  *        the tables, which must fail.
+  *     3. The first gets a new common configuration, the tables are released and
+  *        allocated again by the next configuration with half the ADC samples, which
+  *        the second can then use.
+  *     4. The tables are released when both instances are de-initialized.
+  *
+  *  @param[in] dataPathObj Pointer to main test data structure
+  *
+  *  @retval    Test result: 1: Passed, 0: Failed
+  *
+  */
+uint32_t ObjectDetection_Test_instanceGroup(ObjectDetection_Test_DataPathObj *dataPathObj)
+{
+    DPC_ObjectDetection_InstanceGroup *group = &gObjectDetection_Test_instanceGroup;
+    DPC_ObjectDetection_DPC_IOCTL_preStartCfg_memUsage memUsage[2];
+    ObjectDetection_Test_SubFrameObj *subFrameObj = &dataPathObj->testSubFrmObj[0];
+    sensorConfig_t sensorConfig = gPipelineTestFrameConfig.sensorConfig;
+    DPC_ObjectDetection_ExecuteResult *result;
+    DPM_Handle dpmHandle[2];
+    uint8_t  numSubFrames = gNumSubFrames;
+    uint32_t isOk = 1;
+    int32_t  errCode[2];
+    int32_t  i;
+
+    System_printf("Instance group test\n");
+
+    /* Reference point cloud of the main instance, the memory of which the group
+       instances use afterwards */
+    gNumSubFrames = 1;
+    ObjectDetection_Test_setCommonProfile(dataPathObj);
+    ObjectDetection_Test_setProfile(dataPathObj, subFrameObj, &sensorConfig,
+                                    &gPipelineTestFrameConfig.sceneConfig);
+    ObjectDetection_Test_configDPC(dataPathObj);
+    ObjectDetection_Test_startDPC(dataPathObj);
+    result = ObjectDetection_Test_runSingleFrame(dataPathObj);
+    gPipelineRefNumObjOut[0] = result->numObjOut;
+    if ((result->numObjOut == 0U) || (result->numObjOut > PIPELINE_TEST_MAX_NUM_OBJ))
+    {
+        System_printf("Group: %d objects in the reference point cloud\n", result->numObjOut);
+        isOk = 0;
+    }
+    if (gPipelineRefNumObjOut[0] > PIPELINE_TEST_MAX_NUM_OBJ)
+    {
+        gPipelineRefNumObjOut[0] = PIPELINE_TEST_MAX_NUM_OBJ;
+    }
+    memcpy((void *)gPipelineRefObjOut[0], (void *)result->objOut,
+           gPipelineRefNumObjOut[0] * sizeof(DPIF_PointCloudCartesian));
+    memcpy((void *)gPipelineRefObjOutSideInfo[0], (void *)result->objOutSideInfo,
+           gPipelineRefNumObjOut[0] * sizeof(DPIF_PointCloudSideInfo));
+    ObjectDetection_Test_exportSingleFrame(dataPathObj, result);
+    ObjectDetection_Test_stopDPC(dataPathObj);
+
+    memset((void *)group, 0, sizeof(DPC_ObjectDetection_InstanceGroup));
+    group->CoreL2RamCfg.addr = &gObjectDetection_Test_groupL2RamHeap;
+    group->CoreL2RamCfg.size = sizeof(gObjectDetection_Test_groupL2RamHeap);
+    group->CoreL1RamCfg.addr = &gObjectDetection_Test_groupL1RamHeap;
+    group->CoreL1RamCfg.size = sizeof(gObjectDetection_Test_groupL1RamHeap);
+
+    dpmHandle[0] = ObjectDetection_Test_groupInit(dataPathObj, 0xFEEDFEE0);
+    dpmHandle[1] = ObjectDetection_Test_groupInit(dataPathObj, 0xFEEDFEE1);
+
+    /* Shared */
+    for (i = 0; i < 2; i++)
+    {
+        errCode[i] = ObjectDetection_Test_groupConfig(dpmHandle[i], dataPathObj, &memUsage[i]);
+    }
+    if ((errCode[0] != 0) || (errCode[1] != 0) ||
+        (group->tables.isAllocated == false) || (group->tables.numUsers != 2U) ||
+        (group->tables.numAdcSamples != sensorConfig.numAdcSamples) ||
+        (memUsage[0].CoreL1RamShared == 0U) ||
+        (memUsage[0].CoreL1RamShared != memUsage[1].CoreL1RamShared) ||
+        (memUsage[0].CoreL2RamShared != memUsage[1].CoreL2RamShared))
+    {
+        System_printf("Group: shared configuration failed [%d %d], %d users, L1 shared %d/%d\n",
+                      errCode[0], errCode[1], group->tables.numUsers,
+                      memUsage[0].CoreL1RamShared, memUsage[1].CoreL1RamShared);
+        isOk = 0;
+    }
+    if (group->tables.isGenerated == false)
+    {
+        System_printf("Group: tables not generated\n");
+        isOk = 0;
+    }
+
+    /* Both process with the tables generated by the first */
+    for (i = 0; i < 2; i++)
+    {
+        if (ObjectDetection_Test_groupFrame(dataPathObj, dpmHandle[i], i) == 0)
+        {
+            isOk = 0;
+        }
+    }
+
+    /* Other sizes while the tables are in use */
+    sensorConfig.numAdcSamples /= 2;
+    ObjectDetection_Test_setProfile(dataPathObj, subFrameObj, &sensorConfig,
+                                    &gPipelineTestFrameConfig.sceneConfig);
+    errCode[1] = ObjectDetection_Test_groupConfig(dpmHandle[1], dataPathObj, &memUsage[1]);
+    if ((errCode[1] != DPC_OBJECTDETECTION_EINVAL__INSTANCE_GROUP_CFG) ||
+        (group->tables.isAllocated == false) || (group->tables.numUsers != 1U) ||
+        (group->tables.numAdcSamples != gPipelineTestFrameConfig.sensorConfig.numAdcSamples))
+    {
+        System_printf("Group: mismatching configuration returned %d, %d users\n",
+                      errCode[1], group->tables.numUsers);
+        isOk = 0;
+    }
+
+    /* Released by the new common configuration of the last user */
+    for (i = 0; i < 2; i++)
+    {
+        errCode[i] = ObjectDetection_Test_groupConfig(dpmHandle[i], dataPathObj, &memUsage[i]);
+    }
+    if ((errCode[0] != 0) || (errCode[1] != 0) ||
+        (group->tables.isAllocated == false) || (group->tables.numUsers != 2U) ||
+        (group->tables.numAdcSamples != sensorConfig.numAdcSamples))
+    {
+        System_printf("Group: reconfiguration failed [%d %d], %d users, %d ADC samples\n",
+                      errCode[0], errCode[1], group->tables.numUsers, group->tables.numAdcSamples);
+        isOk = 0;
+    }
+
+    /* Released by the de-initialization of the last user */
+    for (i = 0; i < 2; i++)
+    {
+        if (DPM_deinit (dpmHandle[i]) < 0)
+        {
+            System_printf ("Error: Unable to de-initialize the DPM Module\n");
+            ObjectDetection_Test_debugAssert (0);
+        }
+        if (group->tables.numUsers != (uint32_t)(1 - i))
+        {
+            System_printf("Group: %d users after de-initializing instance %d\n",
+                          group->tables.numUsers, i);
+            isOk = 0;
+        }
+    }
+    if (group->tables.isAllocated == true)
+    {
+        System_printf("Group: tables not released\n");
+        isOk = 0;
+    }
+
+    gNumSubFrames = numSubFrames;
+
+    System_printf("Instance group test %s\n", isOk ? "PASSED" : "FAILED");
+    return isOk;
+}
+#endif
+
+/**
+ *  @b Description
+ *  @n
+ *      Test task - Main task that performs ObjectDetecion DPC unit test.
+ *
+ *  @retval
+ *      Not Applicable.
+ */
+void ObjectDetection_Test_task(UArg arg0, UArg arg1)
+{
+    ObjectDetection_Test_DataPathObj *dataPathObj = &gDataPathObj;
+    int32_t  errCode; 
+    uint32_t i;
+
+    FILE * fileId;    
+    uint32_t numTests;
+    uint32_t testIndx, gTestIndx;
+    char tempMsg[20]; 
+    char featureName[200];
+    bool allTestsPassed = true;
+    uint32_t testStatus;
+    DPC_ObjectDetection_ExecuteResultExportedInfo exportInfo;
+    uint8_t subFrameIndx;
+    uint8_t frameIdx;
+    uint8_t testResultBuf[RL_MAX_SUBFRAMES];
+    uint8_t numFrames;
+    uint8_t numChirpsPerEvent;
+    uint32_t numTestsTotal;
+    bool isAntGeometryPass;
+
+    ObjectDetection_Test_ReferenceFileInit();
+
+    /* Keep the built-in Test #1 for the pipelined processing test, the
+       configuration array is overwritten when it is read from file */
+    gPipelineTestFrameConfig = gFrameConfig[0];
+
+    /* Initialize EDMA, DPM/DPC */
+    ObjectDetection_Test_initComponents(dataPathObj);
+
+    if(gReadTestConfigFromBinFile)
+    {
+#if defined(SOC_XWR18XX)
+        fileId = fopen("testdata\\xwr18xx_data_path_test_config.bin", "rb");
+#elif defined(SOC_XWR16XX)
+        fileId = fopen("testdata\\xwr16xx_data_path_test_config.bin", "rb");
+#elif defined(SOC_XWR68XX)
+        fileId = fopen("testdata\\xwr68xx_data_path_test_config.bin", "rb");
+#else
+#error "Error: Unsupported platform"
+#endif
+        if (fileId == NULL)
+        {
+            System_printf("Error: Cannot open xwr68xx_data_path_test_config.bin!\n");
+            exit(0);
+        }
+        /* read in number of tests to be run */
+        fread(&numTests, sizeof(uint32_t),1,fileId);
+    }
+    else
+    {
+        numTests = 4;
+    }
+    System_printf("%d Tests to be run\n\r", numTests);
+    if (numTests % gNumSubFrames)
+    {
+        System_printf("numTests = %d must be a multiple of gNumSubFrames = %d\n", numTests, gNumSubFrames);
+        BIOS_exit(0);
+    }
+
+
+    /* The antenna geometry pass reruns the sub-frames of the last test */
+    numTestsTotal = numTests;
+    if (gAntGeometryTestEnabled)
+    {
+        numTestsTotal += gNumSubFrames;
+    }
+
+    /* config common */
+    ObjectDetection_Test_setCommonProfile(dataPathObj);
+    
+    /* process each test */
+    subFrameIndx = 0;
+    testIndx = 0;
+    while (testIndx < numTestsTotal)
+    {
+        sensorConfig_t *sensorConfig;
+        sceneConfig_t *sceneConfig;
+        uint32_t sceneObjIndx;
+
+        gCurrTestId = testIndx + 1;
+        numFrames = MAX_NUM_TEST_FRAME;
+        isAntGeometryPass = (testIndx >= numTests);
+
+        for (subFrameIndx = 0; subFrameIndx < gNumSubFrames; subFrameIndx++)
+        {
+            sensorConfig = &gFrameConfig[subFrameIndx].sensorConfig;
+            sceneConfig = &gFrameConfig[subFrameIndx].sceneConfig;
+
+            if (gReadTestConfigFromBinFile && !isAntGeometryPass)
+            {
+                /* read in test config */
+                fread(&sensorConfig->numRxAntennas, sizeof(uint32_t),1,fileId);
+                fread(&sensorConfig->numAdcSamples, sizeof(uint32_t),1,fileId);
+                fread(&sensorConfig->numTxAntAzim, sizeof(uint32_t),1,fileId);
+                fread(&sensorConfig->numTxAntElev, sizeof(uint32_t),1,fileId);
+                fread(&sensorConfig->numAngleBins, sizeof(uint32_t),1,fileId);
+                fread(&sensorConfig->numChirpsPerFrame, sizeof(uint32_t),1,fileId);
+
+                fread(&sceneConfig->numTargets, sizeof(uint32_t),1,fileId);
+                fread(&sceneConfig->snrdB, sizeof(int32_t),1,fileId);
+
+                for (sceneObjIndx = 0; sceneObjIndx < sceneConfig->numTargets; sceneObjIndx++)
+                {
+                    fread(&sceneConfig->sceneObj[sceneObjIndx].amplitude, sizeof(uint32_t),1,fileId);
+                    fread(&sceneConfig->sceneObj[sceneObjIndx].azimPhyBin, sizeof(uint32_t),1,fileId);
+                    fread(&sceneConfig->sceneObj[sceneObjIndx].rngPhyBin, sizeof(uint32_t),1,fileId);
+                    fread(&sceneConfig->sceneObj[sceneObjIndx].doppPhyBin, sizeof(int32_t),1,fileId);
+                    fread(&sceneConfig->sceneObj[sceneObjIndx].elevationDeg, sizeof(int32_t),1,fileId);
+                }
+            }
+            /* check validity of arguments */
+            if((sensorConfig->numChirpsPerFrame %
+                (sensorConfig->numTxAntAzim + sensorConfig->numTxAntElev)) != 0)
+            {
+                System_printf("\n#### BAD argument. numChirpsPerFrame needs to be (power of 2)*(numTxAntAzim + numTxAntElev)\n\n");
+            }
+
+            /* config datapathObj from sensorConfig */
+            ObjectDetection_Test_setProfile(dataPathObj,
+                            &dataPathObj->testSubFrmObj[subFrameIndx],
+                            &gFrameConfig[subFrameIndx].sensorConfig,
+                            sceneConfig);
+            if (isAntGeometryPass)
+            {
+                ObjectDetection_Test_setAntGeometry(&dataPathObj->testSubFrmObj[subFrameIndx]);
+            }
+
+            testResultBuf[subFrameIndx] = 1; //1-pass, 0-fail
+            if (sceneConfig->numTargets > 4)
+            {
+                numFrames = 1;
+            }
+
+            ObjectDetection_Test_adjustCfarCfg(&dataPathObj->testSubFrmObj[subFrameIndx]);
+        }
+
+        /* config DPC from dataPathObj */
+        ObjectDetection_Test_configDPC(dataPathObj);
+
+        /* start DPC */
+        ObjectDetection_Test_startDPC(dataPathObj);
+        System_printf("running %d frame for the test\n", numFrames);
+        for (frameIdx = 0; frameIdx < numFrames; frameIdx++)
+        {
+            gTestIndx = testIndx;
+            for (subFrameIndx = 0; subFrameIndx < gNumSubFrames; subFrameIndx++)
+            {
+                /* Simulate the trigger of frame start event for DPC */
+                ObjectDetection_Test_trigFrameStart(dataPathObj);
+
+                sensorConfig = &gFrameConfig[subFrameIndx].sensorConfig;
+                sceneConfig = &gFrameConfig[subFrameIndx].sceneConfig;
+
+                numChirpsPerEvent = dataPathObj->testSubFrmObj[subFrameIndx].staticCfg.ADCBufData.dataProperty.numChirpsPerChirpEvent;
 
                 if (frameIdx == numFrames - 1)
                 {
@@ -1882,7 +3277,11 @@ void ObjectDetection_Test_task(UArg arg0, UArg arg1)
                     System_printf("\n");
 
                     /* prepare the feature to be printed in test report */
-                    if (sceneConfig->numTargets == 2)
+                    if (dataPathObj->testSubFrmObj[subFrameIndx].params.isAntGeometryEnabled)
+                    {
+                        sprintf(tempMsg, "%s", " g");
+                    }
+                    else if (sceneConfig->numTargets == 2)
                     {
                         sprintf(tempMsg, "%s", " m");
                     }
@@ -1975,6 +3374,73 @@ void ObjectDetection_Test_task(UArg arg0, UArg arg1)
 
     }/* end of test while loop */
 
+#ifdef USE_BUILT_IN_GENERATOR
+    if (gPipelineTestEnabled)
+    {
+        if (ObjectDetection_Test_pipeline(dataPathObj) == 1)
+        {
+            MCPI_setFeatureTestResult("Pipelined frame processing", MCPI_TestResult_PASS);
+        }
+        else
+        {
+            allTestsPassed = false;
+            MCPI_setFeatureTestResult("Pipelined frame processing", MCPI_TestResult_FAIL);
+        }
+    }
+
+    if (gGovernorTestEnabled)
+    {
+        if (ObjectDetection_Test_overloadGovernor(dataPathObj) == 1)
+        {
+            MCPI_setFeatureTestResult("Overload governor", MCPI_TestResult_PASS);
+        }
+        else
+        {
+            allTestsPassed = false;
+            MCPI_setFeatureTestResult("Overload governor", MCPI_TestResult_FAIL);
+        }
+    }
+
+    if (gDpuStatsTestEnabled)
+    {
+        if (ObjectDetection_Test_dpuStats(dataPathObj) == 1)
+        {
+            MCPI_setFeatureTestResult("DPU statistics", MCPI_TestResult_PASS);
+        }
+        else
+        {
+            allTestsPassed = false;
+            MCPI_setFeatureTestResult("DPU statistics", MCPI_TestResult_FAIL);
+        }
+    }
+
+    if (gOutputRingTestEnabled)
+    {
+        if (ObjectDetection_Test_outputRing(dataPathObj) == 1)
+        {
+            MCPI_setFeatureTestResult("Output ring", MCPI_TestResult_PASS);
+        }
+        else
+        {
+            allTestsPassed = false;
+            MCPI_setFeatureTestResult("Output ring", MCPI_TestResult_FAIL);
+        }
+    }
+
+    if (gInstanceGroupTestEnabled)
+    {
+        if (ObjectDetection_Test_instanceGroup(dataPathObj) == 1)
+        {
+            MCPI_setFeatureTestResult("Instance group", MCPI_TestResult_PASS);
+        }
+        else
+        {
+            allTestsPassed = false;
+            MCPI_setFeatureTestResult("Instance group", MCPI_TestResult_FAIL);
+        }
+    }
+#endif
+
     System_printf("DPC ObjDet Maximum Memory usage: L3: %d Bytes (Test #%d), L2: %d Bytes (Test #%d), L1: %d Bytes (Test #%d)\n",
                   gMaxL3RamUsage,
                   gMaxL3RamUsageTestId,
@@ -1982,6 +3448,9 @@ void ObjectDetection_Test_task(UArg arg0, UArg arg1)
                   gMaxL2UsageTestId,
                   gMaxL1Usage,
                   gMaxL1UsageTestId);
+    System_printf("DPC ObjDet Scratch overlay saved over all tests: L2: %d Bytes, L1: %d Bytes\n",
+                  gTotalL2ScratchSaved,
+                  gTotalL1ScratchSaved);
     System_printf("All %d Tests finished!\n\r", testIndx);
     if (allTestsPassed)
     {
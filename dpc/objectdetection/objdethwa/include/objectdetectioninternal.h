@@ -499,6 +499,10 @@ typedef struct ObjDetObj_t
     /*! @brief   Stats structure to convey to Application timing and related information. */
     DPC_ObjectDetection_Stats stats;
 
+    /*! @brief   End of the inter-frame processing of the last reported frame, zero
+     *           before the first result after start */
+    uint32_t      prevInterFrameEndTimeStamp;
+
     /*! @brief   Process call back function configuration */
     DPC_ObjectDetection_ProcessCallBackCfg processCallBackCfg;
 } ObjDetObj;
@@ -213,6 +213,21 @@ typedef struct DPC_ObjectDetection_extMaxVelCfg_t
    DPU_AoAProc_ExtendedMaxVelocityCfg cfg;
 } DPC_ObjectDetection_extMaxVelCfg;
 
+/*
+ * @brief Azimuth peak interpolation configuration
+ *
+ */
+typedef struct DPC_ObjectDetection_angleInterpCfg_t
+{
+    /*! @brief   Subframe number for which this message is applicable. When
+     *           advanced frame is not used, this should be set to
+     *           0 (the 1st and only sub-frame) */
+   uint8_t subFrameNum;
+
+   /*! @brief    Azimuth peak interpolation configuration */
+   DPU_AoAProc_AngleInterpCfg cfg;
+} DPC_ObjectDetection_angleInterpCfg;
+
 /*
  * @brief Range Bias and rx channel gain/phase compensation configuration.
  *
@@ -390,6 +405,14 @@ typedef struct DPC_ObjectDetection_StaticCfg_t
 
    /*! @brief   1 if valid profile has one Tx per chirp else 0 */
   uint8_t      isValidProfileHasOneTxPerChirp;
+
+   /*! @brief  Clutter map of the static clutter removal, tracking the clutter across frames.
+               When enabled, the map is allocated in L3 after the detection matrix. The map
+               is re-initialized whenever the static clutter DPU is configured, which
+               includes every sub-frame switch, so it can only be enabled when advanced
+               frame has a single sub-frame, the pre-start configuration fails with
+               @ref DPC_OBJECTDETECTION_EINVAL__COMMAND otherwise. */
+   DPU_StaticClutterProc_ClutterMapCfg staticClutterMapCfg;
 } DPC_ObjectDetection_StaticCfg;
 
 /*
@@ -424,6 +447,9 @@ typedef struct DPC_ObjectDetection_DynCfg_t
     /*! @brief      Extended maximum velocity configuration */
     DPU_AoAProc_ExtendedMaxVelocityCfg extMaxVelCfg;
 
+    /*! @brief      Azimuth peak interpolation configuration */
+    DPU_AoAProc_AngleInterpCfg angleInterpCfg;
+
     /*! @brief   Static Clutter Removal Cfg */
     DPC_ObjectDetection_StaticClutterRemovalCfg_Base staticClutterRemovalCfg;
 } DPC_ObjectDetection_DynCfg;
@@ -525,6 +551,15 @@ typedef struct DPC_ObjectDetection_Stats_t
      *         in the processing of DPC_OBJDET_IOCTL__DYNAMIC_EXECUTE_RESULT_EXPORTED,
      *         which is after the DPC process. */
     uint32_t      subFramePreparationCycles;
+
+    /*! @brief   CPU cycles from the frame start of the reported frame to the end of its
+     *           inter-frame processing. */
+    uint32_t      frameLatency;
+
+    /*! @brief   CPU cycles between the end of the inter-frame processing of the reported
+     *           frame and of the one before it, the inverse of the result throughput.
+     *           Zero for the first result after start. */
+    uint32_t      resultPeriod;
 } DPC_ObjectDetection_Stats;
 
 /*
@@ -717,6 +752,11 @@ typedef struct DPC_ObjectDetection_ExecuteResultExportedInfo_t
  *        Must be issued between start and stop of DPC.
  */
 #define DPC_OBJDET_IOCTL__TRIGGER_FRAME                                   (DPM_CMD_DPC_START_INDEX + 15U)
+
+/**
+ * @brief Command associated with @ref DPC_ObjectDetection_angleInterpCfg_t
+ */
+#define DPC_OBJDET_IOCTL__DYNAMIC_ANGLE_INTERP_CFG                        (DPM_CMD_DPC_START_INDEX + 16U)
 /**
 @}
 */
@@ -832,6 +872,11 @@ typedef struct DPC_ObjectDetection_ExecuteResultExportedInfo_t
  */
 #define DPC_OBJECTDETECTION_ENOMEM__CORE_LOCAL_RAM_AOA_SCRATCH_BUFFER    (DP_ERRNO_OBJECTDETECTION_BASE-25)
 
+/**
+ * @brief   Error Code: Out of L3 RAM during static clutter map allocation.
+ */
+#define DPC_OBJECTDETECTION_ENOMEM__L3_RAM_STATIC_CLUTTER_MAP    (DP_ERRNO_OBJECTDETECTION_BASE-26)
+
 /**
  * @brief   Error Code: Pre-start config was received before pre-start common config.
  */
@@ -673,6 +673,27 @@ static uint32_t DPC_ObjDet_GetDopplerWinGenLen(DPU_DopplerProcHWA_Config *cfg)
     return(winGenLen);
 }
 
+/**
+ *  @b Description
+ *  @n
+ *      Tells if static clutter removal is to be done by the doppler DPU in its input
+ *      stage. This is the case unless the clutter map is enabled, which needs the
+ *      static clutter DPU.
+ *
+ *  @param[in]  staticCfg Pointer to static configuration
+ *  @param[in]  dynCfg    Pointer to dynamic configuration
+ *
+ *  @retval   true if doppler DPU removes static clutter, false otherwise
+ *
+ * \ingroup DPC_OBJDET__INTERNAL_FUNCTION
+ */
+static bool DPC_ObjDet_isDopplerClutterRemovalEnabled(DPC_ObjectDetection_StaticCfg *staticCfg,
+                                                      DPC_ObjectDetection_DynCfg    *dynCfg)
+{
+    return ((dynCfg->staticClutterRemovalCfg.enabled == 1) &&
+            (staticCfg->staticClutterMapCfg.enabled == 0));
+}
+
 /**
  *  @b Description
  *  @n
@@ -827,7 +848,8 @@ int32_t DPC_ObjectDetection_execute
 
     DebugP_log0("ObjDet DPC: Range Proc Done\n");
 
-    if (subFrmObj->dynCfg.staticClutterRemovalCfg.enabled == 1)
+    if ((subFrmObj->dynCfg.staticClutterRemovalCfg.enabled == 1) &&
+        (subFrmObj->staticCfg.staticClutterMapCfg.enabled == 1))
     {
         retVal = DPU_StaticClutterProc_process(subFrmObj->dpuStaticClutterObj,
                                                &outStaticClutter);
@@ -838,6 +860,9 @@ int32_t DPC_ObjectDetection_execute
         }
     }
 
+    subFrmObj->dpuCfg.dopplerCfg.dynCfg.staticClutterCfg.isEnabled =
+        DPC_ObjDet_isDopplerClutterRemovalEnabled(&subFrmObj->staticCfg, &subFrmObj->dynCfg);
+
     DPC_ObjDet_GenDopplerWindow(&subFrmObj->dpuCfg.dopplerCfg);
     retVal = DPU_DopplerProcHWA_config(subFrmObj->dpuDopplerObj, &subFrmObj->dpuCfg.dopplerCfg);
     if (retVal != 0)
@@ -924,6 +949,21 @@ int32_t DPC_ObjectDetection_execute
     objDetObj->stats.interChirpProcessingMargin = 0;
 
     objDetObj->stats.interFrameEndTimeStamp = Cycleprofiler_getTimeStamp();
+
+    /* Latency and throughput of the results */
+    objDetObj->stats.frameLatency = objDetObj->stats.interFrameEndTimeStamp -
+                                    objDetObj->stats.frameStartTimeStamp;
+    if (objDetObj->prevInterFrameEndTimeStamp != 0U)
+    {
+        objDetObj->stats.resultPeriod = objDetObj->stats.interFrameEndTimeStamp -
+                                        objDetObj->prevInterFrameEndTimeStamp;
+    }
+    else
+    {
+        objDetObj->stats.resultPeriod = 0U;
+    }
+    objDetObj->prevInterFrameEndTimeStamp = objDetObj->stats.interFrameEndTimeStamp;
+
     result->stats = &objDetObj->stats;
 
     /* populate DPM_resultBuf - first pointer and size are for results of the
@@ -1036,6 +1076,7 @@ static int32_t DPC_ObjectDetection_start (DPM_DPCHandle handle)
     DebugP_assert (objDetObj != NULL);
 
     objDetObj->stats.frameStartIntCounter = 0;
+    objDetObj->prevInterFrameEndTimeStamp = 0;
 
     /* Start marks consumption of all pre-start configs, reset the flag to check
      * if pre-starts were issued only after common config was issued for the next
@@ -1460,6 +1501,23 @@ static int32_t DPC_ObjDet_dopplerConfig(DPU_DopplerProcHWA_Handle dpuHandle,
     edmaCfg->edmaHotSig.pong.channelShadow =  DPC_OBJDET_DPU_DOPPLERPROC_EDMA_PONG_SIG_SHADOW;
     edmaCfg->edmaHotSig.pong.eventQueue =     DPC_OBJDET_DPU_DOPPLERPROC_EDMA_PONG_SIG_EVENT_QUE;
 
+    /* Static clutter removal is done in the doppler input stage unless the clutter map
+     * is enabled, in which case the static clutter DPU is used. The static clutter DPU
+     * output channels are therefore free to be reused for the radar cube write back,
+     * which is needed because AoA and range bias measurement read the radar cube. */
+    dopCfg.dynCfg.staticClutterCfg.isEnabled = DPC_ObjDet_isDopplerClutterRemovalEnabled(staticCfg, dynCfg);
+    dopStaticCfg->isCubeWriteBackEnabled = true;
+
+    /* edmaCubeOut - ping */
+    edmaCfg->edmaCubeOut.ping.channel =       DPC_OBJDET_DPU_STATIC_CLUTTER_PROC_EDMAOUT_PING_CH;
+    edmaCfg->edmaCubeOut.ping.channelShadow = DPC_OBJDET_DPU_STATIC_CLUTTER_PROC_EDMAOUT_PING_SHADOW;
+    edmaCfg->edmaCubeOut.ping.eventQueue =    DPC_OBJDET_DPU_STATIC_CLUTTER_PROC_EDMAOUT_PING_EVENT_QUE;
+
+    /* edmaCubeOut - pong */
+    edmaCfg->edmaCubeOut.pong.channel =       DPC_OBJDET_DPU_STATIC_CLUTTER_PROC_EDMAOUT_PONG_CH;
+    edmaCfg->edmaCubeOut.pong.channelShadow = DPC_OBJDET_DPU_STATIC_CLUTTER_PROC_EDMAOUT_PONG_SHADOW;
+    edmaCfg->edmaCubeOut.pong.eventQueue =    DPC_OBJDET_DPU_STATIC_CLUTTER_PROC_EDMAOUT_PONG_EVENT_QUE;
+
     /* hwaCfg */
     hwaCfg->numParamSets = 2 * staticCfg->numTxAntennas + 2;
     hwaCfg->paramSetStartIdx = DPC_OBJDET_DPU_DOPPLERPROC_PARAMSET_START_IDX;
@@ -1528,6 +1586,8 @@ exit:
  *  @param[in]  edmaHandle Handle to edma driver to be used for the DPU
  *  @param[in]  radarCube Pointer to DPIF radar cube, which will be the input and output of
  *              static clutter processing
+ *  @param[in]  L3ramObj Pointer to L3 RAM memory pool object, used for the clutter map
+ *              which persists across frames
  *  @param[in]  CoreLocalRamObj Pointer to core local RAM object to allocate local memory
  *              for the DPU, only for scratch purposes
  *  @param[out] CoreLocalRamScratchUsage Core Local RAM's scratch usage in bytes
@@ -1548,6 +1608,7 @@ static int32_t DPC_ObjDet_staticClutterConfig(DPU_StaticClutterProc_Handle dpuHa
                    DPC_ObjectDetection_DynCfg    *dynCfg,
                    EDMA_Handle                   edmaHandle,
                    DPIF_RadarCube                *radarCube,
+                   MemPoolObj                    *L3ramObj,
                    MemPoolObj                    *CoreLocalRamObj,
                    uint32_t                      *CoreLocalRamScratchUsage,
                    DPU_StaticClutterProc_Config  *cfgSave)
@@ -1584,6 +1645,20 @@ static int32_t DPC_ObjDet_staticClutterConfig(DPU_StaticClutterProc_Handle dpuHa
     clutCfg.staticCfg.numRxAntennas = staticCfg->ADCBufData.dataProperty.numRxAntennas;
     clutCfg.staticCfg.numTxAntennas = staticCfg->numTxAntennas;
     clutCfg.staticCfg.numVirtualAntennas = staticCfg->numVirtualAntennas;
+    clutCfg.staticCfg.clutterMapCfg = staticCfg->staticClutterMapCfg;
+
+    if (staticCfg->staticClutterMapCfg.enabled)
+    {
+        hwRes->clutterMapSize = staticCfg->numTxAntennas * staticCfg->ADCBufData.dataProperty.numRxAntennas *
+                                staticCfg->numRangeBins * sizeof(cmplx32ImRe_t);
+        hwRes->clutterMap = DPC_ObjDet_MemPoolAlloc(L3ramObj, hwRes->clutterMapSize,
+                                DPU_STATICCLUTTERPROC_CLUTTERMAP_BYTE_ALIGNMENT);
+        if (hwRes->clutterMap == NULL)
+        {
+            retVal = DPC_OBJECTDETECTION_ENOMEM__L3_RAM_STATIC_CLUTTER_MAP;
+            goto exit;
+        }
+    }
 
     /* hwRes */
     hwRes->edmaHandle = edmaHandle;
@@ -1865,6 +1940,7 @@ static int32_t DPC_ObjDet_AoAconfig(DPU_AoAProcHWA_Handle dpuHandle,
     aoaCfg.dynCfg.multiObjBeamFormingCfg     = &dynCfg->multiObjBeamFormingCfg;
     aoaCfg.dynCfg.prepareRangeAzimuthHeatMap = dynCfg->prepareRangeAzimuthHeatMap;
     aoaCfg.dynCfg.extMaxVelCfg               = &dynCfg->extMaxVelCfg;
+    aoaCfg.dynCfg.angleInterpCfg             = dynCfg->angleInterpCfg;
 
     /* res */
     res->radarCube = *radarCube;
@@ -2080,6 +2156,16 @@ static int32_t DPC_ObjDet_preStartConfig(SubFrameObj *obj,
     uint32_t cfarRngDopSnrListSize;
     void *CoreLocalScratchStartPoolAddr;
 
+    /* Sub-frames share the L3 memory of the clutter map and reconfigure the
+       static clutter DPU on every switch, so the map can only be carried over
+       between frames without sub-frames */
+    if ((staticCfg->staticClutterMapCfg.enabled == 1) &&
+        (commonCfg->numSubFrames > 1U))
+    {
+        retVal = DPC_OBJECTDETECTION_EINVAL__COMMAND;
+        goto exit;
+    }
+
     /* save configs to object. We need to pass this stored config (instead of
        the input arguments to this function which will be in stack) to
        the DPU config functions inside of this function because the DPUs
@@ -2154,7 +2240,7 @@ static int32_t DPC_ObjDet_preStartConfig(SubFrameObj *obj,
     retVal = DPC_ObjDet_staticClutterConfig(obj->dpuStaticClutterObj,
                  &obj->staticCfg, &obj->dynCfg,
                  edmaHandle[DPC_OBJDET_DPU_STATIC_CLUTTER_PROC_EDMA_INST_ID],
-                 &radarCube, CoreLocalRamObj,
+                 &radarCube, L3ramObj, CoreLocalRamObj,
                  &staticClutterCoreLocalsratchUsage,
                  &obj->dpuCfg.staticClutterCfg);
     if (retVal != 0)
@@ -2569,6 +2655,28 @@ static int32_t DPC_ObjectDetection_ioctl
 
                 break;
             }
+            case DPC_OBJDET_IOCTL__DYNAMIC_ANGLE_INTERP_CFG:
+            {
+                DPC_ObjectDetection_angleInterpCfg *cfg;
+
+                DebugP_assert(argLen == sizeof(DPC_ObjectDetection_angleInterpCfg));
+
+                cfg = (DPC_ObjectDetection_angleInterpCfg*)arg;
+
+                retVal = DPU_AoAProcHWA_control(subFrmObj->dpuAoAObj,
+                             DPU_AoAProcHWA_Cmd_AngleInterpCfg,
+                             &cfg->cfg,
+                             sizeof(DPU_AoAProc_AngleInterpCfg));
+                if (retVal != 0)
+                {
+                    goto exit;
+                }
+
+                /* save into object */
+                subFrmObj->dynCfg.angleInterpCfg = cfg->cfg;
+
+                break;
+            }
             case DPC_OBJDET_IOCTL__DYNAMIC_FOV_AOA:
             {
                 DPC_ObjectDetection_fovAoaCfg *cfg;
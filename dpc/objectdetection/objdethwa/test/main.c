@@ -543,6 +543,7 @@ void ObjectDetection_Test_setProfile
     /* Hard coded these two values */
     params->isInterleavedSampInAdcBuf = 0;
     params->isBpmEnabled = 0;
+    params->isAntGeometryEnabled = 0;
 
     params->numRxAntennas = sensorConfig->numRxAntennas;
 
@@ -575,6 +576,7 @@ void ObjectDetection_Test_setProfile
     }
 
     subFrameObj->staticCfg.isValidProfileHasOneTxPerChirp = 0;
+    subFrameObj->staticCfg.staticClutterMapCfg.enabled = 0;
 
     /* Fill static config */
     subFrameObj->staticCfg.ADCBufData.dataProperty.adcBits = 2; //16 bits
@@ -636,6 +638,7 @@ void ObjectDetection_Test_setProfile
     subFrameObj->dynCfg.fovRange.max = (subFrameObj->staticCfg.numRangeBins - 1) * subFrameObj->staticCfg.rangeStep;
     subFrameObj->dynCfg.multiObjBeamFormingCfg.enabled = params->multiObjBeamFormingCfgEnabled;
     subFrameObj->dynCfg.multiObjBeamFormingCfg.multiPeakThrsScal = 0.5;
+    subFrameObj->dynCfg.multiObjBeamFormingCfg.maxNumPeaks = 0;
     subFrameObj->dynCfg.extMaxVelCfg.enabled = 1;
 
     if(params->numVirtualAntAzim > 1)
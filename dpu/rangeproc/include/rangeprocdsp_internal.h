@@ -97,6 +97,10 @@ typedef struct rangeProcDSPObj_t
     /*! @brief     EDMA Handle */
     EDMA_Handle             edmaHandle;
 
+    /*! @brief     EDMA configuration, kept to reprogram the data out channels when
+     *             the radar cube is switched */
+    DPU_RangeProcDSP_EDMAConfig edmaCfg;
+
     /*! @brief     Calibrate DC (zero) range signature Configuration */
     DPU_RangeProc_CalibDcRangeSigCfg   calibDcRangeSigCfg;
 
@@ -109,6 +113,9 @@ typedef struct rangeProcDSPObj_t
     /*! @brief     Pointer to Radar Cube buffer - this is the only format supported */
     cmplx16ImRe_t           *radarCubebuf;
 
+    /*! @brief     Radar Cube buffer size in bytes */
+    uint32_t                radarCubeSize;
+
     /*! @brief      Window coefficients for 1D FFT */
     int16_t                 *window;
 
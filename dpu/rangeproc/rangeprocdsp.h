@@ -447,7 +447,11 @@ typedef struct DPU_RangeProcDSP_OutParams_t
 typedef enum DPU_RangeProcDSP_Cmd_e
 {
     /*! @brief     Command to update configuration */
-    DPU_RangeProcDSP_Cmd_dcRangeCfg
+    DPU_RangeProcDSP_Cmd_dcRangeCfg,
+
+    /*! @brief     Command to switch the output radar cube at a frame boundary. The argument is
+     *             a @ref DPIF_RadarCube of the same size and format as the configured one */
+    DPU_RangeProcDSP_Cmd_radarCubeCfg
 }DPU_RangeProcDSP_Cmd;
 
 /**
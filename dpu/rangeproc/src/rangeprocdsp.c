@@ -92,7 +92,7 @@ static int32_t rangeProcDSP_ConfigDataInEDMA
 static int32_t rangeProcDSP_ConfigDataOutEDMA
 (
     rangeProcDSPObj          *rangeProcObj,
-    DPU_RangeProcDSP_HW_Resources  *hwRes
+    DPU_RangeProcDSP_EDMAConfig    *edmaCfg
 );
 
 static int32_t rangeProcDSP_dcRangeSignatureCompensation_init
@@ -219,7 +219,7 @@ exit:
  *      Helper function to configuration data out EDMA
  *
  *  @param[in]  rangeProcObj             Pointer to rangeProc object
- *  @param[in]  hwRes                    Pointer to hard resource configuration
+ *  @param[in]  edmaCfg                  Pointer to EDMA configuration
  *
  *  \ingroup    DPU_RANGEPROC_INTERNAL_FUNCTION
  *
@@ -231,7 +231,7 @@ exit:
 static int32_t rangeProcDSP_ConfigDataOutEDMA
 (
     rangeProcDSPObj          *rangeProcObj,
-    DPU_RangeProcDSP_HW_Resources  *hwRes
+    DPU_RangeProcDSP_EDMAConfig    *edmaCfg
 )
 {
     int32_t     retVal;
@@ -240,9 +240,7 @@ static int32_t rangeProcDSP_ConfigDataOutEDMA
     uint8_t     *oneD_destinationPongAddress;
     DPEDMA_syncABCfg         syncABCfg;
     rangeProc_dpParams      *dpParams;
-    DPU_RangeProcDSP_EDMAConfig *edmaCfg;
 
-    edmaCfg = &hwRes->edmaCfg;
     dpParams = &rangeProcObj->DPParams;
 
     /*****************************************************
@@ -557,10 +555,12 @@ static int32_t rangeProcDSP_ParseConfig
 
     /* Save EDMA Handle */
     rangeProcObj->edmaHandle = pHwRes->edmaCfg.edmaHandle;
+    rangeProcObj->edmaCfg = pHwRes->edmaCfg;
 
     /* Save interface buffers */
     rangeProcObj->ADCdataBuf        = (cmplx16ImRe_t *)pStaticCfg->ADCBufData.data;
     rangeProcObj->radarCubebuf      = (cmplx16ImRe_t *)pHwRes->radarCube.data;
+    rangeProcObj->radarCubeSize     = pHwRes->radarCube.dataSize;
 
     /* Save Scratch buffers */
     rangeProcObj->fftOut1D          = pHwRes->fftOut1D;
@@ -759,7 +759,7 @@ int32_t DPU_RangeProcDSP_config
     {
         goto exit;
     }
-    retVal = rangeProcDSP_ConfigDataOutEDMA(rangeProcObj, &pConfig->hwRes);
+    retVal = rangeProcDSP_ConfigDataOutEDMA(rangeProcObj, &rangeProcObj->edmaCfg);
     if(retVal < 0)
     {
         goto exit;
@@ -1104,6 +1104,46 @@ int32_t DPU_RangeProcDSP_control
         }
         break;
 
+        case DPU_RangeProcDSP_Cmd_radarCubeCfg:
+        {
+            DPIF_RadarCube      *radarCube;
+
+            if((argSize != sizeof(DPIF_RadarCube)) ||
+               (arg == NULL))
+            {
+                retVal = DPU_RANGEPROCDSP_EINVAL;
+                goto exit;
+            }
+
+            radarCube = (DPIF_RadarCube *)arg;
+
+            /* The new radar cube must be a drop-in replacement of the configured one */
+            if((radarCube->data == NULL) ||
+               (radarCube->dataSize != rangeProcObj->radarCubeSize) ||
+               (radarCube->datafmt != DPIF_RADARCUBE_FORMAT_1))
+            {
+                retVal = DPU_RANGEPROCDSP_EINVAL;
+                goto exit;
+            }
+
+            /* Switching in the middle of a frame would split it across two cubes */
+            if(rangeProcObj->chirpCount != 0U)
+            {
+                retVal = DPU_RANGEPROCDSP_EINPROGRESS;
+                goto exit;
+            }
+
+            rangeProcObj->radarCubebuf = (cmplx16ImRe_t *)radarCube->data;
+
+            /* Ping/pong destination addresses are programmed in the EDMA param sets */
+            retVal = rangeProcDSP_ConfigDataOutEDMA(rangeProcObj, &rangeProcObj->edmaCfg);
+            if(retVal < 0)
+            {
+                goto exit;
+            }
+        }
+        break;
+
         default:
             retVal = DPU_RANGEPROCDSP_ECMD;
             break;